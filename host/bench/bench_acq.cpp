@@ -0,0 +1,232 @@
+// FILE: host/bench/bench_acq.cpp
+// IRQ 수집 block ring (src/core/acq_buf.h): interrupt 타이밍 모의 + SPSC 정합성
+//
+//   bench_acq [--sec 20] [--samples 2000000]
+//
+// 결과 (JSON lines)
+//   acq_sim     : 가상 시간. producer = timer tick (period ± jitter), consumer = block당 처리 시간 + 주기적 stall
+//                 (flash erase / 네트워크 지연 모델). dropped/overruns = ring overrun 집계, wait_max_us = publish -> 처리 시작
+//                 inline_lost = 같은 stall을 기존 직선 루프(측정 -> 처리)에서 겪을 때 조용히 사라지는 period 수
+//   acq_threads : producer/consumer 실제 thread (IRQ/main loop 대역, 1024 block마다 consumer 200 us 지연), memory ordering 확인
+//                 (dropped는 core 수/scheduler 의존 -> 정합성(mismatch)만 판정)
+// 두 경우 모두 seq/값 검사: 중복/순서 오류, seq gap 합 != dropped, produced != consumed + dropped -> exit 1
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+#include "bench_util.h"
+
+extern "C" {
+#include "acq_buf.h"
+}
+
+namespace {
+
+uint32_t d1_of(uint32_t seq) { return (seq * 2654435761u) & 0xFFFFFFu; }
+uint32_t d2_of(uint32_t seq) { return (seq ^ 0x5A5A5Au) & 0xFFFFFFu; }
+
+// consumer 측 검사
+struct Check {
+    uint32_t expect   = 0;
+    uint64_t samples  = 0;
+    uint64_t gaps     = 0;
+    uint64_t errors   = 0;
+
+    void block(const acq_block_t *b) {
+        if (b->n == 0 || b->seq0 < expect) {
+            errors++;
+            return;
+        }
+        gaps += b->seq0 - expect;
+        for (uint32_t i = 0; i < b->n; i++) {
+            const acq_sample_t &s = b->s[i];
+            if (s.seq != b->seq0 + i || s.d1 != d1_of(s.seq) || s.d2 != d2_of(s.seq)) errors++;
+        }
+        samples += b->n;
+        expect = b->seq0 + b->n;
+    }
+
+    // 끝에서: 마지막 block 뒤에 버린 샘플 포함
+    uint64_t mismatch(const acq_buf_t &b) const {
+        uint64_t m = errors;
+        if (samples + b.stats.dropped != b.stats.produced) m++;
+        if (gaps + (b.seq - expect) != b.stats.dropped) m++;
+        return m;
+    }
+};
+
+struct Sim {
+    const char *name;
+    uint32_t period_us;
+    uint32_t jitter_us;
+    uint32_t block_len;
+    uint32_t proc_us;           // block당 처리
+    uint32_t stall_us;          // 0: 없음
+    uint32_t stall_every_us;
+};
+
+uint64_t run_sim(const Sim &cfg, double sec) {
+    static acq_buf_t b;
+    acq_buf_init(&b, cfg.block_len, 50000u);
+
+    Check ck;
+    uint64_t rng = 0x2545F4914F6CDD1Dull;
+    auto next = [&rng]() {
+        rng ^= rng << 13;
+        rng ^= rng >> 7;
+        rng ^= rng << 17;
+        return rng;
+    };
+
+    const uint64_t ticks = (uint64_t)(sec * 1e6 / cfg.period_us);
+    uint64_t free_at = 0, next_stall = cfg.stall_every_us, stall_total = 0;
+    bool holding = false;
+    uint32_t wait_max = 0;
+
+    for (uint64_t k = 1; k <= ticks; k++) {
+        const uint64_t t = k * cfg.period_us + (cfg.jitter_us ? next() % cfg.jitter_us : 0u);
+
+        // tick 전까지 consumer 진행
+        while (free_at <= t) {
+            if (holding) {
+                acq_buf_release(&b);
+                holding = false;
+            }
+            if (cfg.stall_us && free_at >= next_stall) {
+                free_at += cfg.stall_us;
+                stall_total += cfg.stall_us;
+                next_stall += cfg.stall_every_us;
+                continue;
+            }
+            const acq_block_t *blk = acq_buf_peek(&b);
+            if (!blk) {
+                free_at = t + 1u; // idle: 이번 tick 이후 다시 확인
+                break;
+            }
+            const uint32_t w = (uint32_t)free_at - blk->ready_us;
+            if ((int32_t)w > 0 && w > wait_max) wait_max = w;
+            ck.block(blk);
+            holding = true;
+            free_at += cfg.proc_us;
+        }
+
+        // timer IRQ
+        const uint32_t seq = b.seq;
+        (void)acq_buf_put(&b, (uint32_t)t, d1_of(seq), d2_of(seq));
+        acq_buf_tick(&b, (uint32_t)t);
+    }
+
+    // 남은 것 처리
+    if (holding) acq_buf_release(&b);
+    acq_buf_tick(&b, (uint32_t)(ticks * cfg.period_us + 1000000u));
+    while (const acq_block_t *blk = acq_buf_peek(&b)) {
+        ck.block(blk);
+        acq_buf_release(&b);
+    }
+
+    const uint64_t mismatch = ck.mismatch(b);
+    const acq_buf_stats_t &st = b.stats;
+    bench::Json("acq_sim")
+        .str("case", cfg.name)
+        .num("period_us", cfg.period_us)
+        .num("blocks", ACQ_BUF_BLOCKS)
+        .num("block", cfg.block_len)
+        .num("headroom_ms", (double)ACQ_BUF_BLOCKS * cfg.block_len * cfg.period_us / 1e3)
+        .num("proc_us", cfg.proc_us)
+        .num("stall_ms", cfg.stall_us / 1e3)
+        .num("produced", st.produced)
+        .num("dropped", st.dropped)
+        .num("overruns", st.overruns)
+        .num("partial", st.partial)
+        .num("depth_max", st.depth_max)
+        .num("wait_max_us", wait_max)
+        .num("inline_lost", (double)(stall_total / cfg.period_us))
+        .num("mismatch", (double)mismatch)
+        .print();
+    return mismatch;
+}
+
+uint64_t run_threads(uint64_t n, uint32_t block_len, uint32_t pace_ns) {
+    static acq_buf_t b;
+    acq_buf_init(&b, block_len, 0);
+
+    std::atomic<bool> done{false};
+    Check ck;
+    uint64_t blocks = 0;
+
+    const double t0 = bench::now_s();
+    std::thread cons([&]() {
+        uint64_t spin = 0;
+        while (true) {
+            const acq_block_t *blk = acq_buf_peek(&b);
+            if (!blk) {
+                if (done.load(std::memory_order_acquire) && acq_buf_pending(&b) == 0) break;
+                continue;
+            }
+            ck.block(blk);
+            // 가끔 느린 처리 (overrun 유발)
+            if ((++blocks & 1023u) == 0) {
+                const double until = bench::now_s() + 200e-6;
+                while (bench::now_s() < until) spin++;
+            }
+            acq_buf_release(&b);
+        }
+        bench::keep(spin);
+    });
+
+    // timer IRQ 대역: pace_ns 간격 (consumer가 평소엔 따라가고 느린 block에서만 overrun)
+    for (uint64_t i = 0; i < n; i++) {
+        while (bench::now_s() - t0 < (double)i * pace_ns * 1e-9) {
+        }
+        const uint32_t seq = b.seq;
+        (void)acq_buf_put(&b, (uint32_t)i, d1_of(seq), d2_of(seq));
+    }
+    // 마지막 덜 찬 block: flush 기준 시각을 지나게 해서 publish
+    b.flush_us = 1;
+    acq_buf_tick(&b, (uint32_t)n + 1000u);
+    done.store(true, std::memory_order_release);
+    cons.join();
+    const double sec = bench::now_s() - t0;
+
+    const uint64_t mismatch = ck.mismatch(b);
+    bench::Json("acq_threads")
+        .num("block", block_len)
+        .num("pace_ns", pace_ns)
+        .num("produced", b.stats.produced)
+        .num("consumed", (double)ck.samples)
+        .num("dropped", b.stats.dropped)
+        .num("overruns", b.stats.overruns)
+        .num("mismatch", (double)mismatch)
+        .rate(n, sec)
+        .print();
+    return mismatch;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    double sec = 20;
+    uint64_t samples = 2000000;
+    for (int i = 1; i + 1 < argc; i++) {
+        if (!std::strcmp(argv[i], "--sec"))          sec     = std::atof(argv[++i]);
+        else if (!std::strcmp(argv[i], "--samples")) samples = std::strtoull(argv[++i], nullptr, 10);
+    }
+    if (sec < 1) sec = 1;
+    if (samples < 1000) samples = 1000;
+
+    // 1 kHz tick (CFG_ACQ_PERIOD_US), block 32 -> ring 128 ms
+    const Sim cases[] = {
+        {"steady",     1000, 100, 32,   800,      0,       0},
+        {"stall_50ms", 1000, 100, 32,   800,  50000, 1000000},
+        {"stall_200ms", 1000, 100, 32,  800, 200000, 1000000},
+        {"slow",       1000, 100, 32, 40000,      0,       0},
+        {"pingpong_8", 1000, 100,  8,   200,  20000,  500000},
+    };
+
+    uint64_t bad = 0;
+    for (const Sim &c : cases) bad += run_sim(c, sec);
+    for (uint32_t blk : {8u, 32u}) bad += run_threads(samples, blk, 200);
+    return bad ? 1 : 0;
+}
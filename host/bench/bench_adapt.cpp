@@ -0,0 +1,315 @@
+// FILE: host/bench/bench_adapt.cpp
+// adaptive sampling / deadband 송신: 트래픽 절감 vs 복원 오차 (+ adapt_offer 비용)
+//
+//   bench_adapt [--hours H] [--tlm FILE]
+//
+// synthetic : 기상 drift (±60 Pa, 수 시간 주기) + 30분마다 엘리베이터 (30 m, 1.5 m/s 하강/상승)
+//             + 간헐적 문 닫힘 (+25 Pa, 2 s). OSR별 잡음 = datasheet RMS
+//   정책별로 firmware loop를 흉내 (adapt가 주기/OSR 권고 -> 다음 샘플), 수신측은 마지막 수신 값 유지
+//   - fixed     : 기존 경로 (100 ms, OSR 4096, 매 샘플 송신)
+//   - deadband  : 100 ms / OSR 4096 고정, deadband + heartbeat만
+//   - adaptive  : deadband + heartbeat + slow/fast profile
+//   오차 = 10 ms 격자에서 |진값 - 수신측 값|  (rms / p99 / max), event 검출 지연 = 시작 -> 첫 fast 전환
+// tlm:FILE  : 기록된 telemetry (ms, t_x100, p_pa) replay, 주기는 기록 그대로 deadband 판정만
+// bytes = text payload (tlm_fmt_sample) + IPv4/UDP 28 byte, batch 1 기준
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "bench_util.h"
+#include "tlm_line.h"
+
+extern "C" {
+#include "adapt.h"
+#include "tlm_fmt.h"
+}
+
+namespace {
+
+constexpr uint32_t kIpUdpBytes = 28;
+constexpr uint64_t kEventEveryMs = 30ull * 60u * 1000u;
+
+double osr_noise_pa(uint32_t osr) {
+    switch (osr) {
+    case 256:  return 6.5;
+    case 512:  return 4.2;
+    case 1024: return 2.7;
+    case 2048: return 1.8;
+    default:   return 1.2;
+    }
+}
+
+// 진값 (Pa): event 구간 정보도 같이
+struct Truth {
+    double p;
+    bool   moving;
+};
+
+Truth truth_at(uint64_t ms) {
+    const double t_s = (double)ms / 1000.0;
+    double p = 100800.0 + 60.0 * std::sin(t_s / (3.0 * 3600.0) * 2.0 * M_PI);
+
+    // 엘리베이터: event 주기 시작 +60 s 에 30 m 하강 (20 s), 60 s 정지, 30 m 상승
+    const double e = std::fmod(t_s, (double)kEventEveryMs / 1000.0) - 60.0;
+    const double pa_per_m = 12.0;
+    bool moving = false;
+    double h = 0.0;
+    if (e >= 0.0 && e < 20.0)       { h = -1.5 * e; moving = true; }
+    else if (e >= 20.0 && e < 80.0) { h = -30.0; }
+    else if (e >= 80.0 && e < 100.0) { h = -30.0 + 1.5 * (e - 80.0); moving = true; }
+    p -= h * pa_per_m;
+
+    // 문 닫힘: event 주기 +900 s, 2 s
+    if (e >= 840.0 && e < 842.0) p += 25.0;
+    return Truth{p, moving};
+}
+
+struct Policy {
+    const char *name;
+    bool        use_adapt;
+    adapt_cfg_t cfg;
+};
+
+struct Result {
+    uint64_t samples = 0;
+    uint64_t sent    = 0;
+    uint64_t bytes   = 0;
+    double   err_rms = 0, err_p99 = 0, err_max = 0;
+    double   detect_ms_max = 0;
+    uint32_t to_fast = 0;
+    double   fast_pct = 0;
+};
+
+uint32_t sample_bytes(uint64_t ms, int32_t t_x100, uint32_t p_pa) {
+    char line[64];
+    const tlm_sample_t s = { .ms = ms, .t_x100 = t_x100, .p_pa = p_pa };
+    return (uint32_t)tlm_fmt_sample(line, sizeof(line), &s) + kIpUdpBytes;
+}
+
+Result run_policy(const Policy &pol, uint64_t dur_ms) {
+    std::mt19937 rng(11);
+    std::normal_distribution<double> unit(0.0, 1.0);
+
+    adapt_t a;
+    adapt_init(&a, &pol.cfg);
+
+    Result r;
+    std::vector<float> errs;
+    errs.reserve((size_t)(dur_ms / 10u) + 1u);
+
+    bool   have_rx = false;
+    double rx_p = 0.0;
+    uint64_t next_ms = 0;
+    uint64_t grid_ms = 0;
+    uint64_t event_start = UINT64_MAX;
+    bool     was_moving = false;
+    uint32_t fast_seen = 0;
+
+    while (next_ms < dur_ms) {
+        const uint64_t ms = next_ms;
+
+        // 수신측 오차: 이 샘플 직전까지의 10 ms 격자
+        for (; grid_ms < ms; grid_ms += 10u) {
+            if (!have_rx) continue;
+            errs.push_back((float)std::fabs(truth_at(grid_ms).p - rx_p));
+        }
+
+        const Truth tr = truth_at(ms);
+        if (tr.moving && !was_moving) event_start = ms;
+        was_moving = tr.moving;
+
+        const uint32_t osr = pol.use_adapt ? adapt_osr(&a) : pol.cfg.slow_osr;
+        const uint32_t p   = (uint32_t)std::lround(tr.p + osr_noise_pa(osr) * unit(rng));
+        const int32_t  t   = 2250;
+        r.samples++;
+
+        const bool send = adapt_offer(&a, t, p, ms) != ADAPT_SKIP;
+        if (send) {
+            r.sent++;
+            r.bytes += sample_bytes(ms, t, p);
+            rx_p = p;
+            have_rx = true;
+        }
+        if (a.to_fast != fast_seen) {
+            fast_seen = a.to_fast;
+            if (event_start != UINT64_MAX) {
+                r.detect_ms_max = std::max(r.detect_ms_max, (double)(ms - event_start));
+                event_start = UINT64_MAX;
+            }
+        }
+
+        next_ms += pol.use_adapt ? adapt_period_ms(&a) : pol.cfg.slow_period_ms;
+    }
+
+    double sum2 = 0;
+    for (float e : errs) sum2 += (double)e * e;
+    if (!errs.empty()) {
+        r.err_rms = std::sqrt(sum2 / (double)errs.size());
+        std::sort(errs.begin(), errs.end());
+        r.err_p99 = errs[errs.size() * 99 / 100];
+        r.err_max = errs.back();
+    }
+    r.to_fast = a.to_fast;
+    char line[256];
+    if (adapt_stats_line(&a, dur_ms, line, sizeof(line)) > 0) {
+        const char *f = std::strstr(line, "fast_pct=");
+        if (f) r.fast_pct = std::atof(f + 9);
+    }
+    return r;
+}
+
+void run_synthetic(double hours) {
+    const uint64_t dur_ms = (uint64_t)(hours * 3600.0 * 1000.0);
+
+    adapt_cfg_t fixed;
+    adapt_cfg_default(&fixed);
+    fixed.deadband_pa    = 0;
+    fixed.deadband_cx100 = 0;
+    fixed.heartbeat_ms   = 0;
+    fixed.fast_rate_pa_s = 0;
+    fixed.slow_period_ms = 100;
+    fixed.slow_osr       = 4096;
+    fixed.base_period_ms = 100;
+
+    std::vector<Policy> pols;
+    pols.push_back(Policy{"fixed", false, fixed});
+    for (uint32_t db : {2u, 3u, 5u, 10u}) {
+        adapt_cfg_t c = fixed;
+        c.deadband_pa  = db;
+        c.heartbeat_ms = 10000;
+        pols.push_back(Policy{"deadband", false, c});
+    }
+    for (uint32_t db : {2u, 3u, 5u, 10u}) {
+        adapt_cfg_t c;
+        adapt_cfg_default(&c);
+        c.deadband_pa    = db;
+        c.base_period_ms = 100;
+        pols.push_back(Policy{"adaptive", true, c});
+    }
+
+    Result base{};
+    for (size_t i = 0; i < pols.size(); i++) {
+        const double t0 = bench::now_s();
+        const Result r = run_policy(pols[i], dur_ms);
+        const double sec = bench::now_s() - t0;
+        if (i == 0) base = r;
+
+        bench::Json("adapt_policy")
+            .str("policy", pols[i].name)
+            .num("deadband_pa", pols[i].cfg.deadband_pa)
+            .num("hours", hours)
+            .num("samples", (double)r.samples)
+            .num("sent", (double)r.sent)
+            .num("bytes", (double)r.bytes)
+            .num("saved_pct", base.bytes ? 100.0 * (1.0 - (double)r.bytes / (double)base.bytes) : 0.0)
+            .num("sample_saved_pct", base.samples ? 100.0 * (1.0 - (double)r.samples / (double)base.samples) : 0.0)
+            .num("err_rms_pa", r.err_rms)
+            .num("err_p99_pa", r.err_p99)
+            .num("err_max_pa", r.err_max)
+            .num("to_fast", r.to_fast)
+            .num("fast_pct", r.fast_pct)
+            .num("detect_ms_max", r.detect_ms_max)
+            .num("sim_sec", sec)
+            .print();
+    }
+}
+
+void bench_offer() {
+    const uint32_t N = 20000000;
+    adapt_t a;
+    adapt_init(&a, nullptr);
+    uint64_t sent = 0;
+    uint64_t ms = 0;
+
+    const double t0 = bench::now_s();
+    for (uint32_t i = 0; i < N; i++) {
+        ms += 20u;
+        sent += adapt_offer(&a, 2250, 100000u + ((i * 2654435761u) >> 29), ms) != ADAPT_SKIP ? 1u : 0u;
+    }
+    const double sec = bench::now_s() - t0;
+    bench::keep(sent);
+    bench::Json("adapt_offer").rate(N, sec).num("sent", (double)sent).print();
+}
+
+void run_replay(const char *path) {
+    FILE *f = std::fopen(path, "rb");
+    if (!f) {
+        std::fprintf(stderr, "cannot open %s\n", path);
+        return;
+    }
+    std::string buf;
+    char chunk[65536];
+    size_t got;
+    while ((got = std::fread(chunk, 1, sizeof(chunk), f)) > 0) buf.append(chunk, got);
+    std::fclose(f);
+
+    struct Rec { uint64_t ms; int32_t t; uint32_t p; };
+    std::vector<Rec> recs;
+    tlm::for_each_line(buf.data(), buf.size(), [&](tlm::Kind kind, const tlm::Record &r, const char *, size_t) {
+        if (kind == tlm::Kind::Sample) recs.push_back(Rec{r.ms, r.t_x100, r.p_pa});
+    });
+    if (recs.empty()) {
+        std::fprintf(stderr, "no samples in %s\n", path);
+        return;
+    }
+
+    uint64_t base_bytes = 0;
+    for (const Rec &r : recs) base_bytes += sample_bytes(r.ms, r.t, r.p);
+
+    for (uint32_t db : {2u, 3u, 5u, 10u}) {
+        adapt_cfg_t c;
+        adapt_cfg_default(&c);
+        c.deadband_pa = db;
+        adapt_t a;
+        adapt_init(&a, &c);
+
+        uint64_t sent = 0, bytes = 0;
+        double max_err = 0, sum2 = 0;
+        uint32_t rx_p = recs[0].p;
+        for (const Rec &r : recs) {
+            if (adapt_offer(&a, r.t, r.p, r.ms) != ADAPT_SKIP) {
+                sent++;
+                bytes += sample_bytes(r.ms, r.t, r.p);
+                rx_p = r.p;
+            }
+            const double e = std::fabs((double)r.p - (double)rx_p);
+            max_err = std::max(max_err, e);
+            sum2 += e * e;
+        }
+        bench::Json("adapt_replay")
+            .str("dataset", std::string("tlm:") + path)
+            .num("deadband_pa", db)
+            .num("samples", (double)recs.size())
+            .num("sent", (double)sent)
+            .num("saved_pct", 100.0 * (1.0 - (double)bytes / (double)base_bytes))
+            .num("err_rms_pa", std::sqrt(sum2 / (double)recs.size()))
+            .num("err_max_pa", max_err)
+            .num("to_fast", a.to_fast)
+            .print();
+    }
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    double hours = 6.0;
+    const char *tlm_path = nullptr;
+    for (int i = 1; i < argc; i++) {
+        if (!std::strcmp(argv[i], "--hours") && i + 1 < argc) hours = std::atof(argv[++i]);
+        else if (!std::strcmp(argv[i], "--tlm") && i + 1 < argc) tlm_path = argv[++i];
+        else {
+            std::fprintf(stderr, "usage: %s [--hours H] [--tlm FILE]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    bench_offer();
+    run_synthetic(hours);
+    if (tlm_path) run_replay(tlm_path);
+    return 0;
+}
@@ -0,0 +1,230 @@
+// FILE: host/bench/bench_alt_est.cpp
+// alt_est (고도/수직속도 Kalman): update cycle budget + 추적 정확도 + 기록 trace replay
+//
+//   bench_alt_est [--tlm FILE] [--csv OUT]
+//
+// synthetic : 정지 -> 상승 2 m/s -> 정지 -> 하강 1 m/s -> 정지, 1 Pa 양자화 + 잡음,
+//             10 ms 주기 지터 + 샘플 누락 + glitch. 진값과 비교 (raw 차분 속도와 같이)
+// tlm:FILE  : 기록된 telemetry text capture (ms, p_pa) replay. 진값이 없으므로 정지 구간 가정 지표만
+//             (속도 잡음 std, 고도 범위, 기각/재초기화). --csv: 샘플별 ms,p_pa,raw_m,alt_m,vs_ms
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "bench_util.h"
+#include "tlm_line.h"
+
+extern "C" {
+#include "alt_est.h"
+}
+
+namespace {
+
+struct Obs {
+    uint32_t t_us;
+    uint32_t p_pa;
+    float    h_true;    // synthetic만
+    float    v_true;
+};
+
+float m_to_pa(float h, float p0) {
+    return p0 * std::pow(1.0f - h / 44330.77f, 1.0f / 0.190263f);
+}
+
+// 구간별 속도 (s 단위 시각)
+float true_v(double t) {
+    if (t < 20.0) return 0.0f;
+    if (t < 50.0) return 2.0f;
+    if (t < 70.0) return 0.0f;
+    if (t < 130.0) return -1.0f;
+    return 0.0f;
+}
+
+std::vector<Obs> make_synthetic() {
+    std::mt19937 rng(42);
+    std::normal_distribution<float> noise(0.0f, 1.2f);      // ~0.1 m
+    std::uniform_int_distribution<int> jitter(-2000, 2000);   // us
+    std::uniform_real_distribution<float> u(0.0f, 1.0f);
+
+    std::vector<Obs> out;
+    const float p0 = 101325.0f;
+    double t = 0.0;
+    float h = 0.0f;
+    uint32_t t_us = 1000000u;
+
+    while (t < 160.0) {
+        const double dt = 0.010 + jitter(rng) * 1e-6 + (u(rng) < 0.01f ? 0.040 : 0.0); // 1%: 샘플 누락
+        const float v = true_v(t);
+        h += v * (float)dt;
+        t += dt;
+        t_us += (uint32_t)(dt * 1e6);
+
+        float p = m_to_pa(h, p0) + noise(rng);
+        if (u(rng) < 0.001f) p += 400.0f;                        // I2C glitch (~35 m)
+        out.push_back(Obs{t_us, (uint32_t)std::lround(p), h, v});
+    }
+    return out;
+}
+
+bool load_tlm(const char *path, std::vector<Obs> &out) {
+    FILE *f = std::fopen(path, "rb");
+    if (!f) return false;
+
+    std::string buf;
+    char chunk[65536];
+    size_t got;
+    while ((got = std::fread(chunk, 1, sizeof(chunk), f)) > 0) buf.append(chunk, got);
+    std::fclose(f);
+
+    tlm::for_each_line(buf.data(), buf.size(), [&](tlm::Kind kind, const tlm::Record &r, const char *, size_t) {
+        if (kind == tlm::Kind::Sample) out.push_back(Obs{(uint32_t)(r.ms * 1000u), r.p_pa, 0.0f, 0.0f});
+    });
+    return !out.empty();
+}
+
+struct Running {
+    double sum = 0, sum2 = 0;
+    uint64_t n = 0;
+    void add(double v) { sum += v; sum2 += v * v; n++; }
+    double rms() const { return n ? std::sqrt(sum2 / (double)n) : 0; }
+    double std_dev() const {
+        if (n < 2) return 0;
+        const double m = sum / (double)n;
+        return std::sqrt(std::max(0.0, sum2 / (double)n - m * m));
+    }
+};
+
+void bench_budget() {
+    const uint32_t N = 2000000;
+    std::vector<uint32_t> p(4096);
+    std::mt19937 rng(1);
+    for (auto &v : p) v = 100000u + rng() % 2000u;
+
+    alt_est_cfg_t cfg;
+    alt_est_cfg_default(&cfg);
+    cfg.gate_sigma = 0.0f; // 무작위 입력이 기각 경로로 빠지지 않도록
+    alt_est_t e;
+    alt_est_init(&e, &cfg);
+
+    uint32_t t_us = 0;
+    double t0 = bench::now_s();
+    for (uint32_t i = 0; i < N; i++) {
+        t_us += 10000u;
+        (void)alt_est_update(&e, p[i & 4095u], t_us);
+    }
+    double sec = bench::now_s() - t0;
+    bench::keep(e);
+    bench::Json("alt_est_update").rate(N, sec).num("budget_pct_at_100hz", sec / N * 100.0 * 100.0).print();
+
+    float acc = 0;
+    t0 = bench::now_s();
+    for (uint32_t i = 0; i < N; i++) acc += alt_est_pa_to_m((float)p[i & 4095u], 101325.0f);
+    sec = bench::now_s() - t0;
+    bench::keep(acc);
+    bench::Json("alt_est_pa_to_m").rate(N, sec).print();
+}
+
+void run_synthetic() {
+    const std::vector<Obs> obs = make_synthetic();
+
+    alt_est_t e;
+    alt_est_init(&e, nullptr);
+
+    Running err_h, err_v, err_v_raw, rest_v;
+    float prev_raw = 0;
+    uint32_t prev_us = 0;
+    bool have_prev = false;
+    const float p0 = (float)obs[0].p_pa;
+
+    for (const Obs &o : obs) {
+        (void)alt_est_update(&e, o.p_pa, o.t_us);
+
+        const float raw = alt_est_pa_to_m((float)o.p_pa, p0);
+        const float h_rel = o.h_true - obs[0].h_true; // estimator 기준 = 첫 샘플
+        err_h.add(e.h - h_rel);
+        err_v.add(e.v - o.v_true);
+        if (o.v_true == 0.0f) rest_v.add(e.v);
+
+        if (have_prev) {
+            const float dt = (float)(o.t_us - prev_us) * 1e-6f;
+            if (dt > 0) err_v_raw.add((raw - prev_raw) / dt - o.v_true);
+        }
+        prev_raw = raw;
+        prev_us = o.t_us;
+        have_prev = true;
+    }
+
+    bench::Json("alt_est_track")
+        .str("dataset", "synthetic")
+        .num("samples", (double)obs.size())
+        .num("alt_rms_m", err_h.rms())
+        .num("vs_rms_ms", err_v.rms())
+        .num("vs_rest_std_ms", rest_v.std_dev())
+        .num("raw_diff_vs_rms_ms", err_v_raw.rms())
+        .num("rejects", e.rejects)
+        .num("resets", e.resets)
+        .print();
+}
+
+void run_replay(const char *path, const char *csv_path) {
+    std::vector<Obs> obs;
+    if (!load_tlm(path, obs)) {
+        std::fprintf(stderr, "cannot load tlm trace %s\n", path);
+        return;
+    }
+
+    FILE *csv = csv_path ? std::fopen(csv_path, "w") : nullptr;
+    if (csv) std::fprintf(csv, "ms,p_pa,raw_m,alt_m,vs_ms\n");
+
+    alt_est_t e;
+    alt_est_init(&e, nullptr);
+    Running vs;
+    float h_min = 1e9f, h_max = -1e9f;
+    const float p0 = (float)obs[0].p_pa;
+
+    const double t0 = bench::now_s();
+    for (const Obs &o : obs) {
+        (void)alt_est_update(&e, o.p_pa, o.t_us);
+        vs.add(e.v);
+        h_min = std::min(h_min, e.h);
+        h_max = std::max(h_max, e.h);
+        if (csv) {
+            std::fprintf(csv, "%lu,%lu,%.3f,%.3f,%.3f\n", (unsigned long)(o.t_us / 1000u), (unsigned long)o.p_pa,
+                         alt_est_pa_to_m((float)o.p_pa, p0), e.h, e.v);
+        }
+    }
+    const double sec = bench::now_s() - t0;
+    if (csv) std::fclose(csv);
+
+    bench::Json("alt_est_replay")
+        .str("dataset", std::string("tlm:") + path)
+        .rate(obs.size(), sec)
+        .num("alt_range_m", h_max - h_min)
+        .num("vs_std_ms", vs.std_dev())
+        .num("rejects", e.rejects)
+        .num("resets", e.resets)
+        .print();
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    const char *tlm_path = nullptr;
+    const char *csv_path = nullptr;
+    for (int i = 1; i < argc; i++) {
+        if (!std::strcmp(argv[i], "--tlm") && i + 1 < argc) tlm_path = argv[++i];
+        else if (!std::strcmp(argv[i], "--csv") && i + 1 < argc) csv_path = argv[++i];
+        else {
+            std::fprintf(stderr, "usage: %s [--tlm FILE] [--csv OUT]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    bench_budget();
+    run_synthetic();
+    if (tlm_path) run_replay(tlm_path, csv_path);
+    return 0;
+}
@@ -0,0 +1,172 @@
+// FILE: host/bench/bench_decim.cpp
+// burst acquisition: decim_push 처리량 + 평균/잡음 감소/min-max 검증 + OSR별 D1 rate / I2C 점유 모델
+//
+// model: 400 kHz I2C (2.5 us/bit), transaction = start + byte*9 + stop
+//   command  = addr + cmd                         (2 byte)
+//   adc read = addr + 0x00, repeated addr + 3 byte (write 2 + read 4 byte)
+//   burst cycle = adc read + 다음 command + conversion max + margin  (D2는 temp_every마다 1 cycle)
+// 실제 rate / bus 점유는 target의 stat=burst로 확인 (여기 값은 datasheet max 기준 상한)
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "bench_util.h"
+
+extern "C" {
+#include "decim.h"
+}
+
+namespace {
+
+constexpr double kBitUs     = 2.5;    // 400 kHz
+constexpr double kXferOhUs  = 8.0;    // SDK 호출 + start/stop (측정값이 아닌 가정)
+constexpr uint32_t kMarginUs = 20;
+
+double xfer_us(uint32_t bytes) { return kXferOhUs + (bytes * 9.0 + 2.0) * kBitUs; }
+
+struct OsrRow {
+    uint32_t osr;
+    uint32_t conv_us;   // datasheet max (ms5611.c conv_time_us_max와 같은 값)
+};
+
+const OsrRow kOsr[] = { {256, 600}, {512, 1170}, {1024, 2280}, {2048, 4540}, {4096, 9040} };
+
+void model() {
+    const double cmd_us = xfer_us(2);
+    const double adc_us = xfer_us(2) + xfer_us(4);
+
+    for (const OsrRow &r : kOsr) {
+        for (uint32_t every : {1u, 4u, 16u, 64u}) {
+            const double cycle_us = adc_us + cmd_us + r.conv_us + kMarginUs;
+            const double d1_hz    = 1e6 / cycle_us * (double)every / (double)(every + 1u);
+            const double bus_pct  = (adc_us + cmd_us) / cycle_us * 100.0;
+            // 기존 경로(gy63_read): D2 + D1 매번, conversion은 sleep (CPU 대기)
+            const double single_hz = 1e6 / (2.0 * cycle_us);
+            bench::Json("burst_model")
+                .num("osr", r.osr)
+                .num("temp_every", every)
+                .num("d1_hz", d1_hz)
+                .num("d2_hz", d1_hz / every)
+                .num("bus_pct", bus_pct)
+                .num("idle_pct", 100.0 - bus_pct)
+                .num("single_read_hz", single_hz)
+                .num("avg_n_at_50hz", d1_hz / 50.0)
+                .print();
+        }
+    }
+}
+
+void bench_push() {
+    const uint32_t N = 20000000;
+    decim_t d;
+    decim_init(&d, 20000u);
+    decim_out_t out{};
+    uint64_t outs = 0;
+
+    uint32_t t_us = 0;
+    const double t0 = bench::now_s();
+    for (uint32_t i = 0; i < N; i++) {
+        t_us += 700u;
+        outs += decim_push(&d, 2345 + (int32_t)(i & 7u), 100000u + (i & 15u), t_us, &out) ? 1u : 0u;
+    }
+    const double sec = bench::now_s() - t0;
+    bench::keep(out);
+    bench::Json("decim_push").rate(N, sec).num("outputs", (double)outs).print();
+}
+
+struct Stat {
+    double sum = 0, sum2 = 0;
+    uint64_t n = 0;
+    void add(double v) { sum += v; sum2 += v * v; n++; }
+    double mean() const { return n ? sum / (double)n : 0; }
+    double std_dev() const {
+        if (n < 2) return 0;
+        const double m = mean();
+        return std::sqrt(std::max(0.0, sum2 / (double)n - m * m));
+    }
+};
+
+// 일정 입력 + 잡음 + poll 지터 -> 출력 평균/잡음/개수/min-max 확인
+bool verify() {
+    std::mt19937 rng(7);
+    std::normal_distribution<double> noise(0.0, 6.0);        // OSR 256 ~0.065 mbar RMS ~ 6.5 Pa
+    std::uniform_int_distribution<int> jitter(0, 60);         // service 구간 poll 지연
+
+    const uint32_t period_us = 20000u;
+    const double   p_true    = 100500.0;
+    decim_t d;
+    decim_init(&d, period_us);
+
+    Stat in_p, out_p, out_n;
+    uint64_t span_bad = 0, outs = 0;
+    uint32_t t_us = 0xFFF00000u;                              // wrap 포함
+    const uint32_t t0_us = t_us;
+    std::vector<uint32_t> win;
+
+    for (uint32_t i = 0; i < 200000; i++) {
+        t_us += 766u + (uint32_t)jitter(rng);
+        const uint32_t p = (uint32_t)std::lround(p_true + noise(rng));
+        in_p.add(p);
+        win.push_back(p);
+
+        decim_out_t o;
+        if (decim_push(&d, -1234, p, t_us, &o)) {
+            outs++;
+            out_p.add(o.p_pa);
+            out_n.add(o.n);
+            win.pop_back();                                   // 현재 샘플은 다음 window
+            uint32_t lo = win.front(), hi = win.front();
+            for (uint32_t v : win) { lo = std::min(lo, v); hi = std::max(hi, v); }
+            if (lo != o.p_min || hi != o.p_max || win.size() != o.n || o.t_x100 != -1234) span_bad++;
+            win.assign(1, p);
+        }
+    }
+
+    const double elapsed = (double)(t_us - t0_us);
+    const double expect_outs = elapsed / period_us;
+    const double gain = in_p.std_dev() / std::max(out_p.std_dev(), 1e-9);
+    const double gain_ideal = std::sqrt(out_n.mean());
+    const bool ok = std::fabs(out_p.mean() - p_true) < 0.5 && std::fabs((double)outs - expect_outs) <= 1.0 &&
+                    gain > 0.8 * gain_ideal && span_bad == 0;
+
+    bench::Json("decim_verify")
+        .num("outputs", (double)outs)
+        .num("expected_outputs", expect_outs)
+        .num("avg_n", out_n.mean())
+        .num("mean_err_pa", out_p.mean() - p_true)
+        .num("in_std_pa", in_p.std_dev())
+        .num("out_std_pa", out_p.std_dev())
+        .num("noise_gain", gain)
+        .num("noise_gain_sqrt_n", gain_ideal)
+        .num("span_max_pa", d.span_max)
+        .num("window_mismatch", (double)span_bad)
+        .str("result", ok ? "ok" : "FAIL")
+        .print();
+    return ok;
+}
+
+// 정지 후 재개: 긴 공백 뒤 첫 출력은 이전 window, 격자는 재개 시각 기준
+bool verify_gap() {
+    decim_t d;
+    decim_init(&d, 10000u);
+    decim_out_t o;
+    uint32_t t = 0;
+    for (int i = 0; i < 5; i++) (void)decim_push(&d, 100, 1000u, t += 1000u, &o);
+    const bool first = decim_push(&d, 100, 2000u, t += 500000u, &o) && o.n == 5 && o.p_pa == 1000u;
+    const bool regrid = d.win_start_us == t;
+    const bool ok = first && regrid;
+    bench::Json("decim_gap").str("result", ok ? "ok" : "FAIL").print();
+    return ok;
+}
+
+} // namespace
+
+int main() {
+    model();
+    bench_push();
+    const bool ok  = verify();
+    const bool gap = verify_gap();
+    return (ok && gap) ? 0 : 1;
+}
@@ -0,0 +1,216 @@
+// FILE: host/bench/bench_dlog.cpp
+// deferred log: hot path 비용 (record 적재 vs 즉시 문자열화) + drain/decode 처리량 + drop 집계 검증
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "bench_util.h"
+
+extern "C" {
+#include "dlog.h"
+#include "tlm_fmt.h"
+}
+
+namespace {
+
+uint64_t g_rng = 0x9E3779B97F4A7C15ull;
+
+uint32_t next_u32() {
+    g_rng ^= g_rng << 13;
+    g_rng ^= g_rng >> 7;
+    g_rng ^= g_rng << 17;
+    return (uint32_t)g_rng;
+}
+
+uint32_t g_ms = 0;
+uint32_t fake_clock() { return g_ms; }
+
+struct Sink {
+    uint64_t bytes = 0;
+    uint64_t calls = 0;
+    std::vector<uint8_t> *capture = nullptr;
+};
+
+bool sink_fn(const void *data, size_t len, void *user) {
+    Sink *s = (Sink *)user;
+    s->calls++;
+    s->bytes += len;
+    if (s->capture) s->capture->insert(s->capture->end(), (const uint8_t *)data, (const uint8_t *)data + len);
+    return true;
+}
+
+// 기존 gy63_print_reading 경로 (fwrite 제외): tlm_fmt로 한 줄
+size_t fmt_reading(char *line, int32_t t_x100, uint32_t p_pa) {
+    size_t n = 2;
+    std::memcpy(line, "T=", 2);
+    n += tlm_fmt_x100(line + n, t_x100);
+    std::memcpy(line + n, " C, P=", 6);
+    n += 6;
+    n += tlm_fmt_u32(line + n, p_pa);
+    std::memcpy(line + n, " Pa\n", 4);
+    return n + 4;
+}
+
+} // namespace
+
+int main() {
+    const uint32_t N = 2000000;
+    std::vector<int32_t>  tv(4096);
+    std::vector<uint32_t> pv(4096);
+    for (size_t i = 0; i < tv.size(); i++) {
+        tv[i] = (int32_t)(next_u32() % 12000u) - 4000;
+        pv[i] = 1000u + next_u32() % 120000u;
+    }
+
+    // 1) 일치 검증: DLOG_SAMPLE text == "T=%.2f C, P=%u Pa\n", token round-trip
+    uint64_t mismatch = 0;
+    for (size_t i = 0; i < tv.size(); i++) {
+        const dlog_rec_t r = { .ts_ms = next_u32(), .id = DLOG_SAMPLE, .nargs = 2,
+                               .arg = { (uint32_t)tv[i], pv[i] } };
+        char a[DLOG_LINE_MAX], b[DLOG_LINE_MAX];
+        const int    na = std::snprintf(a, sizeof(a), "T=%.2f C, P=%u Pa\n", (double)tv[i] / 100.0, (unsigned)pv[i]);
+        const size_t nb = dlog_format(&r, b, sizeof(b));
+        if ((size_t)na != nb || std::memcmp(a, b, nb) != 0) mismatch++;
+
+        uint8_t tok[DLOG_TOKEN_MAX];
+        dlog_rec_t back;
+        const size_t nt = dlog_token_encode(&r, tok, sizeof(tok));
+        if (dlog_token_parse(tok, nt, &back) != (int32_t)nt || back.ts_ms != r.ts_ms ||
+            back.arg[0] != r.arg[0] || back.arg[1] != r.arg[1]) {
+            mismatch++;
+        }
+    }
+    bench::Json("dlog_verify").num("checked", (double)tv.size()).num("mismatch", (double)mismatch).print();
+
+    // 2) hot path: record 적재 vs 즉시 문자열화 (snprintf float / tlm_fmt)
+    {
+        static dlog_rec_t slots[1024];
+        dlog_t d;
+        dlog_init(&d, slots, 1024, fake_clock);
+
+        double t0 = bench::now_s();
+        for (uint32_t i = 0; i < N; i++) {
+            (void)DLOG2(&d, DLOG_SAMPLE, tv[i & 4095u], pv[i & 4095u]);
+            // ring을 비우는 비용은 측정 밖으로: 가득 차기 직전 tail만 이동
+            if ((i & 1023u) == 1023u) d.tail = d.head;
+        }
+        double sec = bench::now_s() - t0;
+        bench::Json("dlog_put").rate(N, sec).print();
+
+        char line[64];
+        uint64_t sink = 0;
+        t0 = bench::now_s();
+        for (uint32_t i = 0; i < N; i++) {
+            sink += (uint64_t)std::snprintf(line, sizeof(line), "T=%.2f C, P=%u Pa\n",
+                                            (double)tv[i & 4095u] / 100.0, (unsigned)pv[i & 4095u]);
+        }
+        sec = bench::now_s() - t0;
+        bench::keep(sink);
+        bench::Json("reading_snprintf").rate(N, sec).print();
+
+        t0 = bench::now_s();
+        for (uint32_t i = 0; i < N; i++) {
+            sink += fmt_reading(line, tv[i & 4095u], pv[i & 4095u]);
+            bench::keep(line);
+        }
+        sec = bench::now_s() - t0;
+        bench::keep(sink);
+        bench::Json("reading_tlm_fmt").rate(N, sec).print();
+    }
+
+    // 3) drain 처리량 (idle 쪽 비용): text / binary
+    for (int mode = 0; mode < 2; mode++) {
+        static dlog_rec_t slots[1024];
+        dlog_t d;
+        dlog_init(&d, slots, 1024, fake_clock);
+        Sink s;
+
+        uint64_t done = 0;
+        double busy = 0;
+        for (uint32_t i = 0; i < N; i += 1024) {
+            for (uint32_t k = 0; k < 1024; k++) (void)DLOG2(&d, DLOG_SAMPLE, tv[k], pv[k]);
+            const double t0 = bench::now_s();
+            done += dlog_drain(&d, mode ? DLOG_BINARY : DLOG_TEXT, sink_fn, &s, 1024);
+            busy += bench::now_s() - t0;
+        }
+        bench::Json(mode ? "dlog_drain_binary" : "dlog_drain_text")
+            .rate(done, busy, s.bytes)
+            .num("bytes_per_rec", done ? (double)s.bytes / (double)done : 0)
+            .print();
+    }
+
+    // 4) decode 처리량 (host gy63_dlog 경로): token stream -> text
+    {
+        static dlog_rec_t slots[4096];
+        dlog_t d;
+        dlog_init(&d, slots, 4096, fake_clock);
+        std::vector<uint8_t> stream;
+        Sink s;
+        s.capture = &stream;
+        for (uint32_t k = 0; k < 4096; k++) (void)DLOG2(&d, DLOG_SAMPLE, tv[k], pv[k]);
+        (void)dlog_drain(&d, DLOG_BINARY, sink_fn, &s, 4096);
+
+        uint64_t recs = 0, bytes = 0;
+        const double t0 = bench::now_s();
+        for (int rep = 0; rep < 200; rep++) {
+            size_t off = 0;
+            while (off < stream.size()) {
+                dlog_rec_t r;
+                const int32_t n = dlog_token_parse(stream.data() + off, stream.size() - off, &r);
+                if (n <= 0) break;
+                char line[DLOG_LINE_MAX];
+                bytes += dlog_format(&r, line, sizeof(line));
+                off += (size_t)n;
+                recs++;
+            }
+        }
+        const double sec = bench::now_s() - t0;
+        bench::keep(bytes);
+        bench::Json("dlog_decode").rate(recs, sec, (uint64_t)stream.size() * 200u).print();
+    }
+
+    // 5) overrun: loop 10회마다 drain 4개 (sink가 소비를 못 따라감) -> 적재 + drop == 시도, 보고 drop == drop
+    {
+        static dlog_rec_t slots[64];
+        dlog_t d;
+        dlog_init(&d, slots, 64, fake_clock);
+        std::vector<uint8_t> out;
+        Sink s;
+        s.capture = &out;
+
+        const uint32_t attempts = 100000;
+        for (uint32_t i = 0; i < attempts; i++) {
+            g_ms = i;
+            (void)DLOG2(&d, DLOG_SAMPLE, tv[i & 4095u], pv[i & 4095u]);
+            if (i % 10u == 9u) (void)dlog_drain(&d, DLOG_BINARY, sink_fn, &s, 4);
+        }
+        while (dlog_drain(&d, DLOG_BINARY, sink_fn, &s, 64) > 0) {}
+
+        uint64_t reported = 0, samples = 0;
+        size_t off = 0;
+        while (off < out.size()) {
+            dlog_rec_t r;
+            const int32_t n = dlog_token_parse(out.data() + off, out.size() - off, &r);
+            if (n <= 0) break;
+            if (r.id == DLOG_DROPPED) reported += r.arg[0];
+            if (r.id == DLOG_SAMPLE) samples++;
+            off += (size_t)n;
+        }
+
+        dlog_stats_t st;
+        dlog_get_stats(&d, &st);
+        const bool ok = (uint64_t)st.written + st.dropped == attempts && reported == st.dropped &&
+                        samples == st.drained;
+        bench::Json("dlog_overrun")
+            .num("attempts", attempts)
+            .num("written", st.written)
+            .num("dropped", st.dropped)
+            .num("reported", (double)reported)
+            .num("depth_max", st.depth_max)
+            .str("accounting", ok ? "ok" : "MISMATCH")
+            .print();
+        if (!ok) mismatch++;
+    }
+
+    return mismatch ? 1 : 0;
+}
@@ -0,0 +1,340 @@
+// FILE: host/bench/bench_lwip.cpp
+// firmware 송신 경로 (net_udp.c -> lwIP udp/ip4/etharp -> netif) host 부하 시험 (host/lwip/lwip_host.h)
+// lwIP 한도는 firmware와 같음 (include/lwipopts.h: MEM_SIZE, PBUF_POOL_SIZE). CMake GY63_LWIP_MEM_SIZE 등으로 변경
+//
+//   bench_lwip [--packets 200000] [--fwd PORT]
+//
+//   --fwd : 송신된 UDP payload를 127.0.0.1:PORT로 전달 (gy63_ingest --port PORT로 수신 확인)
+//
+// 결과 (JSON lines, 행마다 heap_max/heap_size, pbuf 오류 포함)
+//   lwip_send     : 최대 속도 net_udp_send (payload 64/256/512 B), 16 send마다 platform_poll
+//   lwip_fanout   : 목적지 4개 (unicast 3 + multicast). sink에서 목적지별 payload/길이 검사
+//                   -> mismatch, 목적지 누락, IP/UDP 길이 불일치가 하나라도 있으면 exit 1
+//   lwip_arp_stall: 2000 packet마다 ARP cache 비움 + peer 응답 20 ms 지연
+//                   -> ARP 대기 중 송신은 ERR_OK지만 entry당 마지막 1개만 남음 (ARP_QUEUEING 0): arp_lost
+//   lwip_backlog  : netif가 frame 64개까지 잡고 poll당 1개 완료 (느린 bus) -> PBUF_RAM heap 고갈
+//                   first_fail = 첫 실패 packet 번호, recover_ms = 고갈 후 다시 송신 가능까지
+//   lwip_udp_tlm  : udp_tlm pipeline (source 4개, 1 ms 주기) + backlog 모델 -> backpressure/backoff
+//   lwip_bg       : background poll thread (1 ms, threadsafe_background 모델)와 lock 경합
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include <arpa/inet.h>
+
+#include "bench_util.h"
+
+extern "C" {
+#include "lwip_host.h"
+#include "net_udp.h"
+#include "platform_core.h"
+#include "udp_tlm.h"
+}
+
+namespace {
+
+constexpr const char *kDst      = "10.63.0.1";
+constexpr uint16_t    kDstPort  = 5005;
+
+struct Result {
+    uint64_t ok         = 0;
+    uint64_t fail       = 0;
+    int64_t  first_fail = -1;
+    double   sec        = 0;
+};
+
+Result send_loop(net_udp_client_t *c, size_t size, uint64_t count, uint32_t poll_every) {
+    std::vector<uint8_t> payload(size);
+    for (size_t i = 0; i < size; i++) payload[i] = (uint8_t)('a' + i % 26);
+
+    Result r;
+    const double t0 = bench::now_s();
+    for (uint64_t i = 0; i < count; i++) {
+        payload[0] = (uint8_t)i;
+        if (net_udp_send(c, payload.data(), payload.size())) {
+            r.ok++;
+        } else {
+            r.fail++;
+            if (r.first_fail < 0) r.first_fail = (int64_t)i;
+        }
+        if (poll_every && i % poll_every == poll_every - 1) lwip_host_poll();
+    }
+    r.sec = bench::now_s() - t0;
+    return r;
+}
+
+bench::Json &add_stats(bench::Json &js) {
+    lwip_host_stats_t st;
+    lwip_host_get_stats(&st);
+    return js.num("tx_frames", (double)st.tx_frames)
+        .num("tx_udp", (double)st.tx_udp)
+        .num("tx_busy", (double)st.tx_busy)
+        .num("hold_max", st.hold_max)
+        .num("arp_req", (double)st.arp_req)
+        .num("heap_size", st.heap_size)
+        .num("heap_max", st.heap_max)
+        .num("heap_err", st.heap_err)
+        .num("pool_size", st.pool_size)
+        .num("pool_max", st.pool_max)
+        .num("pool_err", st.pool_err)
+        .num("pbuf_ref_err", st.pbuf_ref_err)
+        .num("locks", (double)st.locks)
+        .num("lock_contended", (double)st.lock_contended)
+        .num("lock_wait_us", (double)st.lock_wait_ns / 1e3);
+}
+
+// 모델 초기화 + 남은 frame/ARP 처리
+void settle() {
+    lwip_host_set_model(0, 0, 1);
+    for (int i = 0; i < 8; i++) lwip_host_poll();
+    lwip_host_reset_stats();
+}
+
+void run_send(net_udp_client_t *c, uint64_t packets) {
+    for (size_t size : {64u, 256u, (unsigned)UDP_TLM_MTU}) {
+        settle();
+        const Result r = send_loop(c, size, packets, 16);
+        bench::Json js("lwip_send");
+        js.num("size", (double)size).num("fail", (double)r.fail);
+        add_stats(js).rate(r.ok, r.sec, r.ok * size).print();
+    }
+}
+
+// sink tap: 목적지별 수신 수 + payload 검사 (send_loop 패턴: [0] = 번호, 나머지 'a' + i % 26)
+struct FanTap {
+    static constexpr size_t kDsts = 4;
+
+    uint32_t dst[kDsts] = {};
+    uint64_t rx[kDsts]  = {};
+    uint64_t bad[kDsts] = {};
+    uint64_t other      = 0;    // 모르는 목적지/port
+    size_t   size       = 0;
+};
+
+void fan_tap(uint32_t dst_ip, uint16_t dst_port, const uint8_t *payload, size_t len, void *user) {
+    FanTap *t = (FanTap *)user;
+    size_t d = 0;
+    while (d < FanTap::kDsts && t->dst[d] != dst_ip) d++;
+    if (d == FanTap::kDsts || dst_port != kDstPort) {
+        t->other++;
+        return;
+    }
+
+    t->rx[d]++;
+    bool ok = (len == t->size);
+    for (size_t i = 1; ok && i < len; i++) ok = (payload[i] == (uint8_t)('a' + i % 26));
+    if (!ok) t->bad[d]++;
+}
+
+bool run_fanout(net_udp_client_t *c, uint64_t packets) {
+    static const char *const kFan[FanTap::kDsts] = {kDst, "10.63.0.3", "10.63.0.4", "239.255.63.63"};
+    for (size_t d = 1; d < FanTap::kDsts; d++) (void)net_udp_add_dst(c, kFan[d], kDstPort);
+
+    FanTap tap;
+    tap.size = 256;
+    for (size_t d = 0; d < FanTap::kDsts; d++) (void)inet_pton(AF_INET, kFan[d], &tap.dst[d]);
+
+    settle();
+    lwip_host_set_udp_tap(fan_tap, &tap);
+    const Result r = send_loop(c, tap.size, packets / 4, 16);
+    for (int i = 0; i < 8; i++) lwip_host_poll();
+    lwip_host_set_udp_tap(nullptr, nullptr);
+
+    lwip_host_stats_t st;
+    lwip_host_get_stats(&st);
+
+    // 처음 ARP 해석 전 송신은 entry당 1개만 남음 (ARP_QUEUEING 0, 16 send마다 poll)
+    uint64_t mismatch = 0, rx_min = UINT64_MAX;
+    for (size_t d = 0; d < FanTap::kDsts; d++) {
+        mismatch += tap.bad[d];
+        if (tap.rx[d] < rx_min) rx_min = tap.rx[d];
+    }
+    const bool ok = mismatch == 0 && tap.other == 0 && st.udp_bad_len == 0 && rx_min + 16u >= r.ok;
+
+    bench::Json js("lwip_fanout");
+    js.num("dst", FanTap::kDsts)
+        .num("size", (double)tap.size)
+        .num("fail", (double)r.fail)
+        .num("rx_min", (double)rx_min)
+        .num("mismatch", (double)mismatch)
+        .num("other", (double)tap.other)
+        .num("udp_bad_len", (double)st.udp_bad_len)
+        .num("ok", ok ? 1 : 0);
+    add_stats(js).rate(r.ok, r.sec, r.ok * tap.size * FanTap::kDsts).print();
+
+    net_udp_clear_extra_dst(c);
+    if (!ok) {
+        for (size_t d = 0; d < FanTap::kDsts; d++) {
+            std::fprintf(stderr, "fanout %s: rx=%llu bad=%llu\n", kFan[d], (unsigned long long)tap.rx[d],
+                         (unsigned long long)tap.bad[d]);
+        }
+    }
+    return ok;
+}
+
+void run_arp_stall(net_udp_client_t *c, uint64_t packets) {
+    settle();
+    lwip_host_set_model(20, 0, 1);
+
+    Result r;
+    const uint64_t chunk = 2000;
+    const double t0 = bench::now_s();
+    for (uint64_t done = 0; done < packets; done += chunk) {
+        lwip_host_arp_flush();
+        const Result p = send_loop(c, 256, chunk, 16);
+        r.ok += p.ok;
+        r.fail += p.fail;
+    }
+    // 마지막 stall의 ARP 응답까지
+    for (int i = 0; i < 40; i++) {
+        lwip_host_poll();
+        platform_sleep_ms(1);
+    }
+    r.sec = bench::now_s() - t0;
+
+    lwip_host_stats_t st;
+    lwip_host_get_stats(&st);
+    bench::Json js("lwip_arp_stall");
+    js.num("size", 256)
+        .num("arp_delay_ms", 20)
+        .num("fail", (double)r.fail)
+        .num("arp_lost", r.ok > st.tx_udp ? (double)(r.ok - st.tx_udp) : 0);
+    add_stats(js).rate(r.ok, r.sec).print();
+}
+
+void run_backlog(net_udp_client_t *c, uint64_t packets) {
+    settle();
+    lwip_host_set_model(0, 64, 1);
+
+    const Result r = send_loop(c, UDP_TLM_MTU, packets / 4, 4);
+
+    // 고갈 해소: 송신 1개가 다시 성공할 때까지 poll
+    const double t0 = bench::now_s();
+    const uint8_t probe[16] = {0};
+    double recover_ms = -1;
+    for (int i = 0; i < 10000; i++) {
+        lwip_host_poll();
+        if (net_udp_send(c, probe, sizeof(probe))) {
+            recover_ms = (bench::now_s() - t0) * 1e3;
+            break;
+        }
+    }
+
+    bench::Json js("lwip_backlog");
+    js.num("size", UDP_TLM_MTU)
+        .num("tx_hold", 64)
+        .num("fail", (double)r.fail)
+        .num("fail_rate", (r.ok + r.fail) ? (double)r.fail / (double)(r.ok + r.fail) : 0)
+        .num("first_fail", (double)r.first_fail)
+        .num("recover_ms", recover_ms);
+    add_stats(js).rate(r.ok, r.sec, r.ok * UDP_TLM_MTU).print();
+}
+
+struct Src {
+    uint32_t n = 0;
+};
+
+size_t build_line(char *out, size_t out_sz, uint64_t now_ms, void *user) {
+    Src *s = (Src *)user;
+    const int n = std::snprintf(out, out_sz, "stat=bench,ms=%llu,n=%u,pad=%s\n", (unsigned long long)now_ms, s->n++,
+                                "0123456789abcdef0123456789abcdef0123456789abcdef0123456789");
+    return n > 0 && (size_t)n < out_sz ? (size_t)n : 0;
+}
+
+bool tlm_send(const void *data, size_t len, void *user) {
+    return net_udp_send((net_udp_client_t *)user, data, len);
+}
+
+void run_udp_tlm(net_udp_client_t *c, double sec) {
+    settle();
+    lwip_host_set_model(0, 8, 1);
+
+    udp_tlm_t p;
+    udp_tlm_init(&p, tlm_send, c);
+    udp_tlm_set_step_budget(&p, 8);
+    Src src[4];
+    for (int i = 0; i < 4; i++) (void)udp_tlm_add_source(&p, "bench", build_line, &src[i], 1, (uint8_t)i);
+
+    const double t0 = bench::now_s();
+    uint64_t steps = 0;
+    while (bench::now_s() - t0 < sec) {
+        (void)udp_tlm_step(&p, platform_millis());
+        lwip_host_poll();
+        steps++;
+    }
+    const double el = bench::now_s() - t0;
+
+    const udp_tlm_stats_t *ts = udp_tlm_get_stats(&p);
+    uint64_t built = 0, dropped = 0, deferred = 0;
+    for (int i = 0; i < 4; i++) {
+        const udp_tlm_source_stats_t *s = udp_tlm_source_stats(&p, i);
+        built += s->built;
+        dropped += s->dropped;
+        deferred += s->deferred;
+    }
+
+    bench::Json js("lwip_udp_tlm");
+    js.num("sources", 4)
+        .num("steps", (double)steps)
+        .num("datagrams", ts->datagrams)
+        .num("send_fail", ts->send_fail)
+        .num("backoffs", ts->backoffs)
+        .num("lines_built", (double)built)
+        .num("lines_dropped", (double)dropped)
+        .num("lines_deferred", (double)deferred);
+    add_stats(js).rate(ts->datagrams, el, ts->bytes).print();
+}
+
+void run_bg(net_udp_client_t *c, uint64_t packets) {
+    settle();
+    if (!lwip_host_bg(true)) {
+        std::fprintf(stderr, "bg thread failed\n");
+        return;
+    }
+    const Result r = send_loop(c, 256, packets, 0);
+    (void)lwip_host_bg(false);
+
+    bench::Json js("lwip_bg");
+    js.num("size", 256).num("fail", (double)r.fail);
+    add_stats(js).rate(r.ok, r.sec, r.ok * 256u).print();
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    uint64_t packets = 200000;
+    lwip_host_cfg_t cfg;
+    lwip_host_cfg_default(&cfg);
+
+    for (int i = 1; i + 1 < argc; i++) {
+        if (!std::strcmp(argv[i], "--packets"))  packets      = std::strtoull(argv[++i], nullptr, 10);
+        else if (!std::strcmp(argv[i], "--fwd")) cfg.fwd_port = (uint16_t)std::atoi(argv[++i]);
+    }
+    if (packets < 2000) packets = 2000;
+
+    if (!lwip_host_init(&cfg)) {
+        std::fprintf(stderr, "lwip_host_init failed\n");
+        return 1;
+    }
+
+    net_udp_client_t *c = nullptr;
+    if (!net_udp_open(&c, kDst, kDstPort)) {
+        std::fprintf(stderr, "net_udp_open failed\n");
+        return 1;
+    }
+    // 첫 ARP 해석
+    const uint8_t hello[] = "hello\n";
+    (void)net_udp_send(c, hello, sizeof(hello) - 1);
+    for (int i = 0; i < 4; i++) lwip_host_poll();
+
+    run_send(c, packets);
+    const bool fan_ok = run_fanout(c, packets);
+    run_arp_stall(c, packets / 4);
+    run_backlog(c, packets);
+    run_udp_tlm(c, 1.0);
+    run_bg(c, packets);
+
+    net_udp_close(c);
+    return fan_ok ? 0 : 1;
+}
@@ -0,0 +1,202 @@
+// FILE: host/bench/bench_prio.cpp
+// telemetry traffic class (src/core/tlm_prio.h): 경보(urgent) vs bulk 지연, starvation guard
+//
+//   bench_prio [--ticks 200000] [--cap 2]
+//
+// 가상 시간 1 tick = 1 ms. link는 tick당 cap개 datagram만 받음 (넘으면 send 실패 = lwIP heap/link backpressure)
+// latency = submit -> 송신 성공 (tag에 submit 시각, 송신 콜백에서 전수 집계)
+//
+// 결과 (JSON lines)
+//   prio_latency : bulk 부하 load (cap 대비 배수) + 경보 50 tick마다 1개
+//                  mode=fifo: 경보도 bulk로 (기존 단일 경로), mode=prio: 경보 = urgent
+//                  u_lost = 경보 submit 거부 (queue 가득 -> 기존 경로에서는 유실)
+//   prio_storm   : urgent를 cap의 2배로 (경보 폭주) + bulk 0.5배. guard=off면 bulk 정지, on이면 guard로 진행
+//   prio_cost    : submit (즉시 송신 경로) + service 호출 비용
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "bench_util.h"
+
+extern "C" {
+#include "tlm_prio.h"
+}
+
+namespace {
+
+struct Link {
+    uint32_t cap     = 2;
+    uint32_t credit  = 0;
+    uint32_t now_us  = 0;
+    std::vector<uint32_t> lat[TLM_PRIO_CLASSES];
+    std::vector<uint32_t> alarm_lat;
+};
+
+// payload[0] = 1이면 경보
+bool link_send(const void *data, size_t len, tlm_prio_class_t cls, uint32_t tag, void *user) {
+    (void)len;
+    Link *l = (Link *)user;
+    if (l->credit == 0) return false;
+    l->credit--;
+    const uint32_t d = l->now_us - tag;
+    l->lat[cls].push_back(d);
+    if (((const uint8_t *)data)[0] == 1u) l->alarm_lat.push_back(d);
+    return true;
+}
+
+uint32_t pct(std::vector<uint32_t> v, double p) {
+    if (v.empty()) return 0;
+    std::sort(v.begin(), v.end());
+    size_t r = (size_t)((double)v.size() * p / 100.0 + 0.999999);
+    if (r == 0) r = 1;
+    return v[std::min(r, v.size()) - 1];
+}
+
+struct Load {
+    double   bulk_per_tick;
+    double   urgent_per_tick;
+    uint32_t alarm_every;   // 0: 없음
+    bool     alarm_urgent;
+};
+
+struct Run {
+    uint64_t b_sub = 0, b_rej = 0;
+    uint64_t u_sub = 0, u_lost = 0;
+};
+
+Run simulate(tlm_prio_t &p, Link &l, const Load &ld, uint64_t ticks) {
+    static uint8_t bulk[512], alarm[64];
+    bulk[0]  = 0;
+    alarm[0] = 1;
+
+    Run r;
+    double b_acc = 0, u_acc = 0;
+    for (uint64_t t = 0; t < ticks; t++) {
+        l.now_us = (uint32_t)(t * 1000u);
+        l.credit = l.cap;
+
+        // 이전 tick에 남은 것 먼저 (main loop의 gy63_tx_poll)
+        (void)tlm_prio_service(&p, l.now_us, 0);
+
+        for (b_acc += ld.bulk_per_tick; b_acc >= 1.0; b_acc -= 1.0) {
+            r.b_sub++;
+            if (!tlm_prio_submit(&p, TLM_PRIO_BULK, bulk, sizeof(bulk), l.now_us, l.now_us)) r.b_rej++;
+        }
+        for (u_acc += ld.urgent_per_tick; u_acc >= 1.0; u_acc -= 1.0) {
+            r.u_sub++;
+            if (!tlm_prio_submit(&p, TLM_PRIO_URGENT, alarm, sizeof(alarm), l.now_us, l.now_us)) r.u_lost++;
+        }
+        if (ld.alarm_every && t % ld.alarm_every == ld.alarm_every / 2u) {
+            r.u_sub++;
+            const tlm_prio_class_t cls = ld.alarm_urgent ? TLM_PRIO_URGENT : TLM_PRIO_BULK;
+            if (!tlm_prio_submit(&p, cls, alarm, sizeof(alarm), l.now_us, l.now_us)) r.u_lost++;
+        }
+    }
+    return r;
+}
+
+void run_latency(uint64_t ticks, uint32_t cap) {
+    static tlm_prio_t p;
+    for (double load : {0.5, 0.9, 1.5}) {
+        for (bool urgent : {false, true}) {
+            Link l;
+            l.cap = cap;
+            tlm_prio_init(&p, link_send, &l);
+            tlm_prio_set_guard(&p, 4, 250);
+
+            const Load ld{load * cap, 0.0, 50, urgent};
+            const Run r = simulate(p, l, ld, ticks);
+            const tlm_prio_class_stats_t *bs = tlm_prio_stats(&p, TLM_PRIO_BULK);
+
+            // 경보 지연: class와 무관하게 경보 payload만 (fifo에서는 bulk queue 대기 포함)
+            bench::Json("prio_latency")
+                .str("mode", urgent ? "prio" : "fifo")
+                .num("load", load)
+                .num("cap_per_ms", cap)
+                .num("alarms", (double)r.u_sub)
+                .num("u_lost", (double)r.u_lost)
+                .num("u_p50_us", pct(l.alarm_lat, 50))
+                .num("u_p99_us", pct(l.alarm_lat, 99))
+                .num("u_max_us", pct(l.alarm_lat, 100))
+                .num("b_sent", bs->sent)
+                .num("b_rej", (double)r.b_rej)
+                .num("b_p99_us", pct(l.lat[TLM_PRIO_BULK], 99))
+                .num("b_max_us", pct(l.lat[TLM_PRIO_BULK], 100))
+                .print();
+        }
+    }
+}
+
+void run_storm(uint64_t ticks, uint32_t cap) {
+    static tlm_prio_t p;
+    for (bool guard : {false, true}) {
+        Link l;
+        l.cap = cap;
+        tlm_prio_init(&p, link_send, &l);
+        if (guard) tlm_prio_set_guard(&p, 4, 250);
+
+        const Load ld{0.5 * cap, 2.0 * cap, 0, true};
+        const Run r = simulate(p, l, ld, ticks);
+        const tlm_prio_class_stats_t *us = tlm_prio_stats(&p, TLM_PRIO_URGENT);
+        const tlm_prio_class_stats_t *bs = tlm_prio_stats(&p, TLM_PRIO_BULK);
+
+        bench::Json("prio_storm")
+            .str("guard", guard ? "on" : "off")
+            .num("cap_per_ms", cap)
+            .num("u_sent", us->sent)
+            .num("u_drop", us->dropped)
+            .num("u_p99_us", pct(l.lat[TLM_PRIO_URGENT], 99))
+            .num("b_submitted", (double)r.b_sub)
+            .num("b_sent", bs->sent)
+            .num("b_rej", (double)r.b_rej)
+            .num("b_guard", bs->guard)
+            .num("b_p99_us", pct(l.lat[TLM_PRIO_BULK], 99))
+            .num("b_max_us", pct(l.lat[TLM_PRIO_BULK], 100))
+            .print();
+    }
+}
+
+bool sink_send(const void *data, size_t len, tlm_prio_class_t cls, uint32_t tag, void *user) {
+    (void)cls;
+    (void)tag;
+    *(uint64_t *)user += len + ((const uint8_t *)data)[0];
+    return true;
+}
+
+void run_cost(uint64_t n) {
+    static tlm_prio_t p;
+    uint64_t acc = 0;
+    tlm_prio_init(&p, sink_send, &acc);
+
+    uint8_t buf[256] = {0};
+    const double t0 = bench::now_s();
+    for (uint64_t i = 0; i < n; i++) {
+        buf[0] = (uint8_t)i;
+        (void)tlm_prio_submit(&p, (i & 15u) ? TLM_PRIO_BULK : TLM_PRIO_URGENT, buf, sizeof(buf),
+                              0, (uint32_t)i);
+        (void)tlm_prio_service(&p, (uint32_t)i, 4);
+    }
+    const double sec = bench::now_s() - t0;
+    bench::keep(acc);
+    bench::Json("prio_cost").num("size", sizeof(buf)).rate(n, sec).print();
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    uint64_t ticks = 200000;
+    uint32_t cap = 2;
+    for (int i = 1; i + 1 < argc; i++) {
+        if (!std::strcmp(argv[i], "--ticks"))    ticks = std::strtoull(argv[++i], nullptr, 10);
+        else if (!std::strcmp(argv[i], "--cap")) cap   = (uint32_t)std::atoi(argv[++i]);
+    }
+    if (ticks < 1000) ticks = 1000;
+    if (cap == 0) cap = 1;
+
+    run_latency(ticks, cap);
+    run_storm(ticks, cap);
+    run_cost(ticks * 10u);
+    return 0;
+}
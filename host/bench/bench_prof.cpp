@@ -0,0 +1,73 @@
+// FILE: host/bench/bench_prof.cpp
+// prof (per-stage latency profiling) 측정점 overhead + health line 확인
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+#include "bench_util.h"
+
+extern "C" {
+#include "prof.h"
+}
+
+namespace {
+
+uint32_t clock_ns() {
+    using clock = std::chrono::steady_clock;
+    return (uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now().time_since_epoch()).count();
+}
+
+uint32_t g_fake = 0;
+uint32_t clock_fake() {
+    return g_fake;
+}
+
+} // namespace
+
+int main() {
+    const uint64_t iters = 20000000;
+
+    // 1) 측정점 1쌍 (PROF_T0 + PROF_END) 비용: 빈 구간을 반복 측정
+    prof_init(clock_ns, 1000000000u);
+    double t0 = bench::now_s();
+    for (uint64_t i = 0; i < iters; i++) {
+        PROF_T0(t);
+        PROF_END(PROF_LOOP_BUSY, t);
+    }
+    double sec = bench::now_s() - t0;
+
+    prof_stat_t st[PROF_STAGE_COUNT];
+    prof_take(st);
+    bench::Json("prof_point_pair")
+        .rate(iters, sec)
+        .num("clock_min_ns", (double)st[PROF_LOOP_BUSY].min)
+        .num("clock_mean_ns", (double)(st[PROF_LOOP_BUSY].sum / st[PROF_LOOP_BUSY].n))
+        .print();
+
+    // 2) prof_add 단독 (clock 제외)
+    t0 = bench::now_s();
+    for (uint64_t i = 0; i < iters; i++) prof_add(PROF_FORMAT, (uint32_t)(i & 0xFFFFu));
+    sec = bench::now_s() - t0;
+    bench::Json("prof_add").rate(iters, sec).print();
+    prof_take(st);
+
+    // 3) 알려진 분포 -> health line (tick = 1 us)
+    prof_init(clock_fake, 1000000u);
+    for (uint32_t i = 0; i < 1000; i++) {
+        const uint32_t us = (i < 990) ? 9240u : 20000u; // 1%는 긴 꼬리
+        PROF_T0(t);
+        g_fake += us;
+        PROF_END(PROF_CONV_WAIT, t);
+    }
+    prof_take(st);
+
+    char line[256];
+    const size_t n = prof_format_stage(line, sizeof(line), &st[PROF_CONV_WAIT], PROF_CONV_WAIT, 12345);
+    std::fwrite(line, 1, n, stderr);
+
+    const bool ok = n > 0 && std::strstr(line, "n=1000,min_us=9240,") && std::strstr(line, "max_us=20000,") &&
+                    std::strstr(line, "p50_us=16383,") && std::strstr(line, "p99_us=16383,") &&
+                    std::strstr(line, "h=13:990/10");
+    bench::Json("prof_format").num("len", (double)n).str("check", ok ? "ok" : "FAIL").print();
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,231 @@
+// FILE: host/bench/bench_raw.cpp
+// raw passthrough (src/core/tlm_raw.h) vs 현재 telemetry 경로
+//
+//   bench_raw [--samples 1000000] [--batch 16]
+//
+// 결과 (JSON lines)
+//   raw_dev_cost  : 장치 측 샘플당 처리 (host CPU 기준 상대 비교. 실제 cycle은 target 'B' 명령 = gy63_bench_raw)
+//                   text = ms5611_compensate + tlm_fmt_sample, bin = ms5611_compensate + tlm_bin_add, raw = tlm_raw_add
+//                   (bin/raw는 finish의 frame CRC-32 포함, raw_pack = CRC 제외 packing만)
+//   raw_bytes     : batch별 샘플당 byte (payload, UDP/IPv4 header 28 B 포함 wire). raw는 session PROM frame 제외
+//   raw_decode    : host 보상 (RawDecoder) 처리량 + firmware 보상과 비교 (t_x100/p_pa/ms 불일치 -> exit 1)
+//                   PROM을 샘플 frame 뒤에 보내서 보관 -> 재생 경로도 확인
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "bench_util.h"
+#include "raw_tlm.h"
+#include "rtrace_synth.h"
+
+extern "C" {
+#include "ms5611_math.h"
+#include "tlm_bin.h"
+#include "tlm_fmt.h"
+#include "tlm_hdr.h"
+#include "tlm_raw.h"
+}
+
+namespace {
+
+constexpr uint32_t kUdpIp = 28;     // IPv4 20 + UDP 8
+
+struct Smp {
+    uint64_t ms;
+    uint32_t d1, d2;
+};
+
+// 온도 -40..85°C (2차 보상 구간 포함), 기압 30..110 kPa
+std::vector<Smp> make_samples(const uint16_t prom[8], size_t n) {
+    std::vector<Smp> v(n);
+    uint64_t rng = 0x9E3779B97F4A7C15ull;
+    auto next = [&rng]() {
+        rng ^= rng << 13;
+        rng ^= rng >> 7;
+        rng ^= rng << 17;
+        return rng;
+    };
+    for (size_t i = 0; i < n; i++) {
+        const int32_t t = -4000 + (int32_t)(next() % 12501u);
+        const int32_t p = 30000 + (int32_t)(next() % 80001u);
+        v[i].ms = 1000u + (uint64_t)i * 10u;
+        rtrace_synth::invert(prom, t, p, &v[i].d1, &v[i].d2);
+    }
+    return v;
+}
+
+void dev_cost(const std::vector<Smp> &v, const ms5611_coeffs_t &c, uint32_t batch) {
+    char line[TLM_FMT_SAMPLE_MAX];
+    uint64_t acc = 0;
+
+    double t0 = bench::now_s();
+    for (const Smp &s : v) {
+        tlm_sample_t ts{};
+        ts.ms = s.ms;
+        (void)ms5611_compensate(&c, s.d1, s.d2, &ts.t_x100, &ts.p_pa);
+        acc += tlm_fmt_sample(line, sizeof(line), &ts);
+    }
+    double sec = bench::now_s() - t0;
+    bench::keep(acc);
+    bench::Json("raw_dev_cost").str("mode", "text").rate(v.size(), sec).print();
+
+    static tlm_bin_enc_t be;
+    tlm_bin_init(&be);
+    t0 = bench::now_s();
+    for (const Smp &s : v) {
+        tlm_sample_t ts{};
+        ts.ms = s.ms;
+        (void)ms5611_compensate(&c, s.d1, s.d2, &ts.t_x100, &ts.p_pa);
+        (void)tlm_bin_add(&be, &ts);
+        if (be.count >= batch) acc += tlm_bin_finish(&be, nullptr);
+    }
+    acc += tlm_bin_finish(&be, nullptr);
+    sec = bench::now_s() - t0;
+    bench::keep(acc);
+    bench::Json("raw_dev_cost").str("mode", "bin").num("batch", batch).rate(v.size(), sec).print();
+
+    static tlm_raw_enc_t re;
+    tlm_raw_init(&re, 1u);
+    t0 = bench::now_s();
+    for (const Smp &s : v) {
+        (void)tlm_raw_add(&re, s.ms, s.d1, s.d2);
+        if (re.count >= batch) acc += tlm_raw_finish(&re, nullptr);
+    }
+    acc += tlm_raw_finish(&re, nullptr);
+    sec = bench::now_s() - t0;
+    bench::keep(acc);
+    bench::Json("raw_dev_cost").str("mode", "raw").num("batch", batch).rate(v.size(), sec).print();
+
+    // 분해: 24-bit packing만 (finish = header + CRC-32 제외)
+    t0 = bench::now_s();
+    for (const Smp &s : v) {
+        (void)tlm_raw_add(&re, s.ms, s.d1, s.d2);
+        if (re.count >= batch) re.count = 0;
+    }
+    sec = bench::now_s() - t0;
+    bench::keep(re);
+    bench::Json("raw_dev_cost").str("mode", "raw_pack").num("batch", batch).rate(v.size(), sec).print();
+}
+
+void bytes_per_sample(const std::vector<Smp> &v, const ms5611_coeffs_t &c, uint32_t batch) {
+    const size_t n = v.size();
+    tlm_hdr_t h;
+    tlm_hdr_init(&h, 0x5EED0001u, 0xE6614C311B2F5A21ull);
+
+    // text: datagram = header 줄 + 샘플 줄 batch개
+    uint64_t text = 0, dgrams = 0;
+    char buf[TLM_HDR_MAX + TLM_FMT_SAMPLE_MAX];
+    for (size_t i = 0; i < n; i++) {
+        if (i % batch == 0) {
+            text += tlm_hdr_format(&h, buf, sizeof(buf));
+            tlm_hdr_commit(&h);
+            dgrams++;
+        }
+        tlm_sample_t ts{};
+        ts.ms = v[i].ms;
+        (void)ms5611_compensate(&c, v[i].d1, v[i].d2, &ts.t_x100, &ts.p_pa);
+        text += tlm_fmt_sample(buf, sizeof(buf), &ts);
+    }
+
+    const uint64_t full = n / batch, rest = n % batch;
+    const uint64_t bin = full * (TLM_BIN_HDR_SIZE + batch * TLM_BIN_REC_SIZE) +
+                         (rest ? TLM_BIN_HDR_SIZE + rest * TLM_BIN_REC_SIZE : 0);
+    const uint64_t raw = full * (TLM_RAW_HDR_SIZE + batch * TLM_RAW_REC_SIZE) +
+                         (rest ? TLM_RAW_HDR_SIZE + rest * TLM_RAW_REC_SIZE : 0);
+
+    auto row = [&](const char *mode, uint64_t bytes) {
+        bench::Json("raw_bytes")
+            .str("mode", mode)
+            .num("batch", batch)
+            .num("b_per_sample", (double)bytes / (double)n)
+            .num("wire_b_per_sample", (double)(bytes + dgrams * kUdpIp) / (double)n)
+            .print();
+    };
+    row("text", text);
+    row("bin", bin);
+    row("raw", raw);
+}
+
+int decode(const std::vector<Smp> &v, const uint16_t prom[8], const ms5611_coeffs_t &c, uint32_t batch) {
+    // 장치 쪽: 샘플 frame 3개 뒤에 PROM (session 중간 시작한 수신기 = cmd=prom 응답 상황)
+    std::vector<std::vector<uint8_t>> frames;
+    static tlm_raw_enc_t e;
+    tlm_raw_init(&e, 0x5EED0001u);
+    const uint8_t *f = nullptr;
+    for (const Smp &s : v) {
+        (void)tlm_raw_add(&e, s.ms, s.d1, s.d2);
+        if (e.count < batch) continue;
+        const size_t n = tlm_raw_finish(&e, &f);
+        frames.emplace_back(f, f + n);
+        if (frames.size() == 3) {
+            uint8_t p[TLM_RAW_HDR_SIZE + TLM_RAW_PROM_SIZE];
+            const size_t pn = tlm_raw_prom(&e, prom, s.ms, p, sizeof(p));
+            frames.emplace_back(p, p + pn);
+        }
+    }
+    if (const size_t n = tlm_raw_finish(&e, &f)) frames.emplace_back(f, f + n);
+
+    ingest::RawDecoder dec;
+    std::vector<tlm::Record> out;
+    out.reserve(v.size());
+    uint64_t bytes = 0;
+    const double t0 = bench::now_s();
+    for (const auto &fr : frames) {
+        tlm_raw_info_t info;
+        (void)dec.on_frame(fr.data(), fr.size(), info, [&](const tlm::Record &r) { out.push_back(r); });
+        bytes += fr.size();
+    }
+    const double sec = bench::now_s() - t0;
+
+    // firmware 보상 (ms5611_read와 같은 함수)과 비교
+    uint64_t mismatch = 0;
+    if (out.size() != v.size()) mismatch += v.size() > out.size() ? v.size() - out.size() : out.size() - v.size();
+    for (size_t i = 0; i < out.size() && i < v.size(); i++) {
+        int32_t t = 0;
+        uint32_t p = 0;
+        const bool ok = ms5611_compensate(&c, v[i].d1, v[i].d2, &t, &p) == MS5611_OK;
+        if (!ok || out[i].t_x100 != t || out[i].p_pa != p || out[i].ms != v[i].ms) mismatch++;
+    }
+
+    const ingest::RawDecoder::Stats &st = dec.stats();
+    bench::Json("raw_decode")
+        .num("batch", batch)
+        .num("frames", (double)st.frames)
+        .num("proms", (double)st.proms)
+        .num("samples", (double)st.samples)
+        .num("comp_errors", (double)st.comp_errors)
+        .num("no_prom", (double)st.no_prom)
+        .num("mismatch", (double)mismatch)
+        .rate(st.samples, sec, bytes)
+        .print();
+    return mismatch ? 1 : 0;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    size_t n = 1000000;
+    uint32_t batch = 16;
+    for (int i = 1; i + 1 < argc; i++) {
+        if (!std::strcmp(argv[i], "--samples"))    n     = (size_t)std::strtoull(argv[++i], nullptr, 10);
+        else if (!std::strcmp(argv[i], "--batch")) batch = (uint32_t)std::atoi(argv[++i]);
+    }
+    if (n == 0) n = 1;
+    if (batch == 0 || batch > TLM_RAW_MAX_BATCH) batch = 16;
+
+    uint16_t prom[8];
+    rtrace_synth::make_prom(prom);
+    ms5611_coeffs_t c;
+    ms5611_load_coeffs(prom, &c);
+
+    const std::vector<Smp> v = make_samples(prom, n);
+
+    dev_cost(v, c, batch);
+    for (uint32_t b : {1u, 16u, 64u}) bytes_per_sample(v, c, b);
+    bench::Json("raw_bytes")
+        .str("mode", "raw_prom")
+        .num("b_per_session", TLM_RAW_HDR_SIZE + TLM_RAW_PROM_SIZE + kUdpIp)
+        .print();
+    return decode(v, prom, c, batch);
+}
@@ -0,0 +1,282 @@
+// FILE: host/bench/bench_replay.cpp
+// raw trace 결정적 재생: trace(PROM + D1/D2 + 시각) -> 보상 -> (decimation) -> 고도 estimator -> telemetry format
+// firmware와 같은 C 코드 (ms5611_math = ms5611.c가 호출하는 보상, alt_est, decim, tlm_fmt)
+//
+//   bench_replay [FILE] [--hours 6] [--hz 10] [--decim-us 0] [--out FILE] [--expect HEX]
+//
+//   FILE      : gy63_rtrace recv로 받은 trace. 없으면 합성 trace (host/bench/rtrace_synth.h, --hours/--hz)
+//   --decim-us: burst trace용 boxcar window (0: 사용 안 함)
+//   --out     : 재생 결과 text (telemetry 줄 + ",alt_cm=..,vs_cms=..") -> 회귀 시 diff
+//   --expect  : 출력 digest(CRC-32, 16진)와 다르면 exit 1 (같은 toolchain에서 회귀 확인)
+//
+// 결과 (JSON lines)
+//   replay_stage : 단계별 처리량 (decode / compensate / estimate / format, 단계마다 전체 데이터 1회)
+//   replay       : 한 번에 재생 (실제 사용 경로), x_realtime = trace 기간 / 재생 시간, digest
+//                  2회 재생해서 digest 비교 (결정성)
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "bench_util.h"
+#include "rtrace_io.h"
+#include "rtrace_synth.h"
+
+extern "C" {
+#include "alt_est.h"
+#include "crc32.h"
+#include "decim.h"
+#include "ms5611_math.h"
+#include "tlm_buffer.h"
+#include "tlm_fmt.h"
+}
+
+namespace {
+
+struct Smp {
+    uint64_t t_us;
+    uint32_t d1, d2;
+};
+
+struct Opts {
+    uint32_t    decim_us = 0;
+    FILE       *out      = nullptr;
+};
+
+struct Result {
+    uint64_t samples  = 0;  // trace sample
+    uint64_t outputs  = 0;  // format 줄
+    uint64_t comp_err = 0;
+    uint64_t errors   = 0;  // trace ERR record
+    uint64_t osr_chg  = 0;
+    uint64_t bytes    = 0;  // format 출력 byte
+    uint64_t t_end_us = 0;
+    uint32_t digest   = 0;
+};
+
+// 전체 경로 1회: event -> 보상 -> decim -> estimator -> format -> digest
+class Replayer {
+public:
+    explicit Replayer(const Opts &o) : o_(o) {
+        alt_est_cfg_t cfg;
+        alt_est_cfg_default(&cfg);
+        alt_est_init(&alt_, &cfg);
+        decim_init(&dec_, o.decim_us ? o.decim_us : 1u);
+    }
+
+    void on_event(const rtrace_io::Event &e) {
+        switch (e.ev.kind) {
+        case RTRACE_EV_HDR:
+            ms5611_load_coeffs(e.ev.prom, &c_);
+            have_c_ = true;
+            break;
+        case RTRACE_EV_OSR:
+            r_.osr_chg++;
+            break;
+        case RTRACE_EV_ERR:
+            r_.errors++;
+            break;
+        case RTRACE_EV_SAMPLE:
+            on_sample(e.t_us, e.ev.d1, e.ev.d2);
+            break;
+        }
+    }
+
+    Result finish() {
+        r_.digest = ~crc_;
+        return r_;
+    }
+
+private:
+    void on_sample(uint64_t t_us, uint32_t d1, uint32_t d2) {
+        r_.samples++;
+        r_.t_end_us = t_us;
+        if (!have_c_) { r_.comp_err++; return; }
+
+        int32_t t_x100 = 0;
+        uint32_t p_pa = 0;
+        if (ms5611_compensate(&c_, d1, d2, &t_x100, &p_pa) != MS5611_OK) { r_.comp_err++; return; }
+
+        if (o_.decim_us) {
+            decim_out_t d;
+            if (!decim_push(&dec_, t_x100, p_pa, (uint32_t)t_us, &d)) return;
+            // window 마지막 샘플 시각 (u32) -> 현재 64-bit 시각 기준으로 펼침
+            emit(t_us - (uint32_t)((uint32_t)t_us - d.t_us), d.t_x100, d.p_pa);
+            return;
+        }
+        emit(t_us, t_x100, p_pa);
+    }
+
+    void emit(uint64_t t_us, int32_t t_x100, uint32_t p_pa) {
+        (void)alt_est_update(&alt_, p_pa, (uint32_t)t_us);
+
+        const tlm_sample_t s = { t_us / 1000u, t_x100, p_pa };
+        char line[TLM_FMT_SAMPLE_MAX];
+        const size_t n = tlm_fmt_sample(line, sizeof(line), &s);
+        const int32_t est[2] = { alt_est_alt_cm(&alt_), alt_est_vs_cms(&alt_) };
+
+        crc_ = crc32_update(crc_, (const uint8_t *)line, n);
+        crc_ = crc32_update(crc_, (const uint8_t *)est, sizeof(est));
+        r_.outputs++;
+        r_.bytes += n;
+
+        if (o_.out) {
+            // line은 '\n'으로 끝남 -> 떼고 estimator 값 추가
+            std::fprintf(o_.out, "%.*s,alt_cm=%ld,vs_cms=%ld\n", (int)(n ? n - 1 : 0), line, (long)est[0],
+                         (long)est[1]);
+        }
+    }
+
+    Opts            o_;
+    ms5611_coeffs_t c_{};
+    bool            have_c_ = false;
+    alt_est_t       alt_;
+    decim_t         dec_;
+    uint32_t        crc_ = 0xFFFFFFFFu;
+    Result          r_;
+};
+
+Result replay(const std::vector<uint8_t> &trace, const Opts &o, rtrace_io::Scan *scan) {
+    Replayer rp(o);
+    const rtrace_io::Scan sc = rtrace_io::for_each_event(trace.data(), trace.size(),
+                                                         [&](const rtrace_io::Event &e) { rp.on_event(e); });
+    if (scan) *scan = sc;
+    return rp.finish();
+}
+
+// 단계별 처리량 (각 단계를 전체 데이터에 대해 따로)
+void bench_stages(const std::vector<uint8_t> &trace) {
+    // 1) decode
+    std::vector<Smp> smp;
+    uint16_t prom[8] = {};
+    double t0 = bench::now_s();
+    (void)rtrace_io::for_each_event(trace.data(), trace.size(), [&](const rtrace_io::Event &e) {
+        if (e.ev.kind == RTRACE_EV_SAMPLE) smp.push_back(Smp{e.t_us, e.ev.d1, e.ev.d2});
+        else if (e.ev.kind == RTRACE_EV_HDR) std::memcpy(prom, e.ev.prom, sizeof(prom));
+    });
+    double sec = bench::now_s() - t0;
+    bench::Json("replay_stage").str("stage", "decode").rate(smp.size(), sec, trace.size()).print();
+
+    // 2) compensate
+    ms5611_coeffs_t c;
+    ms5611_load_coeffs(prom, &c);
+    std::vector<tlm_sample_t> comp;
+    comp.reserve(smp.size());
+    t0 = bench::now_s();
+    for (const Smp &s : smp) {
+        tlm_sample_t o = { s.t_us / 1000u, 0, 0 };
+        if (ms5611_compensate(&c, s.d1, s.d2, &o.t_x100, &o.p_pa) == MS5611_OK) comp.push_back(o);
+    }
+    sec = bench::now_s() - t0;
+    bench::Json("replay_stage").str("stage", "compensate").rate(smp.size(), sec).print();
+
+    // 3) estimate
+    alt_est_cfg_t cfg;
+    alt_est_cfg_default(&cfg);
+    alt_est_t alt;
+    alt_est_init(&alt, &cfg);
+    int64_t acc = 0;
+    t0 = bench::now_s();
+    for (const tlm_sample_t &s : comp) {
+        (void)alt_est_update(&alt, s.p_pa, (uint32_t)(s.ms * 1000u));
+        acc += alt_est_alt_cm(&alt);
+    }
+    sec = bench::now_s() - t0;
+    bench::keep(acc);
+    bench::Json("replay_stage").str("stage", "estimate").rate(comp.size(), sec).print();
+
+    // 4) format
+    char line[TLM_FMT_SAMPLE_MAX];
+    uint64_t bytes = 0;
+    t0 = bench::now_s();
+    for (const tlm_sample_t &s : comp) bytes += tlm_fmt_sample(line, sizeof(line), &s);
+    sec = bench::now_s() - t0;
+    bench::keep(line);
+    bench::Json("replay_stage").str("stage", "format").rate(comp.size(), sec, bytes).print();
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    const char *path = nullptr;
+    const char *out_path = nullptr;
+    const char *expect = nullptr;
+    double hours = 6.0;
+    uint32_t hz = 10;
+    Opts o;
+
+    for (int i = 1; i < argc; i++) {
+        if (argv[i][0] != '-') { path = argv[i]; continue; }
+        if (i + 1 >= argc) break;
+        if (!std::strcmp(argv[i], "--hours"))         hours      = std::atof(argv[++i]);
+        else if (!std::strcmp(argv[i], "--hz"))       hz         = (uint32_t)std::atoi(argv[++i]);
+        else if (!std::strcmp(argv[i], "--decim-us")) o.decim_us = (uint32_t)std::atoi(argv[++i]);
+        else if (!std::strcmp(argv[i], "--out"))      out_path   = argv[++i];
+        else if (!std::strcmp(argv[i], "--expect"))   expect     = argv[++i];
+        else {
+            std::fprintf(stderr, "usage: %s [FILE] [--hours H] [--hz HZ] [--decim-us US] [--out FILE] [--expect HEX]\n",
+                         argv[0]);
+            return 2;
+        }
+    }
+
+    std::vector<uint8_t> trace;
+    std::string name;
+    if (path) {
+        if (!rtrace_io::load(path, trace)) { std::perror(path); return 2; }
+        name = std::string("file:") + path;
+    } else {
+        rtrace_synth::Params prm;
+        prm.hours = hours;
+        prm.hz    = hz ? hz : 10u;
+        trace = rtrace_synth::make(prm).bytes;
+        char buf[64];
+        std::snprintf(buf, sizeof(buf), "synth:%gh@%uHz", hours, (unsigned)prm.hz);
+        name = buf;
+    }
+
+    bench_stages(trace);
+
+    // 전체 경로 2회: 처리량 + 결정성 (같은 입력 -> 같은 digest)
+    rtrace_io::Scan sc;
+    double t0 = bench::now_s();
+    const Result a = replay(trace, o, &sc);
+    const double sec = bench::now_s() - t0;
+    const Result b = replay(trace, o, nullptr);
+    const bool deterministic = (a.digest == b.digest && a.outputs == b.outputs);
+
+    if (out_path) {
+        o.out = std::fopen(out_path, "w");
+        if (!o.out) { std::perror(out_path); return 2; }
+        (void)replay(trace, o, nullptr);
+        std::fclose(o.out);
+    }
+
+    char digest[16];
+    std::snprintf(digest, sizeof(digest), "%08lx", (unsigned long)a.digest);
+    const double dur_s = (double)a.t_end_us / 1e6;
+
+    bench::Json("replay")
+        .str("trace", name)
+        .rate(a.samples, sec, trace.size())
+        .num("trace_bytes", (double)trace.size())
+        .num("chunks", (double)sc.chunks)
+        .num("lost_chunks", (double)sc.lost)
+        .num("outputs", (double)a.outputs)
+        .num("errors", (double)a.errors)
+        .num("comp_errors", (double)a.comp_err)
+        .num("osr_changes", (double)a.osr_chg)
+        .num("duration_h", dur_s / 3600.0)
+        .num("x_realtime", sec > 0 ? dur_s / sec : 0.0)
+        .num("deterministic", deterministic ? 1 : 0)
+        .str("digest", digest)
+        .print();
+
+    if (!deterministic) return 1;
+    if (expect && std::strtoul(expect, nullptr, 16) != a.digest) {
+        std::fprintf(stderr, "digest mismatch: got %s, expected %s\n", digest, expect);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,380 @@
+// FILE: host/bench/bench_sample_path.cpp
+// 샘플당 firmware hot path: PROM 검증(CRC4), 보상, payload format, header/ARQ encode
+//
+//   bench_sample_path [--n N] [--raw FILE] [--tlm FILE]
+//
+// dataset
+//   datasheet : datasheet 예제 PROM/D1/D2 (결과 검증 포함)
+//   uniform   : 유효 CRC의 무작위 PROM + D1/D2 전 범위 (2차 보상 분기 포함)
+//   walk      : 대기압 부근 random walk (실제 기록과 비슷한 분기 패턴)
+//   raw:FILE  : 기록된 raw 값. 줄마다 "D1,D2", 선택적으로 첫 줄 "prom=w0,w1,...,w7"
+//   tlm:FILE  : 기록된 telemetry text capture (datagram payload를 이어 붙인 것) -> format/encode만
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "bench_util.h"
+#include "tlm_line.h"
+
+extern "C" {
+#include "ms5611_math.h"
+#include "tlm_buffer.h"
+#include "tlm_fmt.h"
+#include "tlm_hdr.h"
+#include "udp_arq.h"
+}
+
+namespace {
+
+// datasheet (AN520 / MS5611-01BA03) 예제
+const uint16_t k_ds_c[6] = {40127, 36924, 23317, 23282, 33464, 28312};
+const uint32_t k_ds_d1   = 9085466;
+const uint32_t k_ds_d2   = 8569150;
+
+struct Raw {
+    uint32_t d1, d2;
+};
+
+struct Dataset {
+    std::string name;
+    uint16_t prom[8];
+    std::vector<Raw> raw;
+    std::vector<tlm_sample_t> samples; // format/encode 입력 (raw가 있으면 보상 결과)
+};
+
+uint64_t g_rng = 0x9E3779B97F4A7C15ull;
+
+uint64_t next_u64() {
+    g_rng ^= g_rng << 13;
+    g_rng ^= g_rng >> 7;
+    g_rng ^= g_rng << 17;
+    return g_rng;
+}
+
+// C1..C6 -> CRC nibble까지 채운 PROM
+void make_prom(uint16_t prom[8], const uint16_t c[6]) {
+    prom[0] = 0x0000;
+    for (int i = 0; i < 6; i++) prom[i + 1] = c[i];
+    prom[7] = 0x0000;
+    prom[7] |= ms5611_crc4(prom);
+}
+
+// 보상 결과로 format 입력 생성 (ERANGE 샘플은 제외)
+void fill_samples(Dataset &ds) {
+    ms5611_coeffs_t c;
+    ms5611_load_coeffs(ds.prom, &c);
+    uint64_t ms = 0;
+    for (const Raw &r : ds.raw) {
+        tlm_sample_t s;
+        if (ms5611_compensate(&c, r.d1, r.d2, &s.t_x100, &s.p_pa) != MS5611_OK) continue;
+        ms += 100;
+        s.ms = ms;
+        ds.samples.push_back(s);
+    }
+}
+
+Dataset make_datasheet(size_t n) {
+    Dataset ds;
+    ds.name = "datasheet";
+    make_prom(ds.prom, k_ds_c);
+    ds.raw.assign(n, Raw{k_ds_d1, k_ds_d2});
+    fill_samples(ds);
+    return ds;
+}
+
+Dataset make_uniform(size_t n) {
+    Dataset ds;
+    ds.name = "uniform";
+    uint16_t c[6];
+    for (int i = 0; i < 6; i++) c[i] = (uint16_t)(k_ds_c[i] + (int)(next_u64() % 2001) - 1000);
+    make_prom(ds.prom, c);
+    ds.raw.reserve(n);
+    for (size_t i = 0; i < n; i++) {
+        // D2: 약 -19..48°C (2차 보상 분기 포함), D1: 저압~고압 전 범위
+        const uint32_t d2 = 8000000u + (uint32_t)(next_u64() % 1400000u);
+        const uint32_t d1 = 4000000u + (uint32_t)(next_u64() % 8000000u);
+        ds.raw.push_back(Raw{d1, d2});
+    }
+    fill_samples(ds);
+    return ds;
+}
+
+Dataset make_walk(size_t n) {
+    Dataset ds;
+    ds.name = "walk";
+    make_prom(ds.prom, k_ds_c);
+    ds.raw.reserve(n);
+    int64_t d1 = k_ds_d1, d2 = k_ds_d2;
+    for (size_t i = 0; i < n; i++) {
+        d1 += (int64_t)(next_u64() % 201) - 100;
+        d2 += (int64_t)(next_u64() % 41) - 20;
+        ds.raw.push_back(Raw{(uint32_t)d1, (uint32_t)d2});
+    }
+    fill_samples(ds);
+    return ds;
+}
+
+bool load_raw(const char *path, Dataset &ds) {
+    FILE *f = std::fopen(path, "r");
+    if (!f) return false;
+
+    ds.name = std::string("raw:") + path;
+    make_prom(ds.prom, k_ds_c);
+
+    char line[256];
+    while (std::fgets(line, sizeof(line), f)) {
+        unsigned w[8];
+        unsigned long d1, d2;
+        if (std::sscanf(line, "prom=%u,%u,%u,%u,%u,%u,%u,%u",
+                        &w[0], &w[1], &w[2], &w[3], &w[4], &w[5], &w[6], &w[7]) == 8) {
+            for (int i = 0; i < 8; i++) ds.prom[i] = (uint16_t)w[i];
+        } else if (std::sscanf(line, "%lu,%lu", &d1, &d2) == 2) {
+            ds.raw.push_back(Raw{(uint32_t)d1, (uint32_t)d2});
+        }
+    }
+    std::fclose(f);
+    fill_samples(ds);
+    return !ds.raw.empty();
+}
+
+bool load_tlm(const char *path, Dataset &ds) {
+    FILE *f = std::fopen(path, "rb");
+    if (!f) return false;
+
+    std::string buf;
+    char chunk[65536];
+    size_t got;
+    while ((got = std::fread(chunk, 1, sizeof(chunk), f)) > 0) buf.append(chunk, got);
+    std::fclose(f);
+
+    ds.name = std::string("tlm:") + path;
+    tlm::for_each_line(buf.data(), buf.size(), [&](tlm::Kind kind, const tlm::Record &r, const char *, size_t) {
+        if (kind == tlm::Kind::Sample) ds.samples.push_back(tlm_sample_t{r.ms, r.t_x100, r.p_pa});
+    });
+    return !ds.samples.empty();
+}
+
+bool arq_sink(const void *pkt, size_t len, void *user) {
+    bench::keep(pkt);
+    *(size_t *)user += len;
+    return true;
+}
+
+// ---- benchmarks ----
+
+void bench_prom(const Dataset &ds, uint64_t iters) {
+    uint16_t prom[8];
+    std::memcpy(prom, ds.prom, sizeof(prom));
+
+    uint32_t acc = 0;
+    double t0 = bench::now_s();
+    for (uint64_t i = 0; i < iters; i++) {
+        prom[0] = (uint16_t)i; // word 0도 CRC 입력 -> 매번 다른 입력
+        acc += ms5611_crc4(prom);
+    }
+    double sec = bench::now_s() - t0;
+    bench::keep(acc);
+    bench::Json("crc4_calc").str("dataset", ds.name).rate(iters, sec).print();
+
+    uint32_t ok = 0;
+    t0 = bench::now_s();
+    for (uint64_t i = 0; i < iters; i++) {
+        ok += (ms5611_prom_validate(ds.prom) == MS5611_OK);
+        bench::keep(ds.prom);
+    }
+    sec = bench::now_s() - t0;
+    bench::Json("prom_validate").str("dataset", ds.name).rate(iters, sec)
+        .str("result", ok == iters ? "ok" : "crc_fail").print();
+}
+
+void bench_compensate(const Dataset &ds, uint64_t passes) {
+    if (ds.raw.empty()) return;
+
+    ms5611_coeffs_t c;
+    ms5611_load_coeffs(ds.prom, &c);
+
+    uint64_t ops = 0, out_of_range = 0, acc = 0;
+    const double t0 = bench::now_s();
+    for (uint64_t k = 0; k < passes; k++) {
+        for (const Raw &r : ds.raw) {
+            int32_t t;
+            uint32_t p;
+            if (ms5611_compensate(&c, r.d1, r.d2, &t, &p) == MS5611_OK) acc += (uint64_t)p + (uint32_t)t;
+            else                                                       out_of_range++;
+            ops++;
+        }
+    }
+    const double sec = bench::now_s() - t0;
+    bench::keep(acc);
+    bench::Json("compensate_and_check").str("dataset", ds.name).rate(ops, sec)
+        .num("erange_frac", (double)out_of_range / (double)ops).print();
+}
+
+void bench_format(const Dataset &ds, uint64_t passes) {
+    if (ds.samples.empty()) return;
+
+    char out[TLM_FMT_SAMPLE_MAX];
+    uint64_t ops = 0, bytes = 0;
+    double t0 = bench::now_s();
+    for (uint64_t k = 0; k < passes; k++) {
+        for (const tlm_sample_t &s : ds.samples) {
+            bytes += tlm_fmt_sample(out, sizeof(out), &s);
+            bench::keep(out);
+            ops++;
+        }
+    }
+    double sec = bench::now_s() - t0;
+    bench::Json("format_sample").str("dataset", ds.name).rate(ops, sec, bytes).print();
+
+    // 기준: snprintf (tlm_fmt 이전 경로)
+    ops = bytes = 0;
+    t0 = bench::now_s();
+    for (uint64_t k = 0; k < passes; k++) {
+        for (const tlm_sample_t &s : ds.samples) {
+            bytes += (uint64_t)std::snprintf(out, sizeof(out), "ms=%llu,t_x100=%ld,p_pa=%u\n",
+                                             (unsigned long long)s.ms, (long)s.t_x100, (unsigned)s.p_pa);
+            bench::keep(out);
+            ops++;
+        }
+    }
+    sec = bench::now_s() - t0;
+    bench::Json("format_sample_snprintf").str("dataset", ds.name).rate(ops, sec, bytes).print();
+}
+
+// datagram 1개 = header 줄 + 샘플 1줄 + ARQ framing (firmware 기본 batch=1 경로)
+void bench_encode(const Dataset &ds, uint64_t passes) {
+    if (ds.samples.empty()) return;
+
+    tlm_hdr_t hdr;
+    tlm_hdr_init(&hdr, 0x1234ABCDu, 0xE66038B7132F4F2Bull);
+
+    size_t sunk = 0;
+    static arq_tx_t arq; // slot 보관분이 커서 static
+    arq_tx_init(&arq, 300, 50, 3, arq_sink, &sunk);
+
+    char pkt[TLM_HDR_MAX + TLM_FMT_SAMPLE_MAX];
+    uint64_t ops = 0, bytes = 0;
+    const double t0 = bench::now_s();
+    for (uint64_t k = 0; k < passes; k++) {
+        for (const tlm_sample_t &s : ds.samples) {
+            size_t n = tlm_hdr_format(&hdr, pkt, sizeof(pkt));
+            n += tlm_fmt_sample(pkt + n, sizeof(pkt) - n, &s);
+            (void)arq_tx_send(&arq, pkt, n, s.ms);
+            tlm_hdr_commit(&hdr);
+            bytes += n + ARQ_HDR_SIZE;
+            ops++;
+        }
+    }
+    const double sec = bench::now_s() - t0;
+    bench::keep(sunk);
+    bench::Json("encode_datagram").str("dataset", ds.name).rate(ops, sec, bytes).print();
+}
+
+// 보상 -> format -> header/ARQ encode (I2C/대기 제외 샘플당 CPU 비용)
+void bench_full(const Dataset &ds, uint64_t passes) {
+    if (ds.raw.empty()) return;
+
+    ms5611_coeffs_t c;
+    tlm_hdr_t hdr;
+    tlm_hdr_init(&hdr, 0x1234ABCDu, 0xE66038B7132F4F2Bull);
+    size_t sunk = 0;
+    static arq_tx_t arq;
+    arq_tx_init(&arq, 300, 50, 3, arq_sink, &sunk);
+
+    char pkt[TLM_HDR_MAX + TLM_FMT_SAMPLE_MAX];
+    uint64_t ops = 0, ms = 0;
+    const double t0 = bench::now_s();
+    for (uint64_t k = 0; k < passes; k++) {
+        for (const Raw &r : ds.raw) {
+            ms5611_load_coeffs(ds.prom, &c);
+            tlm_sample_t s;
+            s.ms = ms += 100;
+            if (ms5611_compensate(&c, r.d1, r.d2, &s.t_x100, &s.p_pa) != MS5611_OK) continue;
+
+            size_t n = tlm_hdr_format(&hdr, pkt, sizeof(pkt));
+            n += tlm_fmt_sample(pkt + n, sizeof(pkt) - n, &s);
+            (void)arq_tx_send(&arq, pkt, n, s.ms);
+            tlm_hdr_commit(&hdr);
+            ops++;
+        }
+    }
+    const double sec = bench::now_s() - t0;
+    bench::keep(sunk);
+    bench::Json("sample_path").str("dataset", ds.name).rate(ops, sec).print();
+}
+
+// datasheet 예제 결과: TEMP 2007 (20.07°C), P 100009 (1000.09 mbar)
+bool check_datasheet() {
+    uint16_t prom[8];
+    make_prom(prom, k_ds_c);
+
+    ms5611_coeffs_t c;
+    ms5611_load_coeffs(prom, &c);
+    int32_t t = 0;
+    uint32_t p = 0;
+    const bool ok = ms5611_prom_validate(prom) == MS5611_OK &&
+                    ms5611_compensate(&c, k_ds_d1, k_ds_d2, &t, &p) == MS5611_OK &&
+                    t == 2007 && p == 100009;
+
+    uint16_t bad[8];
+    std::memcpy(bad, prom, sizeof(bad));
+    bad[7] ^= 0x1;
+    const bool crc_ok = ms5611_prom_validate(bad) == MS5611_ECRC;
+
+    bench::Json("check_datasheet").num("t_x100", t).num("p_pa", p)
+        .str("result", (ok && crc_ok) ? "ok" : "FAIL").print();
+    return ok && crc_ok;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    size_t n = 100000;
+    const char *raw_path = nullptr;
+    const char *tlm_path = nullptr;
+
+    for (int i = 1; i < argc; i++) {
+        if (!std::strcmp(argv[i], "--n") && i + 1 < argc)        n = (size_t)std::strtoull(argv[++i], nullptr, 10);
+        else if (!std::strcmp(argv[i], "--raw") && i + 1 < argc) raw_path = argv[++i];
+        else if (!std::strcmp(argv[i], "--tlm") && i + 1 < argc) tlm_path = argv[++i];
+        else {
+            std::fprintf(stderr, "usage: %s [--n N] [--raw FILE] [--tlm FILE]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    if (!check_datasheet()) return 1;
+
+    std::vector<Dataset> sets;
+    sets.push_back(make_datasheet(n));
+    sets.push_back(make_uniform(n));
+    sets.push_back(make_walk(n));
+
+    if (raw_path) {
+        Dataset ds;
+        if (!load_raw(raw_path, ds)) { std::fprintf(stderr, "cannot load raw dataset %s\n", raw_path); return 2; }
+        sets.push_back(std::move(ds));
+    }
+    if (tlm_path) {
+        Dataset ds;
+        if (!load_tlm(tlm_path, ds)) { std::fprintf(stderr, "cannot load tlm dataset %s\n", tlm_path); return 2; }
+        make_prom(ds.prom, k_ds_c);
+        sets.push_back(std::move(ds));
+    }
+
+    // dataset 크기와 무관하게 항목당 ~1M op
+    for (const Dataset &ds : sets) {
+        const size_t count = ds.raw.empty() ? ds.samples.size() : ds.raw.size();
+        const uint64_t passes = count ? (1000000 + count - 1) / count : 0;
+
+        bench_prom(ds, 1000000);
+        bench_compensate(ds, passes);
+        bench_format(ds, passes);
+        bench_encode(ds, passes);
+        bench_full(ds, passes);
+    }
+    return 0;
+}
@@ -0,0 +1,278 @@
+// FILE: host/bench/bench_sensor.cpp
+// sensor registry: ops table dispatch 비용 (직접 호출 대비) + 공유 bus scheduling 시뮬레이션
+//
+// dispatch : MS5611와 같은 단계(start -> D2 -> D1 -> READY)를 conversion 대기 없이 재생하는 replay driver,
+//            convert는 firmware와 같은 ms5611_compensate. 직접 호출 루프 대비 sample당 추가 ns
+// schedule : 가상 시간 (순회당 50 us). bus 0에 MS5611 (10 Hz, OSR 4096) + 습도 (1 Hz, 15 ms)
+//            + 가속도 (100 Hz, 1 ms), bus 1에 2번째 MS5611. sensor별 달성 rate / start 지연 / deferred
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "bench_util.h"
+
+extern "C" {
+#include "ms5611_math.h"
+#include "sensor_reg.h"
+}
+
+namespace {
+
+const uint16_t k_ds_c[6] = { 40127, 36924, 23317, 23282, 33464, 28312 };
+
+uint64_t g_rng = 0x9E3779B97F4A7C15ull;
+
+uint32_t next_u32() {
+    g_rng ^= g_rng << 13;
+    g_rng ^= g_rng >> 7;
+    g_rng ^= g_rng << 17;
+    return (uint32_t)g_rng;
+}
+
+struct Raw {
+    uint32_t d1, d2;
+};
+
+// ---- replay driver (MS5611 단계 재생, 대기 없음) ----
+
+struct Replay {
+    ms5611_coeffs_t   coeffs;
+    const Raw        *raw;
+    size_t            n, i;
+    uint8_t           phase;
+    uint32_t          d1, d2;
+};
+
+int32_t rp_start(void *dev, uint32_t) {
+    ((Replay *)dev)->phase = 1;
+    return 0;
+}
+
+int32_t rp_poll(void *dev, uint32_t) {
+    Replay *r = (Replay *)dev;
+    if (r->phase == 1) {
+        r->d2 = r->raw[r->i].d2;
+        r->phase = 2;
+        return SENSOR_STEP;
+    }
+    r->d1 = r->raw[r->i].d1;
+    r->i = (r->i + 1 == r->n) ? 0 : r->i + 1;
+    r->phase = 0;
+    return SENSOR_READY;
+}
+
+uint32_t rp_read_raw(void *dev, uint32_t raw[SENSOR_RAW_MAX]) {
+    const Replay *r = (const Replay *)dev;
+    raw[0] = r->d1;
+    raw[1] = r->d2;
+    return 2;
+}
+
+int32_t rp_convert(const void *dev, const uint32_t *raw, uint32_t n, sensor_sample_t *out) {
+    const Replay *r = (const Replay *)dev;
+    if (n < 2) return MS5611_EINVAL;
+    int32_t t = 0;
+    uint32_t p = 0;
+    const ms5611_status_t st = ms5611_compensate(&r->coeffs, raw[0], raw[1], &t, &p);
+    if (st != MS5611_OK) return st;
+    out->n      = 2;
+    out->qty[0] = SENSOR_Q_TEMP_CX100;
+    out->val[0] = t;
+    out->qty[1] = SENSOR_Q_PRESS_PA;
+    out->val[1] = (int32_t)p;
+    return 0;
+}
+
+const sensor_ops_t k_replay_ops = { "replay", nullptr, rp_start, rp_poll, rp_read_raw, rp_convert };
+
+void make_coeffs(ms5611_coeffs_t *c) {
+    uint16_t prom[8] = {};
+    for (int i = 0; i < 6; i++) prom[i + 1] = k_ds_c[i];
+    prom[7] = ms5611_crc4(prom);
+    ms5611_load_coeffs(prom, c);
+}
+
+std::vector<Raw> make_raw(size_t n) {
+    std::vector<Raw> v(n);
+    for (Raw &r : v) {
+        r.d2 = 8000000u + next_u32() % 1400000u;
+        r.d1 = 6000000u + next_u32() % 4000000u;
+    }
+    return v;
+}
+
+bool bench_dispatch(uint32_t n_sensors) {
+    const std::vector<Raw> raw = make_raw(4096);
+    const uint64_t target = 4000000;
+
+    // 1) 직접 호출: 같은 단계, 같은 보상
+    ms5611_coeffs_t c;
+    make_coeffs(&c);
+    std::vector<int32_t> ref_p;
+    ref_p.reserve(raw.size());
+    uint64_t acc = 0;
+    double t0 = bench::now_s();
+    for (uint64_t k = 0; k < target; k++) {
+        const Raw &r = raw[k & 4095u];
+        int32_t t = 0;
+        uint32_t p = 0;
+        const bool ok = ms5611_compensate(&c, r.d1, r.d2, &t, &p) == MS5611_OK;
+        if (ok) acc += p + (uint32_t)t;
+        if (k < raw.size()) ref_p.push_back(ok ? (int32_t)p : -1);
+    }
+    const double direct = bench::now_s() - t0;
+    bench::keep(acc);
+
+    // 2) registry: n_sensors개 replay driver, 같은 bus (매 순회 start는 1개)
+    std::vector<Replay> dev(n_sensors);
+    sensor_reg_t reg;
+    sensor_reg_init(&reg);
+    for (uint32_t i = 0; i < n_sensors; i++) {
+        dev[i] = Replay{c, raw.data(), raw.size(), 0, 0, 0, 0};
+        (void)sensor_reg_add(&reg, &k_replay_ops, &dev[i], (uint8_t)(i & 1u), 1);
+    }
+    (void)sensor_reg_init_all(&reg, 0);
+
+    uint64_t got = 0, mismatch = 0, passes = 0;
+    std::vector<size_t> seen(n_sensors, 0);
+    sensor_sample_t out[SENSOR_REG_MAX];
+    uint32_t now = 0;
+    t0 = bench::now_s();
+    while (got < target) {
+        const size_t n = sensor_reg_poll(&reg, ++now, out, SENSOR_REG_MAX);
+        passes++;
+        for (size_t i = 0; i < n; i++) {
+            int32_t p = 0;
+            const size_t idx = seen[out[i].id]++;
+            if (idx < ref_p.size() && (!sensor_sample_get(&out[i], SENSOR_Q_PRESS_PA, &p) || p != ref_p[idx])) {
+                mismatch++;
+            }
+            acc += (uint32_t)out[i].val[1];
+        }
+        got += n;
+    }
+    const double via = bench::now_s() - t0;
+    bench::keep(acc);
+
+    bench::Json("sensor_dispatch")
+        .num("sensors", n_sensors)
+        .num("samples", (double)got)
+        .num("passes", (double)passes)
+        .num("direct_ns_per_sample", direct / (double)target * 1e9)
+        .num("registry_ns_per_sample", via / (double)got * 1e9)
+        .num("overhead_ns_per_sample", (via / (double)got - direct / (double)target) * 1e9)
+        .num("sample_bytes", sizeof(sensor_sample_t))
+        .num("mismatch", (double)mismatch)
+        .print();
+    return mismatch == 0;
+}
+
+// ---- scheduling 시뮬레이션 (가상 시간) ----
+
+struct Timed {
+    const char *name;
+    uint32_t    steps;      // conversion 단계 수 (MS5611: 2)
+    uint32_t    conv_us;    // 단계당
+    uint32_t    step;
+    uint32_t    due;
+    uint64_t    delay_sum;  // 예정 시각 -> 실제 start
+    uint32_t    delay_max;
+    uint32_t    starts;
+};
+
+int32_t tm_start(void *dev, uint32_t now) {
+    Timed *t = (Timed *)dev;
+    t->step     = 1;
+    t->due      = now + t->conv_us;
+    return 0;
+}
+
+int32_t tm_poll(void *dev, uint32_t now) {
+    Timed *t = (Timed *)dev;
+    if ((int32_t)(now - t->due) < 0) return SENSOR_PENDING;
+    if (t->step < t->steps) {
+        t->step++;
+        t->due = now + t->conv_us;
+        return SENSOR_STEP;
+    }
+    return SENSOR_READY;
+}
+
+uint32_t tm_read_raw(void *, uint32_t raw[SENSOR_RAW_MAX]) {
+    raw[0] = 0;
+    return 1;
+}
+
+int32_t tm_convert(const void *, const uint32_t *, uint32_t, sensor_sample_t *out) {
+    out->n = 1;
+    out->qty[0] = SENSOR_Q_PRESS_PA;
+    return 0;
+}
+
+void bench_schedule() {
+    const sensor_ops_t ops[4] = {
+        { "ms5611",  nullptr, tm_start, tm_poll, tm_read_raw, tm_convert },
+        { "humid",   nullptr, tm_start, tm_poll, tm_read_raw, tm_convert },
+        { "accel",   nullptr, tm_start, tm_poll, tm_read_raw, tm_convert },
+        { "ms5611b", nullptr, tm_start, tm_poll, tm_read_raw, tm_convert },
+    };
+    Timed dev[4] = {
+        { "ms5611",  2, 9060,  0, 0, 0, 0, 0 },
+        { "humid",   1, 15000, 0, 0, 0, 0, 0 },
+        { "accel",   1, 1000,  0, 0, 0, 0, 0 },
+        { "ms5611b", 2, 9060,  0, 0, 0, 0, 0 },
+    };
+    const uint8_t  bus[4]    = { 0, 0, 0, 1 };
+    const uint32_t period[4] = { 100000, 1000000, 10000, 100000 };
+
+    sensor_reg_t reg;
+    sensor_reg_init(&reg);
+    for (int i = 0; i < 4; i++) (void)sensor_reg_add(&reg, &ops[i], &dev[i], bus[i], period[i]);
+    (void)sensor_reg_init_all(&reg, 0);
+
+    const uint32_t sim_us = 60u * 1000000u;
+    sensor_sample_t out[SENSOR_REG_MAX];
+    uint32_t prev_next[4];
+    for (int i = 0; i < 4; i++) prev_next[i] = reg.slot[i].next_us;
+
+    for (uint32_t now = 0; now < sim_us; now += 50u) {
+        (void)sensor_reg_poll(&reg, now, out, SENSOR_REG_MAX);
+        for (int i = 0; i < 4; i++) {
+            // start가 일어나면 next_us가 바뀜 -> 예정 시각(prev_next) 대비 지연
+            if (reg.slot[i].next_us != prev_next[i]) {
+                const uint32_t d = now - prev_next[i];
+                dev[i].delay_sum += d;
+                dev[i].delay_max = std::max(dev[i].delay_max, d);
+                dev[i].starts++;
+                prev_next[i] = reg.slot[i].next_us;
+            }
+        }
+    }
+
+    for (int i = 0; i < 4; i++) {
+        const sensor_slot_t &s = reg.slot[i];
+        bench::Json("sensor_schedule")
+            .str("sensor", dev[i].name)
+            .num("bus", bus[i])
+            .num("period_ms", period[i] / 1000.0)
+            .num("rate_hz", s.samples / (sim_us / 1e6))
+            .num("start_delay_avg_us", dev[i].starts ? (double)dev[i].delay_sum / dev[i].starts : 0.0)
+            .num("start_delay_max_us", dev[i].delay_max)
+            .num("deferred", s.deferred)
+            .num("errors", s.errors)
+            .print();
+    }
+
+    char line[256];
+    if (sensor_reg_stats_line(&reg, sim_us / 1000u, line, sizeof(line)) > 0) std::fputs(line, stderr);
+}
+
+} // namespace
+
+int main() {
+    bool ok = true;
+    for (uint32_t n : {1u, 2u, 4u, 8u}) ok = bench_dispatch(n) && ok;
+    bench_schedule();
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,287 @@
+// FILE: host/bench/bench_store.cpp
+// time-series store (host/store/ts_store.h): 합성 multi-node dataset으로 ingest rate + query latency
+//
+//   bench_store [--nodes 16] [--days 3] [--hz 1] [--dir DIR] [--keep]
+//
+// dataset : node마다 대기압 random walk + 일교차 온도, 주기 지터 ±20 ms, 전 node가 같은 시각 순서로 도착
+//           node 0은 1%를 50 샘플 늦게 append (backfill 순서 뒤바뀜)
+// 결과 (JSON lines)
+//   store_ingest : append 처리량, 샘플당 column byte / disk byte, 같은 내용 CSV 대비 크기
+//   store_open   : 닫았다가 다시 열기 (segment/rollup mmap + 마지막 block 복원)
+//   store_query  : 1시간 range scan (임의 node/시각) p50/p99, 1일 scan, 분/시간 rollup
+//   store_csv    : 같은 1시간 query를 node CSV 전체 parse로 (기존 방식 기준선)
+//   store_verify : scan 개수 / rollup min/max/mean을 scan 재계산과 비교 (불일치면 exit 1)
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "bench_util.h"
+#include "ts_store.h"
+
+namespace {
+
+constexpr int64_t kEpochMs = 1767225600000ll;    // 2026-01-01T00:00:00Z
+
+uint64_t g_rng = 0x9E3779B97F4A7C15ull;
+
+uint64_t next_u64() {
+    g_rng ^= g_rng << 13;
+    g_rng ^= g_rng >> 7;
+    g_rng ^= g_rng << 17;
+    return g_rng;
+}
+
+struct NodeGen {
+    int64_t p_x16;      // 압력 random walk (1/16 Pa)
+};
+
+store::Sample make_sample(NodeGen &g, uint64_t i, uint32_t period_ms) {
+    g.p_x16 += (int64_t)(next_u64() % 97) - 48;
+    g.p_x16  = std::clamp<int64_t>(g.p_x16, 95000 * 16, 104000 * 16);
+    const int64_t ms  = kEpochMs + (int64_t)(i * period_ms) + (int64_t)(next_u64() % 41) - 20;
+    const double  day = (double)(i * period_ms) / 86400000.0;
+    const int32_t t   = 1800 + (int32_t)(600.0 * std::sin(day * 2.0 * M_PI)) + (int32_t)(next_u64() % 11) - 5;
+    return store::Sample{ms, t, (uint32_t)(g.p_x16 / 16)};
+}
+
+double pct(std::vector<double> &v, double q) {
+    if (v.empty()) return 0;
+    std::sort(v.begin(), v.end());
+    return v[std::min(v.size() - 1, (size_t)(q * (double)v.size()))];
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    uint32_t n_nodes = 16, hz = 1;
+    double days = 3;
+    std::string dir;
+    bool keep = false;
+
+    for (int i = 1; i < argc; i++) {
+        if (!std::strcmp(argv[i], "--keep")) { keep = true; continue; }
+        if (i + 1 >= argc) break;
+        if (!std::strcmp(argv[i], "--nodes"))     n_nodes = (uint32_t)std::atoi(argv[++i]);
+        else if (!std::strcmp(argv[i], "--days")) days    = std::atof(argv[++i]);
+        else if (!std::strcmp(argv[i], "--hz"))   hz      = (uint32_t)std::atoi(argv[++i]);
+        else if (!std::strcmp(argv[i], "--dir"))  dir     = argv[++i];
+    }
+    if (n_nodes == 0 || hz == 0 || days <= 0) {
+        std::fprintf(stderr, "usage: %s [--nodes N] [--days D] [--hz HZ] [--dir DIR] [--keep]\n", argv[0]);
+        return 2;
+    }
+    if (dir.empty()) {
+        char tmpl[] = "/tmp/gy63_store_XXXXXX";
+        if (!mkdtemp(tmpl)) { std::perror("mkdtemp"); return 2; }
+        dir = tmpl;
+    }
+
+    const uint32_t period_ms = 1000u / hz;
+    const uint64_t per_node  = (uint64_t)(days * 86400.0 * hz);
+    const int64_t  span_ms   = (int64_t)per_node * period_ms;
+    bool ok = true;
+
+    // ---- ingest ----
+    std::vector<NodeGen> gen(n_nodes, NodeGen{101325 * 16});
+    std::vector<store::Sample> held;              // node 0 늦은 샘플 (i, sample)
+    std::vector<uint64_t> held_at;
+    uint64_t csv_bytes = 0, total = 0;
+    std::vector<uint64_t> expect(n_nodes, 0);
+
+    double t0, sec;
+    {
+        store::Store st(dir);
+        if (!st.open()) { std::perror(dir.c_str()); return 2; }
+        std::vector<store::Series *> ser(n_nodes);
+        for (uint32_t n = 0; n < n_nodes; n++) ser[n] = st.series(0x6763000000000000ull + n);
+
+        t0 = bench::now_s();
+        for (uint64_t i = 0; i < per_node; i++) {
+            for (uint32_t n = 0; n < n_nodes; n++) {
+                const store::Sample s = make_sample(gen[n], i, period_ms);
+                if (n == 0 && next_u64() % 100 == 0) {
+                    held.push_back(s);
+                    held_at.push_back(i + 50);
+                } else {
+                    ok = ser[n]->append(s) && ok;
+                }
+                expect[n]++;
+                char line[64];
+                csv_bytes += (uint64_t)std::snprintf(line, sizeof(line), "%u,%lld,%ld,%lu\n", n, (long long)s.ms,
+                                                     (long)s.t_x100, (unsigned long)s.p_pa);
+                total++;
+            }
+            while (!held.empty() && held_at.front() <= i) {
+                ok = ser[0]->append(held.front()) && ok;
+                held.erase(held.begin());
+                held_at.erase(held_at.begin());
+            }
+        }
+        for (const store::Sample &s : held) ok = ser[0]->append(s) && ok;
+        sec = bench::now_s() - t0;
+
+        uint64_t col = 0, disk = 0;
+        for (store::Series *s : ser) {
+            const store::SeriesStats ss = s->stats();
+            col  += ss.col_bytes;
+            disk += ss.disk_bytes;
+        }
+        bench::Json("store_ingest")
+            .num("nodes", n_nodes)
+            .num("days", days)
+            .num("hz", hz)
+            .rate(total, sec)
+            .num("col_bytes_per_sample", (double)col / (double)total)
+            .num("disk_bytes_per_sample", (double)disk / (double)total)
+            .num("csv_bytes_per_sample", (double)csv_bytes / (double)total)
+            .num("disk_mb", (double)disk / 1e6)
+            .print();
+        st.flush(true);
+    }
+
+    // ---- reopen ----
+    store::Store st(dir);
+    t0 = bench::now_s();
+    const bool reopened = st.open();
+    sec = bench::now_s() - t0;
+    const std::vector<uint64_t> nodes = st.nodes();
+    bench::Json("store_open").num("nodes", (double)nodes.size()).num("ms", sec * 1e3).print();
+    if (!reopened || nodes.size() != n_nodes) return 1;
+
+    // ---- queries ----
+    std::vector<double> lat;
+    uint64_t got = 0;
+    const int64_t hour = store::kRollupHour;
+    for (int q = 0; q < 200; q++) {
+        store::Series *s = st.series(nodes[next_u64() % nodes.size()]);
+        const int64_t a = kEpochMs + (int64_t)(next_u64() % (uint64_t)std::max<int64_t>(span_ms - hour, 1));
+        int64_t sum = 0;
+        t0 = bench::now_s();
+        got += s->scan(a, a + hour, [&](const store::Sample &x) { sum += x.p_pa; });
+        lat.push_back((bench::now_s() - t0) * 1e6);
+        bench::keep(sum);
+    }
+    bench::Json("store_query")
+        .str("query", "scan_1h")
+        .num("queries", 200)
+        .num("samples_per_query", (double)got / 200.0)
+        .num("p50_us", pct(lat, 0.50))
+        .num("p99_us", pct(lat, 0.99))
+        .print();
+
+    {
+        store::Series *s = st.series(nodes[0]);
+        const int64_t a = kEpochMs + std::min<int64_t>(86400000ll, span_ms / 2);
+        int64_t sum = 0;
+        t0 = bench::now_s();
+        const uint64_t n = s->scan(a, a + 86400000ll, [&](const store::Sample &x) { sum += x.p_pa; });
+        sec = bench::now_s() - t0;
+        bench::keep(sum);
+        bench::Json("store_query").str("query", "scan_1d").rate(n, sec).num("ms", sec * 1e3).print();
+
+        lat.clear();
+        uint64_t buckets = 0;
+        for (int q = 0; q < 200; q++) {
+            const int64_t b = kEpochMs + (int64_t)(next_u64() % (uint64_t)std::max<int64_t>(span_ms - 86400000ll, 1));
+            t0 = bench::now_s();
+            buckets += s->rollups(store::kRollupMinute, b, b + 86400000ll, [&](const store::Rollup &r) { sum += r.p_max; });
+            lat.push_back((bench::now_s() - t0) * 1e6);
+        }
+        bench::keep(sum);
+        bench::Json("store_query")
+            .str("query", "rollup_1m_1d")
+            .num("buckets_per_query", (double)buckets / 200.0)
+            .num("p50_us", pct(lat, 0.50))
+            .num("p99_us", pct(lat, 0.99))
+            .print();
+
+        // 전 node 전 기간 시간 rollup
+        t0 = bench::now_s();
+        buckets = 0;
+        for (uint64_t id : nodes) {
+            buckets += st.series(id)->rollups(store::kRollupHour, kEpochMs - hour, kEpochMs + span_ms + hour,
+                                              [&](const store::Rollup &r) { sum += r.p_min; });
+        }
+        sec = bench::now_s() - t0;
+        bench::keep(sum);
+        bench::Json("store_query").str("query", "rollup_1h_all").num("buckets", (double)buckets)
+            .num("ms", sec * 1e3).print();
+    }
+
+    // ---- CSV 기준선: node 0 CSV 전체 parse로 1시간 query ----
+    {
+        const std::string csv = dir + "/node0.csv";
+        FILE *f = std::fopen(csv.c_str(), "w");
+        if (f) {
+            st.series(nodes[0])->scan(INT64_MIN, INT64_MAX, [&](const store::Sample &x) {
+                std::fprintf(f, "%lld,%ld,%lu\n", (long long)x.ms, (long)x.t_x100, (unsigned long)x.p_pa);
+            });
+            std::fclose(f);
+        }
+        const int64_t a = kEpochMs + span_ms / 2;
+        uint64_t n = 0;
+        int64_t sum = 0;
+        t0 = bench::now_s();
+        if ((f = std::fopen(csv.c_str(), "r"))) {
+            char line[96];
+            while (std::fgets(line, sizeof(line), f)) {
+                char *e = nullptr;
+                const long long ms = std::strtoll(line, &e, 10);
+                if (ms < a || ms >= a + hour) continue;
+                (void)std::strtol(e + 1, &e, 10);
+                sum += std::strtoul(e + 1, nullptr, 10);
+                n++;
+            }
+            std::fclose(f);
+        }
+        sec = bench::now_s() - t0;
+        bench::keep(sum);
+        bench::Json("store_csv").str("query", "scan_1h").num("samples", (double)n).num("ms", sec * 1e3).print();
+        std::remove(csv.c_str());
+    }
+
+    // ---- verify ----
+    uint64_t count_bad = 0, roll_bad = 0, roll_checked = 0;
+    for (uint32_t i = 0; i < nodes.size(); i++) {
+        store::Series *s = st.series(nodes[i]);
+        if (s->scan(INT64_MIN, INT64_MAX, [](const store::Sample &) {}) != expect[i]) count_bad++;
+
+        // 임의 시간 bucket 3개: rollup == scan 재계산
+        for (int k = 0; k < 3; k++) {
+            const int64_t b = kEpochMs - hour + (int64_t)(next_u64() % (uint64_t)(span_ms / hour + 2)) * hour;
+            store::Rollup ref{b, 0, UINT32_MAX, 0, INT32_MAX, INT32_MIN, 0, 0};
+            s->scan(b, b + hour, [&](const store::Sample &x) {
+                ref.n++;
+                ref.p_min = std::min(ref.p_min, x.p_pa);
+                ref.p_max = std::max(ref.p_max, x.p_pa);
+                ref.t_min = std::min(ref.t_min, x.t_x100);
+                ref.t_max = std::max(ref.t_max, x.t_x100);
+                ref.p_sum += x.p_pa;
+                ref.t_sum += x.t_x100;
+            });
+            store::Rollup r{};
+            s->rollups(store::kRollupHour, b, b + hour, [&](const store::Rollup &x) { r = x; });
+            const bool same = (r.n == ref.n) &&
+                              (ref.n == 0 || (r.p_min == ref.p_min && r.p_max == ref.p_max && r.t_min == ref.t_min &&
+                                              r.t_max == ref.t_max && r.p_sum == ref.p_sum && r.t_sum == ref.t_sum));
+            if (!same) roll_bad++;
+            roll_checked++;
+        }
+    }
+    bench::Json("store_verify")
+        .num("count_mismatch", (double)count_bad)
+        .num("rollup_checked", (double)roll_checked)
+        .num("rollup_mismatch", (double)roll_bad)
+        .print();
+    ok = ok && count_bad == 0 && roll_bad == 0;
+
+    if (!keep) std::filesystem::remove_all(dir);
+    else       std::fprintf(stderr, "store kept in %s\n", dir.c_str());
+    return ok ? 0 : 1;
+}
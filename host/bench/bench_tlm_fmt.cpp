@@ -0,0 +1,141 @@
+// FILE: host/bench/bench_tlm_fmt.cpp
+// tlm_fmt (digit-pair serializer) vs snprintf: byte 일치 검증 + 처리량
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "bench_util.h"
+
+extern "C" {
+#include "tlm_fmt.h"
+}
+
+namespace {
+
+uint64_t g_rng = 0x243F6A8885A308D3ull;
+
+uint64_t next_u64() {
+    g_rng ^= g_rng << 13;
+    g_rng ^= g_rng >> 7;
+    g_rng ^= g_rng << 17;
+    return g_rng;
+}
+
+// 자릿수 분포가 고르게 나오도록 (작은 값/경계값 포함)
+uint64_t rand_width(int bits) {
+    const int w = 1 + (int)(next_u64() % (uint64_t)bits);
+    const uint64_t v = next_u64();
+    return w >= 64 ? v : (v & ((1ull << w) - 1));
+}
+
+tlm_sample_t rand_sample() {
+    tlm_sample_t s;
+    s.ms     = rand_width(64);
+    s.t_x100 = (int32_t)(uint32_t)rand_width(32);
+    s.p_pa   = (uint32_t)rand_width(32);
+    return s;
+}
+
+int ref_sample(char *out, size_t sz, const tlm_sample_t *s) {
+    return std::snprintf(out, sz, "ms=%llu,t_x100=%ld,p_pa=%u\n",
+                         (unsigned long long)s->ms, (long)s->t_x100, (unsigned)s->p_pa);
+}
+
+} // namespace
+
+int main() {
+    // 1) 일치 검증: 경계값 + 무작위 1M
+    std::vector<tlm_sample_t> edge = {
+        {0, 0, 0},
+        {UINT64_MAX, INT32_MIN, UINT32_MAX},
+        {UINT32_MAX, INT32_MAX, 101325},
+        {(uint64_t)UINT32_MAX + 1, -1, 1},
+        {99999999, -100, 100000000},
+        {100000000, 99, 9},
+        {9999999999999999ull, 10, 10},
+        {10000000000000000ull, -9, 99},
+    };
+    uint64_t mismatch = 0, checked = 0;
+    char a[128], b[128];
+    for (int i = 0; i < 1000000 + (int)edge.size(); i++) {
+        const tlm_sample_t s = i < (int)edge.size() ? edge[(size_t)i] : rand_sample();
+        const int    na = ref_sample(a, sizeof(a), &s);
+        const size_t nb = tlm_fmt_sample(b, sizeof(b), &s);
+        if ((size_t)na != nb || std::memcmp(a, b, nb) != 0) {
+            if (mismatch < 5) std::fprintf(stderr, "mismatch:\n  ref  %s  fast %s", a, b);
+            mismatch++;
+        }
+
+        // x100 vs "%.2f"
+        const int32_t v = s.t_x100;
+        const int    nx = std::snprintf(a, sizeof(a), "%.2f", (double)v / 100.0);
+        const size_t ny = tlm_fmt_x100(b, v);
+        if ((size_t)nx != ny || std::memcmp(a, b, ny) != 0) {
+            if (mismatch < 5) std::fprintf(stderr, "x100 mismatch: %d ref=%.*s fast=%.*s\n", (int)v, nx, a, (int)ny, b);
+            mismatch++;
+        }
+        checked++;
+    }
+
+    // 작은 buffer: snprintf처럼 잘리면 0
+    {
+        const tlm_sample_t s = {123456, -2534, 101325};
+        for (size_t sz = 0; sz < 40; sz++) {
+            const int    na = ref_sample(a, sz, &s);
+            const size_t nb = tlm_fmt_sample(b, sz, &s);
+            const bool ref_fits = na > 0 && (size_t)na < sz;
+            if (ref_fits != (nb != 0)) mismatch++;
+        }
+    }
+
+    bench::Json("tlm_fmt/verify").num("checked", (double)checked).num("mismatch", (double)mismatch).print();
+
+    // 2) 처리량: firmware 범위 샘플 (ms < 2^32, 실온 근처, 대기압 근처)
+    std::vector<tlm_sample_t> in(4096);
+    for (size_t i = 0; i < in.size(); i++) {
+        in[i].ms     = 1000000u + i * 10u;
+        in[i].t_x100 = (int32_t)(next_u64() % 6000) - 1000;
+        in[i].p_pa   = 95000u + (uint32_t)(next_u64() % 10000);
+    }
+    const int reps = 500;
+    const uint64_t ops = (uint64_t)reps * in.size();
+
+    uint64_t bytes = 0;
+    double t0 = bench::now_s();
+    for (int r = 0; r < reps; r++) {
+        for (const auto &s : in) bytes += (uint64_t)ref_sample(a, sizeof(a), &s);
+    }
+    double el = bench::now_s() - t0;
+    bench::keep(a);
+    bench::Json("tlm_fmt/snprintf").rate(ops, el, bytes).print();
+
+    bytes = 0;
+    t0 = bench::now_s();
+    for (int r = 0; r < reps; r++) {
+        for (const auto &s : in) bytes += tlm_fmt_sample(b, sizeof(b), &s);
+    }
+    el = bench::now_s() - t0;
+    bench::keep(b);
+    bench::Json("tlm_fmt/fast").rate(ops, el, bytes).print();
+
+    // debug 줄의 "%.2f"
+    t0 = bench::now_s();
+    for (int r = 0; r < reps; r++) {
+        for (const auto &s : in) bytes += (uint64_t)std::snprintf(a, sizeof(a), "%.2f", (double)s.t_x100 / 100.0);
+    }
+    el = bench::now_s() - t0;
+    bench::keep(a);
+    bench::Json("tlm_fmt/snprintf_f2").rate(ops, el).print();
+
+    t0 = bench::now_s();
+    for (int r = 0; r < reps; r++) {
+        for (const auto &s : in) bytes += tlm_fmt_x100(b, s.t_x100);
+    }
+    el = bench::now_s() - t0;
+    bench::keep(b);
+    bench::keep(bytes);
+    bench::Json("tlm_fmt/x100").rate(ops, el).print();
+
+    return mismatch ? 1 : 0;
+}
@@ -0,0 +1,77 @@
+// FILE: host/bench/bench_tlm_parse.cpp
+// telemetry line parser: tlm_line.h vs sscanf (같은 입력, 결과 일치 확인)
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "bench_util.h"
+#include "tlm_line.h"
+
+int main() {
+    // batch 4 datagram (firmware flush_live 형태) 여러 개
+    std::vector<std::string> dgrams;
+    uint32_t rng = 12345;
+    for (int d = 0; d < 4096; d++) {
+        std::string s;
+        for (int i = 0; i < 4; i++) {
+            rng = rng * 1664525u + 1013904223u;
+            char line[96];
+            std::snprintf(line, sizeof(line), "ms=%llu,t_x100=%ld,p_pa=%u\n",
+                          (unsigned long long)(123456789ull + (uint64_t)d * 40 + (uint64_t)i * 10),
+                          (long)((int32_t)(rng % 8000) - 4000), (unsigned)(90000 + rng % 20000));
+            s += line;
+        }
+        dgrams.push_back(s);
+    }
+
+    uint64_t bytes = 0;
+    for (const auto &s : dgrams) bytes += s.size();
+    const int reps = 200;
+
+    // 1) tlm_line
+    uint64_t sum_fast = 0, n_fast = 0;
+    double t0 = bench::now_s();
+    for (int r = 0; r < reps; r++) {
+        for (const auto &s : dgrams) {
+            tlm::for_each_line(s.data(), s.size(), [&](tlm::Kind k, const tlm::Record &rec, const char *, size_t) {
+                if (k != tlm::Kind::Sample) return;
+                sum_fast += rec.ms + (uint64_t)(int64_t)rec.t_x100 + rec.p_pa;
+                n_fast++;
+            });
+        }
+    }
+    double el = bench::now_s() - t0;
+    bench::keep(sum_fast);
+    bench::Json("tlm_parse/fast").rate(n_fast, el, bytes * reps).print();
+
+    // 2) sscanf (줄 단위)
+    uint64_t sum_ref = 0, n_ref = 0;
+    t0 = bench::now_s();
+    for (int r = 0; r < reps; r++) {
+        for (const auto &s : dgrams) {
+            const char *p = s.c_str();
+            while (*p) {
+                unsigned long long ms;
+                long t;
+                unsigned pa;
+                int used = 0;
+                if (std::sscanf(p, "ms=%llu,t_x100=%ld,p_pa=%u\n%n", &ms, &t, &pa, &used) == 3 && used > 0) {
+                    sum_ref += ms + (uint64_t)(int64_t)t + pa;
+                    n_ref++;
+                    p += used;
+                } else {
+                    break;
+                }
+            }
+        }
+    }
+    el = bench::now_s() - t0;
+    bench::keep(sum_ref);
+    bench::Json("tlm_parse/sscanf")
+        .rate(n_ref, el, bytes * reps)
+        .num("match", (sum_ref == sum_fast && n_ref == n_fast) ? 1 : 0)
+        .print();
+
+    return (sum_ref == sum_fast && n_ref == n_fast) ? 0 : 1;
+}
@@ -0,0 +1,161 @@
+// FILE: host/bench/bench_udp_arq.cpp
+// udp_arq: 가상 시간 lossy channel 시뮬레이션 (loss rate별 전달률/goodput/복구 지연)
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <queue>
+#include <random>
+#include <vector>
+
+#include "bench_util.h"
+
+extern "C" {
+#include "udp_arq.h"
+}
+
+namespace {
+
+struct Event {
+    uint64_t t_ms;
+    bool     to_rx;      // true: sender->receiver DATA, false: receiver->sender FB
+    std::vector<uint8_t> pkt;
+    bool operator>(const Event &o) const { return t_ms > o.t_ms; }
+};
+
+struct Channel {
+    std::priority_queue<Event, std::vector<Event>, std::greater<Event>> q;
+    std::mt19937 rng{42};
+    double   loss = 0;
+    uint32_t delay_ms = 5;
+    uint32_t jitter_ms = 3;
+    uint64_t now_ms = 0;
+    uint64_t wire_pkts = 0;
+    uint64_t wire_bytes = 0;
+
+    void push(bool to_rx, const void *p, size_t len) {
+        wire_pkts++;
+        wire_bytes += len;
+        if (std::uniform_real_distribution<double>(0, 1)(rng) < loss) return;
+        const uint64_t d = delay_ms + (jitter_ms ? rng() % (jitter_ms + 1) : 0);
+        const uint8_t *b = (const uint8_t *)p;
+        q.push({now_ms + d, to_rx, std::vector<uint8_t>(b, b + len)});
+    }
+};
+
+bool send_data(const void *pkt, size_t len, void *user) {
+    ((Channel *)user)->push(true, pkt, len);
+    return true;
+}
+
+double pct(std::vector<double> v, double p) {
+    if (v.empty()) return 0;
+    std::sort(v.begin(), v.end());
+    size_t i = (size_t)(p * (double)(v.size() - 1) + 0.5);
+    return v[std::min(i, v.size() - 1)];
+}
+
+void run(double loss, uint32_t n_pkts, uint32_t interval_ms, size_t payload) {
+    Channel ch;
+    ch.loss = loss;
+
+    arq_tx_t *tx = new arq_tx_t;   // 슬롯 버퍼가 커서 heap
+    arq_tx_init(tx, /*rto*/ 60, /*holdoff*/ 20, /*max_tx*/ 4, send_data, &ch);
+
+    arq_rx_t rx;
+    arq_rx_init(&rx, 8, 20);
+
+    std::vector<uint64_t> sent_at(n_pkts, 0);
+    std::vector<int64_t>  got_at(n_pkts, -1);
+    std::vector<uint8_t>  buf(payload, 0x55);
+
+    uint32_t next = 0;
+    const uint64_t end_ms = (uint64_t)n_pkts * interval_ms + 2000;
+
+    const double t0 = bench::now_s();
+    for (ch.now_ms = 0; ch.now_ms < end_ms; ch.now_ms++) {
+        if (next < n_pkts && ch.now_ms >= (uint64_t)next * interval_ms) {
+            std::memcpy(buf.data(), &next, sizeof(next));
+            sent_at[next] = ch.now_ms;
+            arq_tx_send(tx, buf.data(), buf.size(), ch.now_ms);
+            next++;
+        }
+
+        while (!ch.q.empty() && ch.q.top().t_ms <= ch.now_ms) {
+            Event ev = ch.q.top();
+            ch.q.pop();
+            if (ev.to_rx) {
+                const uint8_t *pl = nullptr;
+                size_t plen = 0;
+                if (arq_rx_on_packet(&rx, ev.pkt.data(), ev.pkt.size(), &pl, &plen, nullptr)) {
+                    uint32_t id;
+                    std::memcpy(&id, pl, sizeof(id));
+                    if (id < n_pkts && got_at[id] < 0) got_at[id] = (int64_t)ch.now_ms;
+                }
+            } else {
+                arq_tx_on_feedback(tx, ev.pkt.data(), ev.pkt.size(), ch.now_ms);
+            }
+        }
+
+        if (arq_rx_feedback_due(&rx, ch.now_ms)) {
+            uint8_t fb[ARQ_FB_SIZE];
+            size_t n = arq_rx_make_feedback(&rx, ch.now_ms, fb, sizeof(fb));
+            ch.push(false, fb, n);
+        }
+
+        arq_tx_poll(tx, ch.now_ms);
+    }
+    const double wall = bench::now_s() - t0;
+
+    // 최초 송신에 도착한 packet과 재전송으로 복구된 packet의 지연 분리
+    std::vector<double> lat_all, lat_recovered;
+    uint64_t delivered = 0;
+    const uint32_t first_try_max = ch.delay_ms + ch.jitter_ms;
+    for (uint32_t i = 0; i < n_pkts; i++) {
+        if (got_at[i] < 0) continue;
+        delivered++;
+        const double l = (double)(got_at[i] - (int64_t)sent_at[i]);
+        lat_all.push_back(l);
+        if (l > first_try_max) lat_recovered.push_back(l);
+    }
+
+    const double sim_s = (double)end_ms / 1000.0;
+    char name[64];
+    std::snprintf(name, sizeof(name), "udp_arq/loss_%02d", (int)(loss * 100 + 0.5));
+    bench::Json(name)
+        .num("loss", loss)
+        .num("sent", n_pkts)
+        .num("delivered", (double)delivered)
+        .num("delivery_ratio", (double)delivered / n_pkts)
+        .num("no_arq_ratio", 1.0 - loss)
+        .num("goodput_Bps", (double)delivered * payload / sim_s)
+        .num("wire_overhead", (double)ch.wire_bytes / ((double)n_pkts * payload))
+        .num("retransmits", tx->stats.retransmits)
+        .num("abandoned", tx->stats.abandoned)
+        .num("feedback", rx.stats.feedback_tx)
+        .num("lat_p50_ms", pct(lat_all, 0.50))
+        .num("lat_p99_ms", pct(lat_all, 0.99))
+        .num("recovered_lat_p50_ms", pct(lat_recovered, 0.50))
+        .num("recovered_lat_p99_ms", pct(lat_recovered, 0.99))
+        .num("sim_wall_s", wall)
+        .print();
+
+    delete tx;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    uint32_t n_pkts = 20000, interval_ms = 10;
+    size_t payload = 64;
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (!std::strcmp(argv[i], "--packets"))       n_pkts      = (uint32_t)std::strtoul(argv[i + 1], nullptr, 0);
+        else if (!std::strcmp(argv[i], "--interval")) interval_ms = (uint32_t)std::strtoul(argv[i + 1], nullptr, 0);
+        else if (!std::strcmp(argv[i], "--payload"))  payload     = (size_t)std::strtoul(argv[i + 1], nullptr, 0);
+    }
+    if (payload < sizeof(uint32_t) || payload > ARQ_MAX_PAYLOAD) payload = 64;
+
+    for (double loss : {0.0, 0.01, 0.05, 0.10, 0.20, 0.30}) run(loss, n_pkts, interval_ms, payload);
+    return 0;
+}
@@ -0,0 +1,63 @@
+// FILE: host/bench/bench_util.h
+#ifndef __BENCH_UTIL_H__
+#define __BENCH_UTIL_H__
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+// host benchmark 공용: 시간 측정 + JSON line 출력 (1 결과 = 1 line)
+namespace bench {
+
+inline double now_s() {
+    using clock = std::chrono::steady_clock;
+    return std::chrono::duration<double>(clock::now().time_since_epoch()).count();
+}
+
+// 최적화로 결과가 사라지지 않도록
+template <typename T>
+inline void keep(const T &v) {
+    asm volatile("" : : "g"(&v) : "memory");
+}
+
+class Json {
+public:
+    explicit Json(const std::string &name) { body_ = "{\"bench\":\"" + name + "\""; }
+
+    Json &num(const char *key, double v) {
+        char buf[64];
+        std::snprintf(buf, sizeof(buf), ",\"%s\":%.6g", key, v);
+        body_ += buf;
+        return *this;
+    }
+
+    Json &str(const char *key, const std::string &v) {
+        body_ += ",\"" + std::string(key) + "\":\"" + v + "\"";
+        return *this;
+    }
+
+    // ops 개를 sec 동안 처리 -> ns_per_op / ops_per_s (+ bytes면 mb_per_s)
+    Json &rate(uint64_t ops, double sec, uint64_t bytes = 0) {
+        num("ops", (double)ops);
+        num("sec", sec);
+        if (ops && sec > 0) {
+            num("ns_per_op", sec * 1e9 / (double)ops);
+            num("ops_per_s", (double)ops / sec);
+        }
+        if (bytes && sec > 0) num("mb_per_s", (double)bytes / sec / 1e6);
+        return *this;
+    }
+
+    void print(FILE *out = stdout) const {
+        std::fprintf(out, "%s}\n", body_.c_str());
+        std::fflush(out);
+    }
+
+private:
+    std::string body_;
+};
+
+} // namespace bench
+
+#endif // __BENCH_UTIL_H__
@@ -0,0 +1,114 @@
+// FILE: host/bench/rtrace_io.h
+#ifndef __RTRACE_IO_H__
+#define __RTRACE_IO_H__
+
+// raw trace file (chunk 연결) 읽기/쓰기 + event 순회 (gy63_rtrace tool, bench_replay 공용)
+// - chunk 경계는 rtrace_parse로 재동기 (손상 byte는 resync로 집계)
+// - seq 구멍 = 유실 chunk. seq가 0으로 돌아가면 새 boot (gap 아님)
+// - t_us(u32, ~71분 wrap)는 64-bit로 펼쳐서 넘김
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+extern "C" {
+#include "rtrace.h"
+}
+
+namespace rtrace_io {
+
+struct Scan {
+    uint64_t chunks  = 0;
+    uint64_t lost    = 0;   // seq 구멍
+    uint64_t resync  = 0;   // 버린 byte
+    uint64_t bad     = 0;   // decode 형식 오류 chunk
+    uint64_t boots   = 0;
+    uint64_t events  = 0;
+};
+
+struct Event {
+    rtrace_ev_t ev;
+    uint64_t    t_us;       // 펼친 시각 (첫 sample = 0, 이후 delta 누적)
+};
+
+inline bool load(const char *path, std::vector<uint8_t> &out) {
+    FILE *f = std::fopen(path, "rb");
+    if (!f) return false;
+    uint8_t buf[1 << 16];
+    size_t n;
+    while ((n = std::fread(buf, 1, sizeof(buf), f)) > 0) out.insert(out.end(), buf, buf + n);
+    std::fclose(f);
+    return true;
+}
+
+inline bool save(const char *path, const std::vector<uint8_t> &data) {
+    FILE *f = std::fopen(path, "wb");
+    if (!f) return false;
+    const bool ok = std::fwrite(data.data(), 1, data.size(), f) == data.size();
+    return (std::fclose(f) == 0) && ok;
+}
+
+// 전 chunk의 event -> fn(const Event &)
+template <typename Fn>
+Scan for_each_event(const uint8_t *buf, size_t len, Fn &&fn) {
+    struct Ctx {
+        Fn       *fn;
+        uint64_t  t64;
+        uint32_t  last;
+        bool      have_t;
+    };
+    Scan sc;
+    Ctx ctx{&fn, 0, 0, false};
+    bool have_seq = false;
+    uint32_t last_seq = 0;
+
+    size_t off = 0;
+    while (off < len) {
+        rtrace_info_t info;
+        const int32_t r = rtrace_parse(buf + off, len - off, &info);
+        if (r == 0) {
+            sc.resync += len - off;
+            break;
+        }
+        if (r < 0) {
+            sc.resync += (uint64_t)-r;
+            off += (size_t)-r;
+            continue;
+        }
+
+        if (!have_seq || info.seq == 0) {
+            // 새 stream (첫 chunk / 재부팅): 시각은 이어 붙임
+            sc.boots++;
+            ctx.have_t = false;
+        } else if (info.seq != last_seq + 1u && info.seq - last_seq - 1u < 0x80000000u) {
+            sc.lost += info.seq - last_seq - 1u;
+        }
+        have_seq = true;
+        last_seq = info.seq;
+        sc.chunks++;
+
+        const int32_t n = rtrace_decode(buf + off, &info, [](const rtrace_ev_t *ev, void *user) {
+            Ctx *c = (Ctx *)user;
+            Event e;
+            e.ev = *ev;
+            e.t_us = c->t64;
+            if (ev->kind == RTRACE_EV_SAMPLE) {
+                if (c->have_t) c->t64 += (uint32_t)(ev->t_us - c->last);
+                c->last   = ev->t_us;
+                c->have_t = true;
+                e.t_us    = c->t64;
+            } else if (ev->kind == RTRACE_EV_ERR && c->have_t) {
+                e.t_us = c->t64 + (uint64_t)(int64_t)(int32_t)(ev->t_us - c->last);
+            }
+            (*c->fn)(e);
+            return true;
+        }, &ctx);
+        if (n < 0) sc.bad++;
+        else       sc.events += (uint64_t)n;
+        off += (size_t)r;
+    }
+    return sc;
+}
+
+} // namespace rtrace_io
+
+#endif // __RTRACE_IO_H__
@@ -0,0 +1,119 @@
+// FILE: host/bench/rtrace_synth.h
+#ifndef __RTRACE_SYNTH_H__
+#define __RTRACE_SYNTH_H__
+
+// 합성 raw trace (src/core/rtrace.h format): 실제 기록이 없을 때 replay/benchmark 입력
+// - 비행 profile (상승 -> 선회 -> 하강 반복) + 센서 noise -> 압력/온도
+// - 1차 보상식의 역산으로 D1/D2 생성 (20°C 이상 유지 -> 2차 보상 없음, 역산 오차 1 Pa 이내)
+// - OSR 변경 1회 (중간 지점), ERANGE 오류 주기적으로 (err_every sample마다)
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+extern "C" {
+#include "ms5611_math.h"
+#include "rtrace.h"
+}
+
+namespace rtrace_synth {
+
+struct Params {
+    double   hours     = 1.0;
+    uint32_t hz        = 10;
+    uint16_t osr       = 4096;
+    uint16_t osr_mid   = 1024;      // 중간 지점부터 (0: 변경 없음)
+    uint32_t err_every = 50000;     // 0: 오류 없음
+    uint32_t boot_id   = 0x5EED0001u;
+    uint32_t hdr_every = 64;
+    uint64_t seed      = 0x9E3779B97F4A7C15ull;
+};
+
+struct Result {
+    std::vector<uint8_t> bytes;     // chunk 연결 (file 그대로)
+    uint64_t samples = 0;
+    uint64_t errors  = 0;
+    uint64_t chunks  = 0;
+};
+
+// datasheet (AN520) 예제 계수 + CRC4
+inline void make_prom(uint16_t prom[8]) {
+    static const uint16_t c[6] = { 40127, 36924, 23317, 23282, 33464, 28312 };
+    prom[0] = 0;
+    for (int i = 0; i < 6; i++) prom[i + 1] = c[i];
+    prom[7] = 0;
+    prom[7] = ms5611_crc4(prom);
+}
+
+// 1차 보상 역산: (TEMP x100, P Pa) -> (D1, D2)
+inline void invert(const uint16_t prom[8], int32_t temp_x100, int32_t p_pa, uint32_t *d1, uint32_t *d2) {
+    const int64_t c1 = prom[1], c2 = prom[2], c3 = prom[3], c4 = prom[4], c5 = prom[5], c6 = prom[6];
+    const int64_t dt   = ((int64_t)(temp_x100 - 2000) << 23) / c6;
+    const int64_t off  = (c2 << 16) + ((c4 * dt) >> 7);
+    const int64_t sens = (c1 << 15) + ((c3 * dt) >> 8);
+    *d2 = (uint32_t)((c5 << 8) + dt);
+    *d1 = (uint32_t)((((int64_t)p_pa << 15) + off) * ((int64_t)1 << 21) / sens);
+}
+
+inline Result make(const Params &prm) {
+    Result r;
+    uint16_t prom[8];
+    make_prom(prom);
+
+    rtrace_enc_t enc;
+    rtrace_enc_init(&enc, prom, prm.osr, prm.boot_id, prm.hdr_every);
+
+    uint64_t rng = prm.seed;
+    auto next = [&rng]() {
+        rng ^= rng << 13;
+        rng ^= rng >> 7;
+        rng ^= rng << 17;
+        return rng;
+    };
+    auto flush = [&]() {
+        const uint8_t *c = nullptr;
+        const size_t n = rtrace_enc_finish(&enc, &c);
+        if (n == 0) return;
+        r.bytes.insert(r.bytes.end(), c, c + n);
+        r.chunks++;
+    };
+
+    const uint64_t n = (uint64_t)(prm.hours * 3600.0 * prm.hz);
+    const uint32_t dt_us = 1000000u / (prm.hz ? prm.hz : 1u);
+    r.bytes.reserve((size_t)(n * 5u));
+
+    for (uint64_t i = 0; i < n; i++) {
+        const double ts = (double)i / prm.hz;
+        // 고도: 20분 주기 상승/하강 (0..300 m) + 90초 주기 선회 흔들림 + noise ~0.3 m
+        const double cyc = std::fmod(ts, 1200.0) / 1200.0;
+        const double h   = 300.0 * (cyc < 0.5 ? cyc * 2.0 : (1.0 - cyc) * 2.0) +
+                           4.0 * std::sin(ts * 2.0 * M_PI / 90.0) +
+                           0.3 * (((double)(next() % 2001) - 1000.0) / 1000.0);
+        const double p   = 101325.0 * std::pow(1.0 - h / 44330.0, 5.255);
+        const int32_t t  = 2500 + (int32_t)(300.0 * std::sin(ts * 2.0 * M_PI / 3600.0)) - (int32_t)(h * 0.65);
+
+        uint32_t d1 = 0, d2 = 0;
+        invert(prom, t, (int32_t)std::lround(p), &d1, &d2);
+        const uint32_t t_us = (uint32_t)(i * dt_us);
+        const uint16_t osr  = (prm.osr_mid && i >= n / 2) ? prm.osr_mid : prm.osr;
+
+        if (prm.err_every && i % prm.err_every == prm.err_every - 1) {
+            if (!rtrace_enc_error(&enc, t_us, MS5611_ERANGE)) {
+                flush();
+                (void)rtrace_enc_error(&enc, t_us, MS5611_ERANGE);
+            }
+            r.errors++;
+            continue;
+        }
+        if (!rtrace_enc_sample(&enc, t_us, d1, d2, osr)) {
+            flush();
+            (void)rtrace_enc_sample(&enc, t_us, d1, d2, osr);
+        }
+        r.samples++;
+    }
+    flush();
+    return r;
+}
+
+} // namespace rtrace_synth
+
+#endif // __RTRACE_SYNTH_H__
@@ -0,0 +1,455 @@
+// FILE: host/ingest/ingest.cpp
+#include "ingest.h"
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+extern "C" {
+#include "lat_probe.h"
+#include "tlm_raw.h"
+#include "udp_arq.h"
+}
+
+namespace ingest {
+
+// ---------- internal ----------
+
+struct Collector::Rx {
+    int fd = -1;
+    std::thread th;
+    std::vector<std::unique_ptr<SpscRing<Packet>>> rings; // worker별
+    std::atomic<uint64_t> ring_drops{0};
+    std::atomic<uint64_t> kernel_drops{0};
+    std::atomic<uint64_t> calls{0};
+    std::atomic<uint64_t> echoes{0};
+    LatencyHist echo_lat;   // rx thread 전용 (stop 후 읽기)
+};
+
+struct Collector::Worker {
+    int index = 0;
+    std::thread th;
+    std::vector<SpscRing<Packet> *> rings;  // rx별 (이 worker가 consumer)
+
+    std::unordered_map<uint64_t, NodeStats> nodes;
+    LatencyHist lat;
+
+    std::atomic<uint64_t> datagrams{0};
+    std::atomic<uint64_t> samples{0};
+    std::atomic<uint64_t> stat_lines{0};
+    std::atomic<uint64_t> bad_lines{0};
+    std::atomic<uint64_t> raw_frames{0};
+    std::atomic<uint64_t> prom_reqs{0};
+    int req_fd = -1;        // PROM 요청 송신 (처음 필요할 때 생성)
+};
+
+static uint64_t realtime_ns() {
+    timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+// source -> worker (같은 node는 항상 같은 worker)
+static int shard_of(uint32_t ip, uint16_t port, int n) {
+    uint64_t h = node_key(ip, port) * 0x9E3779B97F4A7C15ull;
+    return (int)((h >> 32) % (uint64_t)n);
+}
+
+static int open_socket(const Config &cfg) {
+    int fd = socket(AF_INET, SOCK_DGRAM, 0);
+    if (fd < 0) return -1;
+
+    int one = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEPORT, &one, sizeof(one));
+    setsockopt(fd, SOL_SOCKET, SO_TIMESTAMPNS, &one, sizeof(one));
+    setsockopt(fd, SOL_SOCKET, SO_RXQ_OVFL, &one, sizeof(one));
+    setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &cfg.rcvbuf, sizeof(cfg.rcvbuf));
+
+    timeval tv{0, 100000}; // stop 확인 주기
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+
+    sockaddr_in a{};
+    a.sin_family      = AF_INET;
+    a.sin_port        = htons(cfg.port);
+    a.sin_addr.s_addr = htonl(INADDR_ANY);
+    if (bind(fd, (sockaddr *)&a, sizeof(a)) != 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+// ---------- public ----------
+
+Collector::Collector(const Config &cfg) : cfg_(cfg) {
+    if (cfg_.rx_threads < 1) cfg_.rx_threads = 1;
+    if (cfg_.workers < 1)    cfg_.workers = 1;
+    if (cfg_.batch < 1)      cfg_.batch = 1;
+
+    size_t slots = 1;
+    while (slots < cfg_.ring_slots) slots <<= 1;
+    cfg_.ring_slots = slots;
+}
+
+Collector::~Collector() {
+    stop();
+}
+
+bool Collector::start() {
+    if (running_.load()) return false;
+
+    for (int r = 0; r < cfg_.rx_threads; r++) {
+        auto rx = std::make_unique<Rx>();
+        rx->fd = open_socket(cfg_);
+        if (rx->fd < 0) {
+            std::perror("ingest: bind");
+            for (auto &p : rx_) close(p->fd);
+            rx_.clear();
+            return false;
+        }
+        for (int w = 0; w < cfg_.workers; w++) {
+            rx->rings.push_back(std::make_unique<SpscRing<Packet>>(cfg_.ring_slots));
+        }
+        rx_.push_back(std::move(rx));
+    }
+
+    for (int w = 0; w < cfg_.workers; w++) {
+        auto wk = std::make_unique<Worker>();
+        wk->index = w;
+        for (auto &rx : rx_) wk->rings.push_back(rx->rings[w].get());
+        workers_.push_back(std::move(wk));
+    }
+
+    running_ = true;
+    rx_done_ = false;
+    for (auto &w : workers_) w->th = std::thread([this, wp = w.get()] { worker_loop(*wp); });
+    for (auto &r : rx_)      r->th = std::thread([this, rp = r.get()] { rx_loop(*rp); });
+    return true;
+}
+
+void Collector::stop() {
+    if (!running_.exchange(false)) return;
+
+    for (auto &r : rx_) {
+        if (r->th.joinable()) r->th.join();
+    }
+    rx_done_ = true; // worker: ring이 빌 때까지 처리 후 종료
+    for (auto &w : workers_) {
+        if (w->th.joinable()) w->th.join();
+    }
+    for (auto &r : rx_) {
+        close(r->fd);
+        r->fd = -1;
+    }
+    for (auto &w : workers_) {
+        if (w->req_fd >= 0) close(w->req_fd);
+        w->req_fd = -1;
+    }
+}
+
+void Collector::rx_loop(Rx &rx) {
+    const int vlen = cfg_.batch;
+    const int nw   = cfg_.workers;
+
+    std::vector<char>        bufs((size_t)vlen * kMaxDatagram);
+    std::vector<char>        ctrl((size_t)vlen * 128);
+    std::vector<iovec>       iov((size_t)vlen);
+    std::vector<sockaddr_in> from((size_t)vlen);
+    std::vector<mmsghdr>     msgs((size_t)vlen);
+
+    // echo batch (Config::echo)
+    std::vector<uint8_t>     echo_buf((size_t)vlen * LAT_ECHO_SIZE);
+    std::vector<iovec>       echo_iov((size_t)vlen);
+    std::vector<mmsghdr>     echo_msgs((size_t)vlen);
+    std::vector<uint64_t>    echo_rx_ns((size_t)vlen);
+
+    while (running_.load(std::memory_order_relaxed)) {
+        for (int i = 0; i < vlen; i++) {
+            iov[i].iov_base = &bufs[(size_t)i * kMaxDatagram];
+            iov[i].iov_len  = kMaxDatagram;
+            msghdr &h = msgs[i].msg_hdr;
+            h.msg_name       = &from[i];
+            h.msg_namelen    = sizeof(sockaddr_in);
+            h.msg_iov        = &iov[i];
+            h.msg_iovlen     = 1;
+            h.msg_control    = &ctrl[(size_t)i * 128];
+            h.msg_controllen = 128;
+            h.msg_flags      = 0;
+        }
+
+        const int n = recvmmsg(rx.fd, msgs.data(), (unsigned)vlen, MSG_WAITFORONE, nullptr);
+        if (n <= 0) continue; // timeout(EAGAIN) -> running 확인
+        rx.calls.fetch_add(1, std::memory_order_relaxed);
+
+        const uint64_t now_ns = realtime_ns();
+        int n_echo = 0;
+        for (int i = 0; i < n; i++) {
+            msghdr &h = msgs[i].msg_hdr;
+
+            uint64_t rx_ns = now_ns;
+            for (cmsghdr *c = CMSG_FIRSTHDR(&h); c; c = CMSG_NXTHDR(&h, c)) {
+                if (c->cmsg_level != SOL_SOCKET) continue;
+                if (c->cmsg_type == SO_TIMESTAMPNS) {
+                    timespec ts;
+                    std::memcpy(&ts, CMSG_DATA(c), sizeof(ts));
+                    rx_ns = (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+                } else if (c->cmsg_type == SO_RXQ_OVFL) {
+                    uint32_t ovfl; // socket 누적 drop 수 (0이면 cmsg 없음)
+                    std::memcpy(&ovfl, CMSG_DATA(c), sizeof(ovfl));
+                    rx.kernel_drops.store(ovfl, std::memory_order_relaxed);
+                }
+            }
+
+            if (cfg_.echo) {
+                uint8_t *e = &echo_buf[(size_t)n_echo * LAT_ECHO_SIZE];
+                if (lat_probe_make_echo((const uint8_t *)iov[i].iov_base, msgs[i].msg_len, e)) {
+                    echo_iov[n_echo] = iovec{e, LAT_ECHO_SIZE};
+                    msghdr &eh = echo_msgs[n_echo].msg_hdr;
+                    std::memset(&eh, 0, sizeof(eh));
+                    eh.msg_name    = &from[i];
+                    eh.msg_namelen = sizeof(sockaddr_in);
+                    eh.msg_iov     = &echo_iov[n_echo];
+                    eh.msg_iovlen  = 1;
+                    echo_rx_ns[n_echo] = rx_ns;
+                    n_echo++;
+                }
+            }
+
+            const uint32_t ip   = from[i].sin_addr.s_addr;
+            const uint16_t port = ntohs(from[i].sin_port);
+            SpscRing<Packet> &ring = *rx.rings[(size_t)shard_of(ip, port, nw)];
+
+            Packet *p = ring.acquire();
+            if (!p) {
+                rx.ring_drops.fetch_add(1, std::memory_order_relaxed);
+                continue;
+            }
+            p->src_ip   = ip;
+            p->src_port = port;
+            p->len      = (uint16_t)msgs[i].msg_len;
+            p->rx_ns    = rx_ns;
+            std::memcpy(p->data, iov[i].iov_base, p->len);
+            ring.commit();
+        }
+
+        if (n_echo > 0) {
+            const int sent = sendmmsg(rx.fd, echo_msgs.data(), (unsigned)n_echo, 0);
+            const uint64_t done = realtime_ns();
+            for (int i = 0; i < sent; i++) rx.echo_lat.add(done > echo_rx_ns[i] ? done - echo_rx_ns[i] : 0);
+            if (sent > 0) rx.echoes.fetch_add((uint64_t)sent, std::memory_order_relaxed);
+        }
+    }
+}
+
+void Collector::handle_packet(Worker &w, const Packet &pkt) {
+    const char *data = pkt.data;
+    size_t len = pkt.len;
+
+    // ARQ framing (udp_arq): DATA는 header 제거, 피드백은 무시 (재전송 요청은 gy63_arq_rx 담당)
+    if (arq_is_packet((const uint8_t *)data, len)) {
+        if ((uint8_t)data[1] != ARQ_TYPE_DATA) return;
+        data += ARQ_HDR_SIZE;
+        len  -= ARQ_HDR_SIZE;
+    }
+
+    NodeStats &node = w.nodes[node_key(pkt.src_ip, pkt.src_port)];
+    if (node.packets == 0) {
+        node.src_ip   = pkt.src_ip;
+        node.src_port = pkt.src_port;
+    }
+    node.packets++;
+
+    if (tlm_raw_is_frame((const uint8_t *)data, len)) {
+        handle_raw(w, node, pkt, (const uint8_t *)data, len);
+        return;
+    }
+
+    uint64_t n_samples = 0, n_stat = 0, n_bad = 0;
+    bool have_hdr = false;
+    tlm::Record hdr{};
+    double first_ms = -1.0; // datagram 첫 샘플 device ms (jitter)
+
+    tlm::for_each_line(data, len, [&](tlm::Kind kind, const tlm::Record &r, const char *, size_t) {
+        switch (kind) {
+        case tlm::Kind::Packet:
+            have_hdr = true;
+            hdr = r;
+            if (r.fields & tlm::F_UID) node.uid = r.uid;    // 같은 datagram 샘플부터 uid로 (sample_fn)
+            break;
+        case tlm::Kind::Sample:
+            if (first_ms < 0) first_ms = (double)r.ms;
+            node.last_ms     = r.ms;
+            node.last_t_x100 = r.t_x100;
+            node.last_p_pa   = r.p_pa;
+            n_samples++;
+            if (sample_fn_) sample_fn_(w.index, node, r);
+            break;
+        case tlm::Kind::Stat:
+            n_stat++;
+            break;
+        case tlm::Kind::Bad:
+            n_bad++;
+            break;
+        }
+    });
+
+    if (have_hdr) {
+        node.seq.on_packet(hdr.boot, hdr.seq, (double)pkt.rx_ns / 1e6, first_ms);
+    } else {
+        node.no_hdr++;
+    }
+
+    node.samples += n_samples;
+    node.stats   += n_stat;
+    node.bad     += n_bad;
+
+    w.datagrams.fetch_add(1, std::memory_order_relaxed);
+    w.samples.fetch_add(n_samples, std::memory_order_relaxed);
+    w.stat_lines.fetch_add(n_stat, std::memory_order_relaxed);
+    w.bad_lines.fetch_add(n_bad, std::memory_order_relaxed);
+
+    const uint64_t done = realtime_ns();
+    w.lat.add(done > pkt.rx_ns ? done - pkt.rx_ns : 0);
+}
+
+// raw passthrough frame: PROM으로 보상 -> 텍스트 샘플과 같은 경로 (node 집계 + sample_fn)
+void Collector::handle_raw(Worker &w, NodeStats &node, const Packet &pkt, const uint8_t *data, size_t len) {
+    uint64_t n_samples = 0;
+    double first_ms = -1.0;
+    tlm_raw_info_t info{};
+
+    const bool ok = node.raw.on_frame(data, len, info, [&](const tlm::Record &r) {
+        if (first_ms < 0) first_ms = (double)r.ms;
+        node.last_ms     = r.ms;
+        node.last_t_x100 = r.t_x100;
+        node.last_p_pa   = r.p_pa;
+        n_samples++;
+        if (sample_fn_) sample_fn_(w.index, node, r);
+    });
+
+    if (ok) {
+        // PROM 대기 중 보관된 frame이 풀리면 first_ms는 이전 frame 것 -> jitter에는 이번 frame 시각만
+        node.seq.on_packet(info.boot, info.seq, (double)pkt.rx_ns / 1e6,
+                           info.type == TLM_RAW_T_SAMPLES ? (double)info.base_ms : -1.0);
+        w.raw_frames.fetch_add(1, std::memory_order_relaxed);
+        if (node.raw.need_prom()) request_prom(w, node, pkt.rx_ns);
+    } else {
+        node.bad++;
+        w.bad_lines.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    node.samples += n_samples;
+    w.datagrams.fetch_add(1, std::memory_order_relaxed);
+    w.samples.fetch_add(n_samples, std::memory_order_relaxed);
+
+    const uint64_t done = realtime_ns();
+    w.lat.add(done > pkt.rx_ns ? done - pkt.rx_ns : 0);
+}
+
+// 장치 control channel로 PROM 재송신 요청 (node당 1초에 1회)
+void Collector::request_prom(Worker &w, NodeStats &node, uint64_t now_ns) {
+    constexpr uint64_t kIntervalNs = 1000000000ull;
+    if (cfg_.prom_req_port == 0) return;
+    if (node.prom_req && now_ns - node.prom_req_ns < kIntervalNs) return;
+
+    if (w.req_fd < 0) w.req_fd = socket(AF_INET, SOCK_DGRAM, 0);
+    if (w.req_fd < 0) return;
+
+    char msg[48];
+    const int n = std::snprintf(msg, sizeof(msg), "cmd=prom,id=%llu\n", (unsigned long long)(node.prom_req + 1));
+    sockaddr_in a{};
+    a.sin_family      = AF_INET;
+    a.sin_port        = htons(cfg_.prom_req_port);
+    a.sin_addr.s_addr = node.src_ip;
+    (void)sendto(w.req_fd, msg, (size_t)n, 0, (const sockaddr *)&a, sizeof(a));
+
+    node.prom_req++;
+    node.prom_req_ns = now_ns;
+    w.prom_reqs.fetch_add(1, std::memory_order_relaxed);
+}
+
+void Collector::worker_loop(Worker &w) {
+    uint32_t idle = 0;
+    while (true) {
+        bool any = false;
+        for (SpscRing<Packet> *ring : w.rings) {
+            // ring 하나가 독점하지 않도록 한 번에 최대 64개
+            for (int k = 0; k < 64; k++) {
+                Packet *p = ring->front();
+                if (!p) break;
+                handle_packet(w, *p);
+                ring->pop();
+                any = true;
+            }
+        }
+
+        if (any) {
+            idle = 0;
+            continue;
+        }
+        if (rx_done_.load(std::memory_order_acquire)) {
+            // rx 종료 이후 잔량 확인
+            bool empty = true;
+            for (SpscRing<Packet> *ring : w.rings) empty = empty && !ring->front();
+            if (empty) return;
+            continue;
+        }
+
+        // spin -> yield -> sleep (idle CPU 낭비 방지)
+        if (++idle < 64)        continue;
+        else if (idle < 256)    std::this_thread::yield();
+        else                    std::this_thread::sleep_for(std::chrono::microseconds(50));
+    }
+}
+
+Totals Collector::totals() const {
+    Totals t;
+    for (const auto &r : rx_) {
+        t.ring_drops   += r->ring_drops.load(std::memory_order_relaxed);
+        t.kernel_drops += r->kernel_drops.load(std::memory_order_relaxed);
+        t.rx_calls     += r->calls.load(std::memory_order_relaxed);
+        t.echoes       += r->echoes.load(std::memory_order_relaxed);
+    }
+    for (const auto &w : workers_) {
+        t.datagrams  += w->datagrams.load(std::memory_order_relaxed);
+        t.samples    += w->samples.load(std::memory_order_relaxed);
+        t.stat_lines += w->stat_lines.load(std::memory_order_relaxed);
+        t.bad_lines  += w->bad_lines.load(std::memory_order_relaxed);
+        t.raw_frames += w->raw_frames.load(std::memory_order_relaxed);
+        t.prom_reqs  += w->prom_reqs.load(std::memory_order_relaxed);
+        if (!running_.load()) t.nodes += w->nodes.size();
+    }
+    return t;
+}
+
+LatencyHist Collector::latency() const {
+    LatencyHist h;
+    if (running_.load()) return h;
+    for (const auto &w : workers_) h.merge(w->lat);
+    return h;
+}
+
+LatencyHist Collector::echo_latency() const {
+    LatencyHist h;
+    if (running_.load()) return h;
+    for (const auto &r : rx_) h.merge(r->echo_lat);
+    return h;
+}
+
+std::vector<NodeStats> Collector::nodes() const {
+    std::vector<NodeStats> out;
+    if (running_.load()) return out;
+    for (const auto &w : workers_) {
+        for (const auto &kv : w->nodes) out.push_back(kv.second);
+    }
+    return out;
+}
+
+} // namespace ingest
@@ -0,0 +1,135 @@
+// FILE: host/ingest/ingest.h
+#ifndef __INGEST_H__
+#define __INGEST_H__
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "latency_hist.h"
+#include "raw_tlm.h"
+#include "seq_stats.h"
+#include "spsc_ring.h"
+#include "tlm_line.h"
+
+// telemetry UDP collector
+//
+//   rx thread (recvmmsg batch, SO_REUSEPORT로 N개)
+//     -> source(ip:port) hash로 shard 선택 -> SPSC ring [rx][worker] (lock-free)
+//     -> (옵션) header seq echo를 batch로 즉시 송신 (worker 대기 없이, latency 진단)
+//   worker thread (shard 담당)
+//     -> line 파싱 (tlm_line.h, allocation-free) -> node별 집계 + sample callback
+//
+// 같은 source는 항상 같은 worker -> node 상태에 lock 불필요, node 내 순서 유지
+namespace ingest {
+
+constexpr size_t kMaxDatagram = 1536;   // firmware batch(16 x 64 B) + ARQ header 여유
+
+struct Packet {
+    uint32_t src_ip;        // network byte order
+    uint16_t src_port;      // host byte order
+    uint16_t len;
+    uint64_t rx_ns;         // kernel 수신 시각 (CLOCK_REALTIME, SO_TIMESTAMPNS)
+    char     data[kMaxDatagram];
+};
+
+inline uint64_t node_key(uint32_t ip, uint16_t port) {
+    return ((uint64_t)ip << 16) | port;
+}
+
+struct NodeStats {
+    uint32_t src_ip   = 0;
+    uint16_t src_port = 0;
+    uint64_t packets  = 0;
+    uint64_t samples  = 0;
+    uint64_t stats    = 0;      // stat= 줄
+    uint64_t bad      = 0;      // 파싱 실패 줄
+    uint64_t last_ms  = 0;      // 마지막 샘플의 device ms
+    int32_t  last_t_x100 = 0;
+    uint32_t last_p_pa   = 0;
+
+    // datagram header (pkt=) 가 있는 경우
+    uint64_t uid      = 0;
+    uint64_t no_hdr   = 0;      // header 없는 datagram (구 firmware)
+    SeqStats seq;
+
+    // raw passthrough (D1/D2 frame -> host 보상)
+    RawDecoder raw;
+    uint64_t prom_req    = 0;   // 장치에 보낸 "cmd=prom" 요청
+    uint64_t prom_req_ns = 0;
+};
+
+struct Config {
+    uint16_t port       = 5005;
+    int      rx_threads = 1;
+    int      workers    = 4;
+    int      batch      = 64;       // recvmmsg vlen
+    size_t   ring_slots = 4096;     // worker ring 당 (2의 거듭제곱)
+    int      rcvbuf     = 16 << 20;
+    bool     echo       = false;    // latency 진단: header seq를 송신측으로 echo (lat_probe.h)
+    uint16_t prom_req_port = 5007;  // raw frame인데 PROM이 없으면 장치 control port로 "cmd=prom" (0: 요청 안 함)
+};
+
+// worker 컨텍스트에서 샘플마다 호출 (worker index, node, record). 짧게 끝낼 것
+using SampleFn = std::function<void(int worker, const NodeStats &node, const tlm::Record &rec)>;
+
+struct Totals {
+    uint64_t datagrams   = 0;   // worker가 처리한 datagram
+    uint64_t samples     = 0;
+    uint64_t stat_lines  = 0;
+    uint64_t bad_lines   = 0;
+    uint64_t ring_drops  = 0;   // worker ring 가득 참
+    uint64_t kernel_drops = 0;  // socket 수신 버퍼 overflow (SO_RXQ_OVFL)
+    uint64_t rx_calls    = 0;   // recvmmsg 호출 수
+    uint64_t echoes      = 0;   // 송신한 echo (Config::echo)
+    uint64_t raw_frames  = 0;   // raw passthrough frame (PROM 포함)
+    uint64_t prom_reqs   = 0;
+    size_t   nodes       = 0;
+};
+
+class Collector {
+public:
+    explicit Collector(const Config &cfg);
+    ~Collector();
+
+    void set_sample_fn(SampleFn fn) { sample_fn_ = std::move(fn); }
+
+    bool start();       // socket bind + thread 시작
+    void stop();        // thread 종료 (ring 잔량 처리 후)
+
+    // 실행 중 호출 가능 (atomic counter 합산; nodes는 stop 후에만 정확)
+    Totals totals() const;
+
+    // stop 후: worker latency(kernel 수신 -> 파싱 완료, ns) 합산 / node 목록
+    LatencyHist latency() const;
+
+    // stop 후: echo turnaround (kernel 수신 -> echo sendmmsg 완료, ns)
+    LatencyHist echo_latency() const;
+    std::vector<NodeStats> nodes() const;
+
+private:
+    struct Worker;
+    struct Rx;
+
+    void rx_loop(Rx &rx);
+    void worker_loop(Worker &w);
+    void handle_packet(Worker &w, const Packet &pkt);
+    void handle_raw(Worker &w, NodeStats &node, const Packet &pkt, const uint8_t *data, size_t len);
+    void request_prom(Worker &w, NodeStats &node, uint64_t now_ns);
+
+    Config cfg_;
+    SampleFn sample_fn_;
+    std::atomic<bool> running_{false};
+    std::atomic<bool> rx_done_{false};
+
+    std::vector<std::unique_ptr<Rx>> rx_;
+    std::vector<std::unique_ptr<Worker>> workers_;
+};
+
+} // namespace ingest
+
+#endif // __INGEST_H__
@@ -0,0 +1,86 @@
+// FILE: host/ingest/latency_hist.h
+#ifndef __LATENCY_HIST_H__
+#define __LATENCY_HIST_H__
+
+#include <cstdint>
+#include <cstring>
+
+// 고정 메모리 latency histogram (log2 구간 x 16 선형 sub-bucket, 상대 오차 < 6.25%)
+// 값 단위는 호출자 몫 (ns, us, ...). 0 ~ 2^63 범위.
+namespace ingest {
+
+class LatencyHist {
+public:
+    static constexpr int kSub    = 16;
+    static constexpr int kShift  = 4;   // log2(kSub)
+    static constexpr int kBucket = (64 - kShift + 1) * kSub;
+
+    LatencyHist() { reset(); }
+
+    void reset() {
+        std::memset(counts_, 0, sizeof(counts_));
+        n_ = 0;
+        max_ = 0;
+        sum_ = 0;
+    }
+
+    void add(uint64_t v) {
+        counts_[index(v)]++;
+        n_++;
+        sum_ += (double)v;
+        if (v > max_) max_ = v;
+    }
+
+    void merge(const LatencyHist &o) {
+        for (int i = 0; i < kBucket; i++) counts_[i] += o.counts_[i];
+        n_ += o.n_;
+        sum_ += o.sum_;
+        if (o.max_ > max_) max_ = o.max_;
+    }
+
+    uint64_t count() const { return n_; }
+    uint64_t max() const { return max_; }
+    double mean() const { return n_ ? sum_ / (double)n_ : 0.0; }
+
+    // q in [0,1]. bucket 상한값 리턴 (보수적)
+    uint64_t percentile(double q) const {
+        if (n_ == 0) return 0;
+        uint64_t want = (uint64_t)(q * (double)n_);
+        if (want >= n_) want = n_ - 1;
+        uint64_t acc = 0;
+        for (int i = 0; i < kBucket; i++) {
+            acc += counts_[i];
+            if (acc > want) {
+                const uint64_t hi = upper(i);
+                return hi < max_ ? hi : max_;
+            }
+        }
+        return max_;
+    }
+
+private:
+    static int index(uint64_t v) {
+        if (v < (uint64_t)kSub) return (int)v;
+        const int msb = 63 - __builtin_clzll(v);
+        const int exp = msb - kShift + 1;
+        const int sub = (int)((v >> (msb - kShift)) & (kSub - 1));
+        return exp * kSub + sub;
+    }
+
+    static uint64_t upper(int i) {
+        const int exp = i / kSub;
+        const int sub = i % kSub;
+        if (exp == 0) return (uint64_t)sub;
+        const int shift = exp - 1;
+        return (((uint64_t)(kSub + sub + 1)) << shift) - 1;
+    }
+
+    uint64_t counts_[kBucket];
+    uint64_t n_;
+    uint64_t max_;
+    double   sum_;
+};
+
+} // namespace ingest
+
+#endif // __LATENCY_HIST_H__
@@ -0,0 +1,124 @@
+// FILE: host/ingest/raw_tlm.h
+#ifndef __RAW_TLM_H__
+#define __RAW_TLM_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "tlm_line.h"
+
+extern "C" {
+#include "ms5611_math.h"
+#include "tlm_raw.h"
+}
+
+// raw passthrough telemetry (src/core/tlm_raw.h) host 보상
+//
+// - node당 1개. PROM frame으로 session(boot)의 계수를 적재 -> SAMPLES frame을 ms5611_compensate로 보상
+//   (firmware ms5611_read와 같은 C code -> t_x100 / p_pa bit 동일)
+// - PROM이 아직 없는 session의 frame은 kPending개까지 보관했다가 PROM 도착 시 보상 (넘치면 오래된 것부터 drop)
+// - need_prom()이면 호출자가 장치에 "cmd=prom" 요청 (Collector: Config::prom_req_port)
+namespace ingest {
+
+class RawDecoder {
+public:
+    static constexpr size_t kPending = 32;     // frame
+
+    struct Stats {
+        uint64_t frames      = 0;   // 유효 frame (PROM 포함)
+        uint64_t proms       = 0;
+        uint64_t samples     = 0;   // 보상 완료
+        uint64_t comp_errors = 0;   // ms5611_compensate 범위 오류
+        uint64_t bad         = 0;   // CRC/형식 오류
+        uint64_t no_prom     = 0;   // PROM 없이 drop된 샘플
+        uint64_t bad_prom    = 0;   // CRC4 불일치 PROM
+    };
+
+    // datagram 1개. 보상된 샘플마다 fn(record), record.boot = session. 형식 오류면 false
+    template <typename Fn>
+    bool on_frame(const uint8_t *buf, size_t len, tlm_raw_info_t &info, Fn &&fn) {
+        if (tlm_raw_parse(buf, len, &info) <= 0) {
+            st_.bad++;
+            return false;
+        }
+        st_.frames++;
+
+        if (info.type == TLM_RAW_T_PROM) {
+            uint16_t prom[8];
+            tlm_raw_get_prom(buf, prom);
+            if (ms5611_prom_validate(prom) != MS5611_OK) {
+                st_.bad_prom++;
+                return true;
+            }
+            ms5611_load_coeffs(prom, &c_);
+            have_ = true;
+            boot_ = info.boot;
+            st_.proms++;
+            replay_pending(fn);
+            return true;
+        }
+
+        if (!have_ || boot_ != info.boot) hold(buf, len);
+        else emit(buf, info, fn);
+        return true;
+    }
+
+    // 현재 frame의 session에 PROM이 없음
+    bool need_prom() const { return !pending_.empty(); }
+    uint32_t session() const { return boot_; }
+    const Stats &stats() const { return st_; }
+
+private:
+    template <typename Fn>
+    void emit(const uint8_t *buf, const tlm_raw_info_t &info, Fn &&fn) {
+        for (uint8_t i = 0; i < info.count; i++) {
+            uint64_t ms = 0;
+            uint32_t d1 = 0, d2 = 0;
+            tlm_raw_sample(buf, &info, i, &ms, &d1, &d2);
+
+            tlm::Record r{};
+            if (ms5611_compensate(&c_, d1, d2, &r.t_x100, &r.p_pa) != MS5611_OK) {
+                st_.comp_errors++;
+                continue;
+            }
+            r.ms     = ms;
+            r.boot   = info.boot;
+            r.seq    = info.seq;
+            r.fields = tlm::F_SAMPLE | tlm::F_BOOT | tlm::F_SEQ;
+            st_.samples++;
+            fn(r);
+        }
+    }
+
+    template <typename Fn>
+    void replay_pending(Fn &&fn) {
+        std::vector<std::vector<uint8_t>> keep;
+        for (auto &f : pending_) {
+            tlm_raw_info_t info;
+            if (tlm_raw_parse(f.data(), f.size(), &info) <= 0) continue;
+            if (info.boot == boot_) emit(f.data(), info, fn);
+            else keep.push_back(std::move(f));     // 다른 session (PROM 대기 계속)
+        }
+        pending_.swap(keep);
+    }
+
+    void hold(const uint8_t *buf, size_t len) {
+        if (pending_.size() >= kPending) {
+            tlm_raw_info_t old;
+            if (tlm_raw_parse(pending_.front().data(), pending_.front().size(), &old) > 0) st_.no_prom += old.count;
+            pending_.erase(pending_.begin());
+        }
+        pending_.emplace_back(buf, buf + len);
+    }
+
+    ms5611_coeffs_t c_{};
+    bool     have_     = false;
+    uint32_t boot_     = 0;
+    std::vector<std::vector<uint8_t>> pending_;
+    Stats    st_;
+};
+
+} // namespace ingest
+
+#endif // __RAW_TLM_H__
@@ -0,0 +1,93 @@
+// FILE: host/ingest/seq_stats.cpp
+#include "seq_stats.h"
+
+#include <cmath>
+
+namespace ingest {
+
+void SeqStats::start_boot(uint32_t boot_id, uint32_t seq) {
+    if (started_) {
+        prev_expected_ += (uint64_t)(highest_ - first_) + 1u;
+        prev_received_ += received_;
+    }
+    started_  = true;
+    boot_id_  = boot_id;
+    first_    = seq;
+    highest_  = seq;
+    bits_     = 1;
+    received_ = 1;
+    boots_++;
+
+    // device 시계도 boot와 함께 0부터 -> transit 기준 재설정
+    have_transit_ = false;
+}
+
+void SeqStats::on_packet(uint32_t boot_id, uint32_t seq, double rx_ms, double dev_ms) {
+    bool in_order = true;
+
+    if (!started_ || boot_id != boot_id_) {
+        start_boot(boot_id, seq);
+    } else {
+        const int32_t d = (int32_t)(seq - highest_);
+        if (d > 0) {
+            bits_ = ((uint32_t)d >= kWindow) ? 0 : (bits_ << d);
+            bits_ |= 1;
+            highest_ = seq;
+            received_++;
+        } else if (d == 0) {
+            duplicates_++;
+            return;
+        } else {
+            const uint32_t depth = (uint32_t)(-(int64_t)d);
+            if ((int32_t)(seq - first_) < 0) {
+                // boot 첫 관측 seq보다 앞 (수신 시작 전 송신분이 늦게 도착) -> 범위 확장
+                first_ = seq;
+            }
+            if (depth < kWindow) {
+                const uint64_t bit = 1ull << depth;
+                if (bits_ & bit) {
+                    duplicates_++;
+                    return;
+                }
+                bits_ |= bit;
+            } else {
+                late_++;
+            }
+            received_++;
+            reordered_++;
+            if (depth > max_depth_) max_depth_ = depth;
+            in_order = false;
+        }
+    }
+
+    // jitter: 재정렬 packet은 transit 기준을 흐리므로 제외
+    if (in_order && dev_ms >= 0) {
+        const double transit = rx_ms - dev_ms;
+        if (have_transit_) {
+            const double dd = std::fabs(transit - last_transit_);
+            jitter_ += (dd - jitter_) / 16.0;
+        }
+        last_transit_ = transit;
+        have_transit_ = true;
+    }
+}
+
+SeqStats::Snapshot SeqStats::snapshot() const {
+    Snapshot s;
+    if (!started_) return s;
+
+    const uint64_t exp_cur = (uint64_t)(highest_ - first_) + 1u;
+    s.expected   = prev_expected_ + exp_cur;
+    s.received   = prev_received_ + received_;
+    s.lost       = s.expected > s.received ? s.expected - s.received : 0;
+    s.duplicates = duplicates_;
+    s.reordered  = reordered_;
+    s.late       = late_;
+    s.max_reorder_depth = max_depth_;
+    s.boots      = boots_;
+    s.boot_id    = boot_id_;
+    s.jitter_ms  = jitter_;
+    return s;
+}
+
+} // namespace ingest
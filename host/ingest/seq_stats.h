@@ -0,0 +1,68 @@
+// FILE: host/ingest/seq_stats.h
+#ifndef __SEQ_STATS_H__
+#define __SEQ_STATS_H__
+
+#include <cstdint>
+
+// node별 datagram sequence 통계 (고정 메모리, node당 ~100 B)
+//
+// 입력: datagram header (src/core/tlm_hdr.h) 의 boot/seq + 수신 시각 + (있으면) 첫 샘플 device ms
+// - loss     : (최고 seq - 첫 seq + 1) - 고유 수신 수. 늦게 도착하면 다시 줄어듦
+// - reorder  : 최고 seq보다 작은 seq가 처음 도착 (depth = 최고 seq - seq)
+// - duplicate: kWindow 안에서 이미 받은 seq 재도착
+// - late     : kWindow보다 오래된 seq (중복 여부 판정 불가, 수신으로 계산)
+// - jitter   : RFC 3550 interarrival jitter (transit = 수신 ms - device ms, 1/16 평활)
+// boot가 바뀌면 seq 추적을 새로 시작하고 이전 boot의 loss는 누적값으로 이관
+namespace ingest {
+
+class SeqStats {
+public:
+    static constexpr uint32_t kWindow = 64;    // 중복 판정 bitmap 폭
+
+    struct Snapshot {
+        uint64_t received   = 0;    // 고유 seq (late 포함)
+        uint64_t expected   = 0;
+        uint64_t lost       = 0;
+        uint64_t duplicates = 0;
+        uint64_t reordered  = 0;
+        uint64_t late       = 0;
+        uint32_t max_reorder_depth = 0;
+        uint32_t boots      = 0;    // 관측된 boot 수
+        uint32_t boot_id    = 0;    // 현재 boot
+        double   jitter_ms  = 0;
+
+        double loss_rate() const { return expected ? (double)lost / (double)expected : 0.0; }
+    };
+
+    // rx_ms: 수신 시각 (host, ms 단위 실수). dev_ms < 0 이면 jitter 갱신 안 함
+    void on_packet(uint32_t boot_id, uint32_t seq, double rx_ms, double dev_ms);
+
+    Snapshot snapshot() const;
+
+private:
+    void start_boot(uint32_t boot_id, uint32_t seq);
+
+    bool     started_ = false;
+    uint32_t boot_id_ = 0;
+    uint32_t first_   = 0;      // 현재 boot 첫 seq
+    uint32_t highest_ = 0;
+    uint64_t bits_    = 0;      // bit i: seq (highest_ - i) 수신
+
+    uint64_t received_   = 0;   // 현재 boot
+    uint64_t prev_expected_ = 0;    // 지난 boot들 누적
+    uint64_t prev_received_ = 0;
+
+    uint64_t duplicates_ = 0;
+    uint64_t reordered_  = 0;
+    uint64_t late_       = 0;
+    uint32_t max_depth_  = 0;
+    uint32_t boots_      = 0;
+
+    bool   have_transit_ = false;
+    double last_transit_ = 0;
+    double jitter_       = 0;
+};
+
+} // namespace ingest
+
+#endif // __SEQ_STATS_H__
@@ -0,0 +1,62 @@
+// FILE: host/ingest/spsc_ring.h
+#ifndef __SPSC_RING_H__
+#define __SPSC_RING_H__
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+// single-producer / single-consumer lock-free ring (고정 용량, 2의 거듭제곱)
+// - slot을 직접 빌려주는 API (acquire/commit, front/pop) -> 큰 T도 복사 1회
+// - head/tail은 서로 다른 cache line
+namespace ingest {
+
+template <typename T>
+class SpscRing {
+public:
+    explicit SpscRing(size_t capacity_pow2)
+        : mask_(capacity_pow2 - 1), slots_(new T[capacity_pow2]) {}
+
+    SpscRing(const SpscRing &) = delete;
+    SpscRing &operator=(const SpscRing &) = delete;
+
+    size_t capacity() const { return mask_ + 1; }
+
+    // producer: 비어 있는 slot (가득 차면 nullptr)
+    T *acquire() {
+        const size_t h = head_.load(std::memory_order_relaxed);
+        if (h - tail_cache_ > mask_) {
+            tail_cache_ = tail_.load(std::memory_order_acquire);
+            if (h - tail_cache_ > mask_) return nullptr;
+        }
+        return &slots_[h & mask_];
+    }
+
+    void commit() { head_.store(head_.load(std::memory_order_relaxed) + 1, std::memory_order_release); }
+
+    // consumer: 가장 오래된 slot (비었으면 nullptr)
+    T *front() {
+        const size_t t = tail_.load(std::memory_order_relaxed);
+        if (t == head_cache_) {
+            head_cache_ = head_.load(std::memory_order_acquire);
+            if (t == head_cache_) return nullptr;
+        }
+        return &slots_[t & mask_];
+    }
+
+    void pop() { tail_.store(tail_.load(std::memory_order_relaxed) + 1, std::memory_order_release); }
+
+private:
+    const size_t mask_;
+    std::unique_ptr<T[]> slots_;
+
+    alignas(64) std::atomic<size_t> head_{0};
+    size_t tail_cache_ = 0;     // producer 전용
+    alignas(64) std::atomic<size_t> tail_{0};
+    size_t head_cache_ = 0;     // consumer 전용
+};
+
+} // namespace ingest
+
+#endif // __SPSC_RING_H__
@@ -0,0 +1,184 @@
+// FILE: host/ingest/tlm_line.h
+#ifndef __TLM_LINE_H__
+#define __TLM_LINE_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// telemetry text line parser (allocation-free, locale 무관)
+//
+//   "ms=%llu,t_x100=%ld,p_pa=%u\n"       샘플 1줄 (firmware format_sample)
+//   "stat=<kind>,ms=..,..."               상태 줄 (kind만 추출, 나머지는 호출자 몫)
+//   "pkt=<seq>,boot=<hex>,uid=<hex>"      datagram header 줄 (src/core/tlm_hdr.h)
+//
+// - key 순서 무관, 모르는 key는 skip (firmware가 field를 추가해도 깨지지 않음)
+// - 한 datagram에 여러 줄 (batch) 가능
+namespace tlm {
+
+enum : uint32_t {
+    F_MS     = 1u << 0,
+    F_T      = 1u << 1,
+    F_P      = 1u << 2,
+    F_SEQ    = 1u << 3,
+    F_BOOT   = 1u << 4,
+    F_UID    = 1u << 5,
+    F_SAMPLE = F_MS | F_T | F_P,  // 샘플로 인정되는 최소 집합
+};
+
+struct Record {
+    uint64_t ms;
+    int32_t  t_x100;
+    uint32_t p_pa;
+    uint32_t seq;       // header 줄
+    uint32_t boot;
+    uint64_t uid;
+    uint32_t fields;    // F_* (파싱된 key)
+};
+
+enum class Kind { Sample, Stat, Packet, Bad };
+
+// 10진 부호 없는 정수. 빈 값/숫자 아님/overflow면 false
+inline bool parse_u64(const char *p, const char *end, uint64_t &out) {
+    if (p == end || end - p > 20) return false;
+    uint64_t v = 0;
+    for (; p < end; p++) {
+        const uint32_t d = (uint32_t)(unsigned char)*p - '0';
+        if (d > 9) return false;
+        if (v > (UINT64_MAX - d) / 10u) return false;
+        v = v * 10u + d;
+    }
+    out = v;
+    return true;
+}
+
+inline bool parse_u32(const char *p, const char *end, uint32_t &out) {
+    uint64_t v;
+    if (!parse_u64(p, end, v) || v > UINT32_MAX) return false;
+    out = (uint32_t)v;
+    return true;
+}
+
+inline bool parse_i32(const char *p, const char *end, int32_t &out) {
+    bool neg = false;
+    if (p < end && *p == '-') { neg = true; p++; }
+    uint64_t v;
+    if (!parse_u64(p, end, v)) return false;
+    if (neg ? v > 2147483648ull : v > 2147483647ull) return false;
+    out = neg ? (int32_t)(0 - v) : (int32_t)v;
+    return true;
+}
+
+// 16진 (대소문자), 최대 16자리
+inline bool parse_hex(const char *p, const char *end, uint64_t &out) {
+    if (p == end || end - p > 16) return false;
+    uint64_t v = 0;
+    for (; p < end; p++) {
+        const char c = *p;
+        uint32_t d;
+        if (c >= '0' && c <= '9')      d = (uint32_t)(c - '0');
+        else if (c >= 'a' && c <= 'f') d = (uint32_t)(c - 'a' + 10);
+        else if (c >= 'A' && c <= 'F') d = (uint32_t)(c - 'A' + 10);
+        else return false;
+        v = (v << 4) | d;
+    }
+    out = v;
+    return true;
+}
+
+inline bool key_is(const char *k, size_t n, const char *lit, size_t lit_n) {
+    if (n != lit_n) return false;
+    for (size_t i = 0; i < n; i++) {
+        if (k[i] != lit[i]) return false;
+    }
+    return true;
+}
+
+// 한 줄 [p, end) ('\n' 제외) 파싱.
+// Stat이면 stat_kind/stat_len에 kind 문자열 (line 내부 포인터)
+inline Kind parse_line(const char *p, const char *end, Record &out,
+                       const char **stat_kind = nullptr, size_t *stat_len = nullptr) {
+    out.fields = 0;
+    if (end > p && end[-1] == '\r') end--;
+
+    while (p < end) {
+        const char *k = p;
+        while (p < end && *p != '=' && *p != ',') p++;
+        if (p == end || *p != '=') return Kind::Bad;
+        const size_t kn = (size_t)(p - k);
+
+        const char *v = ++p;
+        while (p < end && *p != ',') p++;
+        const char *ve = p;
+        if (p < end) p++; // ','
+
+        switch (kn) {
+        case 2:
+            if (key_is(k, kn, "ms", 2)) {
+                if (!parse_u64(v, ve, out.ms)) return Kind::Bad;
+                out.fields |= F_MS;
+            }
+            break;
+        case 3:
+            if (key_is(k, kn, "pkt", 3) && out.fields == 0) {
+                if (!parse_u32(v, ve, out.seq)) return Kind::Bad;
+                out.fields |= F_SEQ;
+            } else if (key_is(k, kn, "uid", 3)) {
+                if (!parse_hex(v, ve, out.uid)) return Kind::Bad;
+                out.fields |= F_UID;
+            }
+            break;
+        case 4:
+            if (key_is(k, kn, "p_pa", 4)) {
+                if (!parse_u32(v, ve, out.p_pa)) return Kind::Bad;
+                out.fields |= F_P;
+            } else if (key_is(k, kn, "stat", 4) && out.fields == 0) {
+                if (stat_kind) *stat_kind = v;
+                if (stat_len)  *stat_len  = (size_t)(ve - v);
+                return Kind::Stat;
+            } else if (key_is(k, kn, "boot", 4)) {
+                uint64_t b;
+                if (!parse_hex(v, ve, b) || b > UINT32_MAX) return Kind::Bad;
+                out.boot = (uint32_t)b;
+                out.fields |= F_BOOT;
+            }
+            break;
+        case 6:
+            if (key_is(k, kn, "t_x100", 6)) {
+                if (!parse_i32(v, ve, out.t_x100)) return Kind::Bad;
+                out.fields |= F_T;
+            }
+            break;
+        default:
+            break; // 모르는 key
+        }
+    }
+
+    if (out.fields & F_SEQ) return Kind::Packet;
+    return ((out.fields & F_SAMPLE) == F_SAMPLE) ? Kind::Sample : Kind::Bad;
+}
+
+// datagram 안의 줄마다 fn(kind, record, stat_kind, stat_len). 빈 줄은 skip. 줄 수 리턴
+template <typename Fn>
+inline size_t for_each_line(const char *p, size_t len, Fn &&fn) {
+    const char *end = p + len;
+    size_t n = 0;
+    while (p < end) {
+        const char *nl = (const char *)std::memchr(p, '\n', (size_t)(end - p));
+        if (!nl) nl = end;
+        if (nl > p) {
+            Record r;
+            const char *sk = nullptr;
+            size_t sl = 0;
+            const Kind kind = parse_line(p, nl, r, &sk, &sl);
+            fn(kind, r, sk, sl);
+            n++;
+        }
+        p = nl + 1;
+    }
+    return n;
+}
+
+} // namespace tlm
+
+#endif // __TLM_LINE_H__
@@ -0,0 +1,410 @@
+// FILE: host/lwip/lwip_host.c
+#define _GNU_SOURCE
+#include "lwip_host.h"
+
+#include <pthread.h>
+#include <string.h>
+#include <time.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "lwip/etharp.h"
+#include "lwip/init.h"
+#include "lwip/memp.h"
+#include "lwip/netif.h"
+#include "lwip/pbuf.h"
+#include "lwip/stats.h"
+#include "lwip/sys.h"
+#include "lwip/timeouts.h"
+#include "netif/ethernet.h"
+#include "pico/cyw43_arch.h"
+
+#include "net_wifi.h"
+#include "platform_core.h"
+
+#define HOLD_MAX        (256u)
+#define ARP_PENDING_MAX (16u)
+#define ETH_HDR         (14u)
+#define ARP_FRAME       (42u)   // Ethernet 14 + ARP 28
+
+typedef struct {
+    bool     used;
+    uint32_t due_ms;
+    uint8_t  req_mac[6];
+    uint8_t  req_ip[4];
+    uint8_t  ip[4];             // 해석 요청된 주소 (peer가 이 주소로 응답)
+} arp_pending_t;
+
+static const uint8_t k_mac[6]  = {0x02, 0x63, 0x00, 0x00, 0x00, 0x01};
+static const uint8_t k_peer[6] = {0x02, 0x63, 0x00, 0x00, 0x00, 0x02};
+
+static lwip_host_cfg_t   s_cfg;
+static lwip_host_stats_t s_st;
+static struct netif      s_nif;
+static bool              s_init;
+static struct timespec   s_t0;
+
+static pthread_mutex_t s_lock = PTHREAD_MUTEX_INITIALIZER;
+static __thread uint32_t t_depth;   // thread별 중첩 (재귀 lock)
+
+static struct pbuf *s_hold[HOLD_MAX];
+static uint32_t     s_hold_head, s_hold_n;
+
+static arp_pending_t s_arp[ARP_PENDING_MAX];
+
+static int s_fwd_fd = -1;
+
+static lwip_host_udp_fn s_tap;
+static void            *s_tap_user;
+
+static pthread_t     s_bg;
+static volatile bool s_bg_run;
+
+// ---------- internal helpers ----------
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)(ts.tv_sec - s_t0.tv_sec) * 1000000000ull + (uint64_t)ts.tv_nsec - (uint64_t)s_t0.tv_nsec;
+}
+
+static void lock_take(bool count) {
+    if (t_depth++ > 0) return;
+
+    if (pthread_mutex_trylock(&s_lock) == 0) {
+        if (count) s_st.locks++;
+        return;
+    }
+    const uint64_t t0 = now_ns();
+    pthread_mutex_lock(&s_lock);
+    if (count) {
+        s_st.locks++;
+        s_st.lock_contended++;
+        s_st.lock_wait_ns += now_ns() - t0;
+    }
+}
+
+static void lock_give(void) {
+    if (--t_depth == 0) pthread_mutex_unlock(&s_lock);
+}
+
+static void on_arp(const uint8_t *f, size_t len) {
+    if (len < ARP_FRAME) return;
+    const uint16_t op = (uint16_t)((f[20] << 8) | f[21]);
+    if (op != 1) return;
+    s_st.arp_req++;
+
+    // 자기 주소 (gratuitous / 충돌 검사)는 응답 안 함
+    if (memcmp(f + 38, &netif_ip4_addr(&s_nif)->addr, 4) == 0) return;
+
+    for (uint32_t i = 0; i < ARP_PENDING_MAX; i++) {
+        arp_pending_t *a = &s_arp[i];
+        if (a->used) continue;
+        a->used   = true;
+        a->due_ms = sys_now() + s_cfg.arp_delay_ms;
+        memcpy(a->req_mac, f + 22, 6);
+        memcpy(a->req_ip, f + 28, 4);
+        memcpy(a->ip, f + 38, 4);
+        return;
+    }
+}
+
+static void on_ipv4(const uint8_t *ip, size_t len) {
+    if (len < 20u || ip[9] != 17u) return;
+    s_st.tx_udp++;
+
+    // 길이 일관성: IP total == frame, UDP length == IP payload
+    const size_t ihl   = (size_t)(ip[0] & 0x0Fu) * 4u;
+    const size_t total = (size_t)((ip[2] << 8) | ip[3]);
+    if (ihl < 20u || total != len || len < ihl + 8u) {
+        s_st.udp_bad_len++;
+        return;
+    }
+
+    const uint8_t *u = ip + ihl;
+    const size_t n = (size_t)((u[4] << 8) | u[5]);
+    if (n < 8u || ihl + n != total) {
+        s_st.udp_bad_len++;
+        return;
+    }
+
+    if (s_tap) {
+        uint32_t dst;
+        memcpy(&dst, ip + 16, 4);
+        s_tap(dst, (uint16_t)((u[2] << 8) | u[3]), u + 8, n - 8u, s_tap_user);
+    }
+
+    if (s_fwd_fd < 0) return;
+
+    struct sockaddr_in a;
+    memset(&a, 0, sizeof(a));
+    a.sin_family      = AF_INET;
+    a.sin_port        = htons(s_cfg.fwd_port);
+    a.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (sendto(s_fwd_fd, u + 8, n - 8u, 0, (const struct sockaddr *)&a, sizeof(a)) >= 0) s_st.fwd++;
+}
+
+// netif linkoutput (lwIP 컨텍스트 = lock 보유)
+static err_t sink_output(struct netif *n, struct pbuf *p) {
+    (void)n;
+    if (s_cfg.tx_hold && s_hold_n >= s_cfg.tx_hold) {
+        s_st.tx_busy++;
+        return ERR_MEM;
+    }
+
+    uint8_t f[1514];
+    const u16_t len = pbuf_copy_partial(p, f, (u16_t)sizeof(f), 0);
+    s_st.tx_frames++;
+    s_st.tx_bytes += p->tot_len;
+
+    if (len >= ETH_HDR) {
+        const uint16_t type = (uint16_t)((f[12] << 8) | f[13]);
+        if (type == ETHTYPE_ARP)     on_arp(f, len);
+        else if (type == ETHTYPE_IP) on_ipv4(f + ETH_HDR, len - ETH_HDR);
+    }
+
+    if (s_cfg.tx_hold) {
+        pbuf_ref(p);
+        s_hold[(s_hold_head + s_hold_n) % HOLD_MAX] = p;
+        s_hold_n++;
+        if (s_hold_n > s_st.hold_max) s_st.hold_max = s_hold_n;
+    }
+    return ERR_OK;
+}
+
+static err_t sink_init(struct netif *n) {
+    n->name[0]    = 'g';
+    n->name[1]    = 'y';
+    n->output     = etharp_output;
+    n->linkoutput = sink_output;
+    n->mtu        = 1500;
+    n->hwaddr_len = ETH_HWADDR_LEN;
+    memcpy(n->hwaddr, k_mac, sizeof(k_mac));
+    n->flags      = NETIF_FLAG_BROADCAST | NETIF_FLAG_ETHARP | NETIF_FLAG_ETHERNET | NETIF_FLAG_IGMP;
+    return ERR_OK;
+}
+
+// peer ARP 응답을 수신 경로로 (driver RX와 같이 PBUF_POOL)
+static void inject_arp_reply(const arp_pending_t *a) {
+    uint8_t f[ARP_FRAME];
+    memcpy(f + 0, a->req_mac, 6);
+    memcpy(f + 6, k_peer, 6);
+    f[12] = 0x08; f[13] = 0x06;
+    f[14] = 0x00; f[15] = 0x01;     // Ethernet
+    f[16] = 0x08; f[17] = 0x00;     // IPv4
+    f[18] = 6;    f[19] = 4;
+    f[20] = 0x00; f[21] = 0x02;     // reply
+    memcpy(f + 22, k_peer, 6);
+    memcpy(f + 28, a->ip, 4);
+    memcpy(f + 32, a->req_mac, 6);
+    memcpy(f + 38, a->req_ip, 4);
+
+    struct pbuf *p = pbuf_alloc(PBUF_RAW, (u16_t)sizeof(f), PBUF_POOL);
+    if (!p) {
+        s_st.rx_drop++;
+        return;
+    }
+    (void)pbuf_take(p, f, (u16_t)sizeof(f));
+    if (s_nif.input(p, &s_nif) != ERR_OK) pbuf_free(p);
+    s_st.arp_reply++;
+}
+
+static void poll_locked(void) {
+    sys_check_timeouts();
+
+    // TX 완료 (tx_hold가 0으로 바뀌었으면 남은 것 전부)
+    uint32_t drain = s_cfg.tx_hold ? s_cfg.tx_drain : s_hold_n;
+    while (drain-- > 0 && s_hold_n > 0) {
+        pbuf_free(s_hold[s_hold_head]);
+        s_hold_head = (s_hold_head + 1u) % HOLD_MAX;
+        s_hold_n--;
+    }
+
+    const uint32_t now = sys_now();
+    for (uint32_t i = 0; i < ARP_PENDING_MAX; i++) {
+        arp_pending_t *a = &s_arp[i];
+        if (!a->used || (int32_t)(now - a->due_ms) < 0) continue;
+        a->used = false;
+        inject_arp_reply(a);
+    }
+}
+
+static void *bg_main(void *arg) {
+    (void)arg;
+    const struct timespec tick = {0, 1000000L};
+    while (s_bg_run) {
+        lwip_host_poll();
+        nanosleep(&tick, NULL);
+    }
+    return NULL;
+}
+
+// ---------- lwIP / pico stand-ins ----------
+
+u32_t sys_now(void) {
+    return (u32_t)(now_ns() / 1000000ull);
+}
+
+sys_prot_t sys_arch_protect(void) {
+    lock_take(false);
+    return 0;
+}
+
+void sys_arch_unprotect(sys_prot_t pval) {
+    (void)pval;
+    lock_give();
+}
+
+void cyw43_arch_lwip_begin(void) {
+    lock_take(true);
+}
+
+void cyw43_arch_lwip_end(void) {
+    lock_give();
+}
+
+bool net_wifi_link_up(void) {
+    return s_init && netif_is_up(&s_nif) && netif_is_link_up(&s_nif);
+}
+
+void platform_poll(void) {
+    lwip_host_poll();
+}
+
+uint64_t platform_millis(void) {
+    return now_ns() / 1000000ull;
+}
+
+uint64_t platform_micros(void) {
+    return now_ns() / 1000ull;
+}
+
+void platform_sleep_ms(uint32_t ms) {
+    const struct timespec ts = {(time_t)(ms / 1000u), (long)(ms % 1000u) * 1000000L};
+    nanosleep(&ts, NULL);
+}
+
+void platform_yield(void) {
+}
+
+// ---------- public API ----------
+
+void lwip_host_cfg_default(lwip_host_cfg_t *cfg) {
+    if (!cfg) return;
+    memset(cfg, 0, sizeof(*cfg));
+    cfg->ip       = "10.63.0.2";
+    cfg->mask     = "255.255.255.0";
+    cfg->gw       = "10.63.0.1";
+    cfg->tx_drain = 1;
+}
+
+bool lwip_host_init(const lwip_host_cfg_t *cfg) {
+    if (s_init) return false;
+
+    lwip_host_cfg_default(&s_cfg);
+    if (cfg) s_cfg = *cfg;
+    if (s_cfg.tx_hold > HOLD_MAX) s_cfg.tx_hold = HOLD_MAX;
+    clock_gettime(CLOCK_MONOTONIC, &s_t0);
+
+    ip4_addr_t ip, mask, gw;
+    if (!ip4addr_aton(s_cfg.ip, &ip) || !ip4addr_aton(s_cfg.mask, &mask) || !ip4addr_aton(s_cfg.gw, &gw)) {
+        return false;
+    }
+
+    lock_take(false);
+    lwip_init();
+    struct netif *n = netif_add(&s_nif, &ip, &mask, &gw, NULL, sink_init, ethernet_input);
+    if (n) {
+        netif_set_default(n);
+        netif_set_link_up(n);
+        netif_set_up(n);
+    }
+    lock_give();
+    if (!n) return false;
+
+    if (s_cfg.fwd_port) s_fwd_fd = socket(AF_INET, SOCK_DGRAM, 0);
+    s_init = true;
+    return true;
+}
+
+void lwip_host_set_model(uint32_t arp_delay_ms, uint32_t tx_hold, uint32_t tx_drain) {
+    lock_take(false);
+    s_cfg.arp_delay_ms = arp_delay_ms;
+    s_cfg.tx_hold      = tx_hold > HOLD_MAX ? HOLD_MAX : tx_hold;
+    s_cfg.tx_drain     = tx_drain;
+    lock_give();
+}
+
+void lwip_host_set_udp_tap(lwip_host_udp_fn fn, void *user) {
+    lock_take(false);
+    s_tap      = fn;
+    s_tap_user = user;
+    lock_give();
+}
+
+void lwip_host_arp_flush(void) {
+    if (!s_init) return;
+    lock_take(false);
+    etharp_cleanup_netif(&s_nif);
+    lock_give();
+}
+
+bool lwip_host_bg(bool on) {
+    if (!s_init || on == s_bg_run) return s_init;
+    if (on) {
+        s_bg_run = true;
+        if (pthread_create(&s_bg, NULL, bg_main, NULL) != 0) {
+            s_bg_run = false;
+            return false;
+        }
+        return true;
+    }
+    s_bg_run = false;
+    pthread_join(s_bg, NULL);
+    return true;
+}
+
+void lwip_host_poll(void) {
+    if (!s_init) return;
+    lock_take(false);
+    poll_locked();
+    lock_give();
+}
+
+void lwip_host_get_stats(lwip_host_stats_t *out) {
+    if (!out) return;
+    lock_take(false);
+    *out = s_st;
+    out->heap_size = (uint32_t)MEM_SIZE;
+    out->heap_used = (uint32_t)lwip_stats.mem.used;
+    out->heap_max  = (uint32_t)lwip_stats.mem.max;
+    out->heap_err  = (uint32_t)lwip_stats.mem.err;
+
+    const struct stats_mem *pool = lwip_stats.memp[MEMP_PBUF_POOL];
+    const struct stats_mem *ref  = lwip_stats.memp[MEMP_PBUF];
+    out->pool_size    = (uint32_t)PBUF_POOL_SIZE;
+    out->pool_max     = pool ? (uint32_t)pool->max : 0;
+    out->pool_err     = pool ? (uint32_t)pool->err : 0;
+    out->pbuf_ref_max = ref ? (uint32_t)ref->max : 0;
+    out->pbuf_ref_err = ref ? (uint32_t)ref->err : 0;
+    lock_give();
+}
+
+void lwip_host_reset_stats(void) {
+    lock_take(false);
+    memset(&s_st, 0, sizeof(s_st));
+    s_st.hold_max = s_hold_n;
+
+    lwip_stats.mem.max = lwip_stats.mem.used;
+    lwip_stats.mem.err = 0;
+    for (int i = 0; i < (int)MEMP_MAX; i++) {
+        struct stats_mem *m = lwip_stats.memp[i];
+        if (!m) continue;
+        m->max = m->used;
+        m->err = 0;
+    }
+    lock_give();
+}
@@ -0,0 +1,96 @@
+// FILE: host/lwip/lwip_host.h
+#ifndef __LWIP_HOST_H__
+#define __LWIP_HOST_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+// host lwIP harness: firmware net_udp.c / udp_tlm.c를 실제 lwIP (NO_SYS, include/lwipopts.h 한도)로 실행
+//
+// - netif: Ethernet "sink" 1개 (Wi-Fi 대신). 송신 frame은 집계 후 버림 (fwd_port면 UDP payload를 host socket으로)
+//   peer는 모든 ARP 요청에 응답 (proxy ARP, arp_delay_ms 후) -> 목적지/gateway 해석 경로 그대로
+// - TX 완료 모델: tx_hold > 0이면 netif가 frame을 tx_hold개까지 잡고 (pbuf ref) poll마다 tx_drain개 완료
+//   -> 느린 bus에서 PBUF_RAM heap (MEM_SIZE)이 차는 상황. 가득 차면 linkoutput ERR_MEM
+// - cyw43_arch_lwip_begin/end = 재귀 lock (획득/경합/대기 시간 집계). sys_arch_protect도 같은 lock
+// - bg: background poll thread (1 ms) -> threadsafe_background의 IRQ 측 lwIP 처리와 main loop 경합
+// - platform_poll / platform_millis / net_wifi_link_up stand-in 포함
+// - udp tap: sink에 도착한 UDP datagram을 목적지/payload 단위로 검사 (fan-out header 재사용 같은 frame 손상 검출)
+
+typedef struct {
+    const char *ip;             // harness netif 주소 (장치 쪽)
+    const char *mask;
+    const char *gw;
+    uint32_t arp_delay_ms;      // peer ARP 응답 지연 (0: 다음 poll)
+    uint32_t tx_hold;           // netif가 잡고 있을 수 있는 frame 수 (0: 즉시 완료)
+    uint32_t tx_drain;          // poll당 완료 frame 수 (tx_hold > 0)
+    uint16_t fwd_port;          // != 0: UDP payload를 127.0.0.1:fwd_port로 전달 (gy63_ingest 등)
+} lwip_host_cfg_t;
+
+typedef struct {
+    // netif
+    uint64_t tx_frames;
+    uint64_t tx_bytes;
+    uint64_t tx_udp;
+    uint64_t udp_bad_len;       // Ethernet/IP/UDP 길이 불일치
+    uint64_t tx_busy;           // hold queue 가득 -> ERR_MEM
+    uint32_t hold_max;
+    uint64_t arp_req;
+    uint64_t arp_reply;
+    uint64_t rx_drop;           // ARP 응답 pbuf (PBUF_POOL) 할당 실패
+    uint64_t fwd;
+
+    // cyw43_arch_lwip_begin (중첩 제외)
+    uint64_t locks;
+    uint64_t lock_contended;
+    uint64_t lock_wait_ns;
+
+    // lwIP stats (MEM_SIZE heap = PBUF_RAM, PBUF_POOL = RX)
+    uint32_t heap_size;
+    uint32_t heap_used;
+    uint32_t heap_max;
+    uint32_t heap_err;
+    uint32_t pool_size;
+    uint32_t pool_max;
+    uint32_t pool_err;
+    uint32_t pbuf_ref_max;      // MEMP_PBUF (PBUF_REF/ROM)
+    uint32_t pbuf_ref_err;
+} lwip_host_stats_t;
+
+// sink에 도착한 UDP datagram마다 (lwIP 컨텍스트, lock 보유). dst_ip는 network byte order, dst_port는 host order
+typedef void (*lwip_host_udp_fn)(uint32_t dst_ip, uint16_t dst_port, const uint8_t *payload, size_t len, void *user);
+
+void lwip_host_cfg_default(lwip_host_cfg_t *cfg);
+
+// lwip_init + netif 추가 (up/link up). process당 1회
+bool lwip_host_init(const lwip_host_cfg_t *cfg);
+
+// 실행 중 TX/ARP 모델 변경
+void lwip_host_set_model(uint32_t arp_delay_ms, uint32_t tx_hold, uint32_t tx_drain);
+
+// ARP cache 비움 (다음 송신부터 ARP 해석 -> pbuf가 ARP entry에 잡힘)
+void lwip_host_arp_flush(void);
+
+// UDP tap 설정 (NULL: 해제)
+void lwip_host_set_udp_tap(lwip_host_udp_fn fn, void *user);
+
+// background poll thread 시작/정지
+bool lwip_host_bg(bool on);
+
+// timers + TX 완료 + ARP 응답 (= platform_poll)
+void lwip_host_poll(void);
+
+void lwip_host_get_stats(lwip_host_stats_t *out);
+
+// high-water / 오류 / counter 초기화 (현재 사용량은 유지)
+void lwip_host_reset_stats(void);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // __LWIP_HOST_H__
@@ -0,0 +1,12 @@
+// FILE: host/lwip/port/arch/cc.h
+#ifndef __LWIP_ARCH_CC_H__
+#define __LWIP_ARCH_CC_H__
+
+// lwIP host port (Linux, NO_SYS). 나머지는 lwip/arch.h 기본값 (stdint, printf/abort)
+#include <stdlib.h>
+
+typedef int sys_prot_t;
+
+#define LWIP_RAND()     ((u32_t)rand())
+
+#endif /* __LWIP_ARCH_CC_H__ */
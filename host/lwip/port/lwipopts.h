@@ -0,0 +1,30 @@
+// FILE: host/lwip/port/lwipopts.h
+#ifndef __LWIPOPTS_HOST_H__
+#define __LWIPOPTS_HOST_H__
+
+// host lwIP harness: firmware 설정 그대로 (MEM_SIZE / PBUF_POOL_SIZE 등 한도 동일) + 측정용 차이만
+#include "../../../include/lwipopts.h"
+
+// CMake GY63_LWIP_MEM_SIZE -> MEM_SIZE (firmware 쪽 #ifndef), GY63_LWIP_PBUF_POOL_SIZE -> 여기서
+#ifdef GY63_PBUF_POOL_SIZE
+#undef  PBUF_POOL_SIZE
+#define PBUF_POOL_SIZE              GY63_PBUF_POOL_SIZE
+#endif
+
+// heap high-water / pool exhaustion 집계 (release build에서도)
+#undef  LWIP_STATS
+#undef  LWIP_STATS_DISPLAY
+#undef  MEM_STATS
+#undef  MEMP_STATS
+#define LWIP_STATS                  1
+#define LWIP_STATS_DISPLAY          0
+#define MEM_STATS                   1
+#define MEMP_STATS                  1
+
+// host socket header (arpa/inet.h: htons 등)와 공존
+#define LWIP_DONT_PROVIDE_BYTEORDER_FUNCTIONS
+
+// pico threadsafe_background와 같이 memp/pbuf ref는 sys_arch_protect (= cyw43 lock stand-in)
+#define SYS_LIGHTWEIGHT_PROT        1
+
+#endif /* __LWIPOPTS_HOST_H__ */
@@ -0,0 +1,19 @@
+// FILE: host/lwip/port/pico/cyw43_arch.h
+#ifndef __HOST_CYW43_ARCH_H__
+#define __HOST_CYW43_ARCH_H__
+
+// pico_cyw43_arch stand-in (host lwIP harness, host/lwip/lwip_host.h)
+// threadsafe_background 모델: lwIP 호출 구간 = 재귀 lock 1개 (background poll thread와 공유)
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+void cyw43_arch_lwip_begin(void);
+void cyw43_arch_lwip_end(void);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // __HOST_CYW43_ARCH_H__
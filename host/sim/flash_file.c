@@ -0,0 +1,119 @@
+// FILE: host/sim/flash_file.c
+#include "flash_file.h"
+
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// ---------- internal helpers ----------
+
+static bool range_ok(const flash_file_t *f, uint32_t off, size_t len) {
+    return f && f->mem && off <= f->size && len <= (size_t)(f->size - off);
+}
+
+// power-cut 주입: 이번 op에서 실제로 반영할 byte 수
+static size_t budget(flash_file_t *f, size_t len) {
+    if (f->cut_after_bytes < 0) return len;
+    if ((int64_t)len <= f->cut_after_bytes) {
+        f->cut_after_bytes -= (int64_t)len;
+        return len;
+    }
+    size_t n = (size_t)f->cut_after_bytes;
+    f->cut_after_bytes = 0;
+    f->dead = true;
+    return n;
+}
+
+static bool ff_read(void *ctx, uint32_t off, void *dst, size_t len) {
+    flash_file_t *f = (flash_file_t *)ctx;
+    if (!range_ok(f, off, len) || f->dead) return false;
+    memcpy(dst, f->mem + off, len);
+    f->bytes_read += len;
+    return true;
+}
+
+static bool ff_program(void *ctx, uint32_t off, const void *src, size_t len) {
+    flash_file_t *f = (flash_file_t *)ctx;
+    if (!range_ok(f, off, len) || f->dead) return false;
+    if ((off % FLASH_LOG_PAGE_SIZE) != 0 || (len % FLASH_LOG_PAGE_SIZE) != 0) return false;
+
+    const uint8_t *s = (const uint8_t *)src;
+    const size_t n = budget(f, len);
+    for (size_t i = 0; i < n; i++) f->mem[off + i] &= s[i];
+
+    f->bytes_programmed += n;
+    f->modeled_us += (uint64_t)f->page_prog_us * (len / FLASH_LOG_PAGE_SIZE);
+    return n == len;
+}
+
+static bool ff_erase(void *ctx, uint32_t off, size_t len) {
+    flash_file_t *f = (flash_file_t *)ctx;
+    if (!range_ok(f, off, len) || f->dead) return false;
+    if ((off % f->sector_size) != 0 || (len % f->sector_size) != 0) return false;
+
+    const size_t n = budget(f, len);
+    memset(f->mem + off, 0xFF, n);
+
+    f->sectors_erased += len / f->sector_size;
+    f->modeled_us += (uint64_t)f->sector_erase_us * (len / f->sector_size);
+    return n == len;
+}
+
+// ---------- public API ----------
+
+bool flash_file_open(flash_file_t *f, const char *path, uint32_t size, uint32_t sector_size, bool create) {
+    if (!f || !path || size == 0 || sector_size == 0) return false;
+    memset(f, 0, sizeof(*f));
+    f->fd = -1;
+    f->cut_after_bytes = -1;
+
+    int fd = open(path, create ? (O_RDWR | O_CREAT | O_TRUNC) : O_RDWR, 0644);
+    if (fd < 0) return false;
+
+    if (create) {
+        if (ftruncate(fd, (off_t)size) != 0) { close(fd); return false; }
+    } else {
+        struct stat st;
+        if (fstat(fd, &st) != 0 || (uint64_t)st.st_size < size) { close(fd); return false; }
+    }
+
+    void *m = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (m == MAP_FAILED) { close(fd); return false; }
+
+    f->fd          = fd;
+    f->mem         = (uint8_t *)m;
+    f->size        = size;
+    f->sector_size = sector_size;
+
+    if (create) memset(f->mem, 0xFF, size);
+    return true;
+}
+
+void flash_file_close(flash_file_t *f) {
+    if (!f) return;
+    if (f->mem) {
+        msync(f->mem, f->size, MS_SYNC);
+        munmap(f->mem, f->size);
+    }
+    if (f->fd >= 0) close(f->fd);
+    f->mem = NULL;
+    f->fd  = -1;
+}
+
+void flash_file_set_typical_timing(flash_file_t *f) {
+    if (!f) return;
+    f->page_prog_us    = 400;
+    f->sector_erase_us = 45000;
+}
+
+void flash_file_dev(flash_file_t *f, flash_log_dev_t *dev) {
+    if (!f || !dev) return;
+    dev->size        = f->size;
+    dev->sector_size = f->sector_size;
+    dev->read        = ff_read;
+    dev->program     = ff_program;
+    dev->erase       = ff_erase;
+    dev->ctx         = f;
+}
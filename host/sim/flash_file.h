@@ -0,0 +1,50 @@
+// FILE: host/sim/flash_file.h
+#ifndef __FLASH_FILE_H__
+#define __FLASH_FILE_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "flash_log.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+// file-backed NOR flash stand-in (host 전용)
+// - program: 기존 값과 AND (1->0만 가능), erase: sector를 0xFF로
+// - power-cut 주입: cut_after_bytes 만큼 program/erase 진행 후 이후 모든 op 실패
+// - timing model: page_prog_us / sector_erase_us 를 modeled_us에 누적 (실제 대기 없음)
+typedef struct {
+    int      fd;
+    uint8_t *mem;           // mmap
+    uint32_t size;
+    uint32_t sector_size;
+
+    int64_t  cut_after_bytes; // <0: 비활성
+    bool     dead;
+
+    uint32_t page_prog_us;    // 256 B page 당
+    uint32_t sector_erase_us; // sector 당
+    uint64_t modeled_us;
+
+    uint64_t bytes_read;
+    uint64_t bytes_programmed;
+    uint64_t sectors_erased;
+} flash_file_t;
+
+// create=true면 size로 만들고 0xFF로 채움 (erased 상태)
+bool flash_file_open(flash_file_t *f, const char *path, uint32_t size, uint32_t sector_size, bool create);
+void flash_file_close(flash_file_t *f);
+
+// W25Q 계열 typ 값으로 timing model 설정 (page 0.4 ms, 4 KiB erase 45 ms)
+void flash_file_set_typical_timing(flash_file_t *f);
+
+void flash_file_dev(flash_file_t *f, flash_log_dev_t *dev);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // __FLASH_FILE_H__
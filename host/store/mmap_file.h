@@ -0,0 +1,93 @@
+// FILE: host/store/mmap_file.h
+#ifndef __MMAP_FILE_H__
+#define __MMAP_FILE_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// 파일 전체를 MAP_SHARED로 매핑 (RAII)
+// - 크기는 ftruncate로만 바뀜: 늘린 영역은 sparse (실제 쓴 page만 disk 사용)
+// - resize는 unmap -> ftruncate -> map (주소가 바뀜: 호출자는 포인터를 다시 읽을 것)
+namespace store {
+
+class MmapFile {
+public:
+    MmapFile() = default;
+    ~MmapFile() { close(); }
+
+    MmapFile(const MmapFile &) = delete;
+    MmapFile &operator=(const MmapFile &) = delete;
+
+    // create면 없을 때 만들고 min_size까지 늘림. 있는 파일은 현재 크기로 (min_size보다 작으면 늘림)
+    bool open(const std::string &path, size_t min_size, bool create) {
+        close();
+        fd_ = ::open(path.c_str(), O_RDWR | (create ? O_CREAT : 0), 0644);
+        if (fd_ < 0) return false;
+        struct stat st;
+        if (fstat(fd_, &st) != 0) { close(); return false; }
+        size_t size = (size_t)st.st_size;
+        if (size < min_size) {
+            if (ftruncate(fd_, (off_t)min_size) != 0) { close(); return false; }
+            size = min_size;
+        }
+        return map(size);
+    }
+
+    bool resize(size_t size) {
+        if (fd_ < 0) return false;
+        unmap();
+        if (ftruncate(fd_, (off_t)size) != 0) return false;
+        return map(size);
+    }
+
+    // MS_ASYNC: page cache에 맡김 (close 시 커널이 기록)
+    void sync(bool wait = false) {
+        if (data_) msync(data_, size_, wait ? MS_SYNC : MS_ASYNC);
+    }
+
+    void close() {
+        unmap();
+        if (fd_ >= 0) ::close(fd_);
+        fd_ = -1;
+    }
+
+    // 실제 disk 사용량 (sparse 제외)
+    uint64_t disk_bytes() const {
+        struct stat st;
+        if (fd_ < 0 || fstat(fd_, &st) != 0) return 0;
+        return (uint64_t)st.st_blocks * 512u;
+    }
+
+    uint8_t *data() const { return data_; }
+    size_t size() const { return size_; }
+    bool is_open() const { return data_ != nullptr; }
+
+private:
+    bool map(size_t size) {
+        void *p = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+        if (p == MAP_FAILED) return false;
+        data_ = (uint8_t *)p;
+        size_ = size;
+        return true;
+    }
+
+    void unmap() {
+        if (data_) munmap(data_, size_);
+        data_ = nullptr;
+        size_ = 0;
+    }
+
+    int      fd_   = -1;
+    uint8_t *data_ = nullptr;
+    size_t   size_ = 0;
+};
+
+} // namespace store
+
+#endif // __MMAP_FILE_H__
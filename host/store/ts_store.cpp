@@ -0,0 +1,461 @@
+// FILE: host/store/ts_store.cpp
+#include "ts_store.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <dirent.h>
+#include <sys/stat.h>
+
+namespace store {
+
+namespace {
+
+constexpr uint32_t kSegMagic  = 0x53545947u;    // "GYTS"
+constexpr uint32_t kRollMagic = 0x52545947u;    // "GYTR"
+constexpr uint16_t kVersion   = 1;
+
+enum { COL_MS = 0, COL_P, COL_T, COL_N };
+
+// column 영역 크기 (샘플당 최악 varint 길이)
+constexpr uint32_t kColMax[COL_N] = { 10, 5, 5 };
+
+struct SegHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t hdr_size;
+    uint64_t node;
+    uint32_t capacity;
+    uint32_t block_samples;
+    uint32_t count;
+    uint32_t blocks;
+    int64_t  t_min, t_max;
+    uint64_t col_off[COL_N];
+    uint64_t col_len[COL_N];
+    uint8_t  rsv[128 - 96];
+};
+static_assert(sizeof(SegHeader) == 128, "segment header size");
+
+// block 첫 샘플 (절대값) + 시간 범위 + column별 시작 offset
+struct BlockIdx {
+    int64_t  t_min, t_max;
+    int64_t  t0;
+    uint32_t p0;
+    int32_t  c0;
+    uint32_t n;
+    uint32_t off[COL_N];
+};
+static_assert(sizeof(BlockIdx) == 48, "block index size");
+
+struct RollHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t hdr_size;
+    int64_t  res_ms;
+    int64_t  base;          // 첫 bucket 번호
+    uint64_t n_buckets;     // 사용 범위 (마지막 bucket + 1)
+    uint64_t miss;          // base 이전 샘플
+    uint8_t  rsv[64 - 40];
+};
+static_assert(sizeof(RollHeader) == 64, "rollup header size");
+
+struct RollRec {
+    uint32_t n;
+    uint32_t p_min, p_max;
+    int32_t  t_min, t_max;
+    uint32_t rsv;
+    int64_t  p_sum;
+    int64_t  t_sum;
+};
+static_assert(sizeof(RollRec) == 40, "rollup record size");
+
+inline uint64_t zz64(int64_t v) { return ((uint64_t)v << 1) ^ (uint64_t)(v >> 63); }
+inline int64_t unzz64(uint64_t v) { return (int64_t)(v >> 1) ^ -(int64_t)(v & 1u); }
+
+inline size_t put_varint(uint8_t *p, uint64_t v) {
+    size_t n = 0;
+    while (v >= 0x80u) {
+        p[n++] = (uint8_t)(v | 0x80u);
+        v >>= 7;
+    }
+    p[n++] = (uint8_t)v;
+    return n;
+}
+
+// column 영역은 writer가 쓴 것만 읽음 -> 경계 검사 없음
+inline uint64_t get_varint(const uint8_t *&p) {
+    uint64_t v = 0;
+    for (unsigned shift = 0;; shift += 7) {
+        const uint8_t b = *p++;
+        v |= (uint64_t)(b & 0x7Fu) << shift;
+        if (!(b & 0x80u)) return v;
+    }
+}
+
+inline int64_t floor_div(int64_t a, int64_t b) {
+    const int64_t q = a / b;
+    return (a % b != 0 && (a < 0) != (b < 0)) ? q - 1 : q;
+}
+
+inline bool overlaps(int64_t lo, int64_t hi, int64_t t0, int64_t t1) {
+    return hi >= t0 && lo < t1;
+}
+
+bool make_dir(const std::string &path) {
+    return mkdir(path.c_str(), 0755) == 0 || errno == EEXIST;
+}
+
+} // namespace
+
+// ---------- segment ----------
+
+class Segment {
+public:
+    bool create(const std::string &path, uint64_t node) {
+        size_t size = sizeof(SegHeader) + (size_t)(kSegSamples / kBlockSamples) * sizeof(BlockIdx);
+        uint64_t off[COL_N];
+        for (int c = 0; c < COL_N; c++) {
+            off[c] = size;
+            size += (size_t)kSegSamples * kColMax[c];
+        }
+        if (!f_.open(path, size, true)) return false;
+
+        SegHeader *h = whdr();
+        std::memset(h, 0, sizeof(*h));
+        h->magic         = kSegMagic;
+        h->version       = kVersion;
+        h->hdr_size      = sizeof(SegHeader);
+        h->node          = node;
+        h->capacity      = kSegSamples;
+        h->block_samples = kBlockSamples;
+        for (int c = 0; c < COL_N; c++) h->col_off[c] = off[c];
+        return true;
+    }
+
+    bool open(const std::string &path) {
+        if (!f_.open(path, 0, false) || f_.size() < sizeof(SegHeader)) return false;
+        const SegHeader *h = hdr();
+        if (h->magic != kSegMagic || h->version != kVersion || h->capacity != kSegSamples ||
+            h->block_samples != kBlockSamples) {
+            return false;
+        }
+        // 이어 쓰기: 마지막 block을 decode해서 delta 기준 복원
+        if (h->count % kBlockSamples != 0) {
+            bool first = true;
+            decode_block(idx()[h->blocks - 1], [&](const Sample &s) {
+                prev_d_  = first ? 0 : s.ms - prev_ms_;
+                first    = false;
+                prev_ms_ = s.ms;
+                prev_p_  = s.p_pa;
+                prev_c_  = s.t_x100;
+            });
+        }
+        return true;
+    }
+
+    bool full() const { return hdr()->count >= hdr()->capacity; }
+
+    void append(const Sample &s) {
+        SegHeader *h = whdr();
+        if (h->count % kBlockSamples == 0) {
+            BlockIdx &b = idx()[h->blocks++];
+            b.t_min = b.t_max = b.t0 = s.ms;
+            b.p0 = s.p_pa;
+            b.c0 = s.t_x100;
+            b.n  = 1;
+            for (int c = 0; c < COL_N; c++) b.off[c] = (uint32_t)h->col_len[c];
+            prev_d_ = 0;
+        } else {
+            BlockIdx &b = idx()[h->blocks - 1];
+            const int64_t d = s.ms - prev_ms_;
+            h->col_len[COL_MS] += put_varint(col(COL_MS) + h->col_len[COL_MS], zz64(d - prev_d_));
+            h->col_len[COL_P]  += put_varint(col(COL_P) + h->col_len[COL_P], zz64((int64_t)s.p_pa - prev_p_));
+            h->col_len[COL_T]  += put_varint(col(COL_T) + h->col_len[COL_T], zz64((int64_t)s.t_x100 - prev_c_));
+            b.t_min = std::min(b.t_min, s.ms);
+            b.t_max = std::max(b.t_max, s.ms);
+            b.n++;
+            prev_d_ = d;
+        }
+        prev_ms_ = s.ms;
+        prev_p_  = s.p_pa;
+        prev_c_  = s.t_x100;
+
+        if (h->count == 0) h->t_min = h->t_max = s.ms;
+        h->t_min = std::min(h->t_min, s.ms);
+        h->t_max = std::max(h->t_max, s.ms);
+        h->count++;
+    }
+
+    template <typename Fn>
+    uint64_t scan(int64_t t0, int64_t t1, Fn &&fn) const {
+        const SegHeader *h = hdr();
+        if (h->count == 0 || !overlaps(h->t_min, h->t_max, t0, t1)) return 0;
+
+        uint64_t n = 0;
+        for (uint32_t i = 0; i < h->blocks; i++) {
+            const BlockIdx &b = idx()[i];
+            if (!overlaps(b.t_min, b.t_max, t0, t1)) continue;
+            decode_block(b, [&](const Sample &s) {
+                if (s.ms < t0 || s.ms >= t1) return;
+                fn(s);
+                n++;
+            });
+        }
+        return n;
+    }
+
+    const SegHeader *hdr() const { return (const SegHeader *)f_.data(); }
+    uint64_t disk_bytes() const { return f_.disk_bytes(); }
+    void sync(bool wait) { f_.sync(wait); }
+
+private:
+    SegHeader *whdr() { return (SegHeader *)f_.data(); }
+    BlockIdx *idx() const { return (BlockIdx *)(f_.data() + sizeof(SegHeader)); }
+    uint8_t *col(int c) const { return f_.data() + hdr()->col_off[c]; }
+
+    template <typename Fn>
+    void decode_block(const BlockIdx &b, Fn &&fn) const {
+        const uint8_t *pm = col(COL_MS) + b.off[COL_MS];
+        const uint8_t *pp = col(COL_P) + b.off[COL_P];
+        const uint8_t *pt = col(COL_T) + b.off[COL_T];
+
+        Sample s{b.t0, b.c0, b.p0};
+        int64_t d = 0;
+        fn(s);
+        for (uint32_t i = 1; i < b.n; i++) {
+            d    += unzz64(get_varint(pm));
+            s.ms += d;
+            s.p_pa   = (uint32_t)((int64_t)s.p_pa + unzz64(get_varint(pp)));
+            s.t_x100 = (int32_t)((int64_t)s.t_x100 + unzz64(get_varint(pt)));
+            fn(s);
+        }
+    }
+
+    MmapFile f_;
+    int64_t  prev_ms_ = 0;
+    int64_t  prev_d_  = 0;
+    int64_t  prev_p_  = 0;
+    int64_t  prev_c_  = 0;
+};
+
+// ---------- rollup ----------
+
+class RollupFile {
+public:
+    explicit RollupFile(int64_t res_ms) : res_(res_ms) {}
+
+    bool open(const std::string &path) {
+        if (!f_.open(path, sizeof(RollHeader) + 1024 * sizeof(RollRec), true)) return false;
+        RollHeader *h = hdr();
+        if (h->magic == 0) {
+            std::memset(h, 0, sizeof(*h));
+            h->magic    = kRollMagic;
+            h->version  = kVersion;
+            h->hdr_size = sizeof(RollHeader);
+            h->res_ms   = res_;
+        }
+        return h->magic == kRollMagic && h->version == kVersion && h->res_ms == res_;
+    }
+
+    bool add(const Sample &s) {
+        RollHeader *h = hdr();
+        const int64_t bucket = floor_div(s.ms, res_);
+        if (h->n_buckets == 0) h->base = bucket;
+        if (bucket < h->base) {
+            h->miss++;
+            return false;
+        }
+        const uint64_t i = (uint64_t)(bucket - h->base);
+        if (i >= capacity()) {
+            // 2배씩 (sparse). 주소가 바뀌므로 h 다시 읽음
+            size_t cap = capacity();
+            while (cap <= i) cap *= 2;
+            if (!f_.resize(sizeof(RollHeader) + cap * sizeof(RollRec))) return false;
+            h = hdr();
+        }
+        if (i >= h->n_buckets) h->n_buckets = i + 1;
+
+        RollRec &r = rec()[i];
+        if (r.n == 0) {
+            r.p_min = r.p_max = s.p_pa;
+            r.t_min = r.t_max = s.t_x100;
+        } else {
+            r.p_min = std::min(r.p_min, s.p_pa);
+            r.p_max = std::max(r.p_max, s.p_pa);
+            r.t_min = std::min(r.t_min, s.t_x100);
+            r.t_max = std::max(r.t_max, s.t_x100);
+        }
+        r.n++;
+        r.p_sum += s.p_pa;
+        r.t_sum += s.t_x100;
+        return true;
+    }
+
+    template <typename Fn>
+    uint64_t query(int64_t t0, int64_t t1, Fn &&fn) const {
+        const RollHeader *h = hdr();
+        if (h->n_buckets == 0 || t1 <= t0) return 0;
+
+        const int64_t lo = std::max<int64_t>(floor_div(t0 + res_ - 1, res_) - h->base, 0);
+        const int64_t hi = std::min<int64_t>(floor_div(t1 - 1, res_) - h->base + 1, (int64_t)h->n_buckets);
+        uint64_t n = 0;
+        for (int64_t i = lo; i < hi; i++) {
+            const RollRec &r = rec()[i];
+            if (r.n == 0) continue;
+            fn(Rollup{(h->base + i) * res_, r.n, r.p_min, r.p_max, r.t_min, r.t_max, r.p_sum, r.t_sum});
+            n++;
+        }
+        return n;
+    }
+
+    uint64_t miss() const { return hdr()->miss; }
+    uint64_t disk_bytes() const { return f_.disk_bytes(); }
+    void sync(bool wait) { f_.sync(wait); }
+
+private:
+    RollHeader *hdr() const { return (RollHeader *)f_.data(); }
+    RollRec *rec() const { return (RollRec *)(f_.data() + sizeof(RollHeader)); }
+    size_t capacity() const { return (f_.size() - sizeof(RollHeader)) / sizeof(RollRec); }
+
+    int64_t  res_;
+    MmapFile f_;
+};
+
+// ---------- series ----------
+
+Series::Series(const std::string &dir, uint64_t node) : dir_(dir), node_(node) {}
+
+Series::~Series() = default;
+
+bool Series::open() {
+    if (!make_dir(dir_)) return false;
+
+    // seg_<n>.gts 번호 순
+    std::vector<uint32_t> ids;
+    if (DIR *d = opendir(dir_.c_str())) {
+        while (dirent *e = readdir(d)) {
+            unsigned id = 0;
+            char tail[8] = {};
+            if (std::sscanf(e->d_name, "seg_%u.%7s", &id, tail) == 2 && !std::strcmp(tail, "gts")) ids.push_back(id);
+        }
+        closedir(d);
+    }
+    std::sort(ids.begin(), ids.end());
+    for (uint32_t id : ids) {
+        auto seg = std::make_unique<Segment>();
+        if (!seg->open(dir_ + "/seg_" + std::to_string(id) + ".gts")) return false;
+        segs_.push_back(std::move(seg));
+    }
+    if (segs_.empty() && !add_segment()) return false;
+
+    roll_m_ = std::make_unique<RollupFile>(kRollupMinute);
+    roll_h_ = std::make_unique<RollupFile>(kRollupHour);
+    return roll_m_->open(dir_ + "/rollup_60s.gtr") && roll_h_->open(dir_ + "/rollup_3600s.gtr");
+}
+
+bool Series::add_segment() {
+    auto seg = std::make_unique<Segment>();
+    if (!seg->create(dir_ + "/seg_" + std::to_string(segs_.size()) + ".gts", node_)) return false;
+    segs_.push_back(std::move(seg));
+    return true;
+}
+
+bool Series::append(const Sample &s) {
+    if (segs_.back()->full()) {
+        segs_.back()->sync(false);
+        if (!add_segment()) return false;
+    }
+    segs_.back()->append(s);
+    (void)roll_m_->add(s);
+    (void)roll_h_->add(s);
+    return true;
+}
+
+void Series::flush(bool wait) {
+    for (auto &s : segs_) s->sync(wait);
+    roll_m_->sync(wait);
+    roll_h_->sync(wait);
+}
+
+uint64_t Series::scan(int64_t t0, int64_t t1, const std::function<void(const Sample &)> &fn) const {
+    uint64_t n = 0;
+    for (const auto &s : segs_) n += s->scan(t0, t1, fn);
+    return n;
+}
+
+uint64_t Series::rollups(int64_t res, int64_t t0, int64_t t1, const std::function<void(const Rollup &)> &fn) const {
+    if (res == kRollupMinute) return roll_m_->query(t0, t1, fn);
+    if (res == kRollupHour)   return roll_h_->query(t0, t1, fn);
+    return 0;
+}
+
+SeriesStats Series::stats() const {
+    SeriesStats st;
+    bool first = true;
+    for (const auto &s : segs_) {
+        const SegHeader *h = s->hdr();
+        st.samples += h->count;
+        st.segments++;
+        for (int c = 0; c < COL_N; c++) st.col_bytes += h->col_len[c];
+        st.col_bytes += (uint64_t)h->blocks * sizeof(BlockIdx);
+        st.disk_bytes += s->disk_bytes();
+        if (h->count == 0) continue;
+        st.t_min = first ? h->t_min : std::min(st.t_min, h->t_min);
+        st.t_max = first ? h->t_max : std::max(st.t_max, h->t_max);
+        first = false;
+    }
+    st.disk_bytes += roll_m_->disk_bytes() + roll_h_->disk_bytes();
+    st.rollup_miss = roll_m_->miss();
+    return st;
+}
+
+// ---------- store ----------
+
+bool Store::open() {
+    if (!make_dir(dir_)) return false;
+
+    std::vector<uint64_t> found;
+    if (DIR *d = opendir(dir_.c_str())) {
+        while (dirent *e = readdir(d)) {
+            char *end = nullptr;
+            const unsigned long long id = std::strtoull(e->d_name, &end, 16);
+            if (end && *end == '\0' && std::strlen(e->d_name) == 16) found.push_back(id);
+        }
+        closedir(d);
+    }
+    for (uint64_t id : found) {
+        if (!series(id)) return false;
+    }
+    return true;
+}
+
+Series *Store::series(uint64_t node) {
+    std::lock_guard<std::mutex> lk(mu_);
+    auto it = series_.find(node);
+    if (it != series_.end()) return it->second.get();
+
+    char name[24];
+    std::snprintf(name, sizeof(name), "/%016llx", (unsigned long long)node);
+    auto s = std::make_unique<Series>(dir_ + name, node);
+    if (!s->open()) return nullptr;
+    Series *p = s.get();
+    series_.emplace(node, std::move(s));
+    return p;
+}
+
+std::vector<uint64_t> Store::nodes() const {
+    std::lock_guard<std::mutex> lk(mu_);
+    std::vector<uint64_t> v;
+    for (const auto &kv : series_) v.push_back(kv.first);
+    return v;
+}
+
+void Store::flush(bool wait) {
+    std::lock_guard<std::mutex> lk(mu_);
+    for (auto &kv : series_) kv.second->flush(wait);
+}
+
+} // namespace store
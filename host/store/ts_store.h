@@ -0,0 +1,114 @@
+// FILE: host/store/ts_store.h
+#ifndef __TS_STORE_H__
+#define __TS_STORE_H__
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "mmap_file.h"
+
+// telemetry time-series store (host, CSV 대체)
+//
+//   <dir>/<node 16진>/seg_<n>.gts    column segment (mmap, 고정 용량 kSegSamples)
+//                    /rollup_60s.gtr  분 단위 rollup (min/max/mean, dense array)
+//                    /rollup_3600s.gtr 시간 단위 rollup
+//
+// segment = header + block index + column 영역 3개 (timestamp / pressure / temperature)
+// - block(kBlockSamples)마다 첫 샘플은 index에 절대값, 이후는 zigzag varint:
+//     timestamp: delta-of-delta (고정 주기면 1 byte), pressure/temperature: delta
+// - block index에 시간 min/max -> range scan은 겹치는 block만 decode (time index)
+// - column 영역은 최대 크기로 잡은 sparse 파일: 실제 disk 사용은 쓴 만큼
+// - backfill로 늦게 도착한 샘플은 도착 순서대로 저장 (block min/max가 범위를 덮음, scan 순서 보장 없음)
+//
+// rollup: bucket = floor(ms / res) - 첫 bucket. append마다 in-place 갱신 (늦은 샘플 포함)
+//
+// 쓰기: node(Series)는 한 thread에서만. Store::series()는 thread-safe
+namespace store {
+
+struct Sample {
+    int64_t  ms;        // 보통 host 기준 epoch ms (gy63_ingest --store)
+    int32_t  t_x100;
+    uint32_t p_pa;
+};
+
+struct Rollup {
+    int64_t  start_ms;
+    uint32_t n;
+    uint32_t p_min, p_max;
+    int32_t  t_min, t_max;
+    int64_t  p_sum;
+    int64_t  t_sum;
+
+    double p_mean() const { return n ? (double)p_sum / n : 0.0; }
+    double t_mean() const { return n ? (double)t_sum / n : 0.0; }
+};
+
+constexpr uint32_t kSegSamples   = 1u << 20;
+constexpr uint32_t kBlockSamples = 512;
+constexpr int64_t  kRollupMinute = 60000;
+constexpr int64_t  kRollupHour   = 3600000;
+
+struct SeriesStats {
+    uint64_t samples     = 0;
+    uint32_t segments    = 0;
+    uint64_t col_bytes   = 0;       // column 영역 사용 byte (encoded)
+    uint64_t disk_bytes  = 0;       // segment + rollup 파일 실제 disk 사용
+    uint64_t rollup_miss = 0;       // 첫 bucket 이전 샘플 (rollup 미반영)
+    int64_t  t_min = 0, t_max = 0;
+};
+
+class Segment;
+class RollupFile;
+
+// node 1개의 시계열
+class Series {
+public:
+    Series(const std::string &dir, uint64_t node);
+    ~Series();
+
+    bool open();                            // 기존 segment/rollup 로드 (없으면 생성)
+    bool append(const Sample &s);
+    void flush(bool wait = false);          // msync
+
+    // [t0, t1) 샘플 -> fn. 처리한 샘플 수
+    uint64_t scan(int64_t t0, int64_t t1, const std::function<void(const Sample &)> &fn) const;
+
+    // res = kRollupMinute / kRollupHour. [t0, t1)에 시작하는 비어 있지 않은 bucket -> fn
+    uint64_t rollups(int64_t res, int64_t t0, int64_t t1, const std::function<void(const Rollup &)> &fn) const;
+
+    SeriesStats stats() const;
+    uint64_t node() const { return node_; }
+
+private:
+    bool add_segment();
+
+    std::string dir_;
+    uint64_t    node_;
+    std::vector<std::unique_ptr<Segment>> segs_;
+    std::unique_ptr<RollupFile> roll_m_;
+    std::unique_ptr<RollupFile> roll_h_;
+};
+
+class Store {
+public:
+    explicit Store(const std::string &dir) : dir_(dir) {}
+
+    bool open();                            // dir 생성 + 기존 node 목록 로드
+    Series *series(uint64_t node);          // 없으면 생성. 실패 시 nullptr
+    std::vector<uint64_t> nodes() const;
+    void flush(bool wait = false);
+
+private:
+    std::string dir_;
+    mutable std::mutex mu_;
+    std::map<uint64_t, std::unique_ptr<Series>> series_;
+};
+
+} // namespace store
+
+#endif // __TS_STORE_H__
@@ -0,0 +1,202 @@
+// FILE: host/tools/gy63_arq_rx.cpp
+// udp_arq loopback/bench receiver
+//   gy63_arq_rx [--port 5005] [--loss 0.05] [--quiet]
+//       ARQ DATA 수신 -> payload를 stdout으로, 피드백을 송신자에게 반송. 비ARQ datagram은 그대로 출력.
+//       --loss: 수신 packet을 확률적으로 버려 lossy link 흉내
+//   gy63_arq_rx --selftest 2000 [--rate 100] [--loss 0.05]
+//       같은 프로세스에서 udp_arq 송신자를 127.0.0.1로 돌려 goodput/복구 통계 측정
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "bench_util.h"
+
+extern "C" {
+#include "udp_arq.h"
+}
+
+namespace {
+
+uint64_t now_ms() {
+    return (uint64_t)(bench::now_s() * 1000.0);
+}
+
+int bind_udp(uint16_t port) {
+    int fd = socket(AF_INET, SOCK_DGRAM, 0);
+    if (fd < 0) return -1;
+    sockaddr_in a{};
+    a.sin_family      = AF_INET;
+    a.sin_port        = htons(port);
+    a.sin_addr.s_addr = htonl(INADDR_ANY);
+    if (bind(fd, (sockaddr *)&a, sizeof(a)) != 0) { close(fd); return -1; }
+    return fd;
+}
+
+struct RxOpts {
+    uint16_t port = 5005;
+    double   loss = 0;
+    bool     quiet = false;
+    uint64_t stop_after_idle_ms = 0; // 0: 무한
+};
+
+// 단일 송신자 가정 (피드백 대상 = 마지막 송신 주소)
+arq_rx_stats_t run_receiver(int fd, const RxOpts &o, std::atomic<bool> *stop) {
+    std::mt19937 rng(7);
+    arq_rx_t rx;
+    arq_rx_init(&rx, 8, 20);
+
+    sockaddr_in peer{};
+    socklen_t plen = sizeof(peer);
+    bool have_peer = false;
+    uint8_t buf[2048];
+    uint64_t last_rx = now_ms();
+
+    while (!stop || !stop->load()) {
+        pollfd pfd{fd, POLLIN, 0};
+        if (poll(&pfd, 1, 5) > 0) {
+            sockaddr_in from{};
+            socklen_t flen = sizeof(from);
+            ssize_t n = recvfrom(fd, buf, sizeof(buf), 0, (sockaddr *)&from, &flen);
+            if (n > 0) {
+                last_rx = now_ms();
+                if (std::uniform_real_distribution<double>(0, 1)(rng) >= o.loss) {
+                    if (arq_is_packet(buf, (size_t)n)) {
+                        peer = from;
+                        plen = flen;
+                        have_peer = true;
+
+                        const uint8_t *pl;
+                        size_t pl_len;
+                        if (arq_rx_on_packet(&rx, buf, (size_t)n, &pl, &pl_len, nullptr) && !o.quiet) {
+                            std::fwrite(pl, 1, pl_len, stdout);
+                        }
+                    } else if (!o.quiet) {
+                        std::fwrite(buf, 1, (size_t)n, stdout);
+                    }
+                }
+            }
+        }
+
+        const uint64_t t = now_ms();
+        if (have_peer && arq_rx_feedback_due(&rx, t)) {
+            uint8_t fb[ARQ_FB_SIZE];
+            size_t n = arq_rx_make_feedback(&rx, t, fb, sizeof(fb));
+            (void)sendto(fd, fb, n, 0, (sockaddr *)&peer, plen);
+        }
+
+        if (o.stop_after_idle_ms && t - last_rx > o.stop_after_idle_ms) break;
+    }
+    return rx.stats;
+}
+
+struct TxCtx {
+    int fd;
+    sockaddr_in dst;
+};
+
+bool tx_send(const void *pkt, size_t len, void *user) {
+    TxCtx *c = (TxCtx *)user;
+    return sendto(c->fd, pkt, len, 0, (sockaddr *)&c->dst, sizeof(c->dst)) == (ssize_t)len;
+}
+
+int selftest(uint32_t n_pkts, uint32_t rate, const RxOpts &o) {
+    int rfd = bind_udp(o.port);
+    int tfd = bind_udp(0);
+    if (rfd < 0 || tfd < 0) { std::perror("bind"); return 1; }
+
+    std::atomic<bool> stop{false};
+    arq_rx_stats_t rs{};
+    RxOpts ro = o;
+    ro.quiet = true;
+    std::thread rxt([&] { rs = run_receiver(rfd, ro, &stop); });
+
+    TxCtx ctx{tfd, {}};
+    ctx.dst.sin_family      = AF_INET;
+    ctx.dst.sin_port        = htons(o.port);
+    ctx.dst.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+    arq_tx_t *tx = new arq_tx_t;
+    arq_tx_init(tx, 60, 20, 4, tx_send, &ctx);
+
+    char payload[64];
+    std::memset(payload, 'x', sizeof(payload));
+    const double t0 = bench::now_s();
+    const double dt = 1.0 / rate;
+    uint32_t sent = 0;
+
+    // 송신 + 피드백 처리 (firmware main loop와 같은 단일 스레드 구조)
+    while (sent < n_pkts || (tx->stats.inflight > 0 && bench::now_s() - t0 < (double)n_pkts / rate + 2.0)) {
+        if (sent < n_pkts && bench::now_s() - t0 >= sent * dt) {
+            std::snprintf(payload, sizeof(payload), "seq=%u\n", sent);
+            arq_tx_send(tx, payload, sizeof(payload), now_ms());
+            sent++;
+        }
+
+        uint8_t fb[64];
+        ssize_t n;
+        while ((n = recv(tfd, fb, sizeof(fb), MSG_DONTWAIT)) > 0) {
+            arq_tx_on_feedback(tx, fb, (size_t)n, now_ms());
+        }
+        arq_tx_poll(tx, now_ms());
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+    const double elapsed = bench::now_s() - t0;
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    stop = true;
+    rxt.join();
+
+    bench::Json("arq_loopback")
+        .num("loss", o.loss)
+        .num("sent", n_pkts)
+        .num("delivered", rs.delivered)
+        .num("delivery_ratio", (double)rs.delivered / n_pkts)
+        .num("goodput_Bps", (double)rs.delivered * sizeof(payload) / elapsed)
+        .num("retransmits", tx->stats.retransmits)
+        .num("abandoned", tx->stats.abandoned)
+        .num("recovered", rs.recovered)
+        .num("duplicates", rs.duplicates)
+        .num("feedback", rs.feedback_tx)
+        .print();
+
+    delete tx;
+    close(rfd);
+    close(tfd);
+    return 0;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    RxOpts o;
+    uint32_t selftest_n = 0, rate = 100;
+
+    for (int i = 1; i < argc; i++) {
+        if (!std::strcmp(argv[i], "--quiet")) { o.quiet = true; continue; }
+        if (i + 1 >= argc) break;
+        if (!std::strcmp(argv[i], "--port"))          o.port     = (uint16_t)std::atoi(argv[++i]);
+        else if (!std::strcmp(argv[i], "--loss"))     o.loss     = std::atof(argv[++i]);
+        else if (!std::strcmp(argv[i], "--selftest")) selftest_n = (uint32_t)std::atoi(argv[++i]);
+        else if (!std::strcmp(argv[i], "--rate"))     rate       = (uint32_t)std::atoi(argv[++i]);
+    }
+
+    if (selftest_n) return selftest(selftest_n, rate ? rate : 100, o);
+
+    int fd = bind_udp(o.port);
+    if (fd < 0) { std::perror("bind"); return 1; }
+    arq_rx_stats_t st = run_receiver(fd, o, nullptr);
+    (void)st;
+    close(fd);
+    return 0;
+}
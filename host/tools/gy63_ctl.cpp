@@ -0,0 +1,70 @@
+// FILE: host/tools/gy63_ctl.cpp
+// runtime control 명령 송신 + ack 대기 (id 자동 부여, timeout 시 재전송)
+//   gy63_ctl <board-ip> "cmd=set,osr=256,period_ms=20" [--port 5007] [--timeout-ms 500] [--retries 3]
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <string>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+int main(int argc, char **argv) {
+    if (argc < 3) {
+        std::fprintf(stderr, "usage: gy63_ctl <board-ip> <cmd=...> [--port 5007] [--timeout-ms 500] [--retries 3]\n");
+        return 1;
+    }
+
+    const char *ip = argv[1];
+    std::string cmd = argv[2];
+    uint16_t port = 5007;
+    int timeout_ms = 500, retries = 3;
+
+    for (int i = 3; i + 1 < argc; i += 2) {
+        if (!std::strcmp(argv[i], "--port"))            port       = (uint16_t)std::atoi(argv[i + 1]);
+        else if (!std::strcmp(argv[i], "--timeout-ms")) timeout_ms = std::atoi(argv[i + 1]);
+        else if (!std::strcmp(argv[i], "--retries"))    retries    = std::atoi(argv[i + 1]);
+    }
+
+    // 재전송이 중복 적용되지 않도록 ack는 id로 매칭
+    const unsigned id = (unsigned)(std::time(nullptr) & 0xFFFFFF);
+    if (cmd.find("id=") == std::string::npos) cmd += ",id=" + std::to_string(id);
+    const std::string want = "ack=" + std::to_string(id) + ",";
+
+    int fd = socket(AF_INET, SOCK_DGRAM, 0);
+    if (fd < 0) { std::perror("socket"); return 1; }
+
+    timeval tv{timeout_ms / 1000, (timeout_ms % 1000) * 1000};
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+
+    sockaddr_in dst{};
+    dst.sin_family = AF_INET;
+    dst.sin_port   = htons(port);
+    if (inet_pton(AF_INET, ip, &dst.sin_addr) != 1) { std::fprintf(stderr, "bad ip: %s\n", ip); return 1; }
+
+    for (int attempt = 0; attempt <= retries; attempt++) {
+        if (sendto(fd, cmd.data(), cmd.size(), 0, (sockaddr *)&dst, sizeof(dst)) < 0) {
+            std::perror("sendto");
+            return 1;
+        }
+
+        char buf[512];
+        ssize_t n;
+        while ((n = recv(fd, buf, sizeof(buf) - 1, 0)) > 0) {
+            buf[n] = '\0';
+            if (std::strncmp(buf, want.c_str(), want.size()) == 0) {
+                std::fputs(buf, stdout);
+                close(fd);
+                return std::strstr(buf, ",st=CTRL_OK,") ? 0 : 2;
+            }
+        }
+    }
+
+    std::fprintf(stderr, "no ack from %s:%u\n", ip, (unsigned)port);
+    close(fd);
+    return 3;
+}
@@ -0,0 +1,140 @@
+// FILE: host/tools/gy63_dlog.cpp
+// deferred log binary token decoder (firmware CFG_DLOG_BINARY=1, format: src/core/dlog.h)
+//   gy63_dlog /dev/ttyACM0 [--ts]      USB stdio (raw tty)
+//   gy63_dlog capture.bin [--ts]       저장된 capture
+//   gy63_dlog - [--ts]                 stdin
+// token은 firmware와 같은 format table로 text 복원, token이 아닌 byte(일반 printf 출력)는 그대로 통과
+//   --ts: 복원한 줄 앞에 "[ts_ms] "
+// 종료 시 stderr에 JSON line (tokens / id별 개수 / 보고된 drop / 비-token byte)
+#include <csignal>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include <fcntl.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include "bench_util.h"
+
+extern "C" {
+#include "dlog.h"
+}
+
+namespace {
+
+volatile sig_atomic_t g_stop = 0;
+
+struct Totals {
+    uint64_t bytes    = 0;
+    uint64_t tokens   = 0;
+    uint64_t text     = 0;    // 통과시킨 비-token byte
+    uint64_t dropped  = 0;    // DLOG_DROPPED record 합
+    uint64_t per_id[DLOG_ID_COUNT] = {};
+};
+
+int open_input(const char *path) {
+    if (!std::strcmp(path, "-")) return STDIN_FILENO;
+
+    int fd = open(path, O_RDONLY | O_NOCTTY);
+    if (fd < 0) return -1;
+
+    termios tio{};
+    if (isatty(fd) && tcgetattr(fd, &tio) == 0) {
+        cfmakeraw(&tio);
+        tio.c_cc[VMIN]  = 1;
+        tio.c_cc[VTIME] = 0;
+        tcsetattr(fd, TCSANOW, &tio);
+    }
+    return fd;
+}
+
+void on_token(const dlog_rec_t &r, bool ts, Totals &t) {
+    t.tokens++;
+    if (r.id < DLOG_ID_COUNT) t.per_id[r.id]++;
+    if (r.id == DLOG_DROPPED && r.nargs > 0) t.dropped += r.arg[0];
+
+    char line[DLOG_LINE_MAX];
+    const size_t n = dlog_format(&r, line, sizeof(line));
+    if (n == 0) return;
+    if (ts) std::printf("[%lu] ", (unsigned long)r.ts_ms);
+    std::fwrite(line, 1, n, stdout);
+}
+
+// buf 앞에서 가능한 만큼 처리 후 소비한 byte 수 리턴
+size_t decode(const uint8_t *buf, size_t len, bool ts, bool eof, Totals &t) {
+    size_t off = 0;
+    while (off < len) {
+        dlog_rec_t r;
+        const int32_t n = dlog_token_parse(buf + off, len - off, &r);
+        if (n == 0) {
+            if (!eof) break;
+            // 끝에 잘린 token: text로 취급
+            std::fwrite(buf + off, 1, len - off, stdout);
+            t.text += len - off;
+            off = len;
+            break;
+        }
+        if (n < 0) {
+            std::fwrite(buf + off, 1, (size_t)-n, stdout);
+            t.text += (uint64_t)-n;
+            off += (size_t)-n;
+            continue;
+        }
+        on_token(r, ts, t);
+        off += (size_t)n;
+    }
+    return off;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    const char *path = nullptr;
+    bool ts = false;
+
+    for (int i = 1; i < argc; i++) {
+        if (!std::strcmp(argv[i], "--ts")) { ts = true; continue; }
+        path = argv[i];
+    }
+    if (!path) {
+        std::fprintf(stderr, "usage: gy63_dlog <tty|file|-> [--ts]\n");
+        return 2;
+    }
+
+    const int fd = open_input(path);
+    if (fd < 0) { std::perror(path); return 1; }
+    std::signal(SIGINT, [](int) { g_stop = 1; });
+
+    Totals t;
+    std::vector<uint8_t> buf;
+    uint8_t chunk[4096];
+    const double t0 = bench::now_s();
+
+    while (!g_stop) {
+        const ssize_t n = read(fd, chunk, sizeof(chunk));
+        if (n <= 0) break;
+        t.bytes += (uint64_t)n;
+        buf.insert(buf.end(), chunk, chunk + n);
+
+        const size_t used = decode(buf.data(), buf.size(), ts, false, t);
+        buf.erase(buf.begin(), buf.begin() + (std::ptrdiff_t)used);
+        std::fflush(stdout);
+    }
+    (void)decode(buf.data(), buf.size(), ts, true, t);
+    std::fflush(stdout);
+    if (fd != STDIN_FILENO) close(fd);
+
+    bench::Json j("dlog_decode");
+    j.rate(t.tokens, bench::now_s() - t0, t.bytes)
+        .num("text_bytes", (double)t.text)
+        .num("reported_drops", (double)t.dropped);
+    static const char *const names[DLOG_ID_COUNT] = {
+#define DLOG_X_NAME(name, fmt) #name,
+        DLOG_FORMATS(DLOG_X_NAME)
+#undef DLOG_X_NAME
+    };
+    for (uint32_t i = 0; i < DLOG_ID_COUNT; i++) j.num(names[i], (double)t.per_id[i]);
+    j.print(stderr);
+    return 0;
+}
@@ -0,0 +1,291 @@
+// FILE: host/tools/gy63_echo.cpp
+// end-to-end latency 진단 (firmware CFG_LAT_PROBE_ENABLE)
+//   gy63_echo [--port 5005] [--delay-us 0] [--loss 0] [--print]
+//       stand-in responder: telemetry datagram의 header seq를 송신자에게 echo (gy63_ingest --echo와 같은 응답)
+//       --delay-us: echo 전 지연 (느린 collector 흉내), --loss: echo를 확률적으로 생략
+//       --print   : 수신 payload를 stdout으로 (장치 "stat=lat" 줄 확인용)
+//   gy63_echo --probe 192.168.0.10:5005 [--count 1000] [--rate 100] [--batch 1]
+//       stand-in device: firmware와 같은 datagram(tlm_hdr + 샘플 줄)을 보내고 lat_probe로 rtt 측정
+//   gy63_echo --selftest 1000 [--rate 100] [--delay-us 0] [--loss 0]
+//       같은 프로세스에서 responder + device를 127.0.0.1로 연결
+// 결과: JSON line (turnaround / rtt p50/p99/max)
+#include <atomic>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <thread>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "bench_util.h"
+#include "latency_hist.h"
+
+extern "C" {
+#include "lat_probe.h"
+#include "tlm_buffer.h"
+#include "tlm_fmt.h"
+#include "tlm_hdr.h"
+}
+
+namespace {
+
+uint32_t now_us32() {
+    return (uint32_t)(uint64_t)(bench::now_s() * 1e6);
+}
+
+int bind_udp(uint16_t port) {
+    int fd = socket(AF_INET, SOCK_DGRAM, 0);
+    if (fd < 0) return -1;
+    sockaddr_in a{};
+    a.sin_family      = AF_INET;
+    a.sin_port        = htons(port);
+    a.sin_addr.s_addr = htonl(INADDR_ANY);
+    if (bind(fd, (sockaddr *)&a, sizeof(a)) != 0) { close(fd); return -1; }
+    return fd;
+}
+
+struct Opts {
+    uint16_t port     = 5005;
+    uint32_t delay_us = 0;
+    double   loss     = 0;
+    bool     print    = false;
+    uint32_t count    = 1000;
+    uint32_t rate     = 100;
+    uint32_t batch    = 1;
+};
+
+struct ResponderResult {
+    uint64_t datagrams = 0;
+    uint64_t echoes    = 0;
+    uint64_t no_hdr    = 0;
+    ingest::LatencyHist turnaround; // 수신 -> echo 송신 (ns)
+};
+
+ResponderResult run_responder(int fd, const Opts &o, std::atomic<bool> *stop) {
+    ResponderResult r;
+    std::mt19937 rng(11);
+    uint8_t buf[2048];
+
+    while (!stop || !stop->load()) {
+        pollfd pfd{fd, POLLIN, 0};
+        if (poll(&pfd, 1, 20) <= 0) continue;
+
+        sockaddr_in from{};
+        socklen_t flen = sizeof(from);
+        const ssize_t n = recvfrom(fd, buf, sizeof(buf), 0, (sockaddr *)&from, &flen);
+        if (n <= 0) continue;
+        const double t_rx = bench::now_s();
+        r.datagrams++;
+        if (o.print) std::fwrite(buf, 1, (size_t)n, stdout);
+
+        uint8_t echo[LAT_ECHO_SIZE];
+        if (!lat_probe_make_echo(buf, (size_t)n, echo)) {
+            r.no_hdr++;
+            continue;
+        }
+        if (o.loss > 0 && std::uniform_real_distribution<double>(0, 1)(rng) < o.loss) continue;
+        if (o.delay_us) std::this_thread::sleep_for(std::chrono::microseconds(o.delay_us));
+
+        if (sendto(fd, echo, sizeof(echo), 0, (sockaddr *)&from, flen) == (ssize_t)sizeof(echo)) {
+            r.echoes++;
+            r.turnaround.add((uint64_t)((bench::now_s() - t_rx) * 1e9));
+        }
+    }
+    return r;
+}
+
+struct ProbeResult {
+    lat_probe_stats_t stats{};
+    ingest::LatencyHist c2s;   // us
+    ingest::LatencyHist rtt;   // us
+    double sec = 0;
+};
+
+// 대기 중 echo 처리 -> rtt를 전체 histogram에도 누적 (lat_probe window는 보고 주기마다 초기화)
+void drain_echoes(int fd, lat_probe_t &lp, ProbeResult &res) {
+    uint8_t buf[64];
+    ssize_t n;
+    while ((n = recv(fd, buf, sizeof(buf), MSG_DONTWAIT)) > 0) {
+        if (lat_probe_on_echo(&lp, buf, (size_t)n, now_us32())) {
+            res.rtt.add(lp.rtt.v[(lp.rtt.n - 1u) % LAT_PROBE_WINDOW]);
+        }
+    }
+}
+
+// firmware 송신 경로 흉내: 샘플 batch -> header + 샘플 줄 -> sendto, 1초마다 "stat=lat" 줄
+ProbeResult run_probe(int fd, const sockaddr_in &dst, const Opts &o) {
+    ProbeResult res;
+    lat_probe_t lp;
+    const uint32_t boot = 0x5EEDB007u;
+    lat_probe_init(&lp, boot, 1000);
+
+    tlm_hdr_t hdr;
+    tlm_hdr_init(&hdr, boot, 0x00000000E0E0E0E0ull);
+
+    const uint32_t batch = o.batch ? o.batch : 1;
+    const double dt = 1.0 / (o.rate ? o.rate : 1);
+    const double t0 = bench::now_s();
+    double t_report = t0 + 1.0;
+
+    char pkt[1024];
+    size_t len = 0;
+    uint32_t conv_us = 0, in_batch = 0;
+
+    for (uint32_t i = 0; i < o.count; i++) {
+        while (bench::now_s() - t0 < i * dt) {
+            drain_echoes(fd, lp, res);
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+
+        // "conversion 완료" = 샘플 생성 시각
+        const uint32_t c_us = now_us32();
+        if (in_batch == 0) {
+            conv_us = c_us;
+            len = tlm_hdr_format(&hdr, pkt, sizeof(pkt));
+        }
+        const tlm_sample_t s{(uint64_t)((bench::now_s() - t0) * 1000.0), 2007, 100009};
+        len += tlm_fmt_sample(pkt + len, sizeof(pkt) - len, &s);
+
+        if (++in_batch >= batch) {
+            const uint32_t send_us = now_us32();
+            if (sendto(fd, pkt, len, 0, (const sockaddr *)&dst, sizeof(dst)) == (ssize_t)len) {
+                lat_probe_on_send(&lp, hdr.seq, conv_us, send_us);
+                res.c2s.add(send_us - conv_us);
+                tlm_hdr_commit(&hdr);
+            }
+            in_batch = 0;
+        }
+
+        lat_probe_expire(&lp, now_us32());
+        if (bench::now_s() >= t_report) {
+            char line[256];
+            const size_t n = lat_probe_stats_line(&lp, (uint64_t)((bench::now_s() - t0) * 1000.0), line, sizeof(line));
+            std::fwrite(line, 1, n, stderr);
+            t_report += 1.0;
+        }
+    }
+
+    // 마지막 echo 대기 (timeout까지)
+    const double t_end = bench::now_s();
+    while (bench::now_s() - t_end < 1.1) {
+        drain_echoes(fd, lp, res);
+        lat_probe_expire(&lp, now_us32());
+        if (lp.stats.echoed + lp.stats.lost >= lp.stats.probed) break;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    lat_probe_expire(&lp, now_us32() + lp.timeout_us + 1u);
+
+    res.sec   = bench::now_s() - t0;
+    res.stats = lp.stats;
+    return res;
+}
+
+void print_probe(const char *name, const ProbeResult &r, const Opts &o) {
+    bench::Json(name)
+        .num("rate", o.rate)
+        .num("batch", o.batch)
+        .num("probed", r.stats.probed)
+        .num("echoed", r.stats.echoed)
+        .num("lost", r.stats.lost)
+        .num("stray", r.stats.stray)
+        .num("c2s_p50_us", (double)r.c2s.percentile(0.50))
+        .num("c2s_p99_us", (double)r.c2s.percentile(0.99))
+        .num("c2s_max_us", (double)r.c2s.max())
+        .num("rtt_p50_us", (double)r.rtt.percentile(0.50))
+        .num("rtt_p99_us", (double)r.rtt.percentile(0.99))
+        .num("rtt_max_us", (double)r.rtt.max())
+        .print();
+}
+
+void print_responder(const ResponderResult &r) {
+    bench::Json("echo_responder")
+        .num("datagrams", (double)r.datagrams)
+        .num("echoes", (double)r.echoes)
+        .num("no_hdr", (double)r.no_hdr)
+        .num("turnaround_p50_us", (double)r.turnaround.percentile(0.50) / 1e3)
+        .num("turnaround_p99_us", (double)r.turnaround.percentile(0.99) / 1e3)
+        .num("turnaround_max_us", (double)r.turnaround.max() / 1e3)
+        .print();
+}
+
+bool parse_hostport(const char *s, sockaddr_in &out) {
+    const char *colon = std::strrchr(s, ':');
+    if (!colon) return false;
+    const std::string host(s, (size_t)(colon - s));
+    out = sockaddr_in{};
+    out.sin_family = AF_INET;
+    out.sin_port   = htons((uint16_t)std::atoi(colon + 1));
+    return inet_pton(AF_INET, host.c_str(), &out.sin_addr) == 1;
+}
+
+std::atomic<bool> g_stop{false};
+
+} // namespace
+
+int main(int argc, char **argv) {
+    Opts o;
+    uint32_t selftest_n = 0;
+    const char *probe = nullptr;
+
+    for (int i = 1; i < argc; i++) {
+        if (!std::strcmp(argv[i], "--print")) { o.print = true; continue; }
+        if (i + 1 >= argc) break;
+        if (!std::strcmp(argv[i], "--port"))          o.port     = (uint16_t)std::atoi(argv[++i]);
+        else if (!std::strcmp(argv[i], "--delay-us")) o.delay_us = (uint32_t)std::atoi(argv[++i]);
+        else if (!std::strcmp(argv[i], "--loss"))     o.loss     = std::atof(argv[++i]);
+        else if (!std::strcmp(argv[i], "--count"))    o.count    = (uint32_t)std::atoi(argv[++i]);
+        else if (!std::strcmp(argv[i], "--rate"))     o.rate     = (uint32_t)std::atoi(argv[++i]);
+        else if (!std::strcmp(argv[i], "--batch"))    o.batch    = (uint32_t)std::atoi(argv[++i]);
+        else if (!std::strcmp(argv[i], "--probe"))    probe      = argv[++i];
+        else if (!std::strcmp(argv[i], "--selftest")) selftest_n = (uint32_t)std::atoi(argv[++i]);
+    }
+
+    if (probe) {
+        sockaddr_in dst;
+        if (!parse_hostport(probe, dst)) { std::fprintf(stderr, "bad --probe %s (ip:port)\n", probe); return 2; }
+        int fd = bind_udp(0);
+        if (fd < 0) { std::perror("bind"); return 1; }
+        print_probe("echo_probe", run_probe(fd, dst, o), o);
+        close(fd);
+        return 0;
+    }
+
+    if (selftest_n) {
+        int rfd = bind_udp(o.port);
+        int tfd = bind_udp(0);
+        if (rfd < 0 || tfd < 0) { std::perror("bind"); return 1; }
+
+        ResponderResult rr;
+        std::thread rxt([&] { rr = run_responder(rfd, o, &g_stop); });
+
+        sockaddr_in dst{};
+        dst.sin_family      = AF_INET;
+        dst.sin_port        = htons(o.port);
+        dst.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        o.count = selftest_n;
+        const ProbeResult pr = run_probe(tfd, dst, o);
+
+        g_stop = true;
+        rxt.join();
+        print_probe("echo_selftest", pr, o);
+        print_responder(rr);
+        close(rfd);
+        close(tfd);
+        return (pr.stats.echoed > 0) ? 0 : 1;
+    }
+
+    int fd = bind_udp(o.port);
+    if (fd < 0) { std::perror("bind"); return 1; }
+    std::signal(SIGINT, [](int) { g_stop = true; });
+    std::fprintf(stderr, "gy63_echo: responder on udp/%u\n", (unsigned)o.port);
+    print_responder(run_responder(fd, o, &g_stop));
+    close(fd);
+    return 0;
+}
@@ -0,0 +1,199 @@
+// FILE: host/tools/gy63_flashlog.cpp
+// black-box flash log 추출 도구
+//   recv   : firmware bulk readout(UDP) 수신 -> raw page 파일
+//   decode : raw page 파일 (dump 또는 picotool로 읽은 flash image) -> CSV
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include "bench_util.h"
+
+extern "C" {
+#include "flash_log.h"
+}
+
+namespace {
+
+uint32_t rd_u32(const uint8_t *p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+uint16_t rd_u16(const uint8_t *p) {
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+void usage() {
+    std::fprintf(stderr,
+                 "usage:\n"
+                 "  gy63_flashlog recv [--port 5006] [--out flog.bin] [--idle-ms 5000]\n"
+                 "  gy63_flashlog decode <pages.bin> [--out samples.csv]\n"
+                 "\n"
+                 "decode accepts the recv output or a raw image of the log region, e.g.\n"
+                 "  picotool save -r 0x10200000 0x10400000 flog.bin\n");
+}
+
+int cmd_recv(int argc, char **argv) {
+    uint16_t port = 5006;
+    std::string out = "flog.bin";
+    int idle_ms = 5000;
+
+    for (int i = 0; i + 1 < argc; i += 2) {
+        if (!std::strcmp(argv[i], "--port"))         port    = (uint16_t)std::atoi(argv[i + 1]);
+        else if (!std::strcmp(argv[i], "--out"))     out     = argv[i + 1];
+        else if (!std::strcmp(argv[i], "--idle-ms")) idle_ms = std::atoi(argv[i + 1]);
+    }
+
+    int fd = socket(AF_INET, SOCK_DGRAM, 0);
+    if (fd < 0) { std::perror("socket"); return 1; }
+
+    int rcvbuf = 8 << 20; // burst 대비
+    setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &rcvbuf, sizeof(rcvbuf));
+
+    sockaddr_in addr{};
+    addr.sin_family      = AF_INET;
+    addr.sin_port        = htons(port);
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    if (bind(fd, (sockaddr *)&addr, sizeof(addr)) != 0) { std::perror("bind"); return 1; }
+
+    timeval tv{idle_ms / 1000, (idle_ms % 1000) * 1000};
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+
+    std::fprintf(stderr, "waiting for dump on udp/%u ...\n", (unsigned)port);
+
+    // chunk index 순서로 정렬해서 기록 (UDP 재정렬 대비)
+    std::map<uint32_t, std::vector<uint8_t>> chunks;
+    std::vector<uint8_t> buf(65536);
+    uint32_t last_chunk = 0;
+    bool got_last = false, started = false;
+    double t_first = 0, t_last = 0;
+    uint64_t bytes = 0;
+
+    while (!got_last) {
+        ssize_t n = recv(fd, buf.data(), buf.size(), 0);
+        if (n < 0) {
+            if (started) break; // idle timeout
+            continue;
+        }
+        if ((size_t)n < FLASH_LOG_DUMP_HDR_SIZE || rd_u32(buf.data()) != FLASH_LOG_DUMP_MAGIC) continue;
+
+        const uint32_t chunk = rd_u32(buf.data() + 4);
+        const uint16_t pages = rd_u16(buf.data() + 8);
+        const uint16_t flags = rd_u16(buf.data() + 10);
+        const size_t   len   = (size_t)pages * FLASH_LOG_PAGE_SIZE;
+
+        if (!started) { started = true; t_first = bench::now_s(); }
+        t_last = bench::now_s();
+
+        if (flags & FLASH_LOG_DUMP_FLAG_LAST) { got_last = true; last_chunk = chunk; break; }
+        if ((size_t)n != FLASH_LOG_DUMP_HDR_SIZE + len) continue;
+
+        chunks[chunk].assign(buf.data() + FLASH_LOG_DUMP_HDR_SIZE, buf.data() + n);
+        bytes += len;
+    }
+    close(fd);
+
+    FILE *f = std::fopen(out.c_str(), "wb");
+    if (!f) { std::perror(out.c_str()); return 1; }
+    for (const auto &kv : chunks) std::fwrite(kv.second.data(), 1, kv.second.size(), f);
+    std::fclose(f);
+
+    uint32_t missing = 0;
+    if (got_last) missing = last_chunk - (uint32_t)chunks.size();
+
+    bench::Json("flashlog/recv")
+        .rate(bytes / FLASH_LOG_PAGE_SIZE, t_last - t_first, bytes)
+        .num("chunks", (double)chunks.size())
+        .num("missing_chunks", missing)
+        .num("complete", got_last ? 1 : 0)
+        .str("out", out)
+        .print();
+    return (got_last && missing == 0) ? 0 : 2;
+}
+
+int cmd_decode(int argc, char **argv) {
+    if (argc < 1) { usage(); return 1; }
+    const std::string in = argv[0];
+    std::string out;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (!std::strcmp(argv[i], "--out")) out = argv[i + 1];
+    }
+
+    FILE *f = std::fopen(in.c_str(), "rb");
+    if (!f) { std::perror(in.c_str()); return 1; }
+
+    struct Page {
+        flash_log_page_info_t info;
+        std::vector<uint8_t> raw;
+    };
+    std::vector<Page> pages;
+    uint8_t raw[FLASH_LOG_PAGE_SIZE];
+    uint64_t total = 0, blank = 0;
+
+    while (std::fread(raw, 1, sizeof(raw), f) == sizeof(raw)) {
+        total++;
+        flash_log_page_info_t info;
+        if (flash_log_page_decode(raw, &info)) {
+            pages.push_back({info, std::vector<uint8_t>(raw, raw + sizeof(raw))});
+        } else if (std::all_of(raw, raw + sizeof(raw), [](uint8_t b) { return b == 0xFF; })) {
+            blank++;
+        }
+    }
+    std::fclose(f);
+
+    // flash image는 circular 순서이므로 page_seq로 정렬, 중복 제거
+    std::sort(pages.begin(), pages.end(),
+              [](const Page &a, const Page &b) { return a.info.page_seq < b.info.page_seq; });
+    pages.erase(std::unique(pages.begin(), pages.end(),
+                            [](const Page &a, const Page &b) { return a.info.page_seq == b.info.page_seq; }),
+                pages.end());
+
+    FILE *o = out.empty() ? stdout : std::fopen(out.c_str(), "w");
+    if (!o) { std::perror(out.c_str()); return 1; }
+
+    std::fprintf(o, "sample_seq,boot_id,ms,t_x100,p_pa\n");
+    uint64_t samples = 0, gaps = 0;
+    bool have_prev = false;
+    uint32_t expect = 0;
+
+    for (const Page &p : pages) {
+        if (have_prev && p.info.sample_seq != expect) gaps++;
+        for (uint16_t i = 0; i < p.info.count; i++) {
+            tlm_sample_t s;
+            flash_log_page_sample(p.raw.data(), &p.info, i, &s);
+            std::fprintf(o, "%u,%u,%llu,%ld,%lu\n",
+                         p.info.sample_seq + i, p.info.boot_id,
+                         (unsigned long long)s.ms, (long)s.t_x100, (unsigned long)s.p_pa);
+            samples++;
+        }
+        expect    = p.info.sample_seq + p.info.count;
+        have_prev = true;
+    }
+    if (o != stdout) std::fclose(o);
+
+    std::fprintf(stderr, "pages=%llu valid=%zu blank=%llu invalid=%llu samples=%llu seq_gaps=%llu\n",
+                 (unsigned long long)total, pages.size(), (unsigned long long)blank,
+                 (unsigned long long)(total - pages.size() - blank),
+                 (unsigned long long)samples, (unsigned long long)gaps);
+    return 0;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    if (argc < 2) { usage(); return 1; }
+    const std::string cmd = argv[1];
+    if (cmd == "recv")   return cmd_recv(argc - 2, argv + 2);
+    if (cmd == "decode") return cmd_decode(argc - 2, argv + 2);
+    usage();
+    return 1;
+}
@@ -0,0 +1,259 @@
+// FILE: host/tools/gy63_ingest.cpp
+// telemetry UDP collector (CFG_UDP_DST_PORT 수신측)
+//   gy63_ingest [--port 5005] [--workers 4] [--rx-threads 1] [--batch 64]
+//               [--duration 0] [--report-s 1] [--nodes] [--echo] [--store DIR]
+//   --duration 0 : Ctrl-C까지. 종료 시 JSON 요약 (pps, kernel->parse latency p50/p99/p999/max)
+//   --nodes      : 종료 시 node별 집계 출력
+//   --echo       : header seq를 송신측으로 echo (firmware CFG_LAT_PROBE_ENABLE, 장치가 rtt 측정)
+//                  요약에 echo turnaround (kernel 수신 -> echo 송신) p50/p99/max 추가
+//   --store DIR  : 샘플을 time-series store (host/store/ts_store.h)에 node별로 append
+//                  시각 = host epoch ms 기준: node의 첫 샘플(및 reboot) 때 (수신 시각 - device ms)로 고정
+//                  node id = header uid, 없으면 ip:port
+//   --prom-port N: raw passthrough frame (src/core/tlm_raw.h)은 host에서 보상. PROM 없는 session이면
+//                  장치의 이 포트로 "cmd=prom" 요청 (기본 5007 = CFG_CTRL_PORT, 0: 요청 안 함)
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+#include <arpa/inet.h>
+
+#include "bench_util.h"
+#include "ingest.h"
+#include "ts_store.h"
+
+namespace {
+
+std::atomic<bool> g_stop{false};
+
+void on_signal(int) {
+    g_stop = true;
+}
+
+void print_nodes(const std::vector<ingest::NodeStats> &nodes) {
+    std::vector<ingest::NodeStats> v = nodes;
+    std::sort(v.begin(), v.end(), [](const ingest::NodeStats &a, const ingest::NodeStats &b) {
+        return ingest::node_key(a.src_ip, a.src_port) < ingest::node_key(b.src_ip, b.src_port);
+    });
+
+    std::fprintf(stderr, "%-21s %-16s %10s %10s %6s %6s %8s %7s %6s %5s %9s %12s\n",
+                 "node", "uid", "packets", "samples", "stat", "bad",
+                 "loss%", "reord", "depth", "dup", "jitter_ms", "last_ms");
+    for (const auto &n : v) {
+        char addr[32];
+        const uint8_t *ip = (const uint8_t *)&n.src_ip;
+        std::snprintf(addr, sizeof(addr), "%u.%u.%u.%u:%u", ip[0], ip[1], ip[2], ip[3], (unsigned)n.src_port);
+        const ingest::SeqStats::Snapshot sq = n.seq.snapshot();
+        std::fprintf(stderr, "%-21s %016llx %10llu %10llu %6llu %6llu %8.3f %7llu %6u %5llu %9.3f %12llu\n", addr,
+                     (unsigned long long)n.uid,
+                     (unsigned long long)n.packets, (unsigned long long)n.samples,
+                     (unsigned long long)n.stats, (unsigned long long)n.bad,
+                     sq.loss_rate() * 100.0, (unsigned long long)sq.reordered, (unsigned)sq.max_reorder_depth,
+                     (unsigned long long)sq.duplicates, sq.jitter_ms, (unsigned long long)n.last_ms);
+    }
+}
+
+int64_t wall_ms() {
+    using namespace std::chrono;
+    return duration_cast<milliseconds>(system_clock::now().time_since_epoch()).count();
+}
+
+// store 기록 상태는 store id 단위로 공유. worker는 ip:port로 sharding 되므로 IP/port가 바뀐 node(같은 uid)는
+// 다른 worker로 감 -> Series(단일 writer)와 anchor는 node별 mutex로 보호 (평소엔 경합 없음)
+struct StoreNode {
+    std::mutex mu;
+    store::Series *series = nullptr;
+    int64_t  anchor_ms = 0;     // host epoch ms - device ms
+    uint64_t last_ms   = 0;
+};
+
+struct StoreNodes {
+    std::mutex mu;
+    std::unordered_map<uint64_t, std::unique_ptr<StoreNode>> map;
+
+    StoreNode *get(uint64_t id) {
+        std::lock_guard<std::mutex> lk(mu);
+        std::unique_ptr<StoreNode> &n = map[id];
+        if (!n) n.reset(new StoreNode);
+        return n.get();
+    }
+};
+
+struct StoreWorker {
+    std::unordered_map<uint64_t, StoreNode *> cache;   // StoreNodes 조회 생략 (포인터는 종료까지 유효)
+    uint64_t appended = 0;
+    uint64_t errors   = 0;
+};
+
+constexpr uint64_t kRebootBackMs = 60000;   // device ms가 이만큼 되돌아가면 reboot로 보고 재고정
+
+void store_sample(store::Store &st, StoreNodes &nodes, StoreWorker &w, const ingest::NodeStats &node,
+                  const tlm::Record &rec) {
+    const uint64_t id = node.uid ? node.uid : ingest::node_key(node.src_ip, node.src_port);
+    StoreNode *&sn = w.cache[id];
+    if (!sn) sn = nodes.get(id);
+
+    std::lock_guard<std::mutex> lk(sn->mu);
+    if (!sn->series) {
+        sn->series = st.series(id);
+        if (!sn->series) { w.errors++; return; }
+        sn->anchor_ms = wall_ms() - (int64_t)rec.ms;
+    } else if (rec.ms + kRebootBackMs < sn->last_ms) {
+        sn->anchor_ms = wall_ms() - (int64_t)rec.ms;
+    }
+    sn->last_ms = rec.ms;
+
+    if (sn->series->append(store::Sample{sn->anchor_ms + (int64_t)rec.ms, rec.t_x100, rec.p_pa})) w.appended++;
+    else w.errors++;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    ingest::Config cfg;
+    double duration = 0, report_s = 1.0;
+    bool show_nodes = false;
+    const char *store_dir = nullptr;
+
+    for (int i = 1; i < argc; i++) {
+        if (!std::strcmp(argv[i], "--nodes")) { show_nodes = true; continue; }
+        if (!std::strcmp(argv[i], "--echo"))  { cfg.echo = true; continue; }
+        if (i + 1 >= argc) break;
+        if (!std::strcmp(argv[i], "--port"))            cfg.port       = (uint16_t)std::atoi(argv[++i]);
+        else if (!std::strcmp(argv[i], "--workers"))    cfg.workers    = std::atoi(argv[++i]);
+        else if (!std::strcmp(argv[i], "--rx-threads")) cfg.rx_threads = std::atoi(argv[++i]);
+        else if (!std::strcmp(argv[i], "--batch"))      cfg.batch      = std::atoi(argv[++i]);
+        else if (!std::strcmp(argv[i], "--duration"))   duration       = std::atof(argv[++i]);
+        else if (!std::strcmp(argv[i], "--report-s"))   report_s       = std::atof(argv[++i]);
+        else if (!std::strcmp(argv[i], "--store"))      store_dir      = argv[++i];
+        else if (!std::strcmp(argv[i], "--prom-port"))  cfg.prom_req_port = (uint16_t)std::atoi(argv[++i]);
+    }
+
+    std::signal(SIGINT, on_signal);
+    std::signal(SIGTERM, on_signal);
+
+    ingest::Collector col(cfg);
+
+    std::unique_ptr<store::Store> st;
+    StoreNodes st_nodes;
+    std::vector<StoreWorker> st_workers((size_t)std::max(cfg.workers, 1));
+    if (store_dir) {
+        st.reset(new store::Store(store_dir));
+        if (!st->open()) { std::perror(store_dir); return 1; }
+        col.set_sample_fn([&](int worker, const ingest::NodeStats &node, const tlm::Record &rec) {
+            store_sample(*st, st_nodes, st_workers[(size_t)worker], node, rec);
+        });
+    }
+
+    if (!col.start()) return 1;
+    std::fprintf(stderr, "ingest: udp/%u rx_threads=%d workers=%d batch=%d%s\n",
+                 (unsigned)cfg.port, cfg.rx_threads, cfg.workers, cfg.batch, cfg.echo ? " echo" : "");
+
+    const double t0 = bench::now_s();
+    double t_report = t0 + report_s;
+    double t_first = 0, t_last = 0;  // 첫/마지막 datagram 처리 관측 시각 (pps 구간)
+    uint64_t last_count = 0;
+    ingest::Totals prev;
+
+    while (!g_stop.load()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        const double now = bench::now_s();
+        if (duration > 0 && now - t0 >= duration) break;
+
+        const ingest::Totals t = col.totals();
+        if (t.datagrams != last_count) {
+            if (t_first == 0) t_first = now;
+            t_last = now;
+            last_count = t.datagrams;
+        }
+        if (report_s > 0 && now >= t_report) {
+            const double dt = now - t_report + report_s;
+            std::fprintf(stderr, "pkt/s=%.0f samples/s=%.0f ring_drop=%llu kernel_drop=%llu bad=%llu\n",
+                         (double)(t.datagrams - prev.datagrams) / dt,
+                         (double)(t.samples - prev.samples) / dt,
+                         (unsigned long long)t.ring_drops, (unsigned long long)t.kernel_drops,
+                         (unsigned long long)t.bad_lines);
+            prev = t;
+            t_report = now + report_s;
+        }
+    }
+
+    col.stop();
+    if (st) st->flush(true);
+
+    const ingest::Totals t = col.totals();
+    const ingest::LatencyHist lat = col.latency();
+    const ingest::LatencyHist echo_lat = col.echo_latency();
+    const double active = t_last > t_first ? t_last - t_first : 0;
+
+    const std::vector<ingest::NodeStats> nodes = col.nodes();
+    if (show_nodes) print_nodes(nodes);
+
+    // 전체 sequence 통계 (header 있는 node만)
+    uint64_t expected = 0, lost = 0, reordered = 0, dups = 0;
+    uint32_t max_depth = 0;
+    double jitter_max = 0;
+    for (const auto &n : nodes) {
+        const ingest::SeqStats::Snapshot sq = n.seq.snapshot();
+        expected  += sq.expected;
+        lost      += sq.lost;
+        reordered += sq.reordered;
+        dups      += sq.duplicates;
+        max_depth  = std::max(max_depth, sq.max_reorder_depth);
+        jitter_max = std::max(jitter_max, sq.jitter_ms);
+    }
+
+    bench::Json js("ingest");
+    js
+        .num("workers", cfg.workers)
+        .num("rx_threads", cfg.rx_threads)
+        .num("nodes", (double)t.nodes)
+        .num("datagrams", (double)t.datagrams)
+        .num("samples", (double)t.samples)
+        .num("stat_lines", (double)t.stat_lines)
+        .num("bad_lines", (double)t.bad_lines)
+        .num("ring_drops", (double)t.ring_drops)
+        .num("kernel_drops", (double)t.kernel_drops)
+        .num("seq_expected", (double)expected)
+        .num("seq_lost", (double)lost)
+        .num("loss_rate", expected ? (double)lost / (double)expected : 0)
+        .num("reordered", (double)reordered)
+        .num("max_reorder_depth", max_depth)
+        .num("duplicates", (double)dups)
+        .num("jitter_ms_max", jitter_max)
+        .num("pkts_per_s", active > 0 ? (double)t.datagrams / active : 0)
+        .num("pkts_per_rx_call", t.rx_calls ? (double)t.datagrams / (double)t.rx_calls : 0)
+        .num("lat_p50_us", (double)lat.percentile(0.50) / 1e3)
+        .num("lat_p99_us", (double)lat.percentile(0.99) / 1e3)
+        .num("lat_p999_us", (double)lat.percentile(0.999) / 1e3)
+        .num("lat_max_us", (double)lat.max() / 1e3);
+    if (cfg.echo) {
+        js.num("echoes", (double)t.echoes)
+            .num("echo_p50_us", (double)echo_lat.percentile(0.50) / 1e3)
+            .num("echo_p99_us", (double)echo_lat.percentile(0.99) / 1e3)
+            .num("echo_max_us", (double)echo_lat.max() / 1e3);
+    }
+    if (t.raw_frames) {
+        js.num("raw_frames", (double)t.raw_frames)
+            .num("prom_requests", (double)t.prom_reqs);
+    }
+    if (st) {
+        uint64_t appended = 0, errors = 0;
+        for (const StoreWorker &w : st_workers) {
+            appended += w.appended;
+            errors   += w.errors;
+        }
+        js.num("store_nodes", (double)st->nodes().size())
+            .num("store_samples", (double)appended)
+            .num("store_errors", (double)errors);
+    }
+    js.print();
+    return 0;
+}
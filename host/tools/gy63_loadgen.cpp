@@ -0,0 +1,222 @@
+// FILE: host/tools/gy63_loadgen.cpp
+// 가상 node 트래픽 생성기 (gy63_ingest 부하 측정용)
+//   gy63_loadgen [--dst 127.0.0.1] [--port 5005] [--nodes 32] [--rate 100] [--batch 1]
+//                [--duration 5] [--threads 2]
+//   node마다 별도 socket(= 별도 source port)으로 firmware와 같은 텍스트 format 송신
+//   --rate : node당 datagram/s (0 = 최대 속도), --batch : datagram당 샘플 수
+//   [--loss p] [--reorder p] [--dup p] : seq 통계 검증용 인위적 손실/순서 뒤바꿈/중복 (확률)
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "bench_util.h"
+
+extern "C" {
+#include "tlm_hdr.h"
+}
+
+namespace {
+
+constexpr int kMaxBurst = 64;   // sendmmsg 1회 최대 datagram
+
+struct Node {
+    int      fd = -1;
+    uint64_t sent = 0;          // datagram
+    uint64_t ms = 0;            // 마지막 샘플 device 시각
+    int32_t  t_x100 = 2500;
+    uint32_t p_pa = 101325;
+    uint32_t rng = 1;
+    tlm_hdr_t hdr;
+};
+
+struct Opts {
+    sockaddr_in dst{};
+    int    nodes = 32;
+    double rate = 100;
+    int    batch = 1;
+    double duration = 5;
+    int    threads = 2;
+    double loss = 0, reorder = 0, dup = 0;
+};
+
+uint32_t xorshift(uint32_t &s) {
+    s ^= s << 13;
+    s ^= s >> 17;
+    s ^= s << 5;
+    return s;
+}
+
+bool chance(uint32_t &rng, double p) {
+    return p > 0 && (double)(xorshift(rng) & 0xFFFFFF) < p * (double)0x1000000;
+}
+
+// firmware gy63_tx + format_sample과 같은 format (header 줄 + 샘플 줄)
+// dev_ms: 송신 시점 가상 device 시각 (수신측 jitter 계산 기준)
+size_t build_datagram(Node &n, int batch, uint64_t dev_ms, char *out, size_t out_sz) {
+    size_t len = tlm_hdr_format(&n.hdr, out, out_sz);
+    tlm_hdr_commit(&n.hdr);
+    for (int i = 0; i < batch; i++) {
+        n.ms = dev_ms + (uint64_t)i;
+        n.t_x100 += (int32_t)(xorshift(n.rng) % 5) - 2;
+        n.p_pa   += (uint32_t)(xorshift(n.rng) % 7) - 3u;
+        int k = std::snprintf(out + len, out_sz - len, "ms=%llu,t_x100=%ld,p_pa=%u\n",
+                              (unsigned long long)n.ms, (long)n.t_x100, (unsigned)n.p_pa);
+        if (k <= 0 || (size_t)k >= out_sz - len) break;
+        len += (size_t)k;
+    }
+    return len;
+}
+
+struct ThreadResult {
+    uint64_t datagrams = 0;
+    uint64_t bytes = 0;
+    uint64_t errors = 0;
+};
+
+void run_thread(const Opts &o, std::vector<Node> &nodes, double t0, ThreadResult &res) {
+    static thread_local char bufs[kMaxBurst][2048];
+    mmsghdr msgs[kMaxBurst];
+    iovec iov[kMaxBurst];
+
+    while (true) {
+        const double el = bench::now_s() - t0;
+        if (el >= o.duration) break;
+
+        bool any = false;
+        for (Node &n : nodes) {
+            uint64_t due = o.rate > 0 ? (uint64_t)(el * o.rate) - std::min<uint64_t>(n.sent, (uint64_t)(el * o.rate))
+                                      : (uint64_t)kMaxBurst;
+            if (due == 0) continue;
+            if (due > (uint64_t)kMaxBurst) due = kMaxBurst;
+
+            // 인위적 손실: 번호만 소모하고 보내지 않음 / 중복: 같은 buffer 한 번 더
+            uint64_t m = 0;
+            for (uint64_t i = 0; i < due && m < (uint64_t)kMaxBurst; i++) {
+                const size_t len = build_datagram(n, o.batch, (uint64_t)(el * 1000.0), bufs[m], sizeof(bufs[m]));
+                if (chance(n.rng, o.loss)) continue;
+                iov[m].iov_base = bufs[m];
+                iov[m].iov_len  = len;
+                m++;
+                if (m < (uint64_t)kMaxBurst && chance(n.rng, o.dup)) {
+                    iov[m] = iov[m - 1];
+                    m++;
+                }
+            }
+            // 재정렬: 인접 datagram 교환
+            for (uint64_t i = 0; i + 1 < m; i++) {
+                if (chance(n.rng, o.reorder)) {
+                    std::swap(iov[i], iov[i + 1]);
+                    i++;
+                }
+            }
+            for (uint64_t i = 0; i < m; i++) {
+                std::memset(&msgs[i], 0, sizeof(msgs[i]));
+                msgs[i].msg_hdr.msg_name    = (void *)&o.dst;
+                msgs[i].msg_hdr.msg_namelen = sizeof(o.dst);
+                msgs[i].msg_hdr.msg_iov     = &iov[i];
+                msgs[i].msg_hdr.msg_iovlen  = 1;
+            }
+
+            n.sent += due; // 페이싱 유지 (실패/손실분은 버림)
+            if (m == 0) continue;
+
+            const int k = sendmmsg(n.fd, msgs, (unsigned)m, 0);
+            if (k < 0) {
+                res.errors++;
+                continue;
+            }
+            for (int i = 0; i < k; i++) res.bytes += iov[i].iov_len;
+            res.datagrams += (uint64_t)k;
+            res.errors    += m - (uint64_t)k;
+            any = true;
+        }
+
+        if (!any && o.rate > 0) std::this_thread::sleep_for(std::chrono::microseconds(200));
+    }
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    Opts o;
+    const char *dst_ip = "127.0.0.1";
+    uint16_t port = 5005;
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (!std::strcmp(argv[i], "--dst"))           dst_ip     = argv[i + 1];
+        else if (!std::strcmp(argv[i], "--port"))     port       = (uint16_t)std::atoi(argv[i + 1]);
+        else if (!std::strcmp(argv[i], "--nodes"))    o.nodes    = std::atoi(argv[i + 1]);
+        else if (!std::strcmp(argv[i], "--rate"))     o.rate     = std::atof(argv[i + 1]);
+        else if (!std::strcmp(argv[i], "--batch"))    o.batch    = std::atoi(argv[i + 1]);
+        else if (!std::strcmp(argv[i], "--duration")) o.duration = std::atof(argv[i + 1]);
+        else if (!std::strcmp(argv[i], "--threads"))  o.threads  = std::atoi(argv[i + 1]);
+        else if (!std::strcmp(argv[i], "--loss"))     o.loss     = std::atof(argv[i + 1]);
+        else if (!std::strcmp(argv[i], "--reorder"))  o.reorder  = std::atof(argv[i + 1]);
+        else if (!std::strcmp(argv[i], "--dup"))      o.dup      = std::atof(argv[i + 1]);
+    }
+    o.nodes   = std::max(1, o.nodes);
+    o.threads = std::max(1, std::min(o.threads, o.nodes));
+    o.batch   = std::max(1, std::min(o.batch, 16));
+
+    o.dst.sin_family = AF_INET;
+    o.dst.sin_port   = htons(port);
+    if (inet_pton(AF_INET, dst_ip, &o.dst.sin_addr) != 1) {
+        std::fprintf(stderr, "bad --dst %s\n", dst_ip);
+        return 1;
+    }
+
+    // node -> thread 분배
+    std::vector<std::vector<Node>> groups((size_t)o.threads);
+    for (int i = 0; i < o.nodes; i++) {
+        Node n;
+        n.fd  = socket(AF_INET, SOCK_DGRAM, 0);
+        n.rng = 0x9E3779B9u * (uint32_t)(i + 1);
+        tlm_hdr_init(&n.hdr, xorshift(n.rng), 0xE660000000000000ull | (uint64_t)i);
+        if (n.fd < 0) { std::perror("socket"); return 1; }
+        groups[(size_t)(i % o.threads)].push_back(n);
+    }
+
+    std::vector<ThreadResult> res((size_t)o.threads);
+    std::vector<std::thread> th;
+    const double t0 = bench::now_s();
+    for (int t = 0; t < o.threads; t++) {
+        th.emplace_back([&, t] { run_thread(o, groups[(size_t)t], t0, res[(size_t)t]); });
+    }
+    for (auto &x : th) x.join();
+    const double el = bench::now_s() - t0;
+
+    ThreadResult sum;
+    for (const auto &r : res) {
+        sum.datagrams += r.datagrams;
+        sum.bytes     += r.bytes;
+        sum.errors    += r.errors;
+    }
+    for (auto &g : groups) {
+        for (auto &n : g) close(n.fd);
+    }
+
+    bench::Json("loadgen")
+        .num("nodes", o.nodes)
+        .num("rate_per_node", o.rate)
+        .num("batch", o.batch)
+        .num("loss", o.loss)
+        .num("reorder", o.reorder)
+        .num("dup", o.dup)
+        .num("datagrams", (double)sum.datagrams)
+        .num("samples", (double)sum.datagrams * o.batch)
+        .num("send_errors", (double)sum.errors)
+        .num("pkts_per_s", (double)sum.datagrams / el)
+        .num("mb_per_s", (double)sum.bytes / el / 1e6)
+        .print();
+    return 0;
+}
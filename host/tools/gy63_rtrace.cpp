@@ -0,0 +1,210 @@
+// FILE: host/tools/gy63_rtrace.cpp
+// raw trace 도구 (firmware CFG_RTRACE_ENABLE, format: src/core/rtrace.h)
+//   gy63_rtrace recv --udp 5009 -o FILE [--seconds 0]
+//       datagram(= chunk 1개)을 검증해서 FILE에 이어 붙임. 1초마다 stderr에 rate
+//   gy63_rtrace info FILE
+//       JSON line: chunk/유실 seq/resync/sample/error/OSR 변경/기간/sample당 byte
+//   gy63_rtrace export FILE
+//       text: "prom=w0,...,w7" 후 줄마다 "D1,D2,t_us" (bench_sample_path --raw 입력과 호환)
+//   gy63_rtrace synth -o FILE [--hours 1] [--hz 10]
+//       합성 trace (host/bench/rtrace_synth.h) -> replay/benchmark 입력
+// 재생(보상 -> 필터 -> format)은 bench_replay
+#include <atomic>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "bench_util.h"
+#include "rtrace_io.h"
+#include "rtrace_synth.h"
+
+namespace {
+
+std::atomic<bool> g_stop{false};
+
+int bind_udp(uint16_t port) {
+    int fd = socket(AF_INET, SOCK_DGRAM, 0);
+    if (fd < 0) return -1;
+    int rcvbuf = 4 << 20;
+    setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &rcvbuf, sizeof(rcvbuf));
+    sockaddr_in a{};
+    a.sin_family      = AF_INET;
+    a.sin_port        = htons(port);
+    a.sin_addr.s_addr = htonl(INADDR_ANY);
+    if (bind(fd, (sockaddr *)&a, sizeof(a)) != 0) { close(fd); return -1; }
+    return fd;
+}
+
+int cmd_recv(uint16_t port, const char *path, double seconds) {
+    const int fd = bind_udp(port);
+    if (fd < 0) { std::perror("bind"); return 1; }
+    FILE *out = std::fopen(path, "ab");
+    if (!out) { std::perror(path); close(fd); return 1; }
+
+    std::signal(SIGINT, [](int) { g_stop = true; });
+    uint8_t buf[2048];
+    uint64_t chunks = 0, bytes = 0, bad = 0, prev_bytes = 0;
+    const double t0 = bench::now_s();
+    double t_last = t0;
+
+    while (!g_stop.load()) {
+        pollfd pfd{fd, POLLIN, 0};
+        const int pr = poll(&pfd, 1, 100);
+        const double now = bench::now_s();
+        if (now - t_last >= 1.0) {
+            std::fprintf(stderr, "rtrace: %llu chunks, %.1f kB/s (bad=%llu)\n", (unsigned long long)chunks,
+                         (double)(bytes - prev_bytes) / (now - t_last) / 1e3, (unsigned long long)bad);
+            prev_bytes = bytes;
+            t_last     = now;
+        }
+        if (seconds > 0 && now - t0 >= seconds) break;
+        if (pr <= 0) continue;
+
+        const ssize_t n = recv(fd, buf, sizeof(buf), 0);
+        if (n <= 0) continue;
+        // 손상 datagram은 파일에 넣지 않음 (replay는 seq 구멍으로 유실만 봄)
+        rtrace_info_t info;
+        if (rtrace_parse(buf, (size_t)n, &info) != (int32_t)n) { bad++; continue; }
+        if (std::fwrite(buf, 1, (size_t)n, out) != (size_t)n) { std::perror("write"); break; }
+        chunks++;
+        bytes += (uint64_t)n;
+    }
+    std::fclose(out);
+    close(fd);
+
+    bench::Json("rtrace_recv")
+        .rate(chunks, bench::now_s() - t0, bytes)
+        .num("bad", (double)bad)
+        .print();
+    return 0;
+}
+
+int cmd_info(const char *path) {
+    std::vector<uint8_t> data;
+    if (!rtrace_io::load(path, data)) { std::perror(path); return 1; }
+
+    uint64_t samples = 0, errors = 0, osr_changes = 0, hdrs = 0, t_end = 0;
+    uint16_t prom[8] = {};
+    const rtrace_io::Scan sc = rtrace_io::for_each_event(data.data(), data.size(), [&](const rtrace_io::Event &e) {
+        switch (e.ev.kind) {
+        case RTRACE_EV_HDR:
+            hdrs++;
+            std::memcpy(prom, e.ev.prom, sizeof(prom));
+            break;
+        case RTRACE_EV_SAMPLE: samples++; t_end = e.t_us; break;
+        case RTRACE_EV_OSR:    osr_changes++; break;
+        case RTRACE_EV_ERR:    errors++; break;
+        }
+    });
+
+    char prom_s[64];
+    std::snprintf(prom_s, sizeof(prom_s), "%u,%u,%u,%u,%u,%u,%u,%u", prom[0], prom[1], prom[2], prom[3],
+                  prom[4], prom[5], prom[6], prom[7]);
+    bench::Json("rtrace_info")
+        .str("file", path)
+        .num("bytes", (double)data.size())
+        .num("chunks", (double)sc.chunks)
+        .num("lost_chunks", (double)sc.lost)
+        .num("resync_bytes", (double)sc.resync)
+        .num("bad_chunks", (double)sc.bad)
+        .num("boots", (double)sc.boots)
+        .num("headers", (double)hdrs)
+        .num("samples", (double)samples)
+        .num("errors", (double)errors)
+        .num("osr_changes", (double)osr_changes)
+        .num("duration_s", (double)t_end / 1e6)
+        .num("bytes_per_sample", samples ? (double)data.size() / (double)samples : 0.0)
+        .str("prom", prom_s)
+        .print();
+    return (sc.bad == 0) ? 0 : 1;
+}
+
+int cmd_export(const char *path) {
+    std::vector<uint8_t> data;
+    if (!rtrace_io::load(path, data)) { std::perror(path); return 1; }
+
+    bool have_prom = false;
+    const rtrace_io::Scan sc = rtrace_io::for_each_event(data.data(), data.size(), [&](const rtrace_io::Event &e) {
+        if (e.ev.kind == RTRACE_EV_HDR && !have_prom) {
+            const uint16_t *w = e.ev.prom;
+            std::printf("prom=%u,%u,%u,%u,%u,%u,%u,%u\n", w[0], w[1], w[2], w[3], w[4], w[5], w[6], w[7]);
+            have_prom = true;
+        } else if (e.ev.kind == RTRACE_EV_SAMPLE) {
+            std::printf("%lu,%lu,%llu\n", (unsigned long)e.ev.d1, (unsigned long)e.ev.d2,
+                        (unsigned long long)e.t_us);
+        }
+    });
+    if (sc.lost || sc.bad) {
+        std::fprintf(stderr, "warning: lost=%llu bad=%llu chunks\n", (unsigned long long)sc.lost,
+                     (unsigned long long)sc.bad);
+    }
+    return 0;
+}
+
+int cmd_synth(const char *path, double hours, uint32_t hz) {
+    rtrace_synth::Params prm;
+    prm.hours = hours;
+    prm.hz    = hz;
+    const double t0 = bench::now_s();
+    const rtrace_synth::Result r = rtrace_synth::make(prm);
+    if (!rtrace_io::save(path, r.bytes)) { std::perror(path); return 1; }
+
+    bench::Json("rtrace_synth")
+        .str("file", path)
+        .num("hours", hours)
+        .num("hz", hz)
+        .num("samples", (double)r.samples)
+        .num("errors", (double)r.errors)
+        .num("chunks", (double)r.chunks)
+        .num("bytes", (double)r.bytes.size())
+        .num("bytes_per_sample", r.samples ? (double)r.bytes.size() / (double)r.samples : 0.0)
+        .num("sec", bench::now_s() - t0)
+        .print();
+    return 0;
+}
+
+void usage() {
+    std::fprintf(stderr,
+                 "usage: gy63_rtrace recv --udp PORT -o FILE [--seconds S]\n"
+                 "       gy63_rtrace info FILE\n"
+                 "       gy63_rtrace export FILE\n"
+                 "       gy63_rtrace synth -o FILE [--hours H] [--hz HZ]\n");
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    if (argc < 2) { usage(); return 2; }
+    const char *cmd = argv[1];
+
+    const char *file = nullptr;
+    const char *out  = nullptr;
+    uint16_t port = 0;
+    double seconds = 0, hours = 1.0;
+    uint32_t hz = 10;
+
+    for (int i = 2; i < argc; i++) {
+        if (argv[i][0] != '-') { file = argv[i]; continue; }
+        if (i + 1 >= argc) break;
+        if (!std::strcmp(argv[i], "--udp"))          port    = (uint16_t)std::atoi(argv[++i]);
+        else if (!std::strcmp(argv[i], "-o"))        out     = argv[++i];
+        else if (!std::strcmp(argv[i], "--seconds")) seconds = std::atof(argv[++i]);
+        else if (!std::strcmp(argv[i], "--hours"))   hours   = std::atof(argv[++i]);
+        else if (!std::strcmp(argv[i], "--hz"))      hz      = (uint32_t)std::atoi(argv[++i]);
+    }
+
+    if (!std::strcmp(cmd, "recv") && port && out)  return cmd_recv(port, out, seconds);
+    if (!std::strcmp(cmd, "info") && file)         return cmd_info(file);
+    if (!std::strcmp(cmd, "export") && file)       return cmd_export(file);
+    if (!std::strcmp(cmd, "synth") && out && hz)   return cmd_synth(out, hours, hz);
+    usage();
+    return 2;
+}
@@ -0,0 +1,302 @@
+// FILE: host/tools/gy63_usb_rx.cpp
+// binary sample stream reader (firmware CFG_BIN_STREAM_USB / CFG_BIN_STREAM_UDP, frame: src/core/tlm_bin.h)
+//   gy63_usb_rx /dev/ttyACM1 [--seconds 0] [--print]
+//       USB CDC 1 (raw tty). 열면 DTR이 올라가 장치가 송신 시작
+//   gy63_usb_rx --udp 5008 [--seconds 0] [--print]
+//       같은 frame을 UDP datagram으로 수신
+//   gy63_usb_rx --selftest 1000000 [--batch 16] [--corrupt 0]
+//       encoder -> socketpair(stream) -> decoder 를 최대 속도로 (decoder/재동기 경로 처리량 상한)
+//       --corrupt: frame당 1 byte를 이 확률로 뒤집음 (CRC 실패 -> 재동기 확인)
+// 진행: 1초마다 stderr에 rate, 종료 시 JSON line (frames/samples/seq gap/resync byte + 처리량)
+#include <atomic>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include "bench_util.h"
+
+extern "C" {
+#include "tlm_bin.h"
+}
+
+namespace {
+
+std::atomic<bool> g_stop{false};
+
+struct RxStats {
+    uint64_t bytes       = 0;
+    uint64_t frames      = 0;
+    uint64_t samples     = 0;
+    uint64_t seq_gaps    = 0;   // 빠진 frame 수 (seq 기준)
+    uint64_t resync      = 0;   // 버린 byte (frame 경계 아님 / CRC 실패)
+    bool     have_seq    = false;
+    uint32_t last_seq    = 0;
+    int64_t  sum_p       = 0;   // 최적화 방지 + 간단 확인용
+};
+
+// byte stream -> frame 단위 decode (경계는 magic + CRC로 재동기)
+class Decoder {
+public:
+    explicit Decoder(bool print) : print_(print) { buf_.reserve(1u << 16); }
+
+    void feed(const uint8_t *p, size_t n, RxStats &st) {
+        st.bytes += n;
+        buf_.insert(buf_.end(), p, p + n);
+
+        size_t off = 0;
+        while (off < buf_.size()) {
+            tlm_bin_info_t info;
+            const int32_t r = tlm_bin_parse(buf_.data() + off, buf_.size() - off, &info);
+            if (r == 0) break;
+            if (r < 0) {
+                st.resync += (uint64_t)-r;
+                off += (size_t)-r;
+                continue;
+            }
+            on_frame(buf_.data() + off, info, st);
+            off += (size_t)r;
+        }
+        buf_.erase(buf_.begin(), buf_.begin() + (std::ptrdiff_t)off);
+    }
+
+    // datagram은 1개 = frame 1개 (잔여 byte는 버림)
+    void datagram(const uint8_t *p, size_t n, RxStats &st) {
+        st.bytes += n;
+        tlm_bin_info_t info;
+        const int32_t r = tlm_bin_parse(p, n, &info);
+        if (r > 0) on_frame(p, info, st);
+        else       st.resync += n;
+    }
+
+private:
+    void on_frame(const uint8_t *frame, const tlm_bin_info_t &info, RxStats &st) {
+        if (st.have_seq && info.seq != st.last_seq + 1u) {
+            const uint32_t d = info.seq - st.last_seq - 1u;
+            // 역행(장치 재부팅)은 gap이 아니라 새 stream
+            if (d < 0x80000000u) st.seq_gaps += d;
+        }
+        st.have_seq = true;
+        st.last_seq = info.seq;
+        st.frames++;
+        st.samples += info.count;
+
+        for (uint16_t i = 0; i < info.count; i++) {
+            tlm_sample_t s;
+            tlm_bin_sample(frame, &info, i, &s);
+            st.sum_p += s.p_pa;
+            if (print_) {
+                std::printf("ms=%llu,t_x100=%ld,p_pa=%lu\n", (unsigned long long)s.ms, (long)s.t_x100,
+                            (unsigned long)s.p_pa);
+            }
+        }
+    }
+
+    std::vector<uint8_t> buf_;
+    bool print_;
+};
+
+int open_tty(const char *path) {
+    int fd = open(path, O_RDONLY | O_NOCTTY);
+    if (fd < 0) return -1;
+
+    termios tio{};
+    if (tcgetattr(fd, &tio) == 0) {
+        cfmakeraw(&tio);
+        tio.c_cc[VMIN]  = 0;
+        tio.c_cc[VTIME] = 0;
+        tcsetattr(fd, TCSANOW, &tio);
+    }
+    tcflush(fd, TCIFLUSH);
+    return fd;
+}
+
+int bind_udp(uint16_t port) {
+    int fd = socket(AF_INET, SOCK_DGRAM, 0);
+    if (fd < 0) return -1;
+    int rcvbuf = 4 << 20;
+    setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &rcvbuf, sizeof(rcvbuf));
+    sockaddr_in a{};
+    a.sin_family      = AF_INET;
+    a.sin_port        = htons(port);
+    a.sin_addr.s_addr = htonl(INADDR_ANY);
+    if (bind(fd, (sockaddr *)&a, sizeof(a)) != 0) { close(fd); return -1; }
+    return fd;
+}
+
+void print_progress(const RxStats &st, const RxStats &prev, double dt) {
+    std::fprintf(stderr, "rx: %.1f kB/s, %.0f frames/s, %.0f samples/s (gaps=%llu resync=%llu)\n",
+                 (double)(st.bytes - prev.bytes) / dt / 1e3,
+                 (double)(st.frames - prev.frames) / dt,
+                 (double)(st.samples - prev.samples) / dt,
+                 (unsigned long long)st.seq_gaps, (unsigned long long)st.resync);
+}
+
+void print_result(const char *name, const RxStats &st, double sec) {
+    bench::Json(name)
+        .rate(st.frames, sec, st.bytes)
+        .num("samples", (double)st.samples)
+        .num("samples_per_s", sec > 0 ? (double)st.samples / sec : 0)
+        .num("seq_gaps", (double)st.seq_gaps)
+        .num("resync_bytes", (double)st.resync)
+        .print();
+}
+
+// fd에서 읽어 decode (stream: tty / socketpair, 아니면 datagram)
+RxStats run_reader(int fd, bool stream, bool print, double seconds, bool progress, double *sec_out) {
+    RxStats st, prev;
+    Decoder dec(print);
+    std::vector<uint8_t> buf(1u << 16);
+
+    const double t0 = bench::now_s();
+    double t_last = t0;
+
+    while (!g_stop.load()) {
+        pollfd pfd{fd, POLLIN, 0};
+        const int pr = poll(&pfd, 1, 100);
+        const double now = bench::now_s();
+
+        if (progress && now - t_last >= 1.0) {
+            print_progress(st, prev, now - t_last);
+            prev   = st;
+            t_last = now;
+        }
+        if (seconds > 0 && now - t0 >= seconds) break;
+        if (pr <= 0) continue;
+
+        const ssize_t n = stream ? read(fd, buf.data(), buf.size()) : recv(fd, buf.data(), buf.size(), 0);
+        if (n == 0 && stream) break; // EOF (selftest writer 종료 / 장치 분리)
+        if (n < 0) continue;
+
+        if (stream) dec.feed(buf.data(), (size_t)n, st);
+        else        dec.datagram(buf.data(), (size_t)n, st);
+    }
+
+    *sec_out = bench::now_s() - t0;
+    return st;
+}
+
+// encoder -> fd (blocking write, 최대 속도)
+void run_writer(int fd, uint32_t n_samples, uint32_t batch, double corrupt, uint64_t *bytes_out) {
+    tlm_bin_enc_t enc;
+    tlm_bin_init(&enc);
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<double> u(0.0, 1.0);
+
+    std::vector<uint8_t> out;
+    out.reserve(1u << 16);
+    uint64_t bytes = 0;
+
+    auto flush_out = [&] {
+        size_t off = 0;
+        while (off < out.size()) {
+            const ssize_t w = write(fd, out.data() + off, out.size() - off);
+            if (w <= 0) return;
+            off += (size_t)w;
+        }
+        bytes += out.size();
+        out.clear();
+    };
+
+    auto emit = [&] {
+        const uint8_t *frame = nullptr;
+        const size_t len = tlm_bin_finish(&enc, &frame);
+        if (len == 0) return;
+        const size_t at = out.size();
+        out.insert(out.end(), frame, frame + len);
+        if (corrupt > 0 && u(rng) < corrupt) out[at + (size_t)(rng() % len)] ^= 0x5Au;
+        if (out.size() >= 32768u) flush_out();
+    };
+
+    for (uint32_t i = 0; i < n_samples; i++) {
+        const tlm_sample_t s = {
+            .ms     = 1000u + (uint64_t)i * 10u,
+            .t_x100 = 2000 + (int32_t)(i % 500u),
+            .p_pa   = 100000u + (i % 1000u),
+        };
+        if (!tlm_bin_add(&enc, &s)) {
+            emit();
+            (void)tlm_bin_add(&enc, &s);
+        }
+        if (enc.count >= batch) emit();
+    }
+    emit();
+    flush_out();
+    *bytes_out = bytes;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    const char *tty = nullptr;
+    uint16_t udp_port = 0;
+    uint32_t selftest_n = 0;
+    uint32_t batch = 16;
+    double seconds = 0;
+    double corrupt = 0;
+    bool print = false;
+
+    for (int i = 1; i < argc; i++) {
+        if (!std::strcmp(argv[i], "--print")) { print = true; continue; }
+        if (argv[i][0] != '-') { tty = argv[i]; continue; }
+        if (i + 1 >= argc) break;
+        if (!std::strcmp(argv[i], "--udp"))           udp_port   = (uint16_t)std::atoi(argv[++i]);
+        else if (!std::strcmp(argv[i], "--seconds"))  seconds    = std::atof(argv[++i]);
+        else if (!std::strcmp(argv[i], "--selftest")) selftest_n = (uint32_t)std::atoi(argv[++i]);
+        else if (!std::strcmp(argv[i], "--batch"))    batch      = (uint32_t)std::atoi(argv[++i]);
+        else if (!std::strcmp(argv[i], "--corrupt"))  corrupt    = std::atof(argv[++i]);
+    }
+    if (batch == 0 || batch > TLM_BIN_MAX_BATCH) batch = TLM_BIN_MAX_BATCH;
+
+    if (selftest_n) {
+        int sv[2];
+        if (socketpair(AF_UNIX, SOCK_STREAM, 0, sv) != 0) { std::perror("socketpair"); return 1; }
+
+        uint64_t wbytes = 0;
+        std::thread wt([&] {
+            run_writer(sv[1], selftest_n, batch, corrupt, &wbytes);
+            close(sv[1]);
+        });
+
+        double sec = 0;
+        const RxStats st = run_reader(sv[0], true, false, 0, false, &sec);
+        wt.join();
+        close(sv[0]);
+
+        print_result("usb_rx_selftest", st, sec);
+        // 손상 없으면 전 샘플 복원 + byte 일치해야 함
+        const bool ok = corrupt > 0 ? st.frames > 0 : (st.samples == selftest_n && st.bytes == wbytes && st.resync == 0);
+        return ok ? 0 : 1;
+    }
+
+    int fd = -1;
+    bool stream = true;
+    if (udp_port) {
+        fd = bind_udp(udp_port);
+        stream = false;
+    } else if (tty) {
+        fd = open_tty(tty);
+    } else {
+        std::fprintf(stderr, "usage: gy63_usb_rx <tty> | --udp PORT | --selftest N  [--seconds S] [--print]\n");
+        return 2;
+    }
+    if (fd < 0) { std::perror(udp_port ? "bind" : tty); return 1; }
+
+    std::signal(SIGINT, [](int) { g_stop = true; });
+    double sec = 0;
+    const RxStats st = run_reader(fd, stream, print, seconds, true, &sec);
+    close(fd);
+    print_result(udp_port ? "bin_rx_udp" : "bin_rx_usb", st, sec);
+    return 0;
+}
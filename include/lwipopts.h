@@ -48,6 +48,8 @@
 #define LWIP_IPV4                   1
 #define LWIP_TCP                    1
 #define LWIP_UDP                    1
+#define LWIP_IGMP                   1   // telemetry fan-out / control group (net_udp_join_group)
+#define LWIP_MULTICAST_TX_OPTIONS   1   // udp_set_multicast_ttl
 #define LWIP_DNS                    1
 #define LWIP_TCP_KEEPALIVE          1
 #define LWIP_NETIF_TX_SINGLE_PBUF   1
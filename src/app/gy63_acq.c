@@ -0,0 +1,173 @@
+// FILE: src/app/gy63_acq.c
+#include "gy63_acq.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "pico/stdlib.h"
+
+// ---------- internal helpers (IRQ 컨텍스트) ----------
+
+static void on_cmd_done(i2c_pico_status_t st, void *user);
+
+// 다음 conversion command (ADC read 완료 IRQ에서)
+static void start_conv(gy63_acq_t *a, bool is_temp) {
+    a->tx[0] = ms5611_conv_cmd(is_temp, a->osr);
+    a->phase = is_temp ? 1u : 2u;
+    if (i2c_pico_async_xfer(a->dev->i2c, a->dev->addr7, a->tx, 1, NULL, 0, on_cmd_done, a) != I2C_PICO_OK) {
+        a->errors++;
+        a->phase = 0;
+    }
+}
+
+static void on_cmd_done(i2c_pico_status_t st, void *user) {
+    gy63_acq_t *a = (gy63_acq_t *)user;
+    if (st != I2C_PICO_OK) {
+        a->errors++;
+        a->phase = 0; // 다음 tick에서 온도부터
+    }
+}
+
+static void on_adc_done(i2c_pico_status_t st, void *user) {
+    gy63_acq_t *a = (gy63_acq_t *)user;
+    const uint32_t adc = ((uint32_t)a->rx[0] << 16) | ((uint32_t)a->rx[1] << 8) | a->rx[2];
+
+    // ADC 0 = 변환 미완료/중단 (datasheet)
+    if (st != I2C_PICO_OK || adc == 0) {
+        a->errors++;
+        a->phase = 0;
+        return;
+    }
+
+    bool next_temp = false;
+    if (a->phase == 1u) {
+        a->d2 = adc;
+        a->d2_count++;
+        a->d1_since_d2 = 0;
+    } else {
+        a->d1_count++;
+        a->d1_since_d2++;
+        next_temp = (a->d1_since_d2 >= a->temp_every);
+        (void)acq_buf_put(&a->buf, a->tick_us, adc, a->d2);
+    }
+    start_conv(a, next_temp);
+}
+
+// timer IRQ: 고정 주기 tick
+static bool on_tick(repeating_timer_t *rt) {
+    gy63_acq_t *a = (gy63_acq_t *)rt->user_data;
+    const uint32_t now = time_us_32();
+
+    // 예정보다 반 주기 이상 이르면 timer catch-up 호출 -> 무시
+    const int32_t late = (int32_t)(now - a->expect_us);
+    if (late < -(int32_t)(a->period_us / 2u)) return a->running;
+    if (late > 0) {
+        if ((uint32_t)late > a->late_max_us) a->late_max_us = (uint32_t)late;
+        const uint32_t skip = (uint32_t)late / a->period_us;
+        a->missed    += skip;
+        a->expect_us += skip * a->period_us;
+    }
+    a->expect_us += a->period_us;
+    a->ticks++;
+
+    acq_buf_tick(&a->buf, now);
+
+    if (i2c_pico_async_busy(a->dev->i2c)) {
+        a->busy++;
+        // 2 tick 연속이면 bus 정지로 보고 중단 (2회차 cancel = 강제 완료)
+        if (++a->busy_run >= 2u) {
+            i2c_pico_async_cancel(a->dev->i2c);
+            a->phase = 0;
+        }
+        return a->running;
+    }
+    a->busy_run = 0;
+    a->tick_us  = now;
+
+    if (a->phase == 0) {
+        start_conv(a, true);
+    } else {
+        a->tx[0] = MS5611_CMD_ADC_READ;
+        if (i2c_pico_async_xfer(a->dev->i2c, a->dev->addr7, a->tx, 1, a->rx, 3, on_adc_done, a) != I2C_PICO_OK) {
+            a->errors++;
+            a->phase = 0;
+        }
+    }
+
+    const uint32_t spent = time_us_32() - now;
+    if (spent > a->isr_max_us) a->isr_max_us = spent;
+    return a->running;
+}
+
+// ---------- public API ----------
+
+bool gy63_acq_start(gy63_acq_t *a, ms5611_t *dev, ms5611_osr_t osr, uint32_t period_us,
+                    uint32_t temp_every, uint32_t block_len, uint32_t flush_us) {
+    if (!a || !dev || !dev->i2c || !dev->initialized) return false;
+
+    memset(a, 0, sizeof(*a));
+    a->dev        = dev;
+    a->osr        = osr;
+    a->temp_every = temp_every ? temp_every : 1u;
+
+    // tick 사이에 ADC read + 변환이 끝나야 함
+    const uint32_t min_us = ms5611_conv_time_us(osr) + GY63_ACQ_BUS_US;
+    a->period_us = period_us < min_us ? min_us : period_us;
+
+    acq_buf_init(&a->buf, block_len, flush_us);
+    if (i2c_pico_async_init(dev->i2c) != I2C_PICO_OK) return false;
+
+    a->running   = true;
+    a->expect_us = time_us_32() + a->period_us;
+    // 음수 delay: 이전 예정 시각 기준 (callback 실행 시간으로 주기가 늘지 않음)
+    if (!add_repeating_timer_us(-(int64_t)a->period_us, on_tick, a, &a->timer)) {
+        a->running = false;
+        return false;
+    }
+    return true;
+}
+
+void gy63_acq_stop(gy63_acq_t *a) {
+    if (!a || !a->running) return;
+    a->running = false;
+    (void)cancel_repeating_timer(&a->timer);
+}
+
+void gy63_acq_note_flash(gy63_acq_t *a, uint32_t us) {
+    if (!a || us == 0) return;
+    a->flash_us += us;
+    if (us > a->flash_max_us) a->flash_max_us = us;
+}
+
+size_t gy63_acq_stats_line(gy63_acq_t *a, uint64_t now_ms, char *out, size_t out_sz) {
+    if (!a || !out || out_sz == 0) return 0;
+
+    const acq_buf_stats_t *bs = &a->buf.stats;
+    int n = snprintf(out, out_sz,
+                     "stat=acq,ms=%llu,hz=%lu,ticks=%lu,d1=%lu,d2=%lu,blocks=%lu,dropped=%lu,overruns=%lu,"
+                     "missed=%lu,busy=%lu,err=%lu,depth_max=%lu,isr_max_us=%lu,late_max_us=%lu,"
+                     "flash_us=%llu,flash_max_us=%lu\n",
+                     (unsigned long long)now_ms,
+                     (unsigned long)(1000000u / a->period_us),
+                     (unsigned long)a->ticks,
+                     (unsigned long)a->d1_count,
+                     (unsigned long)a->d2_count,
+                     (unsigned long)bs->consumed,
+                     (unsigned long)bs->dropped,
+                     (unsigned long)bs->overruns,
+                     (unsigned long)a->missed,
+                     (unsigned long)a->busy,
+                     (unsigned long)a->errors,
+                     (unsigned long)bs->depth_max,
+                     (unsigned long)a->isr_max_us,
+                     (unsigned long)a->late_max_us,
+                     (unsigned long long)a->flash_us,
+                     (unsigned long)a->flash_max_us);
+    if (n <= 0 || (size_t)n >= out_sz) return 0;
+
+    a->isr_max_us  = 0;
+    a->late_max_us = 0;
+    a->flash_max_us = 0;
+    a->buf.stats.depth_max = 0;
+    return (size_t)n;
+}
@@ -0,0 +1,91 @@
+// FILE: src/app/gy63_acq.h
+#ifndef __GY63_ACQ_H__
+#define __GY63_ACQ_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "pico/time.h" // repeating_timer_t
+
+#include "acq_buf.h"
+#include "drivers/ms5611.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+// interrupt 구동 MS5611 수집 (foreground loop와 분리)
+//
+//   timer IRQ (period_us 고정) ──> I2C ADC read ──I2C IRQ──> acq_buf_put + 다음 conversion command ──I2C IRQ──> 끝
+//
+// - tick마다 conversion 1개: 이전 tick에 시작한 변환 결과를 읽고 바로 다음 변환 시작 (D1 temp_every회마다 D2)
+//   -> period_us >= 변환 max + bus 시간 (start에서 보정)
+// - foreground는 acq_buf block 단위로 보상/처리. 밀려도 수집 주기는 그대로, ring이 차면 샘플 버림 (acq_buf 집계)
+// - tick 시점에 이전 I2C가 안 끝났으면 그 tick 생략 (busy), timer 자체가 늦어 건너뛴 period는 missed
+//   2 tick 연속 busy면 transfer 중단 후 온도부터 재시작
+// - 수집 중에는 같은 I2C bus를 foreground에서 쓰지 않음 (gy63_read / burst / registry와 같이 쓰지 않음)
+// - flash program/erase (gy63_rec)는 flash_safe_execute로 IRQ를 막음: sector erase (~45 ms) 동안 tick이
+//   돌지 못해 missed로 잡힘. foreground가 block 사이에서만 pre-erase 하고 그 시간을 gy63_acq_note_flash로
+//   넘김 -> stat=acq flash_us/flash_max_us (missed 중 flash 몫 확인용)
+
+#ifndef GY63_ACQ_BUS_US
+#define GY63_ACQ_BUS_US  (300u)    // tick당 I2C 시간 여유 (400 kHz: ADC read ~140 us + command ~50 us)
+#endif
+
+typedef struct {
+    ms5611_t    *dev;
+    acq_buf_t    buf;
+    repeating_timer_t timer;
+    bool         running;
+
+    ms5611_osr_t osr;
+    uint32_t     period_us;
+    uint32_t     temp_every;
+
+    // IRQ 상태
+    uint8_t  phase;         // 0: 재시작 대기, 1: D2 변환 중, 2: D1 변환 중
+    uint32_t d1_since_d2;
+    uint32_t d2;
+    uint32_t tick_us;       // 이번 tick (= 직전 conversion 완료 기준 시각)
+    uint32_t expect_us;     // 다음 tick 예정
+    uint32_t busy_run;
+    uint8_t  tx[1];         // async write 버퍼 (완료까지 유효)
+    uint8_t  rx[3];
+
+    // 통계 (IRQ 갱신, foreground 읽기)
+    uint32_t ticks;
+    uint32_t d1_count;
+    uint32_t d2_count;
+    uint32_t missed;        // timer 지연으로 건너뛴 period
+    uint32_t busy;          // 이전 I2C 진행 중으로 생략한 tick
+    uint32_t errors;        // I2C 오류 / ADC 0
+    uint32_t isr_max_us;    // tick handler 실행 최대 (보고 후 0)
+    uint32_t late_max_us;   // tick 지연 최대 (보고 후 0)
+
+    // foreground 갱신: flash 작업으로 IRQ가 막힌 시간
+    uint64_t flash_us;
+    uint32_t flash_max_us;  // note 1회 최대 (보고 후 0)
+} gy63_acq_t;
+
+// dev는 init 완료 상태. period_us가 변환에 모자라면 늘림 (a->period_us로 확인)
+// block_len / flush_us: acq_buf_init. I2C IRQ 등록 + timer 시작
+bool gy63_acq_start(gy63_acq_t *a, ms5611_t *dev, ms5611_osr_t osr, uint32_t period_us,
+                    uint32_t temp_every, uint32_t block_len, uint32_t flush_us);
+
+// timer 정지 (진행 중 I2C는 IRQ에서 끝남)
+void gy63_acq_stop(gy63_acq_t *a);
+
+// flash program/erase로 IRQ가 막혔던 시간 (foreground에서 flash 작업 직후 호출)
+void gy63_acq_note_flash(gy63_acq_t *a, uint32_t us);
+
+// "stat=acq,ms=..,hz=..,ticks=..,d1=..,d2=..,blocks=..,dropped=..,overruns=..,missed=..,busy=..,err=..,
+//  depth_max=..,isr_max_us=..,late_max_us=..,flash_us=..,flash_max_us=..\n"
+// 최대값은 보고 후 초기화
+size_t gy63_acq_stats_line(gy63_acq_t *a, uint64_t now_ms, char *out, size_t out_sz);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // __GY63_ACQ_H__
@@ -0,0 +1,120 @@
+// FILE: src/app/gy63_bench.c
+#include "gy63_bench.h"
+
+#include <stdio.h>
+
+#include "alt_est.h"
+#include "ms5611_math.h"
+#include "platform_core.h"
+#include "tlm_fmt.h"
+#include "tlm_raw.h"
+
+// 최적화로 결과가 사라지지 않도록
+static volatile uint32_t s_sink;
+
+static void report(const char *name, uint32_t iters, uint64_t us) {
+    const double ns  = (double)us * 1000.0 / (double)iters;
+    const double cyc = ns * (double)platform_cpu_hz() / 1e9;
+    // 여기서는 float printf 허용 (측정 구간 밖)
+    printf("{\"bench\":\"target/%s\",\"ops\":%lu,\"ns_per_op\":%.1f,\"cycles_per_op\":%.0f}\n",
+           name, (unsigned long)iters, ns, cyc);
+}
+
+void gy63_bench_fmt(uint32_t iters) {
+    if (iters == 0) return;
+
+    char buf[TLM_FMT_SAMPLE_MAX];
+    tlm_sample_t s = {.ms = 123456u, .t_x100 = 2534, .p_pa = 101325u};
+    uint32_t acc = 0;
+
+    uint64_t t0 = platform_micros();
+    for (uint32_t i = 0; i < iters; i++) {
+        s.ms += 10u;
+        s.t_x100 ^= (int32_t)(i & 7u);
+        acc += (uint32_t)snprintf(buf, sizeof(buf), "ms=%llu,t_x100=%ld,p_pa=%u\n",
+                                  (unsigned long long)s.ms, (long)s.t_x100, (unsigned)s.p_pa);
+    }
+    report("fmt_snprintf", iters, platform_micros() - t0);
+
+    t0 = platform_micros();
+    for (uint32_t i = 0; i < iters; i++) {
+        s.ms += 10u;
+        s.t_x100 ^= (int32_t)(i & 7u);
+        acc += (uint32_t)tlm_fmt_sample(buf, sizeof(buf), &s);
+    }
+    report("fmt_fast", iters, platform_micros() - t0);
+
+    t0 = platform_micros();
+    for (uint32_t i = 0; i < iters; i++) {
+        acc += (uint32_t)snprintf(buf, sizeof(buf), "%.2f", (double)(s.t_x100 + (int32_t)i) / 100.0);
+    }
+    report("fmt_snprintf_f2", iters, platform_micros() - t0);
+
+    t0 = platform_micros();
+    for (uint32_t i = 0; i < iters; i++) {
+        acc += (uint32_t)tlm_fmt_x100(buf, s.t_x100 + (int32_t)i);
+    }
+    report("fmt_x100", iters, platform_micros() - t0);
+
+    s_sink = acc;
+}
+
+void gy63_bench_est(uint32_t iters) {
+    if (iters == 0) return;
+
+    alt_est_t e;
+    alt_est_init(&e, NULL);
+    uint32_t p = 101325u;
+    uint32_t t_us = 0;
+    float acc = 0.0f;
+
+    uint64_t t0 = platform_micros();
+    for (uint32_t i = 0; i < iters; i++) {
+        p += (i & 3u) - 1u;     // 천천히 변하는 기압 (+ 작은 잡음)
+        t_us += 10000u;
+        (void)alt_est_update(&e, p, t_us);
+    }
+    report("est_update", iters, platform_micros() - t0);
+
+    t0 = platform_micros();
+    for (uint32_t i = 0; i < iters; i++) {
+        acc += alt_est_pa_to_m((float)(p + (i & 255u)), 101325.0f);
+    }
+    report("est_pa_to_m", iters, platform_micros() - t0);
+
+    s_sink = (uint32_t)alt_est_alt_cm(&e) ^ (uint32_t)(int32_t)acc;
+}
+
+void gy63_bench_raw(uint32_t iters) {
+    if (iters == 0) return;
+
+    // AN520 예제 계수 (20°C, 2000 mbar 부근)
+    static const uint16_t prom[8] = {0, 40127, 36924, 23317, 23282, 33464, 28312, 0};
+    ms5611_coeffs_t c;
+    ms5611_load_coeffs(prom, &c);
+
+    char buf[TLM_FMT_SAMPLE_MAX];
+    tlm_sample_t s = {.ms = 123456u};
+    uint32_t d1 = 9085466u, d2 = 8569150u;
+    uint32_t acc = 0;
+
+    uint64_t t0 = platform_micros();
+    for (uint32_t i = 0; i < iters; i++) {
+        s.ms += 10u;
+        (void)ms5611_compensate(&c, d1 + (i & 63u), d2 + (i & 7u), &s.t_x100, &s.p_pa);
+        acc += (uint32_t)tlm_fmt_sample(buf, sizeof(buf), &s);
+    }
+    report("sample_comp_fmt", iters, platform_micros() - t0);
+
+    static tlm_raw_enc_t e;     // frame 버퍼 (~600 B) -> stack 밖
+    tlm_raw_init(&e, 1u);
+    t0 = platform_micros();
+    for (uint32_t i = 0; i < iters; i++) {
+        s.ms += 10u;
+        (void)tlm_raw_add(&e, s.ms, d1 + (i & 63u), d2 + (i & 7u));
+        if (e.count >= 16u) acc += (uint32_t)tlm_raw_finish(&e, NULL);
+    }
+    report("sample_raw", iters, platform_micros() - t0);
+
+    s_sink = acc;
+}
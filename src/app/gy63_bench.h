@@ -0,0 +1,25 @@
+// FILE: src/app/gy63_bench.h
+#ifndef __GY63_BENCH_H__
+#define __GY63_BENCH_H__
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+// on-target micro benchmark: tlm_fmt vs snprintf (샘플 1줄, "%.2f")
+// 결과: {"bench":"target/...","ns_per_op":..,"cycles_per_op":..} (USB stdio)
+void gy63_bench_fmt(uint32_t iters);
+
+// alt_est update 1회 (powf 포함 전체) + 기압->고도 변환 단독. cycle budget 확인용
+void gy63_bench_est(uint32_t iters);
+
+// 샘플 1개의 장치 측 비용: 현재 경로 (ms5611_compensate + tlm_fmt_sample) vs raw passthrough (tlm_raw_add, 16개마다 finish)
+void gy63_bench_raw(uint32_t iters);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // __GY63_BENCH_H__
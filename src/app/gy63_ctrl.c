@@ -0,0 +1,100 @@
+// FILE: src/app/gy63_ctrl.c
+#include "gy63_ctrl.h"
+
+#include <string.h>
+
+// ---------- internal helpers ----------
+
+// "id=<u32>" 값만 (busy ack용, 전체 파싱은 main loop). 없으면 0
+static uint32_t peek_id(const uint8_t *data, size_t len) {
+    for (size_t i = 0; i + 3u <= len; i++) {
+        if ((i == 0 || data[i - 1] == ',') && !memcmp(data + i, "id=", 3)) {
+            uint32_t id = 0;
+            for (size_t k = i + 3u; k < len && data[k] >= '0' && data[k] <= '9'; k++) {
+                id = id * 10u + (uint32_t)(data[k] - '0');
+            }
+            return id;
+        }
+    }
+    return 0;
+}
+
+static void send_ack(gy63_ctrl_t *c, uint32_t ip, uint16_t port, uint32_t id, ctrl_status_t st,
+                     const ctrl_settings_t *cur) {
+    if (!c || !c->udp || !cur || port == 0) return;
+
+    char msg[128];
+    size_t n = ctrl_format_ack(msg, sizeof(msg), id, st, cur);
+    if (n > 0) {
+        (void)net_udp_sendto(c->udp, ip, port, msg, n);
+    }
+}
+
+// lwIP 컨텍스트: 복사 후 리턴
+static void on_ctrl_rx(const uint8_t *data, size_t len, uint32_t src_ip, uint16_t src_port, void *user) {
+    gy63_ctrl_t *c = (gy63_ctrl_t *)user;
+
+    if (c->pending) {
+        c->rx_busy_drops++;
+        if (c->busy) return;
+        c->busy_id   = peek_id(data, len);
+        c->busy_ip   = src_ip;
+        c->busy_port = src_port;
+        __sync_synchronize();
+        c->busy = true;
+        return;
+    }
+
+    if (len > sizeof(c->rx)) len = sizeof(c->rx);
+    memcpy(c->rx, data, len);
+    c->rx_len   = len;
+    c->src_ip   = src_ip;
+    c->src_port = src_port;
+    c->rx_count++;
+
+    __sync_synchronize();
+    c->pending = true;
+}
+
+// ---------- public API ----------
+
+bool gy63_ctrl_init(gy63_ctrl_t *c, uint16_t local_port) {
+    if (!c) return false;
+    memset(c, 0, sizeof(*c));
+
+    if (!net_udp_bind(&c->udp, local_port)) return false;
+    net_udp_set_recv(c->udp, on_ctrl_rx, c);
+    return true;
+}
+
+bool gy63_ctrl_poll(gy63_ctrl_t *c, const ctrl_settings_t *cur, ctrl_cmd_t *out) {
+    if (!c || !cur || !out) return false;
+
+    if (c->busy) {
+        __sync_synchronize();
+        send_ack(c, c->busy_ip, c->busy_port, c->busy_id, CTRL_EBUSY, cur);
+        __sync_synchronize();
+        c->busy = false;
+    }
+    if (!c->pending) return false;
+
+    __sync_synchronize();
+    c->reply_ip   = c->src_ip;
+    c->reply_port = c->src_port;
+    ctrl_status_t st = ctrl_parse((const char *)c->rx, c->rx_len, out);
+
+    __sync_synchronize();
+    c->pending = false; // mailbox 반환
+
+    if (st != CTRL_OK) {
+        c->rejected++;
+        gy63_ctrl_ack(c, out->id, st, cur); // id는 파싱된 경우만 의미 있음
+        return false;
+    }
+    return true;
+}
+
+void gy63_ctrl_ack(gy63_ctrl_t *c, uint32_t id, ctrl_status_t st, const ctrl_settings_t *cur) {
+    if (!c) return;
+    send_ack(c, c->reply_ip, c->reply_port, id, st, cur);
+}
@@ -0,0 +1,56 @@
+// FILE: src/app/gy63_ctrl.h
+#ifndef __GY63_CTRL_H__
+#define __GY63_CTRL_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ctrl_proto.h"
+#include "net_udp.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+// UDP control channel: lwIP 콜백은 mailbox에 복사만, 파싱/적용은 main loop(샘플 사이)에서
+typedef struct {
+    net_udp_client_t *udp;          // CFG_CTRL_PORT bind
+
+    // mailbox (1 slot, lwIP 컨텍스트 -> main loop)
+    volatile bool pending;
+    uint8_t  rx[NET_UDP_RX_MAX];
+    size_t   rx_len;
+    uint32_t src_ip;
+    uint16_t src_port;
+
+    // mailbox가 차 있을 때 도착한 명령: CTRL_EBUSY ack 대상 (1 slot, main loop에서 송신)
+    volatile bool busy;
+    uint32_t busy_id;
+    uint32_t busy_ip;
+    uint16_t busy_port;
+
+    // 마지막 명령의 응답 대상 (gy63_ctrl_ack)
+    uint32_t reply_ip;
+    uint16_t reply_port;
+
+    uint32_t rx_count;
+    uint32_t rx_busy_drops;         // 처리 전에 새 명령 도착 (CTRL_EBUSY ack, busy slot도 차 있으면 ack 없음)
+    uint32_t rejected;
+} gy63_ctrl_t;
+
+bool gy63_ctrl_init(gy63_ctrl_t *c, uint16_t local_port);
+
+// 샘플 사이에서 호출: 유효한 명령이 있으면 out에 담고 true.
+// 파싱/검증 실패 명령은 여기서 바로 NACK (cur = 변경 없는 현재 설정).
+// mailbox가 차 있어 버린 명령에는 여기서 CTRL_EBUSY ack (client가 재전송 판단).
+bool gy63_ctrl_poll(gy63_ctrl_t *c, const ctrl_settings_t *cur, ctrl_cmd_t *out);
+
+// 적용 결과 ack (cur = 적용 후 현재 설정)
+void gy63_ctrl_ack(gy63_ctrl_t *c, uint32_t id, ctrl_status_t st, const ctrl_settings_t *cur);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // __GY63_CTRL_H__
@@ -0,0 +1,96 @@
+// FILE: src/app/gy63_log.c
+#include "gy63_log.h"
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "pico/stdio_usb.h"
+#include "tusb.h"
+#include "log_config.h"
+#include "platform_core.h"
+
+static dlog_rec_t s_slots[CFG_DLOG_DEPTH];
+static dlog_t     s_log;
+static bool       s_ready;
+static uint32_t   s_echo_drop;  // gy63_log_echo가 버린 줄
+
+// ---------- internal helpers ----------
+
+static uint32_t clock_ms(void) {
+    return (uint32_t)platform_millis();
+}
+
+// USB stdio: host 미연결이거나 CDC 0 TX FIFO에 record 전체가 들어갈 자리가 없으면 거부
+// (record는 ring에 남아 sink_busy 집계, 차면 drop). 포트만 열고 읽지 않는 host에서
+// stdio_usb가 timeout까지 block 하면 drain을 부른 샘플 대기 구간이 밀림
+static bool stdio_sink(const void *data, size_t len, void *user) {
+    (void)user;
+    if (!stdio_usb_connected()) return false;
+
+    // stdio CRLF 변환: '\n'마다 1 byte 추가
+    size_t need = len;
+    const char *p = (const char *)data;
+    for (size_t i = 0; i < len; i++) {
+        if (p[i] == '\n') need++;
+    }
+    if (tud_cdc_write_available() < need) return false;
+
+    // record마다 flush: newlib buffer에 쌓였다가 한꺼번에 나가면 위 여유 확인이 무의미
+    const bool ok = fwrite(data, 1, len, stdout) == len;
+    fflush(stdout);
+    return ok;
+}
+
+// ---------- public API ----------
+
+void gy63_log_init(void) {
+    s_ready = dlog_init(&s_log, s_slots, CFG_DLOG_DEPTH, clock_ms);
+}
+
+dlog_t *gy63_log(void) {
+    return s_ready ? &s_log : NULL;
+}
+
+uint32_t gy63_log_drain(uint32_t max_recs) {
+    if (!s_ready) return 0;
+    return dlog_drain(&s_log, CFG_DLOG_BINARY ? DLOG_BINARY : DLOG_TEXT, stdio_sink, NULL, max_recs);
+}
+
+bool gy63_log_echo(const char *text, size_t len) {
+    if (!text || !stdio_usb_connected()) return false; // 받을 host 없음 (drop 아님)
+
+    size_t off = 0;
+    while (off < len) {
+        const char *nl = memchr(text + off, '\n', len - off);
+        const size_t n = nl ? (size_t)(nl - (text + off)) + 1u : len - off;
+        if (!stdio_sink(text + off, n, NULL)) {
+            // 남은 줄 전부 버림 (다음 datagram에서 다시 시도)
+            for (size_t i = off; i < len; i++) {
+                if (text[i] == '\n' || i + 1u == len) s_echo_drop++;
+            }
+            return false;
+        }
+        off += n;
+    }
+    return true;
+}
+
+size_t gy63_log_stats_line(uint64_t now_ms, char *out, size_t out_sz) {
+    if (!s_ready || !out || out_sz == 0) return 0;
+
+    dlog_stats_t st;
+    dlog_get_stats(&s_log, &st);
+
+    int n = snprintf(out, out_sz,
+                     "stat=dlog,ms=%llu,written=%lu,drained=%lu,drop=%lu,max=%lu,busy=%lu,echo_drop=%lu\n",
+                     (unsigned long long)now_ms,
+                     (unsigned long)st.written,
+                     (unsigned long)st.drained,
+                     (unsigned long)st.dropped,
+                     (unsigned long)st.depth_max,
+                     (unsigned long)st.sink_busy,
+                     (unsigned long)s_echo_drop);
+    if (n <= 0 || (size_t)n >= out_sz) return 0;
+    return (size_t)n;
+}
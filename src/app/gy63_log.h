@@ -0,0 +1,38 @@
+// FILE: src/app/gy63_log.h
+#ifndef __GY63_LOG_H__
+#define __GY63_LOG_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "dlog.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+// firmware 전역 deferred log (dlog + USB stdio sink)
+// - hot path: DLOGn(gy63_log(), id, ...)  (init 전이면 NULL -> 무시)
+// - drain: 대기 loop에서 gy63_log_drain. host가 USB 포트를 열지 않았으면 출력하지 않음
+//   (ring이 차면 drop 카운트, printf처럼 stdio timeout으로 loop를 멈추지 않음)
+
+void gy63_log_init(void);
+
+dlog_t *gy63_log(void);
+
+// 최대 max_recs개 출력. 출력한 record 수 리턴
+uint32_t gy63_log_drain(uint32_t max_recs);
+
+// 완성된 text (stat datagram 등)를 로컬 USB로 echo. 줄 단위로 stdio sink와 같은 non-blocking 규칙
+// (CDC FIFO에 자리가 없는 줄부터 버리고 echo_drop 집계). 전부 나갔으면 true
+bool gy63_log_echo(const char *text, size_t len);
+
+// "stat=dlog,ms=..,written=..,drained=..,drop=..,max=..,busy=..,echo_drop=..\n"
+size_t gy63_log_stats_line(uint64_t now_ms, char *out, size_t out_sz);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // __GY63_LOG_H__
@@ -2,10 +2,15 @@
 #include "gy63_op.h"
 
 #include <stdio.h>
+#include <string.h>
 
 #include "pico/stdlib.h"
 #include "gy63_config.h"
 #include "ms5611.h"
+#include "prof.h"
+#include "tlm_fmt.h"
+#include "gy63_log.h"
+#include "log_config.h"
 
 // ---- internal helpers (file-local) ----
 static void fatal_i2c(const char *tag, i2c_pico_status_t st) {
@@ -36,11 +41,152 @@ void gy63_init(gy63_ctx_t *ctx) {
 
     ms5611_config_default(&ctx->cfg);
     ctx->cfg.osr = MS5611_OSR_4096;
+
+    memset(&ctx->burst, 0, sizeof(ctx->burst));
+    memset(&ctx->burst_snap, 0, sizeof(ctx->burst_snap));
+    sensor_reg_init(&ctx->reg);
+    ms5611_load_coeffs(ctx->dev.prom, &ctx->coeffs);
+    ctx->raw_tap  = NULL;
+    ctx->raw_user = NULL;
+}
+
+void gy63_set_osr(gy63_ctx_t *ctx, ms5611_osr_t osr) {
+    if (!ctx) return;
+    ctx->cfg.osr = osr;
+}
+
+void gy63_set_raw_tap(gy63_ctx_t *ctx, gy63_raw_tap_fn fn, void *user) {
+    if (!ctx) return;
+    ctx->raw_tap  = fn;
+    ctx->raw_user = user;
 }
 
 ms5611_status_t gy63_read(gy63_ctx_t *ctx, int32_t *t_x100, uint32_t *p_pa) {
     if (!ctx || !t_x100 || !p_pa) return MS5611_EINVAL;
-    return ms5611_read(&ctx->dev, &ctx->cfg, t_x100, p_pa);
+
+    PROF_T0(t0);
+    ms5611_status_t st;
+    if (ctx->raw_tap) {
+        // raw 경로: tap에 D1/D2를 넘기고 캐시된 coeffs로 보상 (ms5611_read와 같은 결과)
+        uint32_t D1 = 0, D2 = 0;
+        st = ms5611_read_raw(&ctx->dev, &ctx->cfg, &D1, &D2);
+        if (st == MS5611_OK) {
+            ctx->raw_tap(ctx->dev.conv_end_us, D1, D2, (uint16_t)ctx->cfg.osr, ctx->raw_user);
+            PROF_T0(t_comp);
+            st = ms5611_compensate(&ctx->coeffs, D1, D2, t_x100, p_pa);
+            PROF_END(PROF_COMPENSATE, t_comp);
+        }
+    } else {
+        st = ms5611_read(&ctx->dev, &ctx->cfg, t_x100, p_pa);
+    }
+    PROF_END(PROF_SENSOR_READ, t0);
+    return st;
+}
+
+ms5611_status_t gy63_read_raw(gy63_ctx_t *ctx, uint32_t *d1, uint32_t *d2) {
+    if (!ctx || !d1 || !d2) return MS5611_EINVAL;
+
+    PROF_T0(t0);
+    ms5611_status_t st = ms5611_read_raw(&ctx->dev, &ctx->cfg, d1, d2);
+    if (st == MS5611_OK && ctx->raw_tap) {
+        ctx->raw_tap(ctx->dev.conv_end_us, *d1, *d2, (uint16_t)ctx->cfg.osr, ctx->raw_user);
+    }
+    PROF_END(PROF_SENSOR_READ, t0);
+    return st;
+}
+
+ms5611_status_t gy63_burst_start(gy63_ctx_t *ctx, ms5611_osr_t osr, uint32_t temp_every, uint32_t margin_us) {
+    if (!ctx) return MS5611_EINVAL;
+    ctx->snap_us    = time_us_32();
+    ctx->snap_outs  = 0;
+    ctx->burst_snap = ctx->burst;
+    return ms5611_burst_start(&ctx->dev, &ctx->burst, osr, temp_every, margin_us);
+}
+
+ms5611_status_t gy63_burst_poll(gy63_ctx_t *ctx, bool *ready, int32_t *t_x100, uint32_t *p_pa) {
+    if (!ctx || !ready || !t_x100 || !p_pa) return MS5611_EINVAL;
+    *ready = false;
+
+    uint32_t D1 = 0, D2 = 0;
+    ms5611_status_t st = ms5611_burst_poll(&ctx->dev, &ctx->burst, ready, &D1, &D2);
+    if (st == MS5611_ESTATE || (st != MS5611_OK && ctx->burst.phase == 0)) {
+        // 오류로 멈춤 -> 온도부터 재시작 (실패하면 다음 poll에서 다시)
+        (void)ms5611_burst_start(&ctx->dev, &ctx->burst, ctx->burst.osr, ctx->burst.temp_every,
+                                 ctx->burst.margin_us);
+        return st == MS5611_ESTATE ? MS5611_OK : st;
+    }
+    if (st != MS5611_OK || !*ready) return st;
+
+    if (ctx->raw_tap) ctx->raw_tap(ctx->dev.conv_end_us, D1, D2, (uint16_t)ctx->burst.osr, ctx->raw_user);
+    PROF_T0(t_comp);
+    st = ms5611_compensate(&ctx->coeffs, D1, D2, t_x100, p_pa);
+    PROF_END(PROF_COMPENSATE, t_comp);
+    if (st != MS5611_OK) *ready = false;
+    return st;
+}
+
+size_t gy63_burst_stats_line(gy63_ctx_t *ctx, decim_t *dec, uint64_t now_ms, char *out, size_t out_sz) {
+    if (!ctx || !out || out_sz == 0) return 0;
+
+    const uint32_t now_us = time_us_32();
+    const uint32_t wall   = now_us - ctx->snap_us;
+    if (wall == 0) return 0;
+
+    const ms5611_burst_t *b = &ctx->burst;
+    const ms5611_burst_t *s = &ctx->burst_snap;
+    const uint32_t d1  = b->d1_count - s->d1_count;
+    const uint32_t d2  = b->d2_count - s->d2_count;
+    const uint32_t err = b->errors - s->errors;
+    const uint64_t bus = b->bus_us - s->bus_us;
+    const uint64_t idl = b->late_us - s->late_us;
+
+    uint32_t outs = 0, span = 0;
+    if (dec) {
+        outs = dec->windows;
+        span = dec->span_max;
+    }
+    // per mille -> "x.y %" (float printf 없이)
+    const uint32_t bus_pm = (uint32_t)(bus * 1000u / wall);
+    const uint32_t idl_pm = (uint32_t)(idl * 1000u / wall);
+
+    int n = snprintf(out, out_sz,
+                     "stat=burst,ms=%llu,osr=%u,d1_hz=%lu,d2_hz=%lu,out_hz=%lu,avg_n=%lu,"
+                     "bus_pct=%lu.%lu,idle_pct=%lu.%lu,late_max_us=%lu,span_pa=%lu,err=%lu\n",
+                     (unsigned long long)now_ms, (unsigned)b->osr,
+                     (unsigned long)((uint64_t)d1 * 1000000u / wall),
+                     (unsigned long)((uint64_t)d2 * 1000000u / wall),
+                     (unsigned long)((uint64_t)(outs - ctx->snap_outs) * 1000000u / wall),
+                     (unsigned long)((outs > ctx->snap_outs) ? d1 / (outs - ctx->snap_outs) : 0u),
+                     (unsigned long)(bus_pm / 10u), (unsigned long)(bus_pm % 10u),
+                     (unsigned long)(idl_pm / 10u), (unsigned long)(idl_pm % 10u),
+                     (unsigned long)b->late_max_us, (unsigned long)span, (unsigned long)err);
+
+    ctx->burst_snap        = *b;
+    ctx->burst.late_max_us = 0;
+    ctx->snap_us           = now_us;
+    ctx->snap_outs         = outs;
+    if (dec) dec->span_max = 0;
+
+    if (n <= 0 || (size_t)n >= out_sz) return 0;
+    return (size_t)n;
+}
+
+// registry raw tap -> ctx raw tap (on-board baro만: D1/D2 + 실제 conversion 완료 시각)
+static void sensors_tap(uint32_t id, uint32_t t_us, const uint32_t *raw, uint32_t n, void *user) {
+    (void)t_us;
+    gy63_ctx_t *ctx = (gy63_ctx_t *)user;
+    if (id != GY63_SENSOR_BARO || n < 2u || !ctx->raw_tap) return;
+    ctx->raw_tap(ctx->dev.conv_end_us, raw[0], raw[1], (uint16_t)ctx->baro.osr, ctx->raw_user);
+}
+
+uint32_t gy63_sensors_init(gy63_ctx_t *ctx, uint32_t period_ms, uint32_t margin_us) {
+    if (!ctx) return 0;
+
+    sensor_reg_init(&ctx->reg);
+    sensor_reg_set_tap(&ctx->reg, sensors_tap, ctx);
+    ms5611_sensor_bind(&ctx->baro, &ctx->dev, gy63_bsp_i2c(), gy63_bsp_addr7(), ctx->cfg.osr, margin_us);
+    (void)sensor_reg_add(&ctx->reg, &ms5611_sensor_ops, &ctx->baro, 0, period_ms * 1000u);
+    return sensor_reg_init_all(&ctx->reg, time_us_32());
 }
 
 void gy63_operation(gy63_ctx_t *ctx) {
@@ -51,9 +197,35 @@ void gy63_operation(gy63_ctx_t *ctx) {
 
     ms5611_status_t st = gy63_read(ctx, &t_x100, &p_pa);
     if (st != MS5611_OK) {
-        printf("ms5611_read failed: %s (%ld)\n", ms5611_status_str(st), (long)st);
+        if (CFG_DLOG_ENABLE) (void)DLOG1(gy63_log(), DLOG_READ_FAIL, st);
+        else                 printf("ms5611_read failed: %s (%ld)\n", ms5611_status_str(st), (long)st);
+        return;
+    }
+
+    gy63_print_reading(t_x100, p_pa);
+}
+
+void gy63_print_reading(int32_t t_x100, uint32_t p_pa) {
+    if (CFG_DLOG_ENABLE) {
+        // record만 적재, 문자열화/출력은 대기 구간 (gy63_log_drain)
+        PROF_T0(t0);
+        (void)DLOG2(gy63_log(), DLOG_SAMPLE, t_x100, p_pa);
+        PROF_END(PROF_USB_PRINT, t0);
         return;
     }
 
-    printf("T=%.2f C, P=%u Pa\n", (double)t_x100 / 100.0, (unsigned)p_pa);
+    char line[40];
+    size_t n = 2;
+    memcpy(line, "T=", 2);
+    n += tlm_fmt_x100(line + n, t_x100);
+    memcpy(line + n, " C, P=", 6);
+    n += 6;
+    n += tlm_fmt_u32(line + n, p_pa);
+    memcpy(line + n, " Pa\n", 4);
+    n += 4;
+
+    // dlog 없이도 block 하지 않음 (CDC에 자리 없으면 버림)
+    PROF_T0(t0);
+    (void)gy63_log_echo(line, n);
+    PROF_END(PROF_USB_PRINT, t0);
 }
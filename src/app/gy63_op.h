@@ -3,28 +3,78 @@
 #define __GY63_OP_H__
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 #include "drivers/ms5611.h" // ms5611_t, ms5611_config_t
+#include "decim.h"
+#include "ms5611_sensor.h"
+#include "sensor_reg.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif // __cplusplus
 
+// raw tap: 보상 전 D1/D2 (conversion 완료 시각 t_us, 그때의 OSR). raw trace capture용
+typedef void (*gy63_raw_tap_fn)(uint32_t t_us, uint32_t d1, uint32_t d2, uint16_t osr, void *user);
+
 typedef struct {
     ms5611_t dev;
     ms5611_config_t cfg;
+
+    // burst mode
+    ms5611_burst_t  burst;
+    ms5611_coeffs_t coeffs;     // PROM은 init 후 불변 -> 샘플마다 다시 풀지 않음
+    ms5611_burst_t  burst_snap; // stats window 시작 시점
+    uint32_t        snap_us;
+    uint32_t        snap_outs;  // decim windows (stats window 시작 시점)
+
+    // sensor registry (slot GY63_SENSOR_BARO = 위 dev)
+    sensor_reg_t    reg;
+    ms5611_sensor_t baro;
+
+    // raw tap (NULL: 없음). blocking / burst / registry 경로 공통
+    gy63_raw_tap_fn raw_tap;
+    void           *raw_user;
 } gy63_ctx_t;
 
+#define GY63_SENSOR_BARO (0u)
+
 // 1회만 호출 (BSP + MS5611 init + cfg 세팅)
 void gy63_init(gy63_ctx_t *ctx);
 
+// OSR 변경 (다음 gy63_read부터 적용)
+void gy63_set_osr(gy63_ctx_t *ctx, ms5611_osr_t osr);
+
+// raw tap 등록 (fn NULL이면 해제)
+void gy63_set_raw_tap(gy63_ctx_t *ctx, gy63_raw_tap_fn fn, void *user);
+
 // 1회 측정만 수행(값 반환)
 ms5611_status_t gy63_read(gy63_ctx_t *ctx, int32_t *t_x100, uint32_t *p_pa);
 
+// 1회 측정, 보상 없이 D1/D2만 (raw passthrough: 보상은 host). raw tap도 호출
+ms5611_status_t gy63_read_raw(gy63_ctx_t *ctx, uint32_t *d1, uint32_t *d2);
+
+// burst 시작 (연속 conversion, gy63_read와 같이 쓰지 않음)
+ms5611_status_t gy63_burst_start(gy63_ctx_t *ctx, ms5611_osr_t osr, uint32_t temp_every, uint32_t margin_us);
+
+// busy loop에서 자주 호출. 새 pressure 샘플이면 *ready=true + 보상값 (오류 후에는 자동 재시작)
+ms5611_status_t gy63_burst_poll(gy63_ctx_t *ctx, bool *ready, int32_t *t_x100, uint32_t *p_pa);
+
+// "stat=burst,ms=..,d1_hz=..,d2_hz=..,out_hz=..,avg_n=..,bus_pct=..,idle_pct=..,late_max_us=..,span_pa=..,err=..\n"
+// 직전 호출 이후 window 기준 (late_max / dec->span_max는 보고 후 초기화)
+size_t gy63_burst_stats_line(gy63_ctx_t *ctx, decim_t *dec, uint64_t now_ms, char *out, size_t out_sz);
+
+// registry에 on-board sensor 등록 + init (gy63_init 후 1회). 추가 sensor는 ctx->reg에 직접 sensor_reg_add
+uint32_t gy63_sensors_init(gy63_ctx_t *ctx, uint32_t period_ms, uint32_t margin_us);
+
 // 측정 후 결과 출력
 void gy63_operation(gy63_ctx_t *ctx);
 
+// "T=%.2f C, P=%u Pa\n" 출력 (float printf 없이, tlm_fmt)
+// CFG_DLOG_ENABLE이면 deferred log에 적재만 (출력은 gy63_log_drain)
+void gy63_print_reading(int32_t t_x100, uint32_t p_pa);
+
 #ifdef __cplusplus
 }
 #endif // __cplusplus
@@ -0,0 +1,96 @@
+// FILE: src/app/gy63_raw.c
+#include "gy63_raw.h"
+
+#include <stdio.h>
+#include <string.h>
+
+// ---------- internal helpers ----------
+
+static bool send(gy63_raw_t *r, const uint8_t *data, size_t len) {
+    if (!r->has_tr || !tlm_transport_ready(&r->tr) || !r->tr.send(r->tr.ctx, data, len)) {
+        r->drops++;
+        return false;
+    }
+    r->bytes += (uint32_t)len;
+    return true;
+}
+
+static void send_prom(gy63_raw_t *r, uint64_t now_ms) {
+    uint8_t f[TLM_RAW_HDR_SIZE + TLM_RAW_PROM_SIZE];
+    const size_t len = tlm_raw_prom(&r->enc, r->prom, now_ms, f, sizeof(f));
+    if (len && send(r, f, len)) {
+        r->prom_pending = false;
+        r->prom_sent++;
+    }
+}
+
+static void flush(gy63_raw_t *r) {
+    const uint8_t *frame = NULL;
+    const size_t len = tlm_raw_finish(&r->enc, &frame);
+    if (len == 0) return;
+    if (send(r, frame, len)) r->frames++;
+}
+
+// ---------- public API ----------
+
+void gy63_raw_init(gy63_raw_t *r, const uint16_t prom[8], uint32_t boot_id, uint32_t batch, uint32_t flush_ms) {
+    if (!r || !prom) return;
+    memset(r, 0, sizeof(*r));
+    tlm_raw_init(&r->enc, boot_id);
+    memcpy(r->prom, prom, sizeof(r->prom));
+    r->prom_pending = true;
+    r->batch    = (batch == 0) ? 1u : (batch > TLM_RAW_MAX_BATCH ? TLM_RAW_MAX_BATCH : batch);
+    r->flush_ms = flush_ms;
+}
+
+void gy63_raw_set_transport(gy63_raw_t *r, const tlm_transport_t *t) {
+    if (!r || !t || !t->send) return;
+    r->tr     = *t;
+    r->has_tr = true;
+}
+
+void gy63_raw_request_prom(gy63_raw_t *r) {
+    if (r) r->prom_pending = true;
+}
+
+void gy63_raw_push(gy63_raw_t *r, uint64_t ms, uint32_t d1, uint32_t d2, uint16_t osr, uint64_t now_ms) {
+    if (!r) return;
+
+    // PROM 없이는 host가 보상할 수 없음 -> 샘플보다 먼저
+    if (r->prom_pending) send_prom(r, now_ms);
+
+    if (!tlm_raw_set_osr(&r->enc, osr) || !tlm_raw_add(&r->enc, ms, d1, d2)) {
+        // OSR 변경 / batch 가득 / dms 범위 초과: 지금 batch를 보내고 새 batch로
+        flush(r);
+        if (!tlm_raw_set_osr(&r->enc, osr) || !tlm_raw_add(&r->enc, ms, d1, d2)) return;
+    }
+    if (r->enc.count == 1) r->first_ms = now_ms;
+    r->samples++;
+
+    if (r->enc.count >= r->batch) flush(r);
+}
+
+void gy63_raw_poll(gy63_raw_t *r, uint64_t now_ms) {
+    if (!r) return;
+    if (r->prom_pending) send_prom(r, now_ms);
+    if (r->enc.count != 0 && now_ms - r->first_ms >= r->flush_ms) flush(r);
+}
+
+size_t gy63_raw_stats_line(const gy63_raw_t *r, uint64_t now_ms, char *out, size_t out_sz) {
+    if (!r || !out || out_sz == 0) return 0;
+
+    const uint32_t bps_x100 = r->samples ? (uint32_t)((uint64_t)r->bytes * 100u / r->samples) : 0u;
+
+    int n = snprintf(out, out_sz,
+                     "stat=raw,ms=%llu,samples=%lu,frames=%lu,prom=%lu,bytes=%lu,drops=%lu,b_per_sample=%lu.%02lu\n",
+                     (unsigned long long)now_ms,
+                     (unsigned long)r->samples,
+                     (unsigned long)r->frames,
+                     (unsigned long)r->prom_sent,
+                     (unsigned long)r->bytes,
+                     (unsigned long)r->drops,
+                     (unsigned long)(bps_x100 / 100u),
+                     (unsigned long)(bps_x100 % 100u));
+    if (n <= 0 || (size_t)n >= out_sz) return 0;
+    return (size_t)n;
+}
@@ -0,0 +1,59 @@
+// FILE: src/app/gy63_raw.h
+#ifndef __GY63_RAW_H__
+#define __GY63_RAW_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "tlm_raw.h"
+#include "tlm_transport.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+// raw passthrough 송신: D1/D2 -> tlm_raw frame (batch) -> transport
+// - PROM frame은 session 시작 시 1회 + 요청 시 (control "cmd=prom"). 보내지 못하면 다음 poll에서 다시
+// - 샘플 frame은 재전송/backlog 없음 (transport가 받지 못하면 drop, host는 seq 구멍으로 확인)
+
+typedef struct {
+    tlm_raw_enc_t   enc;
+    tlm_transport_t tr;
+    bool            has_tr;
+    uint16_t        prom[8];
+    bool            prom_pending;
+
+    uint32_t batch;
+    uint32_t flush_ms;
+    uint64_t first_ms;      // 현재 batch 첫 샘플 적재 시각
+
+    uint32_t samples;
+    uint32_t frames;
+    uint32_t prom_sent;
+    uint32_t bytes;
+    uint32_t drops;         // send 거부 / ready 아님 (frame)
+} gy63_raw_t;
+
+void gy63_raw_init(gy63_raw_t *r, const uint16_t prom[8], uint32_t boot_id, uint32_t batch, uint32_t flush_ms);
+
+void gy63_raw_set_transport(gy63_raw_t *r, const tlm_transport_t *t);
+
+// 다음 poll에서 PROM frame 송신
+void gy63_raw_request_prom(gy63_raw_t *r);
+
+// 샘플 1개 (ms = 측정 시각, osr = 그 측정의 OSR). batch가 차면 송신
+void gy63_raw_push(gy63_raw_t *r, uint64_t ms, uint32_t d1, uint32_t d2, uint16_t osr, uint64_t now_ms);
+
+// PROM 대기분 + flush_ms 경과한 partial batch 송신 (main loop 주기 호출)
+void gy63_raw_poll(gy63_raw_t *r, uint64_t now_ms);
+
+// "stat=raw,ms=..,samples=..,frames=..,prom=..,bytes=..,drops=..,b_per_sample=x.yy\n"
+// (b_per_sample: frame header + PROM 포함 평균)
+size_t gy63_raw_stats_line(const gy63_raw_t *r, uint64_t now_ms, char *out, size_t out_sz);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // __GY63_RAW_H__
@@ -0,0 +1,178 @@
+// FILE: src/app/gy63_rec.c
+#include "gy63_rec.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "platform_core.h"
+#include "net_udp.h"
+#include "rec_config.h"
+
+// ---- flash_log_dev_t adapter (flash_pico) ----
+static bool dev_read(void *ctx, uint32_t off, void *dst, size_t len) {
+    return flash_pico_read((flash_pico_t *)ctx, off, dst, len);
+}
+
+static bool dev_program(void *ctx, uint32_t off, const void *src, size_t len) {
+    return flash_pico_program((flash_pico_t *)ctx, off, src, len);
+}
+
+static bool dev_erase(void *ctx, uint32_t off, size_t len) {
+    return flash_pico_erase((flash_pico_t *)ctx, off, len);
+}
+
+static bool send_with_retry(net_udp_client_t *udp, const void *data, size_t len) {
+    for (uint32_t i = 0; i < CFG_FLOG_DUMP_RETRY; i++) {
+        if (net_udp_send(udp, data, len)) return true;
+        platform_sleep_ms(1); // pbuf / cyw43 tx queue 비워질 때까지
+    }
+    return false;
+}
+
+static void put_dump_hdr(uint8_t *p, uint32_t chunk, uint16_t n_pages, uint16_t flags) {
+    const uint32_t magic = FLASH_LOG_DUMP_MAGIC;
+    for (int i = 0; i < 4; i++) p[i]     = (uint8_t)(magic >> (8 * i));
+    for (int i = 0; i < 4; i++) p[4 + i] = (uint8_t)(chunk >> (8 * i));
+    p[8]  = (uint8_t)n_pages;
+    p[9]  = (uint8_t)(n_pages >> 8);
+    p[10] = (uint8_t)flags;
+    p[11] = (uint8_t)(flags >> 8);
+}
+
+bool gy63_rec_init(gy63_rec_t *rec, uint32_t boot_id) {
+    if (!rec) return false;
+    memset(rec, 0, sizeof(*rec));
+
+    if (!CFG_FLOG_ENABLE) return false;
+
+    if (!flash_pico_init(&rec->flash, CFG_FLOG_FLASH_OFFSET, CFG_FLOG_SIZE)) {
+        printf("flog: bad region 0x%08lx\n", (unsigned long)CFG_FLOG_FLASH_OFFSET);
+        return false;
+    }
+
+    const flash_log_dev_t dev = {
+        .size        = rec->flash.size,
+        .sector_size = flash_pico_sector_size(),
+        .read        = dev_read,
+        .program     = dev_program,
+        .erase       = dev_erase,
+        .ctx         = &rec->flash,
+    };
+
+    const uint64_t t0 = platform_millis();
+    flash_log_status_t st = flash_log_mount(&rec->log, &dev, boot_id);
+    if (st != FLASH_LOG_OK) {
+        printf("flog: mount failed: %s (%ld)\n", flash_log_status_str(st), (long)st);
+        return false;
+    }
+
+    printf("flog: %lu KiB, valid=%lu torn=%lu next_seq=%lu (mount %llu ms)\n",
+           (unsigned long)(rec->flash.size / 1024u),
+           (unsigned long)rec->log.stats.pages_valid,
+           (unsigned long)rec->log.stats.pages_torn,
+           (unsigned long)rec->log.next_sample_seq,
+           (unsigned long long)(platform_millis() - t0));
+
+    rec->ready = true;
+    return true;
+}
+
+bool gy63_rec_append(gy63_rec_t *rec, const tlm_sample_t *s) {
+    if (!rec || !rec->ready || !s) return false;
+
+    const uint64_t erase0 = rec->flash.erase_us;
+    const bool ok = flash_log_append(&rec->log, s) == FLASH_LOG_OK;
+
+    const uint64_t stall = rec->flash.erase_us - erase0;
+    if (stall) {
+        rec->stall_erase_us += stall;
+        if (stall > rec->stall_erase_max_us) rec->stall_erase_max_us = (uint32_t)stall;
+    }
+    return ok;
+}
+
+void gy63_rec_service(gy63_rec_t *rec) {
+    if (!rec || !rec->ready) return;
+    (void)flash_log_service(&rec->log);
+}
+
+bool gy63_rec_format(gy63_rec_t *rec) {
+    if (!rec || !rec->ready) return false;
+    return flash_log_format(&rec->log) == FLASH_LOG_OK;
+}
+
+uint32_t gy63_rec_dump_udp(gy63_rec_t *rec, const char *dst_ip, uint16_t dst_port) {
+    if (!rec || !rec->ready || !dst_ip) return 0;
+
+    net_udp_client_t *udp = NULL;
+    if (!net_udp_open(&udp, dst_ip, dst_port)) return 0;
+
+    // RAM에 남은 partial page도 포함
+    (void)flash_log_flush(&rec->log);
+
+    static uint8_t pkt[FLASH_LOG_DUMP_HDR_SIZE + CFG_FLOG_DUMP_PAGES_PER_PKT * FLASH_LOG_PAGE_SIZE];
+
+    flash_log_reader_t rd;
+    flash_log_reader_open(&rec->log, &rd);
+
+    const uint64_t t0 = platform_millis();
+    uint32_t chunk = 0, pages = 0;
+    bool more = true, ok = true;
+
+    while (more && ok) {
+        uint16_t n = 0;
+        while (n < CFG_FLOG_DUMP_PAGES_PER_PKT) {
+            uint8_t *dst = pkt + FLASH_LOG_DUMP_HDR_SIZE + (size_t)n * FLASH_LOG_PAGE_SIZE;
+            if (!flash_log_reader_next(&rec->log, &rd, dst)) { more = false; break; }
+            n++;
+        }
+        if (n == 0) break;
+
+        put_dump_hdr(pkt, chunk++, n, 0);
+        ok = send_with_retry(udp, pkt, FLASH_LOG_DUMP_HDR_SIZE + (size_t)n * FLASH_LOG_PAGE_SIZE);
+        pages += n;
+    }
+
+    // end marker (유실 대비 3회)
+    put_dump_hdr(pkt, chunk, 0, FLASH_LOG_DUMP_FLAG_LAST);
+    for (int i = 0; i < 3; i++) (void)send_with_retry(udp, pkt, FLASH_LOG_DUMP_HDR_SIZE);
+
+    net_udp_close(udp);
+
+    const uint64_t dt = platform_millis() - t0;
+    printf("flog: dump %lu pages (%lu B) in %llu ms, %lu B/s%s\n",
+           (unsigned long)pages,
+           (unsigned long)(pages * FLASH_LOG_PAGE_SIZE),
+           (unsigned long long)dt,
+           (unsigned long)(dt ? (uint64_t)pages * FLASH_LOG_PAGE_SIZE * 1000u / dt : 0),
+           ok ? "" : " (aborted)");
+    return pages;
+}
+
+size_t gy63_rec_stats_line(const gy63_rec_t *rec, uint64_t now_ms, char *out, size_t out_sz) {
+    if (!rec || !rec->ready || !out || out_sz == 0) return 0;
+
+    const flash_log_stats_t *st = &rec->log.stats;
+    const uint64_t busy_us = rec->flash.program_us + rec->flash.erase_us;
+    const uint64_t bytes   = (uint64_t)st->pages_written * FLASH_LOG_PAGE_SIZE;
+
+    // wr_Bps: flash busy 시간 기준 지속 write throughput
+    // pre/sync: service 구간 erase / append 안 erase, stall_us/stall_max_us: sync erase로 샘플 경로가 막힌 시간
+    int n = snprintf(out, out_sz,
+                     "stat=flog,ms=%llu,samples=%lu,pages=%lu,erases=%lu,pre=%lu,sync=%lu,err=%lu,"
+                     "prog_us=%llu,erase_us=%llu,stall_us=%llu,stall_max_us=%lu,wr_Bps=%llu\n",
+                     (unsigned long long)now_ms,
+                     (unsigned long)st->samples_appended,
+                     (unsigned long)st->pages_written,
+                     (unsigned long)st->sectors_erased,
+                     (unsigned long)st->erases_pre,
+                     (unsigned long)st->erases_sync,
+                     (unsigned long)st->io_errors,
+                     (unsigned long long)rec->flash.program_us,
+                     (unsigned long long)rec->flash.erase_us,
+                     (unsigned long long)rec->stall_erase_us,
+                     (unsigned long)rec->stall_erase_max_us,
+                     (unsigned long long)(busy_us ? bytes * 1000000u / busy_us : 0));
+    if (n <= 0 || (size_t)n >= out_sz) return 0;
+    return (size_t)n;
+}
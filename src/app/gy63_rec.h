@@ -0,0 +1,51 @@
+// FILE: src/app/gy63_rec.h
+#ifndef __GY63_REC_H__
+#define __GY63_REC_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "flash_log.h"
+#include "flash_pico.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+// black-box recorder: flash_log + 온보드 flash backend
+typedef struct {
+    flash_pico_t flash;
+    flash_log_t  log;
+    bool ready;
+
+    // append 안에서 일어난 sector erase (미리 erase 못 한 경우) = 샘플 경로 stall
+    uint64_t stall_erase_us;
+    uint32_t stall_erase_max_us;
+} gy63_rec_t;
+
+// 영역 확인 + mount (실패 시 ready=false, 샘플링은 계속)
+bool gy63_rec_init(gy63_rec_t *rec, uint32_t boot_id);
+
+// 샘플 기록 (page 단위로 flash program)
+bool gy63_rec_append(gy63_rec_t *rec, const tlm_sample_t *s);
+
+// 다음 sector 미리 erase (샘플 사이 service 구간, 필요할 때만 1 sector)
+// erase는 IRQ를 막고 ~45 ms: IRQ 수집(gy63_acq) 중에는 block 사이에서만 호출하고 시간을 stat=acq로 넘김.
+// burst는 poll 구동이라 그만큼 늦게 읽음 (stat=burst late_max_us)
+void gy63_rec_service(gy63_rec_t *rec);
+
+// 전체 log erase
+bool gy63_rec_format(gy63_rec_t *rec);
+
+// 전체 log를 dst_ip:dst_port로 bulk 송신 (blocking). 송신 page 수 리턴.
+uint32_t gy63_rec_dump_udp(gy63_rec_t *rec, const char *dst_ip, uint16_t dst_port);
+
+// "stat=flog,..." 한 줄 작성. 길이 리턴 (0이면 skip)
+size_t gy63_rec_stats_line(const gy63_rec_t *rec, uint64_t now_ms, char *out, size_t out_sz);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // __GY63_REC_H__
@@ -0,0 +1,89 @@
+// FILE: src/app/gy63_rtrace.c
+#include "gy63_rtrace.h"
+
+#include <stdio.h>
+#include <string.h>
+
+// ---------- internal helpers ----------
+
+static void flush(gy63_rtrace_t *rt) {
+    const uint8_t *chunk = NULL;
+    const size_t len = rtrace_enc_finish(&rt->enc, &chunk);
+    if (len == 0) return;
+
+    if (rt->has_tr && tlm_transport_ready(&rt->tr) && rt->tr.send(rt->tr.ctx, chunk, len)) {
+        rt->chunks++;
+        rt->bytes += (uint32_t)len;
+    } else {
+        rt->drops++;
+    }
+}
+
+// ---------- public API ----------
+
+void gy63_rtrace_init(gy63_rtrace_t *rt, const uint16_t prom[8], uint16_t osr, uint32_t boot_id,
+                      uint32_t hdr_every, uint32_t flush_ms) {
+    if (!rt) return;
+    memset(rt, 0, sizeof(*rt));
+    rtrace_enc_init(&rt->enc, prom, osr, boot_id, hdr_every);
+    rt->flush_us = flush_ms * 1000u;
+}
+
+void gy63_rtrace_set_transport(gy63_rtrace_t *rt, const tlm_transport_t *t) {
+    if (!rt || !t || !t->send) return;
+    rt->tr     = *t;
+    rt->has_tr = true;
+}
+
+void gy63_rtrace_tap(uint32_t t_us, uint32_t d1, uint32_t d2, uint16_t osr, void *user) {
+    gy63_rtrace_t *rt = (gy63_rtrace_t *)user;
+    if (!rt) return;
+
+    const bool fresh = rtrace_enc_empty(&rt->enc);
+    if (!rtrace_enc_sample(&rt->enc, t_us, d1, d2, osr)) {
+        // chunk 가득 -> 보내고 새 chunk (KEY로 시작)
+        flush(rt);
+        if (!rtrace_enc_sample(&rt->enc, t_us, d1, d2, osr)) return;
+        rt->first_us = t_us;
+        return;
+    }
+    if (fresh) rt->first_us = t_us;
+}
+
+void gy63_rtrace_error(gy63_rtrace_t *rt, uint32_t t_us, int32_t status) {
+    if (!rt) return;
+
+    const bool fresh = rtrace_enc_empty(&rt->enc);
+    if (!rtrace_enc_error(&rt->enc, t_us, status)) {
+        flush(rt);
+        if (!rtrace_enc_error(&rt->enc, t_us, status)) return;
+        rt->first_us = t_us;
+        return;
+    }
+    if (fresh) rt->first_us = t_us;
+}
+
+void gy63_rtrace_poll(gy63_rtrace_t *rt, uint32_t now_us) {
+    if (!rt || rtrace_enc_empty(&rt->enc)) return;
+    if (now_us - rt->first_us >= rt->flush_us) flush(rt);
+}
+
+size_t gy63_rtrace_stats_line(const gy63_rtrace_t *rt, uint64_t now_ms, char *out, size_t out_sz) {
+    if (!rt || !out || out_sz == 0) return 0;
+
+    const uint32_t samples = rt->enc.samples;
+    const uint32_t bps_x100 = samples ? (uint32_t)((uint64_t)rt->bytes * 100u / samples) : 0u;
+
+    int n = snprintf(out, out_sz,
+                     "stat=rtrace,ms=%llu,samples=%lu,errors=%lu,chunks=%lu,bytes=%lu,drops=%lu,"
+                     "b_per_sample=%lu.%02lu\n",
+                     (unsigned long long)now_ms,
+                     (unsigned long)samples,
+                     (unsigned long)rt->enc.errors,
+                     (unsigned long)rt->chunks,
+                     (unsigned long)rt->bytes,
+                     (unsigned long)rt->drops,
+                     (unsigned long)(bps_x100 / 100u), (unsigned long)(bps_x100 % 100u));
+    if (n <= 0 || (size_t)n >= out_sz) return 0;
+    return (size_t)n;
+}
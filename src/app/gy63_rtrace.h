@@ -0,0 +1,55 @@
+// FILE: src/app/gy63_rtrace.h
+#ifndef __GY63_RTRACE_H__
+#define __GY63_RTRACE_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "rtrace.h"
+#include "tlm_transport.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+// raw trace capture: gy63 raw tap -> rtrace chunk -> transport (UDP)
+// - 현장 재현용: PROM + raw D1/D2 + 시각을 그대로 기록, host/tools/gy63_rtrace로 수신/변환
+// - chunk가 차거나 flush_ms가 지나면 송신. transport가 받지 못하면 그 chunk는 drop (host가 seq 구멍으로 확인)
+
+typedef struct {
+    rtrace_enc_t    enc;
+    tlm_transport_t tr;
+    bool            has_tr;
+
+    uint32_t flush_us;
+    uint32_t first_us;      // 현재 chunk 첫 record 시각
+
+    uint32_t chunks;
+    uint32_t bytes;
+    uint32_t drops;         // send 거부 / ready 아님
+} gy63_rtrace_t;
+
+void gy63_rtrace_init(gy63_rtrace_t *rt, const uint16_t prom[8], uint16_t osr, uint32_t boot_id,
+                      uint32_t hdr_every, uint32_t flush_ms);
+
+void gy63_rtrace_set_transport(gy63_rtrace_t *rt, const tlm_transport_t *t);
+
+// gy63_raw_tap_fn 형태 (user = gy63_rtrace_t)
+void gy63_rtrace_tap(uint32_t t_us, uint32_t d1, uint32_t d2, uint16_t osr, void *user);
+
+// 측정 실패 기록
+void gy63_rtrace_error(gy63_rtrace_t *rt, uint32_t t_us, int32_t status);
+
+// flush_ms 경과한 partial chunk 송신 (main loop 주기 호출)
+void gy63_rtrace_poll(gy63_rtrace_t *rt, uint32_t now_us);
+
+// "stat=rtrace,ms=..,samples=..,errors=..,chunks=..,bytes=..,drops=..,b_per_sample=x.yy\n"
+// (b_per_sample: chunk header 포함 평균)
+size_t gy63_rtrace_stats_line(const gy63_rtrace_t *rt, uint64_t now_ms, char *out, size_t out_sz);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // __GY63_RTRACE_H__
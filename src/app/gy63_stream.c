@@ -0,0 +1,73 @@
+// FILE: src/app/gy63_stream.c
+#include "gy63_stream.h"
+
+#include <stdio.h>
+#include <string.h>
+
+// ---------- internal helpers ----------
+
+static void flush(gy63_stream_t *st) {
+    const uint8_t *frame = NULL;
+    const size_t len = tlm_bin_finish(&st->enc, &frame);
+    if (len == 0) return;
+    st->frames++;
+
+    for (uint32_t i = 0; i < st->n_port; i++) {
+        gy63_stream_port_t *p = &st->port[i];
+        if (!tlm_transport_ready(&p->tr)) { p->skipped++; continue; }
+        if (p->tr.send(p->tr.ctx, frame, len)) p->sent++;
+        else                                  p->drops++;
+    }
+}
+
+// ---------- public API ----------
+
+void gy63_stream_init(gy63_stream_t *st, uint32_t batch, uint32_t flush_ms) {
+    if (!st) return;
+    memset(st, 0, sizeof(*st));
+    tlm_bin_init(&st->enc);
+    st->batch    = (batch == 0) ? 1u : (batch > TLM_BIN_MAX_BATCH ? TLM_BIN_MAX_BATCH : batch);
+    st->flush_ms = flush_ms;
+}
+
+bool gy63_stream_add_transport(gy63_stream_t *st, const tlm_transport_t *t) {
+    if (!st || !t || !t->send || st->n_port >= GY63_STREAM_MAX_TRANSPORTS) return false;
+    memset(&st->port[st->n_port], 0, sizeof(st->port[0]));
+    st->port[st->n_port].tr = *t;
+    st->n_port++;
+    return true;
+}
+
+void gy63_stream_push(gy63_stream_t *st, const tlm_sample_t *s, uint64_t now_ms) {
+    if (!st || !s || st->n_port == 0) return;
+
+    if (!tlm_bin_add(&st->enc, s)) {
+        // dms 범위 초과 등: 지금 batch를 보내고 새 batch로
+        flush(st);
+        if (!tlm_bin_add(&st->enc, s)) return;
+    }
+    if (st->enc.count == 1) st->first_ms = now_ms;
+    st->samples++;
+
+    if (st->enc.count >= st->batch) flush(st);
+}
+
+void gy63_stream_poll(gy63_stream_t *st, uint64_t now_ms) {
+    if (!st || st->enc.count == 0) return;
+    if (now_ms - st->first_ms >= st->flush_ms) flush(st);
+}
+
+size_t gy63_stream_stats_line(const gy63_stream_t *st, uint64_t now_ms, char *out, size_t out_sz) {
+    if (!st || st->n_port == 0 || !out || out_sz == 0) return 0;
+
+    int n = snprintf(out, out_sz, "stat=bin,ms=%llu,frames=%lu,samples=%lu",
+                     (unsigned long long)now_ms, (unsigned long)st->frames, (unsigned long)st->samples);
+    for (uint32_t i = 0; i < st->n_port && n > 0 && (size_t)n < out_sz; i++) {
+        const gy63_stream_port_t *p = &st->port[i];
+        n += snprintf(out + n, out_sz - (size_t)n, ",%s=%lu/%lu/%lu", p->tr.name ? p->tr.name : "tr",
+                      (unsigned long)p->sent, (unsigned long)p->drops, (unsigned long)p->skipped);
+    }
+    if (n <= 0 || (size_t)n + 1 >= out_sz) return 0;
+    out[n++] = '\n';
+    return (size_t)n;
+}
@@ -0,0 +1,60 @@
+// FILE: src/app/gy63_stream.h
+#ifndef __GY63_STREAM_H__
+#define __GY63_STREAM_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "tlm_bin.h"
+#include "tlm_transport.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+// binary sample stream: 샘플을 tlm_bin frame으로 batch -> 등록된 transport 전부로 송신 (USB, UDP 또는 둘 다)
+// - transport가 받지 못하면 그 frame은 해당 transport에서만 drop (host는 frame seq 구멍으로 확인)
+// - 재전송/backlog 없음: 전 샘플 보존은 flash recorder 담당, stream은 실시간 관측용
+
+#define GY63_STREAM_MAX_TRANSPORTS  (2u)
+
+typedef struct {
+    tlm_transport_t tr;
+    uint32_t sent;      // frame
+    uint32_t drops;     // send 거부 (busy)
+    uint32_t skipped;   // ready 아님 (미연결 / 링크 다운)
+} gy63_stream_port_t;
+
+typedef struct {
+    tlm_bin_enc_t enc;
+    gy63_stream_port_t port[GY63_STREAM_MAX_TRANSPORTS];
+    uint32_t n_port;
+
+    uint32_t batch;
+    uint32_t flush_ms;
+    uint64_t first_ms;  // 현재 batch 첫 샘플 적재 시각
+
+    uint32_t frames;
+    uint32_t samples;
+} gy63_stream_t;
+
+void gy63_stream_init(gy63_stream_t *st, uint32_t batch, uint32_t flush_ms);
+
+// transport 등록 (복사). 초과 시 false
+bool gy63_stream_add_transport(gy63_stream_t *st, const tlm_transport_t *t);
+
+// 샘플 1개 적재 (batch가 차면 송신)
+void gy63_stream_push(gy63_stream_t *st, const tlm_sample_t *s, uint64_t now_ms);
+
+// flush_ms 경과한 partial batch 송신 (main loop 주기 호출)
+void gy63_stream_poll(gy63_stream_t *st, uint64_t now_ms);
+
+// "stat=bin,ms=..,frames=..,samples=..,<name>=sent/drop/skip,...\n" (transport 없으면 0)
+size_t gy63_stream_stats_line(const gy63_stream_t *st, uint64_t now_ms, char *out, size_t out_sz);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // __GY63_STREAM_H__
@@ -0,0 +1,195 @@
+// FILE: src/app/gy63_tx.c
+#include "gy63_tx.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "platform_core.h"
+
+// lwIP 컨텍스트: echo는 수신 시각과 함께 ring에 복사
+static void on_echo_rx(gy63_tx_t *t, const uint8_t *data) {
+    const uint32_t rx_us = (uint32_t)platform_micros();
+
+    const uint32_t head = t->echo_head;
+    if (head - t->echo_tail >= GY63_TX_ECHO_RING) {
+        t->echo_drops++; // 해당 seq는 timeout -> lost로 집계
+        return;
+    }
+
+    memcpy(t->echo[head % GY63_TX_ECHO_RING], data, LAT_ECHO_SIZE);
+    t->echo_us[head % GY63_TX_ECHO_RING] = rx_us;
+    __sync_synchronize();
+    t->echo_head = head + 1u;
+}
+
+// lwIP 컨텍스트: 피드백/echo만 골라 ring에 복사
+static void on_tx_rx(const uint8_t *data, size_t len, uint32_t src_ip, uint16_t src_port, void *user) {
+    (void)src_ip;
+    (void)src_port;
+    gy63_tx_t *t = (gy63_tx_t *)user;
+
+    if (t->lat_on && lat_probe_is_echo(data, len)) {
+        on_echo_rx(t, data);
+        return;
+    }
+    if (!t->arq_on || len < ARQ_FB_SIZE || data[0] != ARQ_MAGIC || data[1] != ARQ_TYPE_FB) return;
+
+    const uint32_t head = t->fb_head;
+    if (head - t->fb_tail >= GY63_TX_FB_RING) {
+        t->fb_drops++; // 다음 피드백이 누적 ACK를 다시 담으므로 손실 무해
+        return;
+    }
+
+    memcpy(t->fb[head % GY63_TX_FB_RING], data, ARQ_FB_SIZE);
+    __sync_synchronize();
+    t->fb_head = head + 1u;
+}
+
+static bool arq_send_udp(const void *pkt, size_t len, void *user) {
+    return net_udp_send((net_udp_client_t *)user, pkt, len);
+}
+
+static bool tx_send(gy63_tx_t *t, const void *data, size_t len, uint64_t now_ms,
+                    bool probe, uint32_t conv_end_us) {
+    if (!t || (len && !data)) return false;
+
+    size_t n = tlm_hdr_format(&t->hdr, t->pkt, sizeof(t->pkt));
+    if (n == 0 || len > sizeof(t->pkt) - n) return false;
+    memcpy(t->pkt + n, data, len);
+    n += len;
+
+    const uint32_t send_us = probe ? (uint32_t)platform_micros() : 0u;
+
+    bool ok;
+    if (!t->arq_on) ok = net_udp_send(t->udp, t->pkt, n);
+    else            ok = arq_tx_send(&t->arq, t->pkt, n, now_ms);
+
+    if (ok) {
+        if (probe) lat_probe_on_send(&t->lat, t->hdr.seq, conv_end_us, send_us);
+        tlm_hdr_commit(&t->hdr);
+    }
+    return ok;
+}
+
+// tlm_prio 송신 콜백: tag = 샘플 datagram의 conv_end_us (0: probe 없음)
+static bool prio_send(const void *data, size_t len, tlm_prio_class_t cls, uint32_t tag, void *user) {
+    (void)cls;
+    gy63_tx_t *t = (gy63_tx_t *)user;
+    return tx_send(t, data, len, t->now_ms, t->lat_on && tag != 0, tag);
+}
+
+bool gy63_tx_init(gy63_tx_t *t, net_udp_client_t *udp, bool arq_on,
+                  uint32_t rto_ms, uint32_t holdoff_ms, uint8_t max_tx) {
+    if (!t || !udp) return false;
+    memset(t, 0, sizeof(*t));
+    t->udp    = udp;
+    t->arq_on = arq_on;
+    tlm_hdr_init(&t->hdr, 0xFFFFFFFFu, 0);
+    tlm_prio_init(&t->prio, prio_send, t);
+
+    if (arq_on) {
+        arq_tx_init(&t->arq, rto_ms, holdoff_ms, max_tx, arq_send_udp, udp);
+        net_udp_set_recv(udp, on_tx_rx, t);
+    }
+    return true;
+}
+
+void gy63_tx_set_id(gy63_tx_t *t, uint32_t boot_id, uint64_t uid) {
+    if (!t) return;
+    tlm_hdr_init(&t->hdr, boot_id, uid);
+}
+
+void gy63_tx_enable_latency(gy63_tx_t *t, uint32_t timeout_ms) {
+    if (!t) return;
+    lat_probe_init(&t->lat, t->hdr.boot_id, timeout_ms);
+    t->lat_on = true;
+    if (!t->arq_on) net_udp_set_recv(t->udp, on_tx_rx, t);
+}
+
+void gy63_tx_set_prio(gy63_tx_t *t, uint32_t guard_burst, uint32_t guard_wait_ms, uint32_t budget) {
+    if (!t) return;
+    tlm_prio_set_guard(&t->prio, guard_burst, guard_wait_ms);
+    t->prio_budget = budget;
+}
+
+static bool tx_submit(gy63_tx_t *t, tlm_prio_class_t cls, const void *data, size_t len,
+                      uint64_t now_ms, uint32_t tag) {
+    if (!t) return false;
+    // header를 붙여 pkt에 못 들어가면 queue head를 영구히 막으므로 여기서 거부
+    if (len > sizeof(t->pkt) - TLM_HDR_MAX) return false;
+    t->now_ms = now_ms;
+    return tlm_prio_submit(&t->prio, cls, data, len, tag, (uint32_t)platform_micros());
+}
+
+bool gy63_tx_send(gy63_tx_t *t, const void *data, size_t len, uint64_t now_ms) {
+    return tx_submit(t, TLM_PRIO_BULK, data, len, now_ms, 0);
+}
+
+bool gy63_tx_send_urgent(gy63_tx_t *t, const void *data, size_t len, uint64_t now_ms) {
+    return tx_submit(t, TLM_PRIO_URGENT, data, len, now_ms, 0);
+}
+
+bool gy63_tx_send_sample(gy63_tx_t *t, const void *data, size_t len, uint64_t now_ms, uint32_t conv_end_us) {
+    if (!t || len > sizeof(t->pkt) - TLM_HDR_MAX) return false;
+    t->now_ms = now_ms;
+    return tlm_prio_send_now(&t->prio, TLM_PRIO_BULK, data, len, t->lat_on ? conv_end_us : 0u);
+}
+
+void gy63_tx_poll(gy63_tx_t *t, uint64_t now_ms) {
+    if (!t) return;
+
+    if (t->lat_on) {
+        while (t->echo_tail != t->echo_head) {
+            __sync_synchronize();
+            const uint32_t tail = t->echo_tail;
+            (void)lat_probe_on_echo(&t->lat, t->echo[tail % GY63_TX_ECHO_RING], LAT_ECHO_SIZE,
+                                    t->echo_us[tail % GY63_TX_ECHO_RING]);
+            __sync_synchronize();
+            t->echo_tail = tail + 1u;
+        }
+        lat_probe_expire(&t->lat, (uint32_t)platform_micros());
+    }
+
+    t->now_ms = now_ms;
+    (void)tlm_prio_service(&t->prio, (uint32_t)platform_micros(), t->prio_budget);
+
+    if (!t->arq_on) return;
+
+    while (t->fb_tail != t->fb_head) {
+        __sync_synchronize();
+        const uint32_t tail = t->fb_tail;
+        arq_tx_on_feedback(&t->arq, t->fb[tail % GY63_TX_FB_RING], ARQ_FB_SIZE, now_ms);
+        __sync_synchronize();
+        t->fb_tail = tail + 1u;
+    }
+
+    arq_tx_poll(&t->arq, now_ms);
+}
+
+size_t gy63_tx_stats_line(const gy63_tx_t *t, uint64_t now_ms, char *out, size_t out_sz) {
+    if (!t || !t->arq_on || !out || out_sz == 0) return 0;
+
+    const arq_tx_stats_t *st = &t->arq.stats;
+    int n = snprintf(out, out_sz,
+                     "stat=arq,ms=%llu,sent=%lu,retx=%lu,ack=%lu,abandon=%lu,inflight=%lu,fb=%lu,fb_drop=%lu\n",
+                     (unsigned long long)now_ms,
+                     (unsigned long)st->sent,
+                     (unsigned long)st->retransmits,
+                     (unsigned long)st->acked,
+                     (unsigned long)st->abandoned,
+                     (unsigned long)st->inflight,
+                     (unsigned long)st->feedback_rx,
+                     (unsigned long)t->fb_drops);
+    if (n <= 0 || (size_t)n >= out_sz) return 0;
+    return (size_t)n;
+}
+
+size_t gy63_tx_lat_stats_line(gy63_tx_t *t, uint64_t now_ms, char *out, size_t out_sz) {
+    if (!t || !t->lat_on) return 0;
+    return lat_probe_stats_line(&t->lat, now_ms, out, out_sz);
+}
+
+size_t gy63_tx_prio_stats_line(gy63_tx_t *t, uint64_t now_ms, char *out, size_t out_sz) {
+    if (!t) return 0;
+    return tlm_prio_stats_line(&t->prio, now_ms, out, out_sz);
+}
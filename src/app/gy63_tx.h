@@ -0,0 +1,104 @@
+// FILE: src/app/gy63_tx.h
+#ifndef __GY63_TX_H__
+#define __GY63_TX_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "lat_probe.h"
+#include "net_udp.h"
+#include "tlm_hdr.h"
+#include "tlm_prio.h"
+#include "udp_arq.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+// telemetry 송신 경로: net_udp client + (옵션) selective-retransmit ARQ
+// - 모든 datagram 앞에 tlm_hdr 줄 (seq/boot/uid) 부착, 실제 송신된 경우만 seq 소모
+// - arq off: net_udp_send 그대로 (기존 텍스트 datagram)
+// - arq on : udp_arq header를 붙여 송신, 수신측 피드백(ACK/SACK)은 같은 소켓으로 받음
+//   피드백은 lwIP 콜백에서 ring에 복사만, 처리는 gy63_tx_poll(main loop)에서
+// - latency probe (진단 모드): 샘플 datagram의 conversion->send / send->echo 측정 (lat_probe.h)
+//   host echo도 같은 소켓, 수신 시각은 lwIP 콜백에서 찍음
+// - traffic class (tlm_prio.h): 경보 = urgent (즉시 송신, bulk queue 앞지름), 나머지 = bulk (깊이 제한 queue)
+//   queue에 남은 datagram은 gy63_tx_poll에서 송신 (header/seq는 실제 송신 순서대로)
+
+#define GY63_TX_FB_RING    (8u)   // 피드백 mailbox 깊이 (2의 거듭제곱)
+#define GY63_TX_ECHO_RING  (16u)  // echo mailbox 깊이 (2의 거듭제곱)
+
+typedef struct {
+    net_udp_client_t *udp;
+    bool arq_on;
+    arq_tx_t arq;
+    tlm_hdr_t hdr;
+
+    char pkt[ARQ_MAX_PAYLOAD];  // header + payload 조립
+
+    // 피드백 ring (lwIP 컨텍스트 -> main loop, SPSC)
+    uint8_t fb[GY63_TX_FB_RING][ARQ_FB_SIZE];
+    volatile uint32_t fb_head;  // producer (lwIP)
+    volatile uint32_t fb_tail;  // consumer (main loop)
+    uint32_t fb_drops;
+
+    // latency probe (lwIP 컨텍스트 -> main loop, SPSC)
+    bool lat_on;
+    lat_probe_t lat;
+    uint8_t  echo[GY63_TX_ECHO_RING][LAT_ECHO_SIZE];
+    uint32_t echo_us[GY63_TX_ECHO_RING];
+    volatile uint32_t echo_head;
+    volatile uint32_t echo_tail;
+    uint32_t echo_drops;
+
+    // traffic class scheduler (payload만 보관, header는 송신 시 부착)
+    tlm_prio_t prio;
+    uint32_t prio_budget;       // poll당 queue 송신 최대
+    uint64_t now_ms;            // prio 송신 콜백용 (ARQ 시각)
+} gy63_tx_t;
+
+// arq_on=false면 rto/holdoff/max_tx 무시
+bool gy63_tx_init(gy63_tx_t *t, net_udp_client_t *udp, bool arq_on,
+                  uint32_t rto_ms, uint32_t holdoff_ms, uint8_t max_tx);
+
+// datagram header 식별자 (boot_id, board uid). init 직후 1회
+void gy63_tx_set_id(gy63_tx_t *t, uint32_t boot_id, uint64_t uid);
+
+// latency probe 켜기 (gy63_tx_set_id 이후: echo의 boot_id 확인). timeout 지나도록 echo 없으면 lost
+void gy63_tx_enable_latency(gy63_tx_t *t, uint32_t timeout_ms);
+
+// starvation guard (tlm_prio_set_guard) + poll당 queue 송신 최대 (0: 제한 없음)
+void gy63_tx_set_prio(gy63_tx_t *t, uint32_t guard_burst, uint32_t guard_wait_ms, uint32_t budget);
+
+// bulk datagram 1개 송신 (header 자동 부착). urgent가 대기 중이거나 송신 실패면 bulk queue로
+// queue도 가득 차 있으면 false (호출자가 backlog로)
+bool gy63_tx_send(gy63_tx_t *t, const void *data, size_t len, uint64_t now_ms);
+
+// urgent datagram (경보/이벤트, <= TLM_PRIO_URGENT_MAX): batch/bulk queue를 거치지 않고 즉시 송신,
+// 실패하면 urgent queue (bulk보다 먼저 재시도). 송신 또는 queue 적재면 true
+bool gy63_tx_send_urgent(gy63_tx_t *t, const void *data, size_t len, uint64_t now_ms);
+
+// 샘플 datagram 송신 (tlm_buffer가 원본을 가진 live/backfill). bulk queue에 넣지 않음:
+// 대기 중인 datagram이 있거나 송신 실패면 false -> 호출자가 backlog에 유지 (실제 송신만 true)
+// latency probe가 켜져 있으면 conv_end_us(가장 오래된 샘플의 conversion 완료,
+// platform_micros 하위 32-bit, 0: probe 없음) 기준으로 c2s/rtt 측정
+bool gy63_tx_send_sample(gy63_tx_t *t, const void *data, size_t len, uint64_t now_ms, uint32_t conv_end_us);
+
+// 피드백/echo 처리 + class queue 송신 + RTO 재전송 + probe timeout (main loop / 대기 중 주기 호출)
+void gy63_tx_poll(gy63_tx_t *t, uint64_t now_ms);
+
+// "stat=arq,..." 한 줄 작성. 길이 리턴 (arq off면 0)
+size_t gy63_tx_stats_line(const gy63_tx_t *t, uint64_t now_ms, char *out, size_t out_sz);
+
+// "stat=lat,..." 한 줄 작성 후 percentile window 초기화. 길이 리턴 (probe off면 0)
+size_t gy63_tx_lat_stats_line(gy63_tx_t *t, uint64_t now_ms, char *out, size_t out_sz);
+
+// "stat=prio,..." 한 줄 작성 후 class별 latency window 초기화. 길이 리턴
+size_t gy63_tx_prio_stats_line(gy63_tx_t *t, uint64_t now_ms, char *out, size_t out_sz);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // __GY63_TX_H__
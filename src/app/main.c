@@ -1,70 +1,925 @@
 // FILE: src/app/main.c
 #include <stdio.h>
+#include <string.h>
 #include "pico/stdlib.h"
 
 #include "gy63_op.h"
 
 #include "platform_core.h"
 #include "net_wifi.h"
+#include "net_link.h"
 #include "net_udp.h"
 #include "net_config.h"
+#include "tlm_buffer.h"
+#include "tlm_fmt.h"
+#include "udp_tlm.h"
+#include "gy63_rec.h"
+#include "gy63_ctrl.h"
+#include "gy63_tx.h"
+#include "rec_config.h"
+#include "bench_config.h"
+#include "gy63_bench.h"
+#include "prof.h"
+#include "stream_config.h"
+#include "gy63_stream.h"
+#include "usb_bulk.h"
+#include "log_config.h"
+#include "gy63_log.h"
+#include "est_config.h"
+#include "alt_est.h"
+#include "burst_config.h"
+#include "decim.h"
+#include "adapt_config.h"
+#include "adapt.h"
+#include "sensor_config.h"
+#include "sensor_reg.h"
+#include "rtrace_config.h"
+#include "gy63_rtrace.h"
+#include "raw_config.h"
+#include "gy63_raw.h"
+#include "prio_config.h"
+#include "alarm.h"
+#include "acq_config.h"
+#include "gy63_acq.h"
+
+static tlm_sample_t    s_tlm_slots[CFG_TLM_BUF_DEPTH];
+static gy63_rec_t      s_rec;
+static gy63_ctrl_t     s_ctrl;
+static ctrl_settings_t s_set;   // runtime 설정 (control channel로 변경)
+static gy63_tx_t       s_tx;    // telemetry 송신 경로 (옵션 ARQ)
+static udp_tlm_t       s_tlm;   // 주기 stat 송신 pipeline
+static gy63_stream_t   s_bin;   // binary sample stream (USB / UDP)
+static alt_est_t       s_alt;   // 고도/수직속도 estimator
+static decim_t         s_dec;   // burst mode decimation
+static uint32_t        s_acq_seq; // IRQ 수집: 다음 기대 seq (gap 검출)
+static adapt_t         s_adapt; // deadband 송신 + 변화율 기반 주기/OSR
+static gy63_rtrace_t   s_rt;    // raw trace capture
+static net_link_t      s_link;  // Wi-Fi 끊김 감시 + 재연결
+static gy63_raw_t      s_raw;   // raw passthrough (D1/D2, 보상은 host)
+static alarm_t         s_alarm; // 기압 경보 -> urgent class
+static gy63_acq_t      s_acq;   // interrupt 구동 수집 (block ring)
+static uint64_t        s_next_prof_ms;
+static bool            s_erase_hold;    // IRQ 수집 중: pre-erase는 service_io가 아닌 run_acq가 block 사이에서
+
+// live 샘플 batch (s_set.batch개 모이면 1 datagram)
+typedef struct {
+    net_udp_client_t *udp;
+    tlm_buffer_t     *backlog;
+    tlm_sample_t      pend[CTRL_BATCH_MAX];
+    uint32_t          n;
+    uint32_t          conv_end_us;  // pend[0]의 conversion 완료 시각 (latency probe)
+} live_batch_t;
+
+static live_batch_t s_live;
+
+// backlog overflow: 모든 샘플은 이미 flash log에 기록되므로 recorder가 살아 있으면 spilled
+static bool spill_to_flash(const tlm_sample_t *s, void *user) {
+    (void)s;
+    const gy63_rec_t *rec = (const gy63_rec_t *)user;
+    return rec->ready;
+}
+
+// link 상태 변화 (net_link_poll 컨텍스트)
+static void on_link_event(bool up, void *user) {
+    (void)user;
+    net_link_stats_t st;
+    net_link_get_stats(&s_link, platform_millis(), &st);
+    if (up) {
+        printf("Wi-Fi up (join %lu ms, outage %lu ms)\n", (unsigned long)st.last_rc_ms,
+               (unsigned long)(st.reconnects ? st.last_outage_ms : 0u));
+    } else {
+        printf("Wi-Fi link lost, reconnecting\n");
+    }
+}
+
+// USB stdio 1-char 명령: 'D' flash log dump (UDP), 'F' flash log format, 'B' on-target benchmark (fmt + est + raw)
+static void poll_usb_command(void) {
+    int ch = getchar_timeout_us(0);
+    if (ch == 'B') {
+        gy63_bench_fmt(CFG_BENCH_ITERS);
+        gy63_bench_est(CFG_BENCH_ITERS);
+        gy63_bench_raw(CFG_BENCH_ITERS);
+    } else if (ch == 'D') {
+        (void)gy63_rec_dump_udp(&s_rec, s_set.dst_ip, (uint16_t)CFG_FLOG_DUMP_PORT);
+    } else if (ch == 'F') {
+        printf("flog: format %s\n", gy63_rec_format(&s_rec) ? "ok" : "failed");
+    }
+}
+
+// UDP payload (텍스트, 샘플당 1줄): "ms=%llu,t_x100=%ld,p_pa=%u\n" (tlm_fmt, snprintf와 byte 동일)
+static int format_sample(char *out, size_t out_sz, const tlm_sample_t *s) {
+    return (int)tlm_fmt_sample(out, out_sz, s);
+}
+
+static bool send_sample(const tlm_sample_t *s, void *user) {
+    gy63_tx_t *tx = (gy63_tx_t *)user;
+
+    char msg[128];
+    PROF_T0(t_fmt);
+    int n = format_sample(msg, sizeof(msg), s);
+    PROF_END(PROF_FORMAT, t_fmt);
+    if (n == 0) return false;
+
+    // backlog 원본은 tlm_buffer: 실제 송신했을 때만 true (prio queue 적재는 송신 아님)
+    return gy63_tx_send_sample(tx, msg, (size_t)n, platform_millis(), 0);
+}
+
+// batch 송신. 실패 시 batch 전체를 backlog로
+static void flush_live(live_batch_t *lb) {
+    if (lb->n == 0) return;
+
+    char msg[CTRL_BATCH_MAX * 64];
+    size_t len = 0;
+    PROF_T0(t_fmt);
+    for (uint32_t i = 0; i < lb->n; i++) {
+        int n = format_sample(msg + len, sizeof(msg) - len, &lb->pend[i]);
+        if (n == 0) break;
+        len += (size_t)n;
+    }
+    PROF_END(PROF_FORMAT, t_fmt);
+
+    if (len == 0 || !net_wifi_link_up() ||
+        !gy63_tx_send_sample(&s_tx, msg, len, platform_millis(), lb->conv_end_us)) {
+        // batch_sample 적재 시점에 sent_live로 집계됨 -> 되돌리고 backlog로
+        tlm_buffer_live_failed(lb->backlog, lb->pend, lb->n);
+    }
+    lb->n = 0;
+}
+
+// tlm_buffer_offer_live의 send_fn: batch에 적재 (적재 = live 경로로 인계, 송신 실패는 flush_live가 되돌림)
+static bool batch_sample(const tlm_sample_t *s, void *user) {
+    live_batch_t *lb = (live_batch_t *)user;
+
+    lb->pend[lb->n++] = *s;
+    if (lb->n >= s_set.batch) flush_live(lb);
+    return true;
+}
+
+// ---- stat sources (udp_tlm pipeline) ----
+
+static size_t build_buf_stats(char *out, size_t out_sz, uint64_t now, void *user) {
+    const tlm_buffer_t *buf = (const tlm_buffer_t *)user;
+    tlm_buffer_stats_t st;
+    tlm_buffer_get_stats(buf, now, &st);
+
+    int n = snprintf(out, out_sz,
+                     "stat=buf,ms=%llu,depth=%lu,max=%lu,drop=%lu,spill=%lu,bf=%lu,lag_ms=%llu\n",
+                     (unsigned long long)now,
+                     (unsigned long)st.depth,
+                     (unsigned long)st.depth_max,
+                     (unsigned long)st.dropped,
+                     (unsigned long)st.spilled,
+                     (unsigned long)st.sent_backfill,
+                     (unsigned long long)st.lag_ms);
+    if (n <= 0 || (size_t)n >= out_sz) return 0;
+    return (size_t)n;
+}
+
+// 목적지별 송신/실패 카운터: "stat=udp,ms=..,d0=ip:port/sent/fail,..."
+static size_t build_udp_stats(char *out, size_t out_sz, uint64_t now, void *user) {
+    const gy63_tx_t *tx = (const gy63_tx_t *)user;
+    net_udp_dst_stats_t ds[NET_UDP_MAX_DST];
+    size_t nd = net_udp_get_dst_stats(tx->udp, ds, NET_UDP_MAX_DST);
+
+    int n = snprintf(out, out_sz, "stat=udp,ms=%llu", (unsigned long long)now);
+    for (size_t i = 0; i < nd && n > 0 && (size_t)n < out_sz; i++) {
+        const uint8_t *ip = (const uint8_t *)&ds[i].ip; // network byte order
+        n += snprintf(out + n, out_sz - (size_t)n, ",d%u=%u.%u.%u.%u:%u/%lu/%lu",
+                      (unsigned)i, ip[0], ip[1], ip[2], ip[3], (unsigned)ds[i].port,
+                      (unsigned long)ds[i].sent, (unsigned long)ds[i].failed);
+    }
+    if (n <= 0 || (size_t)n + 1 >= out_sz) return 0;
+    out[n++] = '\n';
+    return (size_t)n;
+}
+
+static size_t build_flog_stats(char *out, size_t out_sz, uint64_t now, void *user) {
+    return gy63_rec_stats_line((const gy63_rec_t *)user, now, out, out_sz);
+}
+
+static size_t build_arq_stats(char *out, size_t out_sz, uint64_t now, void *user) {
+    return gy63_tx_stats_line((const gy63_tx_t *)user, now, out, out_sz);
+}
+
+static size_t build_lat_stats(char *out, size_t out_sz, uint64_t now, void *user) {
+    return gy63_tx_lat_stats_line((gy63_tx_t *)user, now, out, out_sz);
+}
+
+static size_t build_prio_stats(char *out, size_t out_sz, uint64_t now, void *user) {
+    return gy63_tx_prio_stats_line((gy63_tx_t *)user, now, out, out_sz);
+}
+
+static size_t build_dlog_stats(char *out, size_t out_sz, uint64_t now, void *user) {
+    (void)user;
+    return gy63_log_stats_line(now, out, out_sz);
+}
+
+static size_t build_alt_stats(char *out, size_t out_sz, uint64_t now, void *user) {
+    return alt_est_stats_line((const alt_est_t *)user, now, out, out_sz);
+}
+
+static size_t build_adapt_stats(char *out, size_t out_sz, uint64_t now, void *user) {
+    return adapt_stats_line((const adapt_t *)user, now, out, out_sz);
+}
+
+static size_t build_sensor_stats(char *out, size_t out_sz, uint64_t now, void *user) {
+    return sensor_reg_stats_line((const sensor_reg_t *)user, now, out, out_sz);
+}
+
+static size_t build_burst_stats(char *out, size_t out_sz, uint64_t now, void *user) {
+    return gy63_burst_stats_line((gy63_ctx_t *)user, &s_dec, now, out, out_sz);
+}
+
+static size_t build_rtrace_stats(char *out, size_t out_sz, uint64_t now, void *user) {
+    return gy63_rtrace_stats_line((const gy63_rtrace_t *)user, now, out, out_sz);
+}
+
+static size_t build_link_stats(char *out, size_t out_sz, uint64_t now, void *user) {
+    return net_link_stats_line((const net_link_t *)user, now, out, out_sz);
+}
+
+static size_t build_raw_stats(char *out, size_t out_sz, uint64_t now, void *user) {
+    return gy63_raw_stats_line((const gy63_raw_t *)user, now, out, out_sz);
+}
+
+static size_t build_acq_stats(char *out, size_t out_sz, uint64_t now, void *user) {
+    return gy63_acq_stats_line((gy63_acq_t *)user, now, out, out_sz);
+}
+
+static size_t build_bin_stats(char *out, size_t out_sz, uint64_t now, void *user) {
+    return gy63_stream_stats_line((const gy63_stream_t *)user, now, out, out_sz);
+}
+
+static size_t build_usb_stats(char *out, size_t out_sz, uint64_t now, void *user) {
+    (void)user;
+    usb_bulk_stats_t st;
+    usb_bulk_get_stats(&st);
+
+    int n = snprintf(out, out_sz,
+                     "stat=usb,ms=%llu,conn=%u,frames=%lu,bytes=%lu,submits=%lu,busy=%lu,detached=%lu,fill_max=%lu\n",
+                     (unsigned long long)now,
+                     usb_bulk_connected() ? 1u : 0u,
+                     (unsigned long)st.frames,
+                     (unsigned long)st.bytes,
+                     (unsigned long)st.submits,
+                     (unsigned long)st.drop_busy,
+                     (unsigned long)st.drop_detached,
+                     (unsigned long)st.fill_max);
+    if (n <= 0 || (size_t)n >= out_sz) return 0;
+    return (size_t)n;
+}
+
+// 주기 stat source 등록. slot이 모자라면 그 stat은 나가지 않으므로 부팅 로그로 남김
+static void add_stat(const char *name, telemetry_build_fn build, void *user, uint32_t period_ms, uint8_t priority) {
+    if (udp_tlm_add_source(&s_tlm, name, build, user, period_ms, priority) < 0) {
+        printf("stat=%s: not registered (UDP_TLM_MAX_SOURCES=%u)\n", name, (unsigned)UDP_TLM_MAX_SOURCES);
+    }
+}
+
+// pipeline 출력: USB 로컬 echo (non-blocking, CDC에 자리 없으면 버림) + telemetry 경로 (header/ARQ 포함)
+static bool pipeline_send(const void *data, size_t len, void *user) {
+    (void)gy63_log_echo((const char *)data, len);
+    if (!net_wifi_link_up()) return false;
+    return gy63_tx_send((gy63_tx_t *)user, data, len, platform_millis());
+}
+
+// profiling health packet: stage별 "stat=prof" 줄을 UDP_TLM_MTU 단위 datagram으로
+// (줄 수가 pipeline LINE_MAX를 넘으므로 udp_tlm source가 아닌 별도 주기 송신, 혼잡 시 이번 window 생략)
+static void send_prof_health(uint64_t now) {
+    prof_stat_t st[PROF_STAGE_COUNT];
+    if (prof_take(st) == 0) return;
+    if (udp_tlm_congested(&s_tlm, now)) return;
+
+    char msg[UDP_TLM_MTU];
+    size_t len = 0;
+    for (uint32_t i = 0; i < PROF_STAGE_COUNT; i++) {
+        char line[UDP_TLM_LINE_MAX];
+        size_t n = prof_format_stage(line, sizeof(line), &st[i], (prof_stage_t)i, now);
+        if (n == 0) continue;
+
+        if (len + n > sizeof(msg)) {
+            (void)pipeline_send(msg, len, &s_tx);
+            len = 0;
+        }
+        memcpy(msg + len, line, n);
+        len += n;
+    }
+    if (len) (void)pipeline_send(msg, len, &s_tx);
+}
+
+// control 명령 적용 (샘플 사이에서만 호출 -> 한 샘플 안에서 설정이 섞이지 않음)
+static void apply_ctrl(gy63_ctx_t *ctx, const ctrl_cmd_t *cmd) {
+    if (cmd->kind == CTRL_CMD_GET) {
+        gy63_ctrl_ack(&s_ctrl, cmd->id, CTRL_OK, &s_set);
+        return;
+    }
+
+    if (cmd->kind == CTRL_CMD_DUMP) {
+        gy63_ctrl_ack(&s_ctrl, cmd->id, s_rec.ready ? CTRL_OK : CTRL_EAPPLY, &s_set);
+        (void)gy63_rec_dump_udp(&s_rec, s_set.dst_ip, (uint16_t)CFG_FLOG_DUMP_PORT);
+        return;
+    }
+
+    if (cmd->kind == CTRL_CMD_PROM) {
+        if (CFG_RAW_TLM_ENABLE) gy63_raw_request_prom(&s_raw);
+        gy63_ctrl_ack(&s_ctrl, cmd->id, CFG_RAW_TLM_ENABLE ? CTRL_OK : CTRL_EAPPLY, &s_set);
+        return;
+    }
+
+    ctrl_settings_t next = s_set;
+    ctrl_merge(&next, cmd);
+
+    // 이전 설정으로 모인 batch는 이전 목적지로 먼저 송신
+    flush_live(&s_live);
+
+    // 실패할 수 있는 항목(목적지) 먼저 -> 실패 시 아무것도 바꾸지 않음
+    if ((cmd->fields & CTRL_F_DST) &&
+        !net_udp_set_dst(s_live.udp, next.dst_ip, next.dst_port)) {
+        gy63_ctrl_ack(&s_ctrl, cmd->id, CTRL_EAPPLY, &s_set);
+        return;
+    }
+
+    if (cmd->fields & CTRL_F_OSR) gy63_set_osr(ctx, (ms5611_osr_t)next.osr);
+    // adaptive mode: 명령의 osr/period_ms는 slow profile (fast는 변화율이 결정)
+    if (CFG_ADAPT_ENABLE) adapt_set_slow(&s_adapt, next.period_ms, next.osr);
+    s_set = next;
+
+    printf("ctrl: osr=%lu period_ms=%lu batch=%lu dst=%s:%u\n",
+           (unsigned long)s_set.osr, (unsigned long)s_set.period_ms,
+           (unsigned long)s_set.batch, s_set.dst_ip, (unsigned)s_set.dst_port);
+    gy63_ctrl_ack(&s_ctrl, cmd->id, CTRL_OK, &s_set);
+}
+
+// control/USB 명령 + 송신 경로 poll (샘플 사이)
+static uint64_t service_io(gy63_ctx_t *ctx) {
+    ctrl_cmd_t cmd;
+    if (gy63_ctrl_poll(&s_ctrl, &s_set, &cmd)) apply_ctrl(ctx, &cmd);
+    poll_usb_command();
+
+    const uint64_t now = platform_millis();
+    net_link_poll(&s_link, now);
+    gy63_tx_poll(&s_tx, now);
+    gy63_stream_poll(&s_bin, now);
+    if (CFG_RTRACE_ENABLE) gy63_rtrace_poll(&s_rt, (uint32_t)platform_micros());
+    if (CFG_RAW_TLM_ENABLE) gy63_raw_poll(&s_raw, now);
+    usb_bulk_poll();
+    if (!s_erase_hold) gy63_rec_service(&s_rec); // 다음 sector erase를 샘플 경로 밖에서
+    return now;
+}
+
+// 32-bit us 측정 시각 -> ms since boot (platform_millis와 같은 시간축). 현재 시각 기준 경과로 환산 (~71분 안)
+static uint64_t sample_ms(uint32_t t_us) {
+    const uint64_t now_us = platform_micros();
+    return (now_us - (uint32_t)((uint32_t)now_us - t_us)) / 1000u;
+}
+
+// 측정값 1개 -> recorder / estimator / stream / live telemetry
+// ms: 측정 시각 (처리 시각 아님 -> block/decimation 지연이 timestamp에 섞이지 않음)
+static void on_sample(tlm_buffer_t *buf, uint64_t ms, int32_t t_x100, uint32_t p_pa, uint32_t conv_end_us) {
+    // (옵션) 로컬 로그
+    if (CFG_USB_PRINT_SAMPLES) gy63_print_reading(t_x100, p_pa);
+
+    const tlm_sample_t sample = {
+        .ms     = ms,
+        .t_x100 = t_x100,
+        .p_pa   = p_pa,
+    };
+    (void)gy63_rec_append(&s_rec, &sample);
+    if (CFG_EST_ENABLE) {
+        // 실제 conversion 완료 시각으로 dt (loop 지터 / 주기 변경 반영)
+        PROF_T0(t_est);
+        (void)alt_est_update(&s_alt, p_pa, conv_end_us);
+        PROF_END(PROF_ESTIMATE, t_est);
+    }
+    gy63_stream_push(&s_bin, &sample, sample.ms);
+
+    // 경보: batch / deadband 생략과 무관하게 urgent class로 즉시
+    if (alarm_enabled(&s_alarm)) {
+        char ev[ALARM_LINE_MAX];
+        const size_t n = alarm_update(&s_alarm, p_pa, sample.ms, ev, sizeof(ev));
+        if (n) {
+            // 줄 자체는 urgent telemetry로. 로컬은 deferred log만 (샘플 경로에서 stdio 안 씀)
+            if (CFG_DLOG_ENABLE) (void)DLOG3(gy63_log(), DLOG_ALARM, s_alarm.hi_on, s_alarm.lo_on, p_pa);
+            (void)gy63_tx_send_urgent(&s_tx, ev, n, sample.ms);
+        }
+    }
+
+    // deadband 안이고 heartbeat 전이면 live 송신 생략 (flash에는 이미 기록)
+    if (CFG_ADAPT_ENABLE && adapt_offer(&s_adapt, t_x100, p_pa, sample.ms) == ADAPT_SKIP) return;
+
+    if (s_live.n == 0) s_live.conv_end_us = conv_end_us;
+    (void)tlm_buffer_offer_live(buf, &sample, net_wifi_link_up(), batch_sample, &s_live);
+}
+
+// backfill / 주기 stat / stream flush / profiling health
+static void service_tx(tlm_buffer_t *buf) {
+    // backfill은 stat pipeline이 backpressure 상태면 쉼 (live 샘플이 우선)
+    const uint64_t now = platform_millis();
+    const bool tx_ok = net_wifi_link_up() && !udp_tlm_congested(&s_tlm, now);
+    // 덜 찬 live batch: 다음 샘플을 기다리지 않고 나이로 flush (실패하면 backlog로)
+    if (s_live.n && now - s_live.pend[0].ms >= CFG_TLM_BATCH_AGE_MS) flush_live(&s_live);
+    (void)tlm_buffer_service(buf, now, tx_ok, send_sample, &s_tx);
+    (void)udp_tlm_step(&s_tlm, now);
+    gy63_stream_poll(&s_bin, now);
+    usb_bulk_poll();
+
+    if ((int64_t)(now - s_next_prof_ms) >= 0) {
+        s_next_prof_ms = now + CFG_PROF_PERIOD_MS;
+        send_prof_health(now);
+    }
+}
+
+// 다음 샘플 시각까지 대기하면서 control/USB 명령 처리
+static void wait_until(gy63_ctx_t *ctx, uint64_t deadline_ms) {
+    while (true) {
+        const uint64_t now = service_io(ctx);
+        if ((int64_t)(deadline_ms - now) <= 0) return;
+
+        // 대기 구간에서 deferred log 출력 (남은 record가 있으면 sleep 없이 다시)
+        if (gy63_log_drain(CFG_DLOG_DRAIN_MAX) > 0) continue;
+
+        const uint64_t left = deadline_ms - now;
+        platform_sleep_ms(left > 5u ? 5u : (uint32_t)left);
+    }
+}
+
+// burst 루프: conversion 완료 즉시 다음 명령, 보상/decimation은 다음 conversion 동안 수행.
+// 네트워크/명령 처리는 CFG_BURST_SERVICE_US마다 (conversion 사이 idle 구간)
+static void run_burst(gy63_ctx_t *ctx, tlm_buffer_t *buf) {
+    decim_init(&s_dec, 1000000u / CFG_BURST_OUT_HZ);
+    ms5611_status_t st = gy63_burst_start(ctx, (ms5611_osr_t)CFG_BURST_OSR, CFG_BURST_TEMP_EVERY,
+                                          CFG_BURST_MARGIN_US);
+    printf("burst: osr=%u temp_every=%u out=%u Hz (%s)\n", (unsigned)CFG_BURST_OSR,
+           (unsigned)CFG_BURST_TEMP_EVERY, (unsigned)CFG_BURST_OUT_HZ, ms5611_status_str(st));
+
+    s_next_prof_ms = platform_millis() + CFG_PROF_PERIOD_MS;
+    uint32_t next_service_us = (uint32_t)platform_micros();
+
+    while (true) {
+        bool     ready  = false;
+        int32_t  t_x100 = 0;
+        uint32_t p_pa   = 0;
+
+        st = gy63_burst_poll(ctx, &ready, &t_x100, &p_pa);
+        if (st != MS5611_OK) {
+            if (CFG_DLOG_ENABLE) (void)DLOG1(gy63_log(), DLOG_READ_FAIL, st);
+            if (CFG_RTRACE_ENABLE) gy63_rtrace_error(&s_rt, (uint32_t)platform_micros(), st);
+        } else if (ready) {
+            decim_out_t out;
+            if (decim_push(&s_dec, t_x100, p_pa, ctx->dev.conv_end_us, &out)) {
+                PROF_T0(t_loop);
+                on_sample(buf, sample_ms(out.t_us), out.t_x100, out.p_pa, out.t_us);
+                PROF_END(PROF_LOOP_BUSY, t_loop);
+            }
+        }
+
+        if ((int32_t)((uint32_t)platform_micros() - next_service_us) < 0) continue;
+        next_service_us = (uint32_t)platform_micros() + CFG_BURST_SERVICE_US;
+
+        (void)service_io(ctx);
+        // control channel OSR 변경은 burst 재시작으로 반영 (period_ms는 burst에서 의미 없음)
+        if (ctx->cfg.osr != ctx->burst.osr) {
+            (void)gy63_burst_start(ctx, ctx->cfg.osr, CFG_BURST_TEMP_EVERY, CFG_BURST_MARGIN_US);
+        }
+        service_tx(buf);
+        (void)gy63_log_drain(1);
+    }
+}
+
+// seq gap (ring full로 버린 샘플, 수집 재시작): decimation window를 새로 시작 (gap 양쪽을 평균하지 않음)
+static void acq_gap(void) {
+    if (CFG_ACQ_OUT_HZ) decim_init(&s_dec, 1000000u / CFG_ACQ_OUT_HZ);
+}
+
+// IRQ 수집 block 1개: seq 검사 -> 보상 -> (decimation) -> 샘플 경로
+static void process_acq_block(gy63_ctx_t *ctx, tlm_buffer_t *buf, const acq_block_t *blk) {
+    if (blk->seq0 != s_acq_seq) acq_gap();  // 첫 block은 빈 window라 영향 없음
+
+    uint32_t seq = blk->seq0;
+    for (uint32_t i = 0; i < blk->n; i++) {
+        const acq_sample_t *s = &blk->s[i];
+        if (s->seq != seq) acq_gap();
+        seq = s->seq + 1u;
+
+        if (ctx->raw_tap) ctx->raw_tap(s->t_us, s->d1, s->d2, (uint16_t)s_acq.osr, ctx->raw_user);
+
+        int32_t  t_x100 = 0;
+        uint32_t p_pa   = 0;
+        PROF_T0(t_comp);
+        ms5611_status_t st = ms5611_compensate(&ctx->coeffs, s->d1, s->d2, &t_x100, &p_pa);
+        PROF_END(PROF_COMPENSATE, t_comp);
+        if (st != MS5611_OK) continue;
+
+        if (CFG_ACQ_OUT_HZ == 0) {
+            on_sample(buf, sample_ms(s->t_us), t_x100, p_pa, s->t_us);
+            continue;
+        }
+        decim_out_t out;
+        if (decim_push(&s_dec, t_x100, p_pa, s->t_us, &out)) {
+            on_sample(buf, sample_ms(out.t_us), out.t_x100, out.p_pa, out.t_us);
+        }
+    }
+    s_acq_seq = seq;
+}
+
+// control channel OSR 변경 -> 수집 재시작. 새 OSR로 시작 못 하면 이전 OSR로 되돌림
+// (설정도 되돌려 매 loop 재시도하지 않음). 그것도 실패하면 false (수집 정지)
+static bool acq_restart(gy63_ctx_t *ctx) {
+    const ms5611_osr_t prev = s_acq.osr;
+    gy63_acq_stop(&s_acq);
+    while (i2c_pico_async_busy(ctx->dev.i2c)) tight_loop_contents();
+
+    if (gy63_acq_start(&s_acq, &ctx->dev, ctx->cfg.osr, CFG_ACQ_PERIOD_US,
+                       CFG_ACQ_TEMP_EVERY, CFG_ACQ_BLOCK, CFG_ACQ_FLUSH_US)) {
+        return true;
+    }
+    printf("acq: restart at osr=%u failed, back to osr=%u\n", (unsigned)ctx->cfg.osr, (unsigned)prev);
+    gy63_set_osr(ctx, prev);
+    s_set.osr = (uint32_t)prev;
+
+    return gy63_acq_start(&s_acq, &ctx->dev, prev, CFG_ACQ_PERIOD_US,
+                          CFG_ACQ_TEMP_EVERY, CFG_ACQ_BLOCK, CFG_ACQ_FLUSH_US);
+}
+
+// IRQ 수집 루프: 수집은 timer/I2C IRQ (gy63_acq), 여기서는 block 단위 처리 + 네트워크/명령.
+// 처리가 밀려도 수집 주기는 그대로 (ring이 차면 샘플 버림 -> stat=acq)
+static void run_acq(gy63_ctx_t *ctx, tlm_buffer_t *buf) {
+    if (CFG_ACQ_OUT_HZ) decim_init(&s_dec, 1000000u / CFG_ACQ_OUT_HZ);
+    if (!gy63_acq_start(&s_acq, &ctx->dev, (ms5611_osr_t)CFG_ACQ_OSR, CFG_ACQ_PERIOD_US,
+                        CFG_ACQ_TEMP_EVERY, CFG_ACQ_BLOCK, CFG_ACQ_FLUSH_US)) {
+        printf("acq: start failed (periodic loop)\n");
+        return;
+    }
+    printf("acq: osr=%u period=%lu us block=%u out=%u Hz\n", (unsigned)CFG_ACQ_OSR,
+           (unsigned long)s_acq.period_us, (unsigned)CFG_ACQ_BLOCK, (unsigned)CFG_ACQ_OUT_HZ);
+
+    s_next_prof_ms = platform_millis() + CFG_PROF_PERIOD_MS;
+    s_erase_hold   = true;
+
+    while (true) {
+        const uint64_t flash0 = s_rec.flash.program_us + s_rec.flash.erase_us;
+        const acq_block_t *blk;
+        while ((blk = acq_buf_peek(&s_acq.buf)) != NULL) {
+            PROF_T0(t_loop);
+            process_acq_block(ctx, buf, blk);
+            acq_buf_release(&s_acq.buf);
+            PROF_END(PROF_LOOP_BUSY, t_loop);
+        }
+
+        // ring을 막 비운 block 사이에서만 pre-erase (IRQ가 막히는 동안 새 block이 들어갈 자리 최대)
+        // program/erase로 IRQ가 막힌 시간은 stat=acq flash_us (그 동안의 tick은 missed)
+        gy63_rec_service(&s_rec);
+        gy63_acq_note_flash(&s_acq, (uint32_t)(s_rec.flash.program_us + s_rec.flash.erase_us - flash0));
+
+        (void)service_io(ctx);
+        // control channel OSR 변경은 수집 재시작으로 반영
+        if (ctx->cfg.osr != s_acq.osr && !acq_restart(ctx)) {
+            printf("acq: restart failed (periodic loop)\n");
+            s_erase_hold = false;
+            return;
+        }
+        service_tx(buf);
+
+        // 다음 block까지 대기 중 deferred log 출력
+        if (acq_buf_pending(&s_acq.buf) == 0 && gy63_log_drain(CFG_DLOG_DRAIN_MAX) == 0) platform_sleep_ms(1);
+    }
+}
+
+// registry 루프: sensor별 non-blocking 측정, conversion 대기 동안 네트워크/명령 처리.
+// baro sample만 기존 샘플 경로로 (다른 sensor 값은 stat=sensor 집계)
+static void run_sensors(gy63_ctx_t *ctx, tlm_buffer_t *buf) {
+    const uint32_t ok = gy63_sensors_init(ctx, CFG_ADAPT_ENABLE ? adapt_period_ms(&s_adapt) : s_set.period_ms,
+                                          CFG_SENSOR_MARGIN_US);
+    printf("sensors: %lu/%lu ready\n", (unsigned long)ok, (unsigned long)ctx->reg.n);
+
+    s_next_prof_ms = platform_millis() + CFG_PROF_PERIOD_MS;
+    uint32_t next_service_us = (uint32_t)platform_micros();
+
+    while (true) {
+        sensor_sample_t smp[SENSOR_REG_MAX];
+        const size_t n = sensor_reg_poll(&ctx->reg, (uint32_t)platform_micros(), smp, SENSOR_REG_MAX);
+
+        for (size_t i = 0; i < n; i++) {
+            int32_t t_x100 = 0, p_pa = 0;
+            if (smp[i].id != GY63_SENSOR_BARO ||
+                !sensor_sample_get(&smp[i], SENSOR_Q_TEMP_CX100, &t_x100) ||
+                !sensor_sample_get(&smp[i], SENSOR_Q_PRESS_PA, &p_pa)) {
+                continue;
+            }
+            PROF_T0(t_loop);
+            on_sample(buf, sample_ms(smp[i].t_us), t_x100, (uint32_t)p_pa, smp[i].t_us);
+            PROF_END(PROF_LOOP_BUSY, t_loop);
+        }
+
+        if ((int32_t)((uint32_t)platform_micros() - next_service_us) < 0) continue;
+        next_service_us = (uint32_t)platform_micros() + CFG_SENSOR_SERVICE_US;
+
+        (void)service_io(ctx);
+        // control / adaptive 설정은 다음 측정 시작부터
+        const uint32_t period_ms = CFG_ADAPT_ENABLE ? adapt_period_ms(&s_adapt) : s_set.period_ms;
+        sensor_reg_set_period(&ctx->reg, GY63_SENSOR_BARO, period_ms * 1000u);
+        ctx->baro.osr = CFG_ADAPT_ENABLE ? (ms5611_osr_t)adapt_osr(&s_adapt) : ctx->cfg.osr;
+        service_tx(buf);
+        (void)gy63_log_drain(1);
+    }
+}
+
+// raw passthrough 루프: 보상 없이 D1/D2 -> tlm_raw frame (보상은 gy63_ingest). 주기/OSR은 control channel
+static void run_raw(gy63_ctx_t *ctx, tlm_buffer_t *buf) {
+    printf("raw passthrough: batch=%u -> %s:%u\n", (unsigned)CFG_RAW_BATCH, s_set.dst_ip, (unsigned)s_set.dst_port);
+
+    uint64_t next_sample_ms = platform_millis();
+    s_next_prof_ms = next_sample_ms + CFG_PROF_PERIOD_MS;
+
+    while (true) {
+        PROF_T0(t_loop);
+        uint32_t d1 = 0, d2 = 0;
+        ms5611_status_t st = gy63_read_raw(ctx, &d1, &d2);
+        if (st != MS5611_OK) {
+            if (CFG_DLOG_ENABLE) (void)DLOG1(gy63_log(), DLOG_READ_FAIL, st);
+            else                 printf("gy63_read_raw failed: %s (%ld)\n", ms5611_status_str(st), (long)st);
+            if (CFG_RTRACE_ENABLE) gy63_rtrace_error(&s_rt, (uint32_t)platform_micros(), st);
+        } else {
+            // 샘플 시각 = conversion 완료 (I2C read 완료 시각 아님), flush 판단은 현재 시각
+            gy63_raw_push(&s_raw, sample_ms(ctx->dev.conv_end_us), d1, d2, (uint16_t)ctx->cfg.osr,
+                          platform_millis());
+        }
+
+        service_tx(buf);
+        PROF_END(PROF_LOOP_BUSY, t_loop);
+
+        next_sample_ms += (uint64_t)s_set.period_ms;
+        if ((int64_t)(next_sample_ms - platform_millis()) < 0) next_sample_ms = platform_millis();
+
+        wait_until(ctx, next_sample_ms);
+    }
+}
+
+// boot 대기 (host terminal 연결). GY63_USB_STREAM 빌드는 tud_task를 직접 돌려야 CDC가 enumerate 됨
+static void boot_wait_ms(uint32_t ms) {
+    const uint64_t t0 = platform_millis();
+    while (platform_millis() - t0 < ms) {
+        usb_bulk_poll();
+        platform_sleep_ms(1);
+    }
+}
 
 int main() {
+    usb_bulk_device_init(); // GY63_USB_STREAM 빌드만: stdio_usb보다 먼저 TinyUSB init
     stdio_init_all();
-    sleep_ms(10000);
+    if (CFG_DLOG_ENABLE) gy63_log_init();
+    boot_wait_ms(10000);
 
     // 1) Wi-Fi 플랫폼 초기화 (cyw43 init + STA)
     if (!platform_init()) {
         printf("platform_init failed\n");
-        while (true) tight_loop_contents();
+        while (true) usb_bulk_poll(); // USB stdio는 계속 (오류 메시지 확인용)
     }
 
-    // 2) Wi-Fi 연결
+    // 2) Wi-Fi 연결 (비동기). 첫 연결은 CFG_WIFI_TIMEOUT_MS까지 기다리고, 이후 재연결은 net_link_poll이 관리
+    net_link_cfg_t link_cfg;
+    net_link_cfg_default(&link_cfg);
+    link_cfg.ssid            = CFG_WIFI_SSID;
+    link_cfg.password        = CFG_WIFI_PASSWORD;
+    link_cfg.join_timeout_ms = CFG_WIFI_JOIN_TIMEOUT_MS;
+    link_cfg.backoff_min_ms  = CFG_WIFI_BACKOFF_MIN_MS;
+    link_cfg.backoff_max_ms  = CFG_WIFI_BACKOFF_MAX_MS;
+    link_cfg.fast_tries      = CFG_WIFI_FAST_TRIES;
+    link_cfg.reuse_lease     = CFG_WIFI_REUSE_LEASE != 0;
+    link_cfg.static_ip       = CFG_WIFI_STATIC_IP;
+    link_cfg.static_mask     = CFG_WIFI_STATIC_MASK;
+    link_cfg.static_gw       = CFG_WIFI_STATIC_GW;
+    if (!net_link_init(&s_link, &link_cfg)) printf("net_link: bad static IP config (using DHCP)\n");
+    net_link_set_event_fn(&s_link, on_link_event, NULL);
+
     printf("Connecting Wi-Fi...\n");
-    if (!net_wifi_connect_wpa2(CFG_WIFI_SSID, CFG_WIFI_PASSWORD, CFG_WIFI_TIMEOUT_MS)) {
-        printf("Wi-Fi connect failed\n");
-        while (true) tight_loop_contents();
+    const uint64_t wifi_t0 = platform_millis();
+    (void)net_link_start(&s_link, wifi_t0);
+    while (!net_link_up(&s_link) && platform_millis() - wifi_t0 < CFG_WIFI_TIMEOUT_MS) {
+        net_link_poll(&s_link, platform_millis());
+        usb_bulk_poll();
+        platform_sleep_ms(10);
     }
-    printf("Wi-Fi connected\n");
+    if (!net_link_up(&s_link)) printf("Wi-Fi not connected yet (retrying in background)\n");
 
-    // 3) UDP 오픈
+    // 3) UDP 오픈 (telemetry 송신 + control 수신)
     net_udp_client_t *udp = NULL;
     if (!net_udp_open(&udp, CFG_UDP_DST_IP, (uint16_t)CFG_UDP_DST_PORT)) {
         printf("net_udp_open failed (%s:%u)\n", CFG_UDP_DST_IP, (unsigned)CFG_UDP_DST_PORT);
-        while (true) tight_loop_contents();
+        while (true) usb_bulk_poll(); // USB stdio는 계속 (오류 메시지 확인용)
     }
     printf("UDP ready -> %s:%u\n", CFG_UDP_DST_IP, (unsigned)CFG_UDP_DST_PORT);
 
+    net_udp_set_multicast_ttl(udp, (uint8_t)CFG_UDP_MCAST_TTL);
+    if (CFG_UDP_FANOUT_IP[0] != '\0') {
+        bool ok = net_udp_add_dst(udp, CFG_UDP_FANOUT_IP, (uint16_t)CFG_UDP_FANOUT_PORT);
+        printf("UDP fan-out %s -> %s:%u\n", ok ? "ready" : "failed",
+               CFG_UDP_FANOUT_IP, (unsigned)CFG_UDP_FANOUT_PORT);
+    }
+
+    if (!gy63_ctrl_init(&s_ctrl, (uint16_t)CFG_CTRL_PORT)) {
+        printf("control channel bind failed (udp/%u)\n", (unsigned)CFG_CTRL_PORT);
+    } else {
+        printf("control channel on udp/%u\n", (unsigned)CFG_CTRL_PORT);
+        if (CFG_CTRL_MCAST_GROUP[0] != '\0' && !net_udp_join_group(s_ctrl.udp, CFG_CTRL_MCAST_GROUP)) {
+            printf("IGMP join %s failed\n", CFG_CTRL_MCAST_GROUP);
+        }
+    }
+
+    if (CFG_BENCH_ON_BOOT) {
+        gy63_bench_fmt(CFG_BENCH_ITERS);
+        gy63_bench_est(CFG_BENCH_ITERS);
+        gy63_bench_raw(CFG_BENCH_ITERS);
+    }
+
+#if CFG_PROF_ENABLE
+    uint32_t (*prof_clock)(void) = NULL;
+    uint32_t prof_hz = 0;
+    const bool prof_cyc = platform_prof_clock(&prof_clock, &prof_hz);
+    prof_init(prof_clock, prof_hz);
+    printf("prof: on (%s, %lu Hz)\n", prof_cyc ? "DWT cycles" : "us timer", (unsigned long)prof_hz);
+#endif
+
     // 4) 센서 init
     gy63_ctx_t ctx;
     gy63_init(&ctx);
 
-    // 5) 메인 루프: 1회 측정 -> UDP 송신
+    if (CFG_BURST_ENABLE) ctx.cfg.osr = (ms5611_osr_t)CFG_BURST_OSR;
+    if (CFG_ADAPT_ENABLE) ctx.cfg.osr = (ms5611_osr_t)CFG_ADAPT_SLOW_OSR;
+    s_set.osr       = (uint32_t)ctx.cfg.osr;
+    s_set.period_ms = CFG_ADAPT_ENABLE ? CFG_ADAPT_SLOW_PERIOD_MS : CFG_SAMPLE_PERIOD_MS;
+    s_set.batch     = CFG_TLM_BATCH;
+    strncpy(s_set.dst_ip, CFG_UDP_DST_IP, sizeof(s_set.dst_ip) - 1);
+    s_set.dst_port  = (uint16_t)CFG_UDP_DST_PORT;
+
+    // 5) black-box recorder + store-and-forward 버퍼
+    (void)gy63_rec_init(&s_rec, platform_boot_id());
+
+    tlm_buffer_t tlm_buf;
+    tlm_buffer_init(&tlm_buf, s_tlm_slots, CFG_TLM_BUF_DEPTH,
+                    CFG_BACKFILL_PERIOD_MS, CFG_BACKFILL_BURST);
+    tlm_buffer_set_spill(&tlm_buf, spill_to_flash, &s_rec);
+
+    (void)gy63_tx_init(&s_tx, udp, CFG_ARQ_ENABLE != 0,
+                       CFG_ARQ_RTO_MS, CFG_ARQ_HOLDOFF_MS, (uint8_t)CFG_ARQ_MAX_TX);
+    gy63_tx_set_id(&s_tx, platform_boot_id(), platform_unique_id());
+    gy63_tx_set_prio(&s_tx, CFG_PRIO_GUARD_BURST, CFG_PRIO_GUARD_WAIT_MS, CFG_PRIO_SERVICE_BUDGET);
+    alarm_init(&s_alarm, CFG_ALARM_P_HIGH_PA, CFG_ALARM_P_LOW_PA, CFG_ALARM_HYST_PA);
+    printf("boot=%08lx uid=%016llx\n", (unsigned long)platform_boot_id(), (unsigned long long)platform_unique_id());
+    if (CFG_ARQ_ENABLE) printf("telemetry ARQ on (rto=%ums)\n", (unsigned)CFG_ARQ_RTO_MS);
+    if (CFG_LAT_PROBE_ENABLE) {
+        gy63_tx_enable_latency(&s_tx, CFG_LAT_TIMEOUT_MS);
+        printf("latency probe on (host echo required, timeout=%ums)\n", (unsigned)CFG_LAT_TIMEOUT_MS);
+    }
+
+    // binary stream: USB(CDC 1) / UDP(별도 port) / 둘 다
+    gy63_stream_init(&s_bin, CFG_BIN_BATCH, CFG_BIN_FLUSH_MS);
+    if (CFG_BIN_STREAM_USB) {
+        tlm_transport_t tr;
+        if (usb_bulk_init()) {
+            usb_bulk_transport(&tr);
+            (void)gy63_stream_add_transport(&s_bin, &tr);
+            printf("bin stream: usb (CDC 1)\n");
+        } else {
+            printf("bin stream: usb unavailable (build with GY63_USB_STREAM=ON)\n");
+        }
+    }
+    if (CFG_BIN_STREAM_UDP) {
+        net_udp_client_t *bin_udp = NULL;
+        tlm_transport_t tr;
+        if (net_udp_open(&bin_udp, CFG_UDP_DST_IP, (uint16_t)CFG_BIN_UDP_PORT)) {
+            net_udp_transport(bin_udp, &tr);
+            (void)gy63_stream_add_transport(&s_bin, &tr);
+            printf("bin stream: udp -> %s:%u\n", CFG_UDP_DST_IP, (unsigned)CFG_BIN_UDP_PORT);
+        } else {
+            printf("bin stream: udp open failed\n");
+        }
+    }
+
+    // raw trace: PROM + raw D1/D2 -> UDP (host replay용)
+    if (CFG_RTRACE_ENABLE) {
+        net_udp_client_t *rt_udp = NULL;
+        tlm_transport_t tr;
+        gy63_rtrace_init(&s_rt, ctx.dev.prom, (uint16_t)ctx.cfg.osr, platform_boot_id(),
+                         CFG_RTRACE_HDR_EVERY, CFG_RTRACE_FLUSH_MS);
+        if (net_udp_open(&rt_udp, CFG_UDP_DST_IP, (uint16_t)CFG_RTRACE_UDP_PORT)) {
+            net_udp_transport(rt_udp, &tr);
+            gy63_rtrace_set_transport(&s_rt, &tr);
+            gy63_set_raw_tap(&ctx, gy63_rtrace_tap, &s_rt);
+            printf("raw trace: udp -> %s:%u\n", CFG_UDP_DST_IP, (unsigned)CFG_RTRACE_UDP_PORT);
+        } else {
+            printf("raw trace: udp open failed\n");
+        }
+    }
+
+    alt_est_cfg_t est_cfg;
+    alt_est_cfg_default(&est_cfg);
+    est_cfg.accel_sigma = CFG_EST_ACCEL_SIGMA;
+    est_cfg.meas_sigma  = CFG_EST_MEAS_SIGMA;
+    est_cfg.gate_sigma  = CFG_EST_GATE_SIGMA;
+    est_cfg.p0_pa       = CFG_EST_P0_PA;
+    alt_est_init(&s_alt, &est_cfg);
+
+    adapt_cfg_t adapt_cfg;
+    adapt_cfg_default(&adapt_cfg);
+    adapt_cfg.deadband_pa    = CFG_ADAPT_DEADBAND_PA;
+    adapt_cfg.deadband_cx100 = CFG_ADAPT_DEADBAND_CX100;
+    adapt_cfg.heartbeat_ms   = CFG_ADAPT_HEARTBEAT_MS;
+    adapt_cfg.rate_window_ms = CFG_ADAPT_RATE_WINDOW_MS;
+    adapt_cfg.fast_rate_pa_s = CFG_ADAPT_FAST_RATE_PA_S;
+    adapt_cfg.calm_rate_pa_s = CFG_ADAPT_CALM_RATE_PA_S;
+    adapt_cfg.hold_ms        = CFG_ADAPT_HOLD_MS;
+    adapt_cfg.slow_period_ms = CFG_ADAPT_SLOW_PERIOD_MS;
+    adapt_cfg.slow_osr       = CFG_ADAPT_SLOW_OSR;
+    adapt_cfg.fast_period_ms = CFG_ADAPT_FAST_PERIOD_MS;
+    adapt_cfg.fast_osr       = CFG_ADAPT_FAST_OSR;
+    adapt_cfg.base_period_ms = CFG_SAMPLE_PERIOD_MS;   // 절감률 기준 = 기존 고정 주기
+    adapt_init(&s_adapt, &adapt_cfg);
+
+    s_live.udp     = udp;
+    s_live.backlog = &tlm_buf;
+    s_live.n       = 0;
+
+    // 주기 stat: source별 주기/우선순위, 송신 실패 시 backoff (샘플 경로와 별개)
+    udp_tlm_init(&s_tlm, pipeline_send, &s_tx);
+    udp_tlm_set_rate_limit(&s_tlm, CFG_STAT_RATE_BPS, UDP_TLM_MTU);
+    add_stat("buf",  build_buf_stats,    &tlm_buf, CFG_STATS_PERIOD_MS, 1);
+    add_stat("udp",  build_udp_stats,    &s_tx,    CFG_STATS_PERIOD_MS, 2);
+    add_stat("flog", build_flog_stats,   &s_rec,   CFG_STATS_PERIOD_MS, 2);
+    add_stat("arq",  build_arq_stats,    &s_tx,    CFG_STATS_PERIOD_MS, 2);
+    add_stat("tlm",  udp_tlm_stats_line, &s_tlm,   CFG_STATS_PERIOD_MS * 2u, 3);
+    add_stat("link", build_link_stats,   &s_link,  CFG_STATS_PERIOD_MS, 2);
+    add_stat("prio", build_prio_stats,   &s_tx,    CFG_STATS_PERIOD_MS, 2);
+    if (CFG_LAT_PROBE_ENABLE) {
+        add_stat("lat", build_lat_stats, &s_tx, CFG_STATS_PERIOD_MS, 1);
+    }
+    if (CFG_EST_ENABLE) {
+        add_stat("alt", build_alt_stats, &s_alt, CFG_EST_STAT_PERIOD_MS, 1);
+    }
+    if (CFG_DLOG_ENABLE) {
+        add_stat("dlog", build_dlog_stats, NULL, CFG_STATS_PERIOD_MS, 3);
+    }
+    if (s_bin.n_port > 0) {
+        add_stat("bin", build_bin_stats, &s_bin, CFG_STATS_PERIOD_MS, 2);
+    }
+    if (CFG_BIN_STREAM_USB) {
+        add_stat("usb", build_usb_stats, NULL, CFG_STATS_PERIOD_MS, 3);
+    }
+
+    if (CFG_RTRACE_ENABLE) {
+        add_stat("rtrace", build_rtrace_stats, &s_rt, CFG_STATS_PERIOD_MS, 3);
+    }
+
+    if (CFG_ADAPT_ENABLE) {
+        add_stat("adapt", build_adapt_stats, &s_adapt, CFG_ADAPT_STAT_PERIOD_MS, 2);
+    }
+    if (CFG_RAW_TLM_ENABLE) {
+        tlm_transport_t tr;
+        net_udp_transport(udp, &tr);
+        gy63_raw_init(&s_raw, ctx.dev.prom, platform_boot_id(), CFG_RAW_BATCH, CFG_RAW_FLUSH_MS);
+        gy63_raw_set_transport(&s_raw, &tr);
+        add_stat("raw", build_raw_stats, &s_raw, CFG_STATS_PERIOD_MS, 2);
+        run_raw(&ctx, &tlm_buf); // 리턴하지 않음
+    }
+    if (CFG_ACQ_ISR_ENABLE) {
+        add_stat("acq", build_acq_stats, &s_acq, CFG_STATS_PERIOD_MS, 2);
+        run_acq(&ctx, &tlm_buf); // 시작/재시작 실패 시에만 리턴 (기본 주기 루프)
+    }
+    if (CFG_SENSOR_REG_ENABLE && !CFG_BURST_ENABLE) {
+        add_stat("sensor", build_sensor_stats, &ctx.reg, CFG_STATS_PERIOD_MS, 3);
+        run_sensors(&ctx, &tlm_buf); // 리턴하지 않음
+    }
+    if (CFG_BURST_ENABLE) {
+        add_stat("burst", build_burst_stats, &ctx, CFG_STATS_PERIOD_MS, 2);
+        run_burst(&ctx, &tlm_buf); // 리턴하지 않음
+    }
+
+    uint64_t next_sample_ms = platform_millis();
+    s_next_prof_ms = next_sample_ms + CFG_PROF_PERIOD_MS;
+
+    // 6) 메인 루프: 1회 측정 -> UDP 송신 (live 우선, 이후 backlog backfill)
     while (true) {
+        PROF_T0(t_loop);
         int32_t  t_x100 = 0;
         uint32_t p_pa   = 0;
 
+        if (CFG_ADAPT_ENABLE) gy63_set_osr(&ctx, (ms5611_osr_t)adapt_osr(&s_adapt));
         ms5611_status_t st = gy63_read(&ctx, &t_x100, &p_pa);
         if (st != MS5611_OK) {
-            printf("gy63_read failed: %s (%ld)\n", ms5611_status_str(st), (long)st);
+            if (CFG_DLOG_ENABLE) (void)DLOG1(gy63_log(), DLOG_READ_FAIL, st);
+            else                 printf("gy63_read failed: %s (%ld)\n", ms5611_status_str(st), (long)st);
+            if (CFG_RTRACE_ENABLE) gy63_rtrace_error(&s_rt, (uint32_t)platform_micros(), st);
         } else {
-            // (옵션) 로컬 로그
-            printf("T=%.2f C, P=%u Pa\n", (double)t_x100 / 100.0, (unsigned)p_pa);
-
-            // UDP payload (텍스트)
-            const uint64_t ms = platform_millis();
-            char msg[128];
-            int n = snprintf(msg, sizeof(msg),
-                             "ms=%llu,t_x100=%ld,p_pa=%u\n",
-                             (unsigned long long)ms,
-                             (long)t_x100,
-                             (unsigned)p_pa);
-
-            if (n > 0) {
-                (void)net_udp_send(udp, msg, (size_t)n);
-            }
+            on_sample(&tlm_buf, sample_ms(ctx.dev.conv_end_us), t_x100, p_pa, ctx.dev.conv_end_us);
         }
 
-        sleep_ms(100);
+        service_tx(&tlm_buf);
+        PROF_END(PROF_LOOP_BUSY, t_loop);
+
+        // 고정 주기 (측정 시간 포함). 밀렸으면 누적하지 않고 현재 시각 기준으로 재시작
+        next_sample_ms += (uint64_t)(CFG_ADAPT_ENABLE ? adapt_period_ms(&s_adapt) : s_set.period_ms);
+        if ((int64_t)(next_sample_ms - platform_millis()) < 0) next_sample_ms = platform_millis();
+
+        wait_until(&ctx, next_sample_ms);
     }
 }
@@ -0,0 +1,16 @@
+#ifndef __ACQ_CONFIG_H__
+#define __ACQ_CONFIG_H__
+
+// interrupt 구동 수집 (src/app/gy63_acq.c, buffer: src/core/acq_buf.h)
+// timer IRQ가 고정 주기로 conversion을 돌리고 (I2C IRQ로 read/command), main loop는 block 단위로 보상/decimation
+// 켜면 CFG_SENSOR_REG_ENABLE / CFG_BURST_ENABLE보다 우선 (CFG_RAW_TLM_ENABLE 다음). period_ms 명령은 무시
+// 처리 지연/overrun은 "stat=acq" (dropped, overruns, missed, busy)
+#define CFG_ACQ_ISR_ENABLE      (0)
+#define CFG_ACQ_OSR             (256)     // MS5611_OSR_*
+#define CFG_ACQ_PERIOD_US       (1000u)   // tick당 conversion 1개 (변환 max + bus 여유보다 짧으면 늘림)
+#define CFG_ACQ_TEMP_EVERY      (16u)     // D1 N회마다 온도(D2) 1회
+#define CFG_ACQ_BLOCK           (32u)     // block당 샘플 (<= ACQ_BUF_BLOCK_MAX), ring은 ACQ_BUF_BLOCKS개
+#define CFG_ACQ_FLUSH_US        (50000u)  // 덜 찬 block도 이 시간 뒤 publish
+#define CFG_ACQ_OUT_HZ          (50u)     // decimation 출력 rate (0: 샘플마다 기존 샘플 경로로)
+
+#endif /* __ACQ_CONFIG_H__ */
@@ -0,0 +1,21 @@
+#ifndef __ADAPT_CONFIG_H__
+#define __ADAPT_CONFIG_H__
+
+// change-driven sampling / deadband 송신 (src/core/adapt.h)
+// 켜면 live telemetry는 변화/heartbeat 샘플만, 주기/OSR은 변화율에 따라 slow <-> fast 자동 전환
+// (flash log / estimator / binary stream은 측정한 전 샘플). slow profile은 control channel osr/period_ms
+#define CFG_ADAPT_ENABLE          (0)
+#define CFG_ADAPT_DEADBAND_PA     (3u)      // 마지막 송신 대비 이 이상 변하면 송신 (~25 cm)
+#define CFG_ADAPT_DEADBAND_CX100  (10u)     // 온도 0.1 C
+#define CFG_ADAPT_HEARTBEAT_MS    (10000u)  // 변화 없어도 이 간격마다 1회
+#define CFG_ADAPT_RATE_WINDOW_MS  (1000u)   // 변화율 평가 window
+#define CFG_ADAPT_FAST_RATE_PA_S  (12u)     // ~1 m/s: fast 진입
+#define CFG_ADAPT_CALM_RATE_PA_S  (4u)      // 이 미만이 HOLD 동안 지속되면 slow 복귀
+#define CFG_ADAPT_HOLD_MS         (5000u)
+#define CFG_ADAPT_SLOW_PERIOD_MS  (1000u)
+#define CFG_ADAPT_SLOW_OSR        (4096u)
+#define CFG_ADAPT_FAST_PERIOD_MS  (20u)     // OSR 1024 D1+D2 ~4.6 ms -> 여유 있음
+#define CFG_ADAPT_FAST_OSR        (1024u)
+#define CFG_ADAPT_STAT_PERIOD_MS  (5000u)   // "stat=adapt" 송신 주기
+
+#endif /* __ADAPT_CONFIG_H__ */
@@ -0,0 +1,11 @@
+#ifndef __BENCH_CONFIG_H__
+#define __BENCH_CONFIG_H__
+
+// on-target benchmark (src/app/gy63_bench.c). 결과는 USB stdio로 JSON line (host bench와 같은 형식)
+#define CFG_BENCH_ON_BOOT      (0)      // 1: 부팅 직후 1회 실행 (USB 'B' 명령으로도 실행 가능)
+#define CFG_BENCH_ITERS        (2000u)  // 항목당 반복 횟수
+
+// per-stage latency profiling (src/core/prof.h). 측정점은 CMake option GY63_PROFILE=ON일 때만 compile 됨
+#define CFG_PROF_PERIOD_MS     (10000u) // "stat=prof" health packet 주기 (window 통계, 보고 후 초기화)
+
+#endif /* __BENCH_CONFIG_H__ */
@@ -0,0 +1,13 @@
+#ifndef __BURST_CONFIG_H__
+#define __BURST_CONFIG_H__
+
+// burst acquisition (ms5611_burst_*, src/core/decim.h)
+// 주기 sleep 대신 연속 conversion + decimation. 켜면 CFG_SAMPLE_PERIOD_MS / control period_ms는 무시
+#define CFG_BURST_ENABLE        (0)
+#define CFG_BURST_OSR           (256)    // MS5611_OSR_* (256: 변환 0.6 ms)
+#define CFG_BURST_TEMP_EVERY    (16u)    // D1 N회마다 온도(D2) 1회
+#define CFG_BURST_MARGIN_US     (20u)    // datasheet max conversion time 뒤 여유
+#define CFG_BURST_OUT_HZ        (50u)    // decimation 출력 rate (= 기존 샘플 경로로 들어가는 rate)
+#define CFG_BURST_SERVICE_US    (1000u)  // 네트워크/명령 처리 간격 (길수록 poll 지연 감소, 응답 느림)
+
+#endif /* __BURST_CONFIG_H__ */
@@ -0,0 +1,12 @@
+#ifndef __EST_CONFIG_H__
+#define __EST_CONFIG_H__
+
+// altitude / vertical speed estimator (src/core/alt_est.h), gy63_read 출력마다 update
+#define CFG_EST_ENABLE          (1)
+#define CFG_EST_ACCEL_SIGMA     (0.5f)   // process noise: 가속도 1-sigma (m/s^2). 크면 응답 빠름/잡음 큼
+#define CFG_EST_MEAS_SIGMA      (0.25f)  // 기압 고도 측정 1-sigma (m). OSR을 낮추면 키울 것
+#define CFG_EST_GATE_SIGMA      (6.0f)   // innovation gate (0: 끔)
+#define CFG_EST_P0_PA           (0.0f)   // 기준 기압. 0: 첫 샘플 = 0 m (상대 고도), 101325: ISA 해면
+#define CFG_EST_STAT_PERIOD_MS  (200u)   // "stat=alt" 송신 주기
+
+#endif /* __EST_CONFIG_H__ */
@@ -0,0 +1,11 @@
+#ifndef __LOG_CONFIG_H__
+#define __LOG_CONFIG_H__
+
+// deferred logging (src/core/dlog.h, src/app/gy63_log.c)
+// hot path의 USB stdio 출력(샘플 줄, read 실패)을 record로 미루고 대기 구간에서 출력
+#define CFG_DLOG_ENABLE        (1)      // 0: 기존처럼 즉시 stdio 출력
+#define CFG_DLOG_DEPTH         (64u)    // ring record 수 (2의 거듭제곱, record = 24 B)
+#define CFG_DLOG_BINARY        (0)      // 1: text 대신 binary token (host: gy63_dlog로 복원)
+#define CFG_DLOG_DRAIN_MAX     (8u)     // 대기 loop 1회당 출력 record 상한
+
+#endif /* __LOG_CONFIG_H__ */
@@ -5,11 +5,54 @@
 
 #define CFG_WIFI_SSID        "hotspot"
 #define CFG_WIFI_PASSWORD    "hotspot1111"
-#define CFG_WIFI_TIMEOUT_MS  (30000u)
+#define CFG_WIFI_TIMEOUT_MS  (30000u)  // boot 시 첫 연결 대기 (넘으면 샘플링 시작, 연결은 background 재시도)
+
+// link manager (net_link): 끊김 감시 + 비동기 재연결
+#define CFG_WIFI_JOIN_TIMEOUT_MS  (10000u)  // join 시도 1회 (assoc + IP)
+#define CFG_WIFI_BACKOFF_MIN_MS   (500u)
+#define CFG_WIFI_BACKOFF_MAX_MS   (30000u)
+#define CFG_WIFI_FAST_TRIES       (3u)      // outage마다 cached BSSID/channel 시도 횟수
+#define CFG_WIFI_REUSE_LEASE      (1)       // 재연결 시 마지막 DHCP 주소 즉시 사용
+#define CFG_WIFI_STATIC_IP        ""        // "" = DHCP
+#define CFG_WIFI_STATIC_MASK      "255.255.255.0"
+#define CFG_WIFI_STATIC_GW        ""
 
 #define CFG_UDP_DST_IP       "192.168.144.201"
 #define CFG_UDP_DST_PORT     (5005u)
 
-#define CFG_SEND_PERIOD_MS   (200u)
+#define CFG_SEND_PERIOD_MS   (200u)  // udp_tlm source 기본 주기 (예제/단독 사용)
+
+// main loop 기본값 (runtime control로 변경 가능)
+#define CFG_SAMPLE_PERIOD_MS (100u)
+#define CFG_TLM_BATCH        (1u)    // datagram 당 샘플 수
+#define CFG_TLM_BATCH_AGE_MS (500u)  // 덜 찬 live batch도 첫 샘플이 이만큼 지나면 송신 (저속/adaptive skip)
+
+// runtime control channel (수신 bind 포트)
+#define CFG_CTRL_PORT        (5007u)
+#define CFG_CTRL_MCAST_GROUP "239.255.63.1"     // fleet 전체 명령용 IGMP 그룹 ("" = 사용 안 함)
+
+// telemetry fan-out: primary(CFG_UDP_DST_IP) 외 추가 목적지 ("" = 사용 안 함)
+// multicast 그룹 주소면 여러 수신기가 같은 datagram을 받음 (relay 불필요)
+#define CFG_UDP_FANOUT_IP    ""                 // 예: "239.255.63.63"
+#define CFG_UDP_FANOUT_PORT  (5005u)
+#define CFG_UDP_MCAST_TTL    (1u)
+
+// store-and-forward (미송신 샘플 RAM ring + backfill)
+#define CFG_TLM_BUF_DEPTH         (1024u)  // 샘플 수 (16 B/sample)
+#define CFG_BACKFILL_PERIOD_MS    (50u)    // backfill 주기
+#define CFG_BACKFILL_BURST        (4u)     // 주기당 최대 backfill 샘플 수
+#define CFG_STATS_PERIOD_MS       (5000u)  // stat 줄 송신 주기
+#define CFG_STAT_RATE_BPS         (2048u)  // stat pipeline byte rate 상한 (0 = 무제한)
+
+// telemetry selective-retransmit (udp_arq). 수신측은 ARQ 피드백을 보내야 함 (host/tools/gy63_arq_rx)
+#define CFG_ARQ_ENABLE            (0)
+#define CFG_ARQ_RTO_MS            (300u)   // 피드백 없을 때 재전송 간격
+#define CFG_ARQ_HOLDOFF_MS        (50u)    // 같은 seq NACK 재전송 최소 간격
+#define CFG_ARQ_MAX_TX            (3u)     // seq당 최대 송신 횟수 (최초 포함)
+
+// end-to-end latency 진단 모드: host가 datagram seq를 echo (gy63_ingest --echo / host/tools/gy63_echo)
+// 샘플 datagram마다 conversion->send, send->echo 측정 -> "stat=lat" 줄 (p50/p99/max)
+#define CFG_LAT_PROBE_ENABLE      (0)
+#define CFG_LAT_TIMEOUT_MS        (1000u)  // 이 시간 안에 echo 없으면 lost
 
 #endif /* __NET_CONFIG_H__ */ 
\ No newline at end of file
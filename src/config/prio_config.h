@@ -0,0 +1,15 @@
+#ifndef __PRIO_CONFIG_H__
+#define __PRIO_CONFIG_H__
+
+// telemetry traffic class (src/core/tlm_prio.h, gy63_tx)
+// urgent = 경보 (즉시 송신, batch/backfill 앞), bulk = 샘플 / stat / backfill (queue 깊이 TLM_PRIO_BULK_DEPTH)
+#define CFG_PRIO_GUARD_BURST      (4u)     // bulk 대기 중 연속 urgent 최대 -> 넘으면 bulk 1개
+#define CFG_PRIO_GUARD_WAIT_MS    (250u)   // bulk head 최대 대기 -> 넘으면 urgent보다 먼저 1개
+#define CFG_PRIO_SERVICE_BUDGET   (4u)     // gy63_tx_poll 1회 queue 송신 최대
+
+// 기압 경보 (src/core/alarm.h) -> urgent class. 0 = 해당 경보 끔
+#define CFG_ALARM_P_HIGH_PA       (0u)
+#define CFG_ALARM_P_LOW_PA        (0u)
+#define CFG_ALARM_HYST_PA         (50u)    // clear 조건 여유 (경계 잡음으로 반복 경보 방지)
+
+#endif /* __PRIO_CONFIG_H__ */
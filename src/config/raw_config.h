@@ -0,0 +1,14 @@
+#ifndef __RAW_CONFIG_H__
+#define __RAW_CONFIG_H__
+
+// raw passthrough telemetry (src/app/gy63_raw.c, format: src/core/tlm_raw.h)
+// 장치는 보상 없이 D1/D2(24 bit)만 telemetry 목적지(CFG_UDP_DST_IP:CFG_UDP_DST_PORT)로 송신,
+// gy63_ingest가 PROM으로 보상 (firmware와 같은 ms5611_math -> bit 동일)
+// 켜면 기본 주기 루프가 raw 루프로 바뀜 (CFG_SENSOR_REG_ENABLE / CFG_BURST_ENABLE보다 우선)
+// flash recorder / estimator / adaptive 송신은 보상값이 필요하므로 동작하지 않음
+// PROM: session 시작 시 1회 + control "cmd=prom" 요청 시 (gy63_ingest는 PROM 없는 session을 보면 자동 요청)
+#define CFG_RAW_TLM_ENABLE      (0)
+#define CFG_RAW_BATCH           (16u)    // frame 당 샘플 수 (<= TLM_RAW_MAX_BATCH)
+#define CFG_RAW_FLUSH_MS        (500u)   // batch가 덜 차도 이 시간이 지나면 송신
+
+#endif /* __RAW_CONFIG_H__ */
@@ -0,0 +1,14 @@
+#ifndef __REC_CONFIG_H__
+#define __REC_CONFIG_H__
+
+// black-box flash recorder (src/app/gy63_rec.c)
+#define CFG_FLOG_ENABLE              (1)
+#define CFG_FLOG_FLASH_OFFSET        (0x200000u)  // 2 MiB: firmware image 위쪽
+#define CFG_FLOG_SIZE                (0u)         // 0: flash 끝까지
+
+// bulk readout (UDP, CFG_UDP_DST_IP로 송신)
+#define CFG_FLOG_DUMP_PORT           (5006u)
+#define CFG_FLOG_DUMP_PAGES_PER_PKT  (4u)         // 12 + 4*256 = 1036 B < MTU
+#define CFG_FLOG_DUMP_RETRY          (200u)       // pbuf 부족 시 1ms 간격 재시도 횟수
+
+#endif /* __REC_CONFIG_H__ */
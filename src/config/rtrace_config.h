@@ -0,0 +1,12 @@
+#ifndef __RTRACE_CONFIG_H__
+#define __RTRACE_CONFIG_H__
+
+// raw trace capture (src/app/gy63_rtrace.c, format: src/core/rtrace.h)
+// PROM + raw D1/D2 + conversion 완료 시각을 UDP로 송신 -> host/tools/gy63_rtrace recv 로 파일 저장,
+// host/bench/bench_replay 로 보상/필터/포맷을 결정적으로 재실행
+#define CFG_RTRACE_ENABLE       (0)
+#define CFG_RTRACE_UDP_PORT     (5009u)  // CFG_UDP_DST_IP:port
+#define CFG_RTRACE_FLUSH_MS     (500u)   // chunk가 덜 차도 이 시간이 지나면 송신
+#define CFG_RTRACE_HDR_EVERY    (64u)    // PROM/OSR header 반복 주기 (chunk, 수신 중간 합류용)
+
+#endif /* __RTRACE_CONFIG_H__ */
@@ -0,0 +1,11 @@
+#ifndef __SENSOR_CONFIG_H__
+#define __SENSOR_CONFIG_H__
+
+// sensor registry 경로 (src/drivers/sensor_reg.h)
+// 켜면 main loop가 gy63_read(blocking) 대신 registry를 poll: conversion 대기 중에도 네트워크/명령 처리,
+// 추가 sensor는 gy63_sensors_init 뒤 sensor_reg_add로 등록 (baro 외 sample은 stat=sensor로 집계만)
+#define CFG_SENSOR_REG_ENABLE   (0)
+#define CFG_SENSOR_MARGIN_US    (20u)    // datasheet max conversion time 뒤 여유
+#define CFG_SENSOR_SERVICE_US   (1000u)  // 네트워크/명령 처리 간격
+
+#endif /* __SENSOR_CONFIG_H__ */
@@ -0,0 +1,18 @@
+#ifndef __STREAM_CONFIG_H__
+#define __STREAM_CONFIG_H__
+
+// binary sample stream (src/app/gy63_stream.c, frame: src/core/tlm_bin.h)
+// 텍스트 telemetry(UDP)와 별개로 모든 샘플을 batch frame으로 송신
+#define CFG_BIN_STREAM_USB      (0)      // 1: USB CDC 1 (CMake option GY63_USB_STREAM=ON 필요)
+#define CFG_BIN_STREAM_UDP      (0)      // 1: UDP CFG_UDP_DST_IP:CFG_BIN_UDP_PORT
+#define CFG_BIN_UDP_PORT        (5008u)
+#define CFG_BIN_BATCH           (16u)    // frame당 샘플 수 (<= TLM_BIN_MAX_BATCH)
+#define CFG_BIN_FLUSH_MS        (50u)    // batch가 덜 차도 이 시간이 지나면 송신
+
+// 샘플마다 USB stdio로 "T=.. C, P=.. Pa" 출력. 샘플 경로에서 block 하지 않음:
+// CFG_DLOG_ENABLE이면 record만 적재 후 대기 구간에서 drain, 아니면 즉시 echo.
+// 둘 다 CDC FIFO에 자리가 없거나 host 미연결이면 버림 (stat=dlog busy/drop/echo_drop)
+// USB stream을 쓰면 0 권장 (같은 CDC 대역을 나눠 씀)
+#define CFG_USB_PRINT_SAMPLES   (1)
+
+#endif /* __STREAM_CONFIG_H__ */
@@ -0,0 +1,89 @@
+// FILE: src/core/acq_buf.c
+#include "acq_buf.h"
+
+#include <string.h>
+
+// ---------- internal helpers ----------
+
+// 현재 block 공개 (내용 기록 -> barrier -> head)
+static void publish(acq_buf_t *b, uint32_t now_us) {
+    acq_block_t *blk = &b->blk[b->head % ACQ_BUF_BLOCKS];
+    blk->n        = b->fill;
+    blk->ready_us = now_us;
+    b->fill = 0;
+    b->stats.published++;
+
+    __sync_synchronize();
+    b->head = b->head + 1u;
+}
+
+// ---------- public API ----------
+
+void acq_buf_init(acq_buf_t *b, uint32_t block_len, uint32_t flush_us) {
+    if (!b) return;
+    memset(b, 0, sizeof(*b));
+    b->block_len = (block_len == 0 || block_len > ACQ_BUF_BLOCK_MAX) ? ACQ_BUF_BLOCK_MAX : block_len;
+    b->flush_us  = flush_us;
+}
+
+bool acq_buf_put(acq_buf_t *b, uint32_t t_us, uint32_t d1, uint32_t d2) {
+    if (!b) return false;
+    const uint32_t seq = b->seq++;
+    b->stats.produced++;
+
+    // 채울 block 없음: consumer가 ring 전체를 잡고 있음
+    if (b->head - b->tail >= ACQ_BUF_BLOCKS) {
+        b->stats.dropped++;
+        if (!b->dropping) b->stats.overruns++;
+        b->dropping = true;
+        return false;
+    }
+    b->dropping = false;
+
+    acq_block_t *blk = &b->blk[b->head % ACQ_BUF_BLOCKS];
+    if (b->fill == 0) blk->seq0 = seq;
+
+    acq_sample_t *s = &blk->s[b->fill++];
+    s->seq  = seq;
+    s->t_us = t_us;
+    s->d1   = d1;
+    s->d2   = d2;
+
+    if (b->fill >= b->block_len) publish(b, t_us);
+    return true;
+}
+
+void acq_buf_tick(acq_buf_t *b, uint32_t now_us) {
+    if (!b || b->fill == 0 || b->flush_us == 0) return;
+
+    const acq_block_t *blk = &b->blk[b->head % ACQ_BUF_BLOCKS];
+    if (now_us - blk->s[0].t_us < b->flush_us) return;
+
+    b->stats.partial++;
+    publish(b, now_us);
+}
+
+const acq_block_t *acq_buf_peek(acq_buf_t *b) {
+    if (!b) return NULL;
+
+    const uint32_t tail  = b->tail;
+    const uint32_t depth = b->head - tail;
+    if (depth == 0) return NULL;
+    __sync_synchronize(); // head 확인 후 block 내용
+
+    if (depth > b->stats.depth_max) b->stats.depth_max = depth;
+    return &b->blk[tail % ACQ_BUF_BLOCKS];
+}
+
+void acq_buf_release(acq_buf_t *b) {
+    if (!b || b->head == b->tail) return;
+
+    __sync_synchronize(); // block 읽기 완료 후 slot 반환
+    b->tail = b->tail + 1u;
+    b->stats.consumed++;
+}
+
+uint32_t acq_buf_pending(const acq_buf_t *b) {
+    if (!b) return 0;
+    return b->head - b->tail;
+}
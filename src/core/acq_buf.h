@@ -0,0 +1,97 @@
+// FILE: src/core/acq_buf.h
+#ifndef __ACQ_BUF_H__
+#define __ACQ_BUF_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+// interrupt 수집 -> foreground block 처리 (SPSC block ring, ACQ_BUF_BLOCKS = 2면 ping-pong)
+//
+// - producer (timer/I2C IRQ): acq_buf_put으로 현재 block을 채움. block_len개가 차거나
+//   첫 샘플 후 flush_us가 지나면 publish (느린 rate에서도 block 대기 지연 제한)
+// - consumer (main loop): acq_buf_peek -> block 전체 처리 -> acq_buf_release
+// - 채울 block이 없으면 (consumer가 밀림) 새 샘플 버림 + 집계. 주기는 늘어나지 않음
+//   seq는 버린 샘플에도 부여 -> consumer는 block의 seq0 gap으로 유실 위치를 앎
+// - lock 없음: producer만 head/fill, consumer만 tail 갱신 (memory barrier 후 index 공개)
+// - 시각은 32-bit us (wrap 허용). IRQ/thread 모두 host에서 시험 가능 (host/bench/bench_acq.cpp)
+
+#ifndef ACQ_BUF_BLOCKS
+#define ACQ_BUF_BLOCKS      4u      // block 수 (2 = ping-pong)
+#endif
+#ifndef ACQ_BUF_BLOCK_MAX
+#define ACQ_BUF_BLOCK_MAX   32u     // block당 샘플 최대
+#endif
+
+typedef struct {
+    uint32_t seq;       // 수집 순번 (버린 샘플 포함)
+    uint32_t t_us;      // conversion 완료 시각
+    uint32_t d1;
+    uint32_t d2;
+} acq_sample_t;
+
+typedef struct {
+    uint32_t n;
+    uint32_t seq0;          // s[0].seq
+    uint32_t ready_us;      // publish 시각 (consumer 지연 측정)
+    acq_sample_t s[ACQ_BUF_BLOCK_MAX];
+} acq_block_t;
+
+typedef struct {
+    // producer
+    uint32_t produced;      // put 호출 수
+    uint32_t dropped;       // block 없음으로 버린 샘플
+    uint32_t overruns;      // 버림 구간 시작 횟수 (연속 drop은 1회)
+    uint32_t published;
+    uint32_t partial;       // flush_us로 덜 찬 채 publish
+    // consumer
+    uint32_t consumed;      // release한 block
+    uint32_t depth_max;     // publish된 block 최대 (peek 시점)
+} acq_buf_stats_t;
+
+typedef struct {
+    acq_block_t blk[ACQ_BUF_BLOCKS];
+    uint32_t block_len;
+    uint32_t flush_us;      // 0: 시간 기준 publish 끔
+
+    volatile uint32_t head; // publish 수 (producer)
+    volatile uint32_t tail; // release 수 (consumer)
+
+    // producer 전용
+    uint32_t fill;
+    uint32_t seq;
+    bool     dropping;
+
+    acq_buf_stats_t stats;
+} acq_buf_t;
+
+// block_len: 1..ACQ_BUF_BLOCK_MAX (범위 밖이면 ACQ_BUF_BLOCK_MAX)
+void acq_buf_init(acq_buf_t *b, uint32_t block_len, uint32_t flush_us);
+
+// ---- producer (IRQ) ----
+
+// 샘플 1개 (seq는 내부 부여). 버렸으면 false
+bool acq_buf_put(acq_buf_t *b, uint32_t t_us, uint32_t d1, uint32_t d2);
+
+// 덜 찬 block도 flush_us가 지났으면 publish (새 샘플이 없는 동안 tick에서 호출)
+void acq_buf_tick(acq_buf_t *b, uint32_t now_us);
+
+// ---- consumer (main loop) ----
+
+// 가장 오래된 publish block (없으면 NULL). release 전까지 producer가 건드리지 않음
+const acq_block_t *acq_buf_peek(acq_buf_t *b);
+
+void acq_buf_release(acq_buf_t *b);
+
+// publish되어 처리 대기 중인 block 수
+uint32_t acq_buf_pending(const acq_buf_t *b);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // __ACQ_BUF_H__
@@ -0,0 +1,165 @@
+// FILE: src/core/adapt.c
+#include "adapt.h"
+
+#include <stdio.h>
+#include <string.h>
+
+// ---------- internal helpers ----------
+
+static uint32_t abs_diff_u32(uint32_t a, uint32_t b) {
+    return (a > b) ? a - b : b - a;
+}
+
+static uint32_t abs_diff_i32(int32_t a, int32_t b) {
+    return (a > b) ? (uint32_t)((int64_t)a - b) : (uint32_t)((int64_t)b - a);
+}
+
+static void enter_fast(adapt_t *a, uint64_t now_ms) {
+    a->fast          = true;
+    a->calm          = false;
+    a->fast_since_ms = now_ms;
+    a->to_fast++;
+}
+
+static void leave_fast(adapt_t *a, uint64_t now_ms) {
+    a->fast     = false;
+    a->calm     = false;
+    a->fast_ms += now_ms - a->fast_since_ms;
+}
+
+// window 종료 시 변화율 갱신 + profile 전환
+static void update_rate(adapt_t *a, uint64_t now_ms) {
+    const uint64_t span = now_ms - a->win_start_ms;
+    const uint32_t mean = (uint32_t)((a->win_sum_p + a->win_n / 2u) / a->win_n);
+
+    if (a->have_prev_mean && span > 0) {
+        a->rate_pa_s = (uint32_t)((uint64_t)abs_diff_u32(mean, a->prev_mean_p) * 1000u / span);
+    }
+    a->prev_mean_p    = mean;
+    a->have_prev_mean = true;
+    a->win_start_ms   = now_ms;
+    a->win_sum_p      = 0;
+    a->win_n          = 0;
+
+    if (!a->fast) {
+        if (a->cfg.fast_rate_pa_s > 0 && a->rate_pa_s >= a->cfg.fast_rate_pa_s) enter_fast(a, now_ms);
+        return;
+    }
+
+    if (a->rate_pa_s >= a->cfg.calm_rate_pa_s) {
+        a->calm = false;
+        return;
+    }
+    if (!a->calm) {
+        a->calm          = true;
+        a->calm_since_ms = now_ms;
+    }
+    if (now_ms - a->calm_since_ms >= a->cfg.hold_ms) leave_fast(a, now_ms);
+}
+
+// ---------- public API ----------
+
+void adapt_cfg_default(adapt_cfg_t *cfg) {
+    if (!cfg) return;
+    cfg->deadband_pa    = 3u;       // OSR 4096 잡음(~1 Pa RMS)의 3배 ~ 25 cm
+    cfg->deadband_cx100 = 10u;      // 0.1 C
+    cfg->heartbeat_ms   = 10000u;
+
+    cfg->rate_window_ms = 1000u;
+    cfg->fast_rate_pa_s = 12u;      // ~1 m/s 수직 이동
+    cfg->calm_rate_pa_s = 4u;
+    cfg->hold_ms        = 5000u;
+
+    cfg->slow_period_ms = 1000u;
+    cfg->slow_osr       = 4096u;
+    cfg->fast_period_ms = 20u;
+    cfg->fast_osr       = 1024u;
+
+    cfg->base_period_ms = 0u;
+}
+
+void adapt_init(adapt_t *a, const adapt_cfg_t *cfg) {
+    if (!a) return;
+    memset(a, 0, sizeof(*a));
+    if (cfg) a->cfg = *cfg;
+    else     adapt_cfg_default(&a->cfg);
+    if (a->cfg.rate_window_ms == 0) a->cfg.rate_window_ms = 1000u;
+}
+
+void adapt_set_slow(adapt_t *a, uint32_t period_ms, uint32_t osr) {
+    if (!a) return;
+    if (period_ms) a->cfg.slow_period_ms = period_ms;
+    if (osr)       a->cfg.slow_osr       = osr;
+}
+
+adapt_decision_t adapt_offer(adapt_t *a, int32_t t_x100, uint32_t p_pa, uint64_t now_ms) {
+    if (!a) return ADAPT_CHANGE;
+
+    if (!a->started) {
+        a->started      = true;
+        a->start_ms     = now_ms;
+        a->win_start_ms = now_ms;
+    }
+    a->offered++;
+
+    a->win_sum_p += p_pa;
+    a->win_n++;
+    if (now_ms - a->win_start_ms >= a->cfg.rate_window_ms) update_rate(a, now_ms);
+
+    adapt_decision_t d = ADAPT_SKIP;
+    if (!a->have_sent || a->cfg.deadband_pa == 0 ||
+        abs_diff_u32(p_pa, a->sent_p_pa) > a->cfg.deadband_pa ||
+        (a->cfg.deadband_cx100 > 0 && abs_diff_i32(t_x100, a->sent_t_x100) > a->cfg.deadband_cx100)) {
+        d = ADAPT_CHANGE;
+    } else if (a->cfg.heartbeat_ms > 0 && now_ms - a->sent_ms >= a->cfg.heartbeat_ms) {
+        d = ADAPT_HEARTBEAT;
+    }
+    if (d == ADAPT_SKIP) return d;
+
+    if (d == ADAPT_CHANGE) a->sent_change++;
+    else                   a->sent_heartbeat++;
+    a->have_sent   = true;
+    a->sent_t_x100 = t_x100;
+    a->sent_p_pa   = p_pa;
+    a->sent_ms     = now_ms;
+    return d;
+}
+
+uint32_t adapt_period_ms(const adapt_t *a) {
+    if (!a) return 0;
+    return a->fast ? a->cfg.fast_period_ms : a->cfg.slow_period_ms;
+}
+
+uint32_t adapt_osr(const adapt_t *a) {
+    if (!a) return 0;
+    return a->fast ? a->cfg.fast_osr : a->cfg.slow_osr;
+}
+
+size_t adapt_stats_line(const adapt_t *a, uint64_t now_ms, char *out, size_t out_sz) {
+    if (!a || !a->started || !out || out_sz == 0) return 0;
+
+    const uint64_t elapsed = now_ms - a->start_ms;
+    const uint64_t fast_ms = a->fast_ms + (a->fast ? now_ms - a->fast_since_ms : 0);
+    const uint32_t sent    = a->sent_change + a->sent_heartbeat;
+    const uint32_t base_period = a->cfg.base_period_ms ? a->cfg.base_period_ms : a->cfg.slow_period_ms;
+    const uint64_t base    = base_period ? elapsed / base_period : 0;
+    const uint32_t saved   = (base > sent) ? (uint32_t)((base - sent) * 100u / base) : 0u;
+
+    int n = snprintf(out, out_sz,
+                     "stat=adapt,ms=%llu,mode=%s,rate_pa_s=%lu,period_ms=%lu,osr=%lu,n=%lu,sent=%lu,chg=%lu,hb=%lu,"
+                     "fast_pct=%lu,base=%llu,saved_pct=%lu\n",
+                     (unsigned long long)now_ms,
+                     a->fast ? "fast" : "slow",
+                     (unsigned long)a->rate_pa_s,
+                     (unsigned long)adapt_period_ms(a),
+                     (unsigned long)adapt_osr(a),
+                     (unsigned long)a->offered,
+                     (unsigned long)sent,
+                     (unsigned long)a->sent_change,
+                     (unsigned long)a->sent_heartbeat,
+                     (unsigned long)(elapsed ? fast_ms * 100u / elapsed : 0u),
+                     (unsigned long long)base,
+                     (unsigned long)saved);
+    if (n <= 0 || (size_t)n >= out_sz) return 0;
+    return (size_t)n;
+}
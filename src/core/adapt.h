@@ -0,0 +1,102 @@
+// FILE: src/core/adapt.h
+#ifndef __ADAPT_H__
+#define __ADAPT_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+// Change-driven sampling / deadband transmission
+//
+// - 송신 판정: 마지막 "송신" 값 대비 |dp| > deadband_pa 또는 |dT| > deadband_cx100 이면 송신,
+//   변화가 없어도 heartbeat_ms마다 1회 (수신측 liveness + 느린 drift가 deadband 안에 묻히지 않도록)
+// - 변화율: rate_window_ms 단위 window 평균의 차이 (Pa/s). 단일 샘플 차분은 OSR 256 잡음(~6 Pa)에 묻힘
+// - profile: rate >= fast_rate_pa_s 이면 즉시 fast (짧은 주기 + 낮은 OSR),
+//   rate < calm_rate_pa_s 가 hold_ms 지속되면 slow로 복귀 (hysteresis, 경계에서 왕복 방지)
+// - saved_pct: base_period_ms 고정 주기로 매 샘플 송신했을 때 대비 절감률
+// - 측정/기록은 이 모듈과 무관 (flash log에는 전 샘플), 송신 판정과 주기/OSR 권고만
+
+typedef enum {
+    ADAPT_SKIP = 0,
+    ADAPT_CHANGE,
+    ADAPT_HEARTBEAT,
+} adapt_decision_t;
+
+typedef struct {
+    uint32_t deadband_pa;       // 0: 매 샘플 송신
+    uint32_t deadband_cx100;    // 0.01 C 단위. 0: 온도는 판정에서 제외
+    uint32_t heartbeat_ms;      // 0: heartbeat 없음
+
+    uint32_t rate_window_ms;
+    uint32_t fast_rate_pa_s;
+    uint32_t calm_rate_pa_s;
+    uint32_t hold_ms;
+
+    uint32_t slow_period_ms;
+    uint32_t slow_osr;
+    uint32_t fast_period_ms;
+    uint32_t fast_osr;
+
+    uint32_t base_period_ms;    // 절감률 기준 (0: slow_period_ms)
+} adapt_cfg_t;
+
+typedef struct {
+    adapt_cfg_t cfg;
+
+    // 마지막 송신 값
+    bool     have_sent;
+    int32_t  sent_t_x100;
+    uint32_t sent_p_pa;
+    uint64_t sent_ms;
+
+    // 변화율 window
+    bool     have_prev_mean;
+    uint64_t win_start_ms;
+    uint64_t win_sum_p;
+    uint32_t win_n;
+    uint32_t prev_mean_p;
+    uint32_t rate_pa_s;
+
+    // profile
+    bool     fast;
+    bool     calm;              // fast 중 rate < calm 상태
+    uint64_t calm_since_ms;
+    uint64_t fast_since_ms;
+
+    // stats
+    bool     started;
+    uint64_t start_ms;
+    uint64_t fast_ms;           // fast profile 누적 시간 (진행 중 구간 제외)
+    uint32_t offered;
+    uint32_t sent_change;
+    uint32_t sent_heartbeat;
+    uint32_t to_fast;
+} adapt_t;
+
+void adapt_cfg_default(adapt_cfg_t *cfg);
+
+void adapt_init(adapt_t *a, const adapt_cfg_t *cfg);
+
+// slow profile 변경 (control channel의 osr / period_ms)
+void adapt_set_slow(adapt_t *a, uint32_t period_ms, uint32_t osr);
+
+// 측정 1개 반영 -> 송신 여부 (변화율/profile도 갱신)
+adapt_decision_t adapt_offer(adapt_t *a, int32_t t_x100, uint32_t p_pa, uint64_t now_ms);
+
+// 현재 권고 profile
+uint32_t adapt_period_ms(const adapt_t *a);
+uint32_t adapt_osr(const adapt_t *a);
+
+// "stat=adapt,ms=..,mode=slow|fast,rate_pa_s=..,period_ms=..,osr=..,n=..,sent=..,chg=..,hb=..,
+//  fast_pct=..,base=..,saved_pct=..\n" (샘플 전이면 0)
+size_t adapt_stats_line(const adapt_t *a, uint64_t now_ms, char *out, size_t out_sz);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // __ADAPT_H__
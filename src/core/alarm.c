@@ -0,0 +1,57 @@
+// FILE: src/core/alarm.c
+#include "alarm.h"
+
+#include <stdio.h>
+#include <string.h>
+
+// ---------- internal helpers ----------
+
+static size_t format_event(char *out, size_t out_sz, uint64_t now_ms, const char *kind, bool on,
+                           uint32_t p_pa, uint32_t thr) {
+    int n = snprintf(out, out_sz, "stat=alarm,ms=%llu,kind=%s,on=%u,p_pa=%lu,thr=%lu\n",
+                     (unsigned long long)now_ms, kind, on ? 1u : 0u,
+                     (unsigned long)p_pa, (unsigned long)thr);
+    if (n <= 0 || (size_t)n >= out_sz) return 0;
+    return (size_t)n;
+}
+
+// ---------- public API ----------
+
+void alarm_init(alarm_t *a, uint32_t hi_pa, uint32_t lo_pa, uint32_t hyst_pa) {
+    if (!a) return;
+    memset(a, 0, sizeof(*a));
+    a->hi_pa   = hi_pa;
+    a->lo_pa   = lo_pa;
+    a->hyst_pa = hyst_pa;
+}
+
+bool alarm_enabled(const alarm_t *a) {
+    return a && (a->hi_pa || a->lo_pa);
+}
+
+size_t alarm_update(alarm_t *a, uint32_t p_pa, uint64_t now_ms, char *out, size_t out_sz) {
+    if (!a || !out || out_sz == 0) return 0;
+
+    if (a->hi_pa) {
+        const uint32_t clr = a->hi_pa > a->hyst_pa ? a->hi_pa - a->hyst_pa : 0u;
+        const bool next = a->hi_on ? p_pa >= clr : p_pa >= a->hi_pa;
+        if (next != a->hi_on) {
+            a->hi_on = next;
+            if (next) a->raised++;
+            else      a->cleared++;
+            return format_event(out, out_sz, now_ms, "p_high", next, p_pa, a->hi_pa);
+        }
+    }
+
+    if (a->lo_pa) {
+        const uint32_t clr = a->lo_pa + a->hyst_pa;
+        const bool next = a->lo_on ? p_pa <= clr : p_pa <= a->lo_pa;
+        if (next != a->lo_on) {
+            a->lo_on = next;
+            if (next) a->raised++;
+            else      a->cleared++;
+            return format_event(out, out_sz, now_ms, "p_low", next, p_pa, a->lo_pa);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,48 @@
+// FILE: src/core/alarm.h
+#ifndef __ALARM_H__
+#define __ALARM_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+// 기압 threshold 경보 (urgent traffic class 입력)
+//
+// - high: p_pa >= hi_pa 이면 raise, p_pa < hi_pa - hyst_pa 이면 clear
+// - low : p_pa <= lo_pa 이면 raise, p_pa > lo_pa + hyst_pa 이면 clear
+// - 상태가 바뀔 때만 이벤트 줄 1개 (경계 근처 잡음으로 반복 송신하지 않음)
+//   "stat=alarm,ms=..,kind=p_high|p_low,on=0|1,p_pa=..,thr=..\n"
+//   (stat 줄 형식: host 수집기는 kind만 보고 통과)
+
+#define ALARM_LINE_MAX  (96u)
+
+typedef struct {
+    uint32_t hi_pa;     // 0: high 경보 끔
+    uint32_t lo_pa;     // 0: low 경보 끔
+    uint32_t hyst_pa;
+
+    bool hi_on;
+    bool lo_on;
+
+    uint32_t raised;
+    uint32_t cleared;
+} alarm_t;
+
+void alarm_init(alarm_t *a, uint32_t hi_pa, uint32_t lo_pa, uint32_t hyst_pa);
+
+// 설정된 경보가 하나라도 있으면 true
+bool alarm_enabled(const alarm_t *a);
+
+// 샘플 1개 평가. 상태가 바뀌었으면 이벤트 줄을 out에 쓰고 길이 리턴 (변화 없음 / 공간 부족이면 0)
+// high/low가 동시에 바뀌는 경우는 high 먼저, low는 다음 샘플에서
+size_t alarm_update(alarm_t *a, uint32_t p_pa, uint64_t now_ms, char *out, size_t out_sz);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // __ALARM_H__
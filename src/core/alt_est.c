@@ -0,0 +1,136 @@
+// FILE: src/core/alt_est.c
+#include "alt_est.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#define ALT_EST_V0_VAR        (25.0f)   // 초기 속도 분산 (m/s)^2: 정지 여부 모름
+#define ALT_EST_REJECT_RESET  (10u)     // 연속 기각 -> 실제 급변으로 보고 재초기화
+
+// ---------- internal helpers ----------
+
+static void reset_at(alt_est_t *e, float z, uint32_t t_us) {
+    const float r = e->cfg.meas_sigma * e->cfg.meas_sigma;
+    e->h   = z;
+    e->v   = 0.0f;
+    e->p00 = r;
+    e->p01 = 0.0f;
+    e->p11 = ALT_EST_V0_VAR;
+    e->last_us    = t_us;
+    e->reject_run = 0;
+    e->init       = true;
+}
+
+static void predict(alt_est_t *e, float dt) {
+    const float dt2 = dt * dt;
+    const float q   = e->cfg.accel_sigma * e->cfg.accel_sigma;
+
+    e->h += e->v * dt;
+
+    const float p11 = e->p11;
+    const float p01 = e->p01;
+    e->p00 += 2.0f * dt * p01 + dt2 * p11 + q * dt2 * dt2 * 0.25f;
+    e->p01 += dt * p11 + q * dt2 * dt * 0.5f;
+    e->p11 += q * dt2;
+}
+
+static int32_t round_i32(float v) {
+    return (int32_t)(v >= 0.0f ? v + 0.5f : v - 0.5f);
+}
+
+// ---------- public API ----------
+
+void alt_est_cfg_default(alt_est_cfg_t *cfg) {
+    if (!cfg) return;
+    cfg->accel_sigma = 0.5f;    // 사람/차량 수준 기동
+    cfg->meas_sigma  = 0.25f;   // MS5611 OSR 4096 (~0.012 mbar RMS ~ 0.1 m) + 실내 기류 여유
+    cfg->gate_sigma  = 6.0f;
+    cfg->max_dt_s    = 2.0f;
+    cfg->p0_pa       = 0.0f;
+}
+
+void alt_est_init(alt_est_t *e, const alt_est_cfg_t *cfg) {
+    if (!e) return;
+    memset(e, 0, sizeof(*e));
+    if (cfg) e->cfg = *cfg;
+    else     alt_est_cfg_default(&e->cfg);
+}
+
+float alt_est_pa_to_m(float p_pa, float p0_pa) {
+    if (p_pa <= 0.0f || p0_pa <= 0.0f) return 0.0f;
+    return 44330.77f * (1.0f - powf(p_pa / p0_pa, 0.190263f));
+}
+
+bool alt_est_update(alt_est_t *e, uint32_t p_pa, uint32_t t_us) {
+    if (!e || p_pa == 0) return false;
+
+    if (e->p0 <= 0.0f) e->p0 = (e->cfg.p0_pa > 0.0f) ? e->cfg.p0_pa : (float)p_pa;
+    const float z = alt_est_pa_to_m((float)p_pa, e->p0);
+    e->updates++;
+
+    if (!e->init) {
+        reset_at(e, z, t_us);
+        return true;
+    }
+
+    const float dt = (float)(t_us - e->last_us) * 1e-6f;
+    if (dt > e->cfg.max_dt_s) {
+        e->resets++;
+        reset_at(e, z, t_us);
+        return true;
+    }
+    e->last_us = t_us;
+    if (dt > 0.0f) predict(e, dt);
+
+    const float y = z - e->h;
+    const float s = e->p00 + e->cfg.meas_sigma * e->cfg.meas_sigma;
+
+    if (e->cfg.gate_sigma > 0.0f && y * y > e->cfg.gate_sigma * e->cfg.gate_sigma * s) {
+        e->rejects++;
+        if (++e->reject_run >= ALT_EST_REJECT_RESET) {
+            e->resets++;
+            reset_at(e, z, t_us);
+        }
+        return false;
+    }
+    e->reject_run = 0;
+
+    const float k0 = e->p00 / s;
+    const float k1 = e->p01 / s;
+    e->h += k0 * y;
+    e->v += k1 * y;
+
+    const float p01 = e->p01;
+    e->p11 -= k1 * p01;
+    e->p01  = (1.0f - k0) * p01;
+    e->p00  = (1.0f - k0) * e->p00;
+    return true;
+}
+
+int32_t alt_est_alt_cm(const alt_est_t *e) {
+    return (e && e->init) ? round_i32(e->h * 100.0f) : 0;
+}
+
+int32_t alt_est_vs_cms(const alt_est_t *e) {
+    return (e && e->init) ? round_i32(e->v * 100.0f) : 0;
+}
+
+int32_t alt_est_sigma_cm(const alt_est_t *e) {
+    return (e && e->init && e->p00 > 0.0f) ? round_i32(sqrtf(e->p00) * 100.0f) : 0;
+}
+
+size_t alt_est_stats_line(const alt_est_t *e, uint64_t now_ms, char *out, size_t out_sz) {
+    if (!e || !e->init || !out || out_sz == 0) return 0;
+
+    int n = snprintf(out, out_sz, "stat=alt,ms=%llu,alt_cm=%ld,vs_cms=%ld,sig_cm=%ld,n=%lu,rej=%lu,rst=%lu\n",
+                     (unsigned long long)now_ms,
+                     (long)alt_est_alt_cm(e),
+                     (long)alt_est_vs_cms(e),
+                     (long)alt_est_sigma_cm(e),
+                     (unsigned long)e->updates,
+                     (unsigned long)e->rejects,
+                     (unsigned long)e->resets);
+    if (n <= 0 || (size_t)n >= out_sz) return 0;
+    return (size_t)n;
+}
@@ -0,0 +1,69 @@
+// FILE: src/core/alt_est.h
+#ifndef __ALT_EST_H__
+#define __ALT_EST_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+// Altitude / vertical speed estimator (2-state Kalman, 기압 고도 측정만 사용)
+//
+// - state x = [h (m), v (m/s)], 모델: 등속 + white-noise 가속도 (accel_sigma, m/s^2)
+//     F = [1 dt; 0 1],  Q = accel_sigma^2 * [dt^4/4 dt^3/2; dt^3/2 dt^2]
+//   측정 z = 기압 고도 (meas_sigma, m),  H = [1 0]
+// - dt는 샘플 timestamp(us)의 실제 간격 (지터/누락/OSR 변경 반영). dt > max_dt면 재초기화
+// - 기압 -> 고도: ISA troposphere  h = 44330.77 * (1 - (p / p0)^0.190263)
+//   p0 = 0이면 첫 샘플 기압을 기준 (상대 고도, 0 m에서 시작)
+// - single precision (M33 FPU, double 연산 없음). 공분산은 대칭 3원소만 유지
+// - innovation이 gate_sigma * sqrt(S)를 넘으면 측정 기각 (I2C glitch 등), 연속 기각 시 재초기화
+
+typedef struct {
+    float accel_sigma;      // m/s^2
+    float meas_sigma;       // m
+    float gate_sigma;       // 0: gate 없음
+    float max_dt_s;         // 이보다 긴 공백은 재초기화
+    float p0_pa;            // 0: 첫 샘플 기준
+} alt_est_cfg_t;
+
+typedef struct {
+    alt_est_cfg_t cfg;
+
+    bool     init;
+    float    p0;
+    float    h, v;              // state
+    float    p00, p01, p11;     // covariance (대칭)
+    uint32_t last_us;
+
+    uint32_t updates;
+    uint32_t rejects;
+    uint32_t reject_run;        // 연속 기각
+    uint32_t resets;
+} alt_est_t;
+
+void alt_est_cfg_default(alt_est_cfg_t *cfg);
+
+void alt_est_init(alt_est_t *e, const alt_est_cfg_t *cfg);
+
+// 기압 측정 1개 반영 (t_us: 측정 시각, wrap 허용). 측정이 기각되면 false (예측만 진행)
+bool alt_est_update(alt_est_t *e, uint32_t p_pa, uint32_t t_us);
+
+// 기압 -> 고도 (m)
+float alt_est_pa_to_m(float p_pa, float p0_pa);
+
+// 고정소수점 출력 (telemetry): cm, cm/s, 1-sigma cm
+int32_t alt_est_alt_cm(const alt_est_t *e);
+int32_t alt_est_vs_cms(const alt_est_t *e);
+int32_t alt_est_sigma_cm(const alt_est_t *e);
+
+// "stat=alt,ms=..,alt_cm=..,vs_cms=..,sig_cm=..,n=..,rej=..,rst=..\n" (초기화 전이면 0)
+size_t alt_est_stats_line(const alt_est_t *e, uint64_t now_ms, char *out, size_t out_sz);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // __ALT_EST_H__
@@ -0,0 +1,20 @@
+// FILE: src/core/crc32.h
+#ifndef __CRC32_H__
+#define __CRC32_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+// CRC-32 (IEEE 802.3, reflected). 시작값 0xFFFFFFFF, 끝나면 ~crc
+// nibble table (64 B ROM): flash log page, binary stream frame 공용
+uint32_t crc32_update(uint32_t crc, const uint8_t *p, size_t len);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // __CRC32_H__
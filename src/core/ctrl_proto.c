@@ -0,0 +1,176 @@
+// FILE: src/core/ctrl_proto.c
+#include "ctrl_proto.h"
+
+#include <stdio.h>
+#include <string.h>
+
+// ---------- internal helpers ----------
+
+static bool key_is(const char *k, size_t klen, const char *lit) {
+    return strlen(lit) == klen && memcmp(k, lit, klen) == 0;
+}
+
+static bool parse_u32(const char *v, size_t vlen, uint32_t *out) {
+    if (vlen == 0 || vlen > 10) return false;
+    uint64_t acc = 0;
+    for (size_t i = 0; i < vlen; i++) {
+        if (v[i] < '0' || v[i] > '9') return false;
+        acc = acc * 10u + (uint64_t)(v[i] - '0');
+    }
+    if (acc > 0xFFFFFFFFull) return false;
+    *out = (uint32_t)acc;
+    return true;
+}
+
+static bool valid_osr(uint32_t osr) {
+    switch (osr) {
+    case 256: case 512: case 1024: case 2048: case 4096: return true;
+    default: return false;
+    }
+}
+
+// "a.b.c.d:port"
+static bool parse_dst(const char *v, size_t vlen, char ip_out[CTRL_IP_STR_MAX], uint16_t *port_out) {
+    const char *colon = memchr(v, ':', vlen);
+    if (!colon) return false;
+
+    const size_t ip_len = (size_t)(colon - v);
+    if (ip_len < 7 || ip_len >= CTRL_IP_STR_MAX) return false;
+
+    // dotted quad 검증
+    uint32_t octets = 0, val = 0, digits = 0;
+    for (size_t i = 0; i <= ip_len; i++) {
+        if (i == ip_len || v[i] == '.') {
+            if (digits == 0 || val > 255) return false;
+            octets++;
+            val = 0;
+            digits = 0;
+        } else if (v[i] >= '0' && v[i] <= '9' && digits < 3) {
+            val = val * 10u + (uint32_t)(v[i] - '0');
+            digits++;
+        } else {
+            return false;
+        }
+    }
+    if (octets != 4) return false;
+
+    uint32_t port = 0;
+    if (!parse_u32(colon + 1, vlen - ip_len - 1, &port) || port == 0 || port > 0xFFFF) return false;
+
+    memcpy(ip_out, v, ip_len);
+    ip_out[ip_len] = '\0';
+    *port_out = (uint16_t)port;
+    return true;
+}
+
+static ctrl_status_t apply_kv(ctrl_cmd_t *cmd, const char *k, size_t klen, const char *v, size_t vlen) {
+    uint32_t u = 0;
+
+    if (key_is(k, klen, "cmd")) {
+        if      (key_is(v, vlen, "get"))  cmd->kind = CTRL_CMD_GET;
+        else if (key_is(v, vlen, "set"))  cmd->kind = CTRL_CMD_SET;
+        else if (key_is(v, vlen, "dump")) cmd->kind = CTRL_CMD_DUMP;
+        else if (key_is(v, vlen, "prom")) cmd->kind = CTRL_CMD_PROM;
+        else return CTRL_ECMD;
+        return CTRL_OK;
+    }
+    if (key_is(k, klen, "id")) {
+        if (!parse_u32(v, vlen, &cmd->id)) return CTRL_EVALUE;
+        return CTRL_OK;
+    }
+    if (key_is(k, klen, "osr")) {
+        if (!parse_u32(v, vlen, &u) || !valid_osr(u)) return CTRL_EVALUE;
+        cmd->set.osr = u;
+        cmd->fields |= CTRL_F_OSR;
+        return CTRL_OK;
+    }
+    if (key_is(k, klen, "period_ms")) {
+        if (!parse_u32(v, vlen, &u) || u < CTRL_PERIOD_MIN_MS || u > CTRL_PERIOD_MAX_MS) return CTRL_EVALUE;
+        cmd->set.period_ms = u;
+        cmd->fields |= CTRL_F_PERIOD;
+        return CTRL_OK;
+    }
+    if (key_is(k, klen, "batch")) {
+        if (!parse_u32(v, vlen, &u) || u == 0 || u > CTRL_BATCH_MAX) return CTRL_EVALUE;
+        cmd->set.batch = u;
+        cmd->fields |= CTRL_F_BATCH;
+        return CTRL_OK;
+    }
+    if (key_is(k, klen, "dst")) {
+        if (!parse_dst(v, vlen, cmd->set.dst_ip, &cmd->set.dst_port)) return CTRL_EVALUE;
+        cmd->fields |= CTRL_F_DST;
+        return CTRL_OK;
+    }
+    return CTRL_EKEY;
+}
+
+// ---------- public API ----------
+
+const char *ctrl_status_str(ctrl_status_t st) {
+    switch (st) {
+    case CTRL_OK:     return "CTRL_OK";
+    case CTRL_EPARSE: return "CTRL_EPARSE";
+    case CTRL_ECMD:   return "CTRL_ECMD";
+    case CTRL_EKEY:   return "CTRL_EKEY";
+    case CTRL_EVALUE: return "CTRL_EVALUE";
+    case CTRL_EBUSY:  return "CTRL_EBUSY";
+    case CTRL_EAPPLY: return "CTRL_EAPPLY";
+    default:          return "CTRL_UNKNOWN";
+    }
+}
+
+ctrl_status_t ctrl_parse(const char *buf, size_t len, ctrl_cmd_t *out) {
+    if (!buf || !out) return CTRL_EPARSE;
+    memset(out, 0, sizeof(*out));
+
+    while (len > 0 && (buf[len - 1] == '\n' || buf[len - 1] == '\r')) len--;
+    if (len == 0) return CTRL_EPARSE;
+
+    size_t pos = 0;
+    while (pos < len) {
+        const char *tok = buf + pos;
+        const char *end = memchr(tok, ',', len - pos);
+        const size_t tlen = end ? (size_t)(end - tok) : (len - pos);
+
+        const char *eq = memchr(tok, '=', tlen);
+        if (!eq || eq == tok) return CTRL_EPARSE;
+
+        const size_t klen = (size_t)(eq - tok);
+        ctrl_status_t st = apply_kv(out, tok, klen, eq + 1, tlen - klen - 1);
+        if (st != CTRL_OK) return st;
+
+        pos += tlen + (end ? 1u : 0u);
+    }
+
+    if (out->kind == CTRL_CMD_NONE) return CTRL_ECMD;
+    if (out->kind != CTRL_CMD_SET && out->fields != 0) return CTRL_EKEY;
+    return CTRL_OK;
+}
+
+void ctrl_merge(ctrl_settings_t *cur, const ctrl_cmd_t *cmd) {
+    if (!cur || !cmd) return;
+
+    if (cmd->fields & CTRL_F_OSR)    cur->osr       = cmd->set.osr;
+    if (cmd->fields & CTRL_F_PERIOD) cur->period_ms = cmd->set.period_ms;
+    if (cmd->fields & CTRL_F_BATCH)  cur->batch     = cmd->set.batch;
+    if (cmd->fields & CTRL_F_DST) {
+        memcpy(cur->dst_ip, cmd->set.dst_ip, sizeof(cur->dst_ip));
+        cur->dst_port = cmd->set.dst_port;
+    }
+}
+
+size_t ctrl_format_ack(char *out, size_t out_sz, uint32_t id, ctrl_status_t st, const ctrl_settings_t *cur) {
+    if (!out || out_sz == 0 || !cur) return 0;
+
+    int n = snprintf(out, out_sz,
+                     "ack=%lu,st=%s,osr=%lu,period_ms=%lu,batch=%lu,dst=%s:%u\n",
+                     (unsigned long)id,
+                     ctrl_status_str(st),
+                     (unsigned long)cur->osr,
+                     (unsigned long)cur->period_ms,
+                     (unsigned long)cur->batch,
+                     cur->dst_ip,
+                     (unsigned)cur->dst_port);
+    if (n <= 0 || (size_t)n >= out_sz) return 0;
+    return (size_t)n;
+}
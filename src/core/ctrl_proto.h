@@ -0,0 +1,88 @@
+// FILE: src/core/ctrl_proto.h
+#ifndef __CTRL_PROTO_H__
+#define __CTRL_PROTO_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+// runtime control protocol (UDP, 1 datagram = 1 command, telemetry와 같은 key=value 텍스트)
+//
+//   cmd=get,id=7
+//   cmd=set,id=8,osr=256,period_ms=20,batch=8,dst=192.168.144.201:5005
+//   cmd=dump,id=9                    (flash log bulk readout)
+//   cmd=prom,id=10                   (raw passthrough: PROM frame 재송신, src/core/tlm_raw.h)
+//
+//   -> ack=8,st=CTRL_OK,osr=256,period_ms=20,batch=8,dst=192.168.144.201:5005
+//
+// set은 전 필드를 검증한 뒤에만 적용 (일부만 적용되는 일 없음).
+
+#define CTRL_BATCH_MAX       (16u)
+#define CTRL_PERIOD_MIN_MS   (1u)
+#define CTRL_PERIOD_MAX_MS   (60000u)
+#define CTRL_IP_STR_MAX      (16u)   // "255.255.255.255" + NUL
+
+typedef int32_t ctrl_status_t;
+
+enum {
+    CTRL_OK       = 0,
+
+    CTRL_EPARSE   = -4000, // key=value 형식 오류
+    CTRL_ECMD     = -4001, // 알 수 없는 cmd
+    CTRL_EKEY     = -4002, // 알 수 없는 key
+    CTRL_EVALUE   = -4003, // 범위/형식 밖 값
+    CTRL_EBUSY    = -4004, // 이전 명령 처리 중
+    CTRL_EAPPLY   = -4005, // 적용 실패 (예: 목적지 재연결 실패)
+};
+
+const char *ctrl_status_str(ctrl_status_t st);
+
+typedef enum {
+    CTRL_CMD_NONE = 0,
+    CTRL_CMD_GET,
+    CTRL_CMD_SET,
+    CTRL_CMD_DUMP,
+    CTRL_CMD_PROM,
+} ctrl_cmd_kind_t;
+
+// set 필드 mask
+enum {
+    CTRL_F_OSR    = 1u << 0,
+    CTRL_F_PERIOD = 1u << 1,
+    CTRL_F_BATCH  = 1u << 2,
+    CTRL_F_DST    = 1u << 3,
+};
+
+typedef struct {
+    uint32_t osr;                   // 256/512/1024/2048/4096
+    uint32_t period_ms;             // 샘플 주기
+    uint32_t batch;                 // datagram 당 샘플 수 (1..CTRL_BATCH_MAX)
+    char     dst_ip[CTRL_IP_STR_MAX];
+    uint16_t dst_port;
+} ctrl_settings_t;
+
+typedef struct {
+    ctrl_cmd_kind_t kind;
+    uint32_t id;                    // ack에 그대로 반송 (중복/재전송 판별용)
+    uint32_t fields;                // CTRL_F_* (set)
+    ctrl_settings_t set;
+} ctrl_cmd_t;
+
+// 1 datagram 파싱 + 값 검증 (끝의 \r\n 허용)
+ctrl_status_t ctrl_parse(const char *buf, size_t len, ctrl_cmd_t *out);
+
+// cmd.fields에 해당하는 값만 cur에 덮어씀
+void ctrl_merge(ctrl_settings_t *cur, const ctrl_cmd_t *cmd);
+
+// ack 한 줄 작성. 길이 리턴 (0이면 실패)
+size_t ctrl_format_ack(char *out, size_t out_sz, uint32_t id, ctrl_status_t st, const ctrl_settings_t *cur);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // __CTRL_PROTO_H__
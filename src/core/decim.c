@@ -0,0 +1,66 @@
+// FILE: src/core/decim.c
+#include "decim.h"
+
+#include <string.h>
+
+// ---------- internal helpers ----------
+
+static void open_window(decim_t *d, int32_t t_x100, uint32_t p_pa, uint32_t t_us) {
+    d->open         = true;
+    d->win_start_us = t_us;
+    d->sum_t        = t_x100;
+    d->sum_p        = p_pa;
+    d->n            = 1;
+    d->p_min        = p_pa;
+    d->p_max        = p_pa;
+    d->last_us      = t_us;
+}
+
+static void close_window(decim_t *d, decim_out_t *out) {
+    const int64_t n = (int64_t)d->n;
+    // 0 방향이 아닌 최근접 반올림 (음수 온도 포함)
+    out->t_x100 = (int32_t)((d->sum_t >= 0) ? (d->sum_t + n / 2) / n : (d->sum_t - n / 2) / n);
+    out->p_pa   = (uint32_t)((d->sum_p + (uint64_t)d->n / 2u) / d->n);
+    out->p_min  = d->p_min;
+    out->p_max  = d->p_max;
+    out->n      = d->n;
+    out->t_us   = d->last_us;
+    d->windows++;
+    if (d->p_max - d->p_min > d->span_max) d->span_max = d->p_max - d->p_min;
+}
+
+// ---------- public API ----------
+
+void decim_init(decim_t *d, uint32_t period_us) {
+    if (!d) return;
+    memset(d, 0, sizeof(*d));
+    d->period_us = period_us ? period_us : 1u;
+}
+
+bool decim_push(decim_t *d, int32_t t_x100, uint32_t p_pa, uint32_t t_us, decim_out_t *out) {
+    if (!d || !out) return false;
+    d->inputs++;
+
+    if (!d->open) {
+        open_window(d, t_x100, p_pa, t_us);
+        return false;
+    }
+
+    const uint32_t age = t_us - d->win_start_us;
+    if (age >= d->period_us) {
+        close_window(d, out);
+        // 출력 간격이 입력 간격만큼 밀리지 않도록 window 경계는 period 격자 유지 (긴 공백 후에는 재정렬)
+        const uint32_t start = (age < 2u * d->period_us) ? d->win_start_us + d->period_us : t_us;
+        open_window(d, t_x100, p_pa, t_us);
+        d->win_start_us = start;
+        return true;
+    }
+
+    d->sum_t += t_x100;
+    d->sum_p += p_pa;
+    d->n++;
+    if (p_pa < d->p_min) d->p_min = p_pa;
+    if (p_pa > d->p_max) d->p_max = p_pa;
+    d->last_us = t_us;
+    return false;
+}
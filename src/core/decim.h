@@ -0,0 +1,54 @@
+// FILE: src/core/decim.h
+#ifndef __DECIM_H__
+#define __DECIM_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+// Decimating accumulator (burst 입력 -> 설정 출력 rate)
+//
+// - 시간 window(period_us) 동안 보상값을 합산, window가 끝나면 평균 1개 출력 (boxcar)
+//   입력 rate가 변해도(poll 지연, 오류 재시작) 출력 rate는 일정, 평균 개수는 n으로 확인
+// - window 내 pressure min/max 유지: 평균에 묻히는 짧은 이벤트(돌풍, 문 닫힘) 확인용
+// - 입력 간격이 window보다 길면(정지 후 재개) 이전 window는 그대로 출력하고 새로 시작
+
+typedef struct {
+    int32_t  t_x100;    // 평균 (반올림)
+    uint32_t p_pa;      // 평균 (반올림)
+    uint32_t p_min;
+    uint32_t p_max;
+    uint32_t n;         // 평균한 샘플 수
+    uint32_t t_us;      // window 마지막 샘플 시각
+} decim_out_t;
+
+typedef struct {
+    uint32_t period_us;
+
+    bool     open;
+    uint32_t win_start_us;
+    int64_t  sum_t;
+    uint64_t sum_p;
+    uint32_t n;
+    uint32_t p_min;
+    uint32_t p_max;
+    uint32_t last_us;
+
+    uint32_t windows;   // 출력 수
+    uint32_t inputs;
+    uint32_t span_max;  // window p_max - p_min 최대 (보고 후 호출자가 0으로)
+} decim_t;
+
+void decim_init(decim_t *d, uint32_t period_us);
+
+// 샘플 1개 추가. window가 끝났으면 true + out (이 샘플은 다음 window의 첫 샘플)
+bool decim_push(decim_t *d, int32_t t_x100, uint32_t p_pa, uint32_t t_us, decim_out_t *out);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // __DECIM_H__
@@ -0,0 +1,228 @@
+// FILE: src/core/dlog.c
+#include "dlog.h"
+
+#include <string.h>
+
+#include "tlm_fmt.h"
+
+static const char *const s_fmt[DLOG_ID_COUNT] = {
+#define DLOG_X_FMT(name, fmt) fmt,
+    DLOG_FORMATS(DLOG_X_FMT)
+#undef DLOG_X_FMT
+};
+
+// ---------- internal helpers ----------
+
+static void put_u32(uint8_t *p, uint32_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+static uint32_t get_u32(const uint8_t *p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint8_t token_sum(const uint8_t *t, size_t len) {
+    uint8_t s = 0;
+    for (size_t i = 0; i < len; i++) {
+        if (i != 3) s = (uint8_t)(s + t[i]);
+    }
+    return (uint8_t)(0xFFu - s);
+}
+
+static size_t fmt_hex8(char *out, uint32_t v) {
+    static const char hex[] = "0123456789abcdef";
+    for (int i = 7; i >= 0; i--) {
+        out[i] = hex[v & 0xFu];
+        v >>= 4;
+    }
+    return 8;
+}
+
+static bool emit(dlog_mode_t mode, const dlog_rec_t *r, dlog_sink_fn sink, void *user) {
+    if (mode == DLOG_BINARY) {
+        uint8_t tok[DLOG_TOKEN_MAX];
+        const size_t n = dlog_token_encode(r, tok, sizeof(tok));
+        return n == 0 || sink(tok, n, user);
+    }
+
+    char line[DLOG_LINE_MAX];
+    const size_t n = dlog_format(r, line, sizeof(line));
+    return n == 0 || sink(line, n, user); // 해석 불가 record는 버림
+}
+
+// ---------- public API ----------
+
+bool dlog_init(dlog_t *d, dlog_rec_t *slots, uint32_t depth, uint32_t (*clock_ms)(void)) {
+    if (!d || !slots || depth == 0 || (depth & (depth - 1u)) != 0) return false;
+    memset(d, 0, sizeof(*d));
+    d->slots    = slots;
+    d->depth    = depth;
+    d->clock_ms = clock_ms;
+    return true;
+}
+
+bool dlog_put(dlog_t *d, dlog_id_t id, uint32_t nargs, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+    if (!d || !d->slots) return false;
+
+    const uint32_t head = d->head;
+    const uint32_t used = head - d->tail;
+    if (used >= d->depth) {
+        d->dropped++;
+        return false;
+    }
+
+    dlog_rec_t *r = &d->slots[head & (d->depth - 1u)];
+    r->ts_ms  = d->clock_ms ? d->clock_ms() : 0u;
+    r->id     = (uint8_t)id;
+    r->nargs  = (uint8_t)(nargs > DLOG_MAX_ARGS ? DLOG_MAX_ARGS : nargs);
+    r->arg[0] = a0;
+    r->arg[1] = a1;
+    r->arg[2] = a2;
+    r->arg[3] = a3;
+
+    __sync_synchronize();
+    d->head = head + 1u;
+
+    d->written++;
+    if (used + 1u > d->depth_max) d->depth_max = used + 1u;
+    return true;
+}
+
+uint32_t dlog_drain(dlog_t *d, dlog_mode_t mode, dlog_sink_fn sink, void *user, uint32_t max_recs) {
+    if (!d || !d->slots || !sink) return 0;
+    uint32_t done = 0;
+
+    // 직전 drain 이후 drop이 있었으면 먼저 보고 (순서상 유실 위치를 알 수 있게)
+    const uint32_t dropped = d->dropped;
+    if (dropped != d->dropped_reported && done < max_recs) {
+        const dlog_rec_t r = {
+            .ts_ms = d->clock_ms ? d->clock_ms() : 0u,
+            .id    = (uint8_t)DLOG_DROPPED,
+            .nargs = 1,
+            .arg   = { dropped - d->dropped_reported },
+        };
+        if (!emit(mode, &r, sink, user)) {
+            d->sink_busy++;
+            return 0;
+        }
+        d->dropped_reported = dropped;
+        done++;
+    }
+
+    while (done < max_recs) {
+        const uint32_t tail = d->tail;
+        if (tail == d->head) break;
+        __sync_synchronize();
+
+        const dlog_rec_t *r = &d->slots[tail & (d->depth - 1u)];
+        if (!emit(mode, r, sink, user)) {
+            d->sink_busy++;
+            break;
+        }
+
+        __sync_synchronize();
+        d->tail = tail + 1u;
+        d->drained++;
+        done++;
+    }
+    return done;
+}
+
+uint32_t dlog_pending(const dlog_t *d) {
+    if (!d) return 0;
+    return d->head - d->tail;
+}
+
+void dlog_get_stats(const dlog_t *d, dlog_stats_t *out) {
+    if (!out) return;
+    memset(out, 0, sizeof(*out));
+    if (!d) return;
+    out->written   = d->written;
+    out->drained   = d->drained;
+    out->dropped   = d->dropped;
+    out->depth_max = d->depth_max;
+    out->sink_busy = d->sink_busy;
+}
+
+size_t dlog_format(const dlog_rec_t *r, char *out, size_t out_sz) {
+    if (!r || !out || r->id >= DLOG_ID_COUNT) return 0;
+
+    const char *f = s_fmt[r->id];
+    uint32_t ai = 0;
+    size_t n = 0;
+
+    // 변환 1개 최대 길이(TLM_FMT_X100_MAX) + NUL 여유를 남기며 진행
+    while (*f) {
+        if (n + TLM_FMT_X100_MAX + 1u > out_sz) return 0;
+
+        if (f[0] != '%' || f[1] == '\0') {
+            out[n++] = *f++;
+            continue;
+        }
+
+        const char k = f[1];
+        f += 2;
+        if (k == '%') {
+            out[n++] = '%';
+            continue;
+        }
+
+        const uint32_t v = (ai < r->nargs) ? r->arg[ai] : 0u;
+        ai++;
+        switch (k) {
+        case 'd': n += tlm_fmt_i32(out + n, (int32_t)v);  break;
+        case 'u': n += tlm_fmt_u32(out + n, v);           break;
+        case 'x': n += fmt_hex8(out + n, v);              break;
+        case 'c': n += tlm_fmt_x100(out + n, (int32_t)v); break;
+        default:  out[n++] = '?';                         break;
+        }
+    }
+
+    out[n] = '\0';
+    return n;
+}
+
+size_t dlog_token_encode(const dlog_rec_t *r, uint8_t *out, size_t out_sz) {
+    if (!r || !out) return 0;
+    const uint32_t na = r->nargs > DLOG_MAX_ARGS ? DLOG_MAX_ARGS : r->nargs;
+    const size_t len = DLOG_TOKEN_HDR + (size_t)na * 4u;
+    if (out_sz < len) return 0;
+
+    out[0] = (uint8_t)DLOG_TOKEN_MAGIC;
+    out[1] = r->id;
+    out[2] = (uint8_t)na;
+    out[3] = 0;
+    put_u32(out + 4, r->ts_ms);
+    for (uint32_t i = 0; i < na; i++) put_u32(out + DLOG_TOKEN_HDR + i * 4u, r->arg[i]);
+    out[3] = token_sum(out, len);
+    return len;
+}
+
+int32_t dlog_token_parse(const uint8_t *buf, size_t len, dlog_rec_t *r) {
+    if (!buf || len == 0) return 0;
+
+    if (buf[0] != DLOG_TOKEN_MAGIC) {
+        // 다음 magic 후보까지 한 번에 skip (text와 섞인 stream)
+        size_t i = 1;
+        while (i < len && buf[i] != DLOG_TOKEN_MAGIC) i++;
+        return -(int32_t)i;
+    }
+    if (len < 3) return 0;
+    if (buf[1] >= DLOG_ID_COUNT || buf[2] > DLOG_MAX_ARGS) return -1;
+
+    const size_t tlen = DLOG_TOKEN_HDR + (size_t)buf[2] * 4u;
+    if (len < tlen) return 0;
+    if (buf[3] != token_sum(buf, tlen)) return -1;
+
+    if (r) {
+        memset(r, 0, sizeof(*r));
+        r->id    = buf[1];
+        r->nargs = buf[2];
+        r->ts_ms = get_u32(buf + 4);
+        for (uint32_t i = 0; i < r->nargs; i++) r->arg[i] = get_u32(buf + DLOG_TOKEN_HDR + i * 4u);
+    }
+    return (int32_t)tlen;
+}
@@ -0,0 +1,120 @@
+// FILE: src/core/dlog.h
+#ifndef __DLOG_H__
+#define __DLOG_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "dlog_fmt.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+// Deferred logging: hot path는 record(format id + raw arg)만 ring에 넣고, 문자열화/출력은 idle에서
+//
+// - ring: single producer / single consumer, lock 없음 (head는 producer만, tail은 consumer만 씀)
+//   producer = acquisition loop, consumer = idle drain (같은 core든 core1이든 동작)
+// - ring이 차면 block 하지 않고 drop 카운트 -> drain이 DLOG_DROPPED record로 보고
+// - drain 출력
+//     DLOG_TEXT   : format table로 문자열화 (float printf 없음, tlm_fmt)
+//     DLOG_BINARY : token 그대로 (host gy63_dlog가 같은 table로 복원)
+//
+// binary token (little-endian)
+//   [0] u8 DLOG_TOKEN_MAGIC
+//   [1] u8 id
+//   [2] u8 nargs
+//   [3] u8 sum       [0..3) + [4..) byte 합의 보수 (token 전체 byte 합 == 0xFF)
+//   [4] u32 ts_ms
+//   [8] u32 arg[nargs]
+
+#define DLOG_MAX_ARGS       (4u)
+#define DLOG_TOKEN_MAGIC    (0xDBu)
+#define DLOG_TOKEN_HDR      (8u)
+#define DLOG_TOKEN_MAX      (DLOG_TOKEN_HDR + DLOG_MAX_ARGS * 4u)
+#define DLOG_LINE_MAX       (96u)
+
+typedef enum {
+#define DLOG_X_ENUM(name, fmt) name,
+    DLOG_FORMATS(DLOG_X_ENUM)
+#undef DLOG_X_ENUM
+    DLOG_ID_COUNT
+} dlog_id_t;
+
+typedef enum {
+    DLOG_TEXT = 0,
+    DLOG_BINARY,
+} dlog_mode_t;
+
+typedef struct {
+    uint32_t ts_ms;
+    uint8_t  id;
+    uint8_t  nargs;
+    uint32_t arg[DLOG_MAX_ARGS];
+} dlog_rec_t;
+
+typedef struct {
+    uint32_t written;
+    uint32_t drained;
+    uint32_t dropped;       // ring full (누적)
+    uint32_t depth_max;     // ring 최대 사용량
+    uint32_t sink_busy;     // sink가 거부 -> 다음 drain에서 재시도
+} dlog_stats_t;
+
+// drain 출력 (text line 또는 token 1개). false면 drain 중단 (record는 ring에 남음)
+typedef bool (*dlog_sink_fn)(const void *data, size_t len, void *user);
+
+typedef struct {
+    dlog_rec_t *slots;
+    uint32_t    depth;          // 2의 거듭제곱
+
+    volatile uint32_t head;     // producer
+    volatile uint32_t tail;     // consumer
+    volatile uint32_t dropped;  // producer만 증가
+    uint32_t dropped_reported;  // consumer
+
+    uint32_t (*clock_ms)(void);
+
+    uint32_t written;
+    uint32_t drained;
+    uint32_t depth_max;
+    uint32_t sink_busy;
+} dlog_t;
+
+// depth는 2의 거듭제곱 (아니면 false). clock_ms는 record timestamp (NULL이면 0)
+bool dlog_init(dlog_t *d, dlog_rec_t *slots, uint32_t depth, uint32_t (*clock_ms)(void));
+
+// hot path: record 1개 (format 없음). ring이 차면 drop 카운트 후 false
+bool dlog_put(dlog_t *d, dlog_id_t id, uint32_t nargs, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+
+#define DLOG0(d, id)                 dlog_put((d), (id), 0, 0, 0, 0, 0)
+#define DLOG1(d, id, a)              dlog_put((d), (id), 1, (uint32_t)(a), 0, 0, 0)
+#define DLOG2(d, id, a, b)           dlog_put((d), (id), 2, (uint32_t)(a), (uint32_t)(b), 0, 0)
+#define DLOG3(d, id, a, b, c)        dlog_put((d), (id), 3, (uint32_t)(a), (uint32_t)(b), (uint32_t)(c), 0)
+
+// 최대 max_recs개를 sink로 (drop 보고 포함). 처리한 record 수 리턴
+uint32_t dlog_drain(dlog_t *d, dlog_mode_t mode, dlog_sink_fn sink, void *user, uint32_t max_recs);
+
+// ring에 남은 record 수
+uint32_t dlog_pending(const dlog_t *d);
+
+void dlog_get_stats(const dlog_t *d, dlog_stats_t *out);
+
+// ---- record <-> text / token (host decoder 공용) ----
+
+// format table로 1줄 (NUL 종료). 알 수 없는 id / 공간 부족이면 0
+size_t dlog_format(const dlog_rec_t *r, char *out, size_t out_sz);
+
+// token 1개 작성. 길이 리턴 (공간 부족이면 0)
+size_t dlog_token_encode(const dlog_rec_t *r, uint8_t *out, size_t out_sz);
+
+// buf 앞에서 token 1개 검증 (tlm_bin_parse와 같은 규약)
+//   >0: token 길이 (r 채움), 0: byte 더 필요, <0: 앞의 -n byte는 token 아님
+int32_t dlog_token_parse(const uint8_t *buf, size_t len, dlog_rec_t *r);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // __DLOG_H__
@@ -0,0 +1,19 @@
+// FILE: src/core/dlog_fmt.h
+#ifndef __DLOG_FMT_H__
+#define __DLOG_FMT_H__
+
+// deferred log format table (firmware + host decoder 공용, id = 목록 순서)
+//
+// X(name, "format")
+//   %d i32, %u u32, %x u32 hex(8자리), %c i32 x100 고정소수점 ("%.2f"와 같은 출력)
+//   문자열 arg 없음 (status는 code로)
+// - binary token에는 id만 실림: 항목은 끝에 추가만 (순서 변경/삭제 시 예전 capture 해석이 틀어짐)
+// - arg는 최대 DLOG_MAX_ARGS개
+
+#define DLOG_FORMATS(X)                                    \
+    X(DLOG_DROPPED,     "dlog: dropped %u records\n")      \
+    X(DLOG_SAMPLE,      "T=%c C, P=%u Pa\n")               \
+    X(DLOG_READ_FAIL,   "gy63_read failed: %d\n")          \
+    X(DLOG_ALARM,       "alarm: high=%u low=%u P=%u Pa\n")
+
+#endif // __DLOG_FMT_H__
@@ -0,0 +1,336 @@
+// FILE: src/core/flash_log.c
+#include "flash_log.h"
+
+#include <string.h>
+
+#include "crc32.h"
+
+// ---------- internal helpers ----------
+
+static void put_u16(uint8_t *p, uint16_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
+
+static void put_u32(uint8_t *p, uint32_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+static void put_u64(uint8_t *p, uint64_t v) {
+    put_u32(p, (uint32_t)v);
+    put_u32(p + 4, (uint32_t)(v >> 32));
+}
+
+static uint16_t get_u16(const uint8_t *p) {
+    return (uint16_t)(p[0] | ((uint16_t)p[1] << 8));
+}
+
+static uint32_t get_u32(const uint8_t *p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint64_t get_u64(const uint8_t *p) {
+    return (uint64_t)get_u32(p) | ((uint64_t)get_u32(p + 4) << 32);
+}
+
+static uint32_t page_crc(const uint8_t *page, uint16_t count) {
+    uint32_t crc = 0xFFFFFFFFu;
+    crc = crc32_update(crc, page, 28);
+    crc = crc32_update(crc, page + FLASH_LOG_HDR_SIZE, (size_t)count * FLASH_LOG_REC_SIZE);
+    return ~crc;
+}
+
+static bool is_blank(const uint8_t *p, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        if (p[i] != 0xFF) return false;
+    }
+    return true;
+}
+
+static flash_log_status_t validate_dev(const flash_log_dev_t *dev) {
+    if (!dev || !dev->read || !dev->program || !dev->erase) return FLASH_LOG_EINVAL;
+    if (dev->sector_size == 0 || (dev->sector_size % FLASH_LOG_PAGE_SIZE) != 0) return FLASH_LOG_EINVAL;
+    if (dev->size < dev->sector_size || (dev->size % dev->sector_size) != 0) return FLASH_LOG_EINVAL;
+    return FLASH_LOG_OK;
+}
+
+static uint32_t page_off(uint32_t page) {
+    return page * FLASH_LOG_PAGE_SIZE;
+}
+
+static bool read_page(flash_log_t *log, uint32_t page, uint8_t *out) {
+    if (log->dev.read(log->dev.ctx, page_off(page), out, FLASH_LOG_PAGE_SIZE)) return true;
+    log->stats.io_errors++;
+    return false;
+}
+
+// page..sector 끝까지 전부 erased 상태인지 (head가 sector 중간일 때 재사용 가능 여부)
+static bool sector_tail_blank(flash_log_t *log, uint32_t page) {
+    uint8_t buf[FLASH_LOG_PAGE_SIZE];
+    const uint32_t end = (page / log->pages_per_sector + 1) * log->pages_per_sector;
+
+    for (uint32_t p = page; p < end; p++) {
+        if (!read_page(log, p, buf)) return false;
+        if (!is_blank(buf, sizeof(buf))) return false;
+    }
+    return true;
+}
+
+static bool erase_sector(flash_log_t *log, uint32_t sector) {
+    if (!log->dev.erase(log->dev.ctx, sector * log->dev.sector_size, log->dev.sector_size)) {
+        log->stats.io_errors++;
+        return false;
+    }
+    log->stats.sectors_erased++;
+    return true;
+}
+
+static void page_reset(flash_log_t *log) {
+    memset(log->page, 0xFF, sizeof(log->page));
+    log->page_count = 0;
+}
+
+static flash_log_status_t program_page(flash_log_t *log) {
+    uint8_t *pg = log->page;
+
+    put_u32(pg + 0,  FLASH_LOG_MAGIC);
+    put_u32(pg + 4,  log->next_page_seq);
+    put_u32(pg + 8,  log->page_first_seq);
+    put_u16(pg + 12, log->page_count);
+    put_u16(pg + 14, (uint16_t)FLASH_LOG_REC_SIZE);
+    put_u64(pg + 16, log->page_base_ms);
+    put_u32(pg + 24, log->boot_id);
+    put_u32(pg + 28, page_crc(pg, log->page_count));
+
+    const uint32_t page = log->head_page;
+
+    // sector 진입: flash_log_service가 미리 지웠으면 그대로, 아니면 여기서 erase (가장 오래된 데이터부터 덮어씀)
+    if ((page % log->pages_per_sector) == 0) {
+        const uint32_t sector = page / log->pages_per_sector;
+        if (log->pre_sector == sector) {
+            log->pre_sector = FLASH_LOG_NO_SECTOR; // 한 바퀴 뒤 재진입 때는 다시 erase 필요
+        } else {
+            if (!erase_sector(log, sector)) return FLASH_LOG_EIO;
+            log->stats.erases_sync++;
+        }
+    }
+
+    const bool ok = log->dev.program(log->dev.ctx, page_off(page), pg, FLASH_LOG_PAGE_SIZE);
+
+    // 실패해도 page는 소모 (부분 program 가능성) -> 다음 page로 진행
+    log->head_page = (page + 1) % log->pages_total;
+    log->next_page_seq++;
+    page_reset(log);
+
+    if (!ok) {
+        log->stats.io_errors++;
+        return FLASH_LOG_EIO;
+    }
+
+    log->stats.pages_written++;
+    return FLASH_LOG_OK;
+}
+
+// ---------- public API ----------
+
+const char *flash_log_status_str(flash_log_status_t st) {
+    switch (st) {
+    case FLASH_LOG_OK:     return "FLASH_LOG_OK";
+    case FLASH_LOG_EINVAL: return "FLASH_LOG_EINVAL";
+    case FLASH_LOG_ESTATE: return "FLASH_LOG_ESTATE";
+    case FLASH_LOG_EIO:    return "FLASH_LOG_EIO";
+    default:               return "FLASH_LOG_UNKNOWN";
+    }
+}
+
+bool flash_log_page_decode(const uint8_t page[FLASH_LOG_PAGE_SIZE], flash_log_page_info_t *info) {
+    if (!page || !info) return false;
+
+    if (get_u32(page + 0) != FLASH_LOG_MAGIC) return false;
+
+    const uint16_t count = get_u16(page + 12);
+    if (count == 0 || count > FLASH_LOG_SAMPLES_PER_PAGE) return false;
+    if (get_u16(page + 14) != FLASH_LOG_REC_SIZE) return false;
+    if (get_u32(page + 28) != page_crc(page, count)) return false;
+
+    info->page_seq   = get_u32(page + 4);
+    info->sample_seq = get_u32(page + 8);
+    info->count      = count;
+    info->base_ms    = get_u64(page + 16);
+    info->boot_id    = get_u32(page + 24);
+    return true;
+}
+
+void flash_log_page_sample(const uint8_t page[FLASH_LOG_PAGE_SIZE],
+                           const flash_log_page_info_t *info,
+                           uint16_t idx,
+                           tlm_sample_t *out) {
+    if (!page || !info || !out || idx >= info->count) return;
+
+    const uint8_t *r = page + FLASH_LOG_HDR_SIZE + (size_t)idx * FLASH_LOG_REC_SIZE;
+    out->ms     = info->base_ms + get_u32(r + 0);
+    out->t_x100 = (int32_t)get_u32(r + 4);
+    out->p_pa   = get_u32(r + 8);
+}
+
+flash_log_status_t flash_log_mount(flash_log_t *log, const flash_log_dev_t *dev, uint32_t boot_id) {
+    if (!log) return FLASH_LOG_EINVAL;
+
+    flash_log_status_t st = validate_dev(dev);
+    if (st != FLASH_LOG_OK) return st;
+
+    memset(log, 0, sizeof(*log));
+    log->dev              = *dev;
+    log->boot_id          = boot_id;
+    log->pages_total      = dev->size / FLASH_LOG_PAGE_SIZE;
+    log->pages_per_sector = dev->sector_size / FLASH_LOG_PAGE_SIZE;
+    log->pre_sector       = FLASH_LOG_NO_SECTOR;
+    page_reset(log);
+
+    // 1) 전체 scan: 최신(page_seq 최대) 유효 page 찾기
+    uint8_t buf[FLASH_LOG_PAGE_SIZE];
+    bool found = false;
+    uint32_t newest_page = 0;
+    flash_log_page_info_t newest = {0};
+
+    for (uint32_t p = 0; p < log->pages_total; p++) {
+        if (!read_page(log, p, buf)) return FLASH_LOG_EIO;
+
+        flash_log_page_info_t info;
+        if (flash_log_page_decode(buf, &info)) {
+            log->stats.pages_valid++;
+            if (!found || info.page_seq > newest.page_seq) {
+                found       = true;
+                newest      = info;
+                newest_page = p;
+            }
+        } else if (!is_blank(buf, sizeof(buf))) {
+            log->stats.pages_torn++;
+        }
+    }
+
+    // 2) head / sequence 복구
+    if (found) {
+        log->head_page       = (newest_page + 1) % log->pages_total;
+        log->next_page_seq   = newest.page_seq + 1;
+        log->next_sample_seq = newest.sample_seq + newest.count;
+    }
+
+    // 3) head가 sector 중간이면 나머지가 깨끗한지 확인 (찢어진 program / 부분 erase)
+    if ((log->head_page % log->pages_per_sector) != 0 && !sector_tail_blank(log, log->head_page)) {
+        const uint32_t next_sector = (log->head_page / log->pages_per_sector + 1) * log->pages_per_sector;
+        log->head_page = next_sector % log->pages_total;
+    }
+
+    log->mounted = true;
+    return FLASH_LOG_OK;
+}
+
+flash_log_status_t flash_log_format(flash_log_t *log) {
+    if (!log || !log->mounted) return FLASH_LOG_ESTATE;
+
+    for (uint32_t off = 0; off < log->dev.size; off += log->dev.sector_size) {
+        if (!log->dev.erase(log->dev.ctx, off, log->dev.sector_size)) {
+            log->stats.io_errors++;
+            return FLASH_LOG_EIO;
+        }
+        log->stats.sectors_erased++;
+    }
+
+    // sequence는 이어서 사용 (host가 format 전후 dump를 섞어도 구분 가능)
+    log->head_page  = 0;
+    log->pre_sector = 0;
+    page_reset(log);
+    log->stats.pages_valid = 0;
+    log->stats.pages_torn  = 0;
+    return FLASH_LOG_OK;
+}
+
+flash_log_status_t flash_log_append(flash_log_t *log, const tlm_sample_t *s) {
+    if (!log || !s) return FLASH_LOG_EINVAL;
+    if (!log->mounted) return FLASH_LOG_ESTATE;
+
+    // dms는 u32: page 내 시간 폭이 ~49일을 넘으면 새 page로
+    if (log->page_count > 0 && (s->ms < log->page_base_ms || s->ms - log->page_base_ms > 0xFFFFFFFFull)) {
+        flash_log_status_t st = program_page(log);
+        if (st != FLASH_LOG_OK) return st;
+    }
+
+    if (log->page_count == 0) {
+        log->page_base_ms   = s->ms;
+        log->page_first_seq = log->next_sample_seq;
+    }
+
+    uint8_t *r = log->page + FLASH_LOG_HDR_SIZE + (size_t)log->page_count * FLASH_LOG_REC_SIZE;
+    put_u32(r + 0, (uint32_t)(s->ms - log->page_base_ms));
+    put_u32(r + 4, (uint32_t)s->t_x100);
+    put_u32(r + 8, s->p_pa);
+
+    log->page_count++;
+    log->next_sample_seq++;
+    log->stats.samples_appended++;
+
+    if (log->page_count == FLASH_LOG_SAMPLES_PER_PAGE) return program_page(log);
+    return FLASH_LOG_OK;
+}
+
+flash_log_status_t flash_log_flush(flash_log_t *log) {
+    if (!log) return FLASH_LOG_EINVAL;
+    if (!log->mounted) return FLASH_LOG_ESTATE;
+    if (log->page_count == 0) return FLASH_LOG_OK;
+    return program_page(log);
+}
+
+bool flash_log_service(flash_log_t *log) {
+    if (!log || !log->mounted) return false;
+
+    const uint32_t sectors = log->pages_total / log->pages_per_sector;
+    if (sectors < 2) return false; // head가 있는 sector를 지우게 됨
+
+    // head가 sector 경계면 그 sector, 아니면 다음 sector
+    const uint32_t head_sector = log->head_page / log->pages_per_sector;
+    const uint32_t target = (log->head_page % log->pages_per_sector) == 0 ? head_sector
+                                                                          : (head_sector + 1) % sectors;
+    if (log->pre_sector == target) return false;
+
+    // 실패하면 pre_sector 그대로 -> 진입 시 sync erase로 재시도
+    if (!erase_sector(log, target)) return false;
+    log->pre_sector = target;
+    log->stats.erases_pre++;
+    return true;
+}
+
+void flash_log_reader_open(const flash_log_t *log, flash_log_reader_t *rd) {
+    if (!rd) return;
+    memset(rd, 0, sizeof(*rd));
+    if (!log || !log->mounted) return;
+
+    // head부터 한 바퀴: circular 순서 == page_seq 오름차순
+    rd->page      = log->head_page;
+    rd->remaining = log->pages_total;
+}
+
+bool flash_log_reader_next(flash_log_t *log, flash_log_reader_t *rd, uint8_t out[FLASH_LOG_PAGE_SIZE]) {
+    if (!log || !rd || !out || !log->mounted) return false;
+
+    while (rd->remaining > 0) {
+        const uint32_t p = rd->page;
+        rd->page = (p + 1) % log->pages_total;
+        rd->remaining--;
+
+        if (!read_page(log, p, out)) continue;
+
+        flash_log_page_info_t info;
+        if (!flash_log_page_decode(out, &info)) continue;
+        if (info.page_seq >= log->next_page_seq) continue;
+        if (rd->any && info.page_seq <= rd->last_seq) continue;
+
+        rd->any      = true;
+        rd->last_seq = info.page_seq;
+        return true;
+    }
+    return false;
+}
@@ -0,0 +1,163 @@
+// FILE: src/core/flash_log.h
+#ifndef __FLASH_LOG_H__
+#define __FLASH_LOG_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "tlm_buffer.h" // tlm_sample_t
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+// Log-structured append-only sample recorder (NOR flash 영역을 circular log로 사용)
+//
+// on-flash format (little-endian, page = 256 B, program 단위)
+//   [0]  u32 magic       FLASH_LOG_MAGIC
+//   [4]  u32 page_seq    log 전체에서 단조 증가 (wrap 없음)
+//   [8]  u32 sample_seq  이 page 첫 샘플의 sequence
+//   [12] u16 count       샘플 수 (<= FLASH_LOG_SAMPLES_PER_PAGE)
+//   [14] u16 rec_size    FLASH_LOG_REC_SIZE
+//   [16] u64 base_ms     첫 샘플 시각 (ms since boot)
+//   [24] u32 boot_id     기록 시점 boot 식별자 (0xFFFFFFFF: unknown)
+//   [28] u32 crc32       [0..28) + payload 의 CRC-32 (IEEE)
+//   [32] record[count]   u32 dms (base_ms 기준), i32 t_x100, u32 p_pa
+//
+// - page는 erase 후 1회만 program 됨. 전원 차단으로 찢어진 page는 CRC로 걸러냄.
+// - sector erase는 flash_log_service가 head 앞 sector를 미리 (idle/service 구간).
+//   미리 지워지지 않은 sector에 head가 진입하면 append 안에서 erase (sync, stats.erases_sync).
+// - circular -> 모든 sector 균등 마모. 미리 지운 sector 1개만큼 가장 오래된 데이터가 먼저 사라짐.
+
+#define FLASH_LOG_PAGE_SIZE         256u
+#define FLASH_LOG_HDR_SIZE          32u
+#define FLASH_LOG_REC_SIZE          12u
+#define FLASH_LOG_SAMPLES_PER_PAGE  ((FLASH_LOG_PAGE_SIZE - FLASH_LOG_HDR_SIZE) / FLASH_LOG_REC_SIZE)
+#define FLASH_LOG_MAGIC             0x474C5947u // "GYLG"
+#define FLASH_LOG_NO_SECTOR         0xFFFFFFFFu
+
+// bulk readout datagram (UDP/USB 공통 framing)
+//   [0]  u32 magic     FLASH_LOG_DUMP_MAGIC
+//   [4]  u32 chunk     0부터 증가 (host에서 유실 검출)
+//   [8]  u16 n_pages   뒤따르는 raw page 수
+//   [10] u16 flags     FLASH_LOG_DUMP_FLAG_*
+//   [12] page[n_pages]
+#define FLASH_LOG_DUMP_MAGIC        0x44465947u // "GYFD"
+#define FLASH_LOG_DUMP_HDR_SIZE     12u
+#define FLASH_LOG_DUMP_FLAG_LAST    0x0001u
+
+// 0: OK, <0: error
+typedef int32_t flash_log_status_t;
+
+enum {
+    FLASH_LOG_OK      = 0,
+
+    FLASH_LOG_EINVAL  = -3000,
+    FLASH_LOG_ESTATE  = -3001,
+    FLASH_LOG_EIO     = -3002,
+};
+
+const char *flash_log_status_str(flash_log_status_t st);
+
+// flash 장치 추상화 (target: QSPI XIP flash, host: file-backed stand-in)
+// off는 log 영역 기준 offset. program은 page 정렬/길이, erase는 sector 정렬/길이.
+typedef struct {
+    uint32_t size;          // log 영역 크기 (sector_size 배수)
+    uint32_t sector_size;   // erase 단위 (예: 4096)
+
+    bool (*read)(void *ctx, uint32_t off, void *dst, size_t len);
+    bool (*program)(void *ctx, uint32_t off, const void *src, size_t len);
+    bool (*erase)(void *ctx, uint32_t off, size_t len);
+    void *ctx;
+} flash_log_dev_t;
+
+typedef struct {
+    uint32_t samples_appended;
+    uint32_t pages_written;
+    uint32_t sectors_erased;
+    uint32_t erases_pre;    // flash_log_service에서 (샘플 경로 밖)
+    uint32_t erases_sync;   // append/flush 안에서 (샘플 경로 stall)
+    uint32_t io_errors;
+
+    // mount scan 결과
+    uint32_t pages_valid;
+    uint32_t pages_torn;    // program 흔적은 있으나 CRC 불일치
+} flash_log_stats_t;
+
+typedef struct {
+    flash_log_dev_t dev;
+    bool mounted;
+
+    uint32_t pages_total;
+    uint32_t pages_per_sector;
+
+    uint32_t head_page;        // 다음 program할 page index
+    uint32_t pre_sector;       // 미리 erase된 sector (FLASH_LOG_NO_SECTOR: 없음)
+    uint32_t next_page_seq;
+    uint32_t next_sample_seq;
+    uint32_t boot_id;
+
+    // RAM page batch
+    uint8_t  page[FLASH_LOG_PAGE_SIZE];
+    uint16_t page_count;
+    uint64_t page_base_ms;
+    uint32_t page_first_seq;
+
+    flash_log_stats_t stats;
+} flash_log_t;
+
+// decode된 page header
+typedef struct {
+    uint32_t page_seq;
+    uint32_t sample_seq;
+    uint16_t count;
+    uint64_t base_ms;
+    uint32_t boot_id;
+} flash_log_page_info_t;
+
+// 영역 scan -> head/sequence 복구. 유효 page가 없으면 빈 log로 시작(FLASH_LOG_OK).
+flash_log_status_t flash_log_mount(flash_log_t *log, const flash_log_dev_t *dev, uint32_t boot_id);
+
+// 전체 영역 erase 후 빈 log로 시작
+flash_log_status_t flash_log_format(flash_log_t *log);
+
+// 샘플 1개 추가 (page가 차면 program)
+flash_log_status_t flash_log_append(flash_log_t *log, const tlm_sample_t *s);
+
+// RAM에 남은 partial page를 즉시 program (page 잔여 공간은 버려짐)
+flash_log_status_t flash_log_flush(flash_log_t *log);
+
+// head가 다음에 진입할 sector를 미리 erase (이미 되어 있으면 no-op). 샘플 사이 service 구간에서 호출.
+// erase를 했으면 true (호출당 최대 1 sector). sector가 1개뿐인 영역에서는 아무것도 안 함
+bool flash_log_service(flash_log_t *log);
+
+// sequential readout (오래된 page -> 최신 page)
+typedef struct {
+    uint32_t page;       // 다음 검사할 page index
+    uint32_t remaining;  // 남은 검사 page 수
+    uint32_t last_seq;   // 마지막으로 내보낸 page_seq (역순 잔재 page skip)
+    bool     any;
+} flash_log_reader_t;
+
+void flash_log_reader_open(const flash_log_t *log, flash_log_reader_t *rd);
+
+// 다음 유효 page를 out에 복사 (raw 256 B). 끝이면 false.
+bool flash_log_reader_next(flash_log_t *log, flash_log_reader_t *rd, uint8_t out[FLASH_LOG_PAGE_SIZE]);
+
+// ---- page decode (host tool 공용) ----
+
+// magic + CRC 검증 후 header decode. 유효하지 않으면 false.
+bool flash_log_page_decode(const uint8_t page[FLASH_LOG_PAGE_SIZE], flash_log_page_info_t *info);
+
+// idx번째 샘플 (decode 성공한 page에만 사용)
+void flash_log_page_sample(const uint8_t page[FLASH_LOG_PAGE_SIZE],
+                           const flash_log_page_info_t *info,
+                           uint16_t idx,
+                           tlm_sample_t *out);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // __FLASH_LOG_H__
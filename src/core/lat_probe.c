@@ -0,0 +1,207 @@
+// FILE: src/core/lat_probe.c
+#include "lat_probe.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "udp_arq.h" // ARQ framing 건너뛰기
+
+// ---------- internal helpers ----------
+
+static void put_u32(uint8_t *p, uint32_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+static uint32_t get_u32(const uint8_t *p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// 정렬된 표본에서 nearest-rank percentile
+static uint32_t rank(const uint32_t *v, uint32_t n, uint32_t pct) {
+    uint32_t r = (uint32_t)(((uint64_t)n * pct + 99u) / 100u);
+    if (r == 0) r = 1;
+    return v[r - 1u];
+}
+
+static const char *parse_dec_u32(const char *p, const char *end, uint32_t *out) {
+    uint64_t v = 0;
+    const char *s = p;
+    while (p < end && *p >= '0' && *p <= '9') {
+        v = v * 10u + (uint64_t)(*p - '0');
+        if (v > UINT32_MAX) return NULL;
+        p++;
+    }
+    if (p == s) return NULL;
+    *out = (uint32_t)v;
+    return p;
+}
+
+static const char *parse_hex_u32(const char *p, const char *end, uint32_t *out) {
+    uint64_t v = 0;
+    const char *s = p;
+    while (p < end) {
+        const char c = *p;
+        uint32_t d;
+        if (c >= '0' && c <= '9')      d = (uint32_t)(c - '0');
+        else if (c >= 'a' && c <= 'f') d = (uint32_t)(c - 'a' + 10);
+        else if (c >= 'A' && c <= 'F') d = (uint32_t)(c - 'A' + 10);
+        else break;
+        v = (v << 4) | d;
+        if (v > UINT32_MAX) return NULL;
+        p++;
+    }
+    if (p == s) return NULL;
+    *out = (uint32_t)v;
+    return p;
+}
+
+// ---------- public API ----------
+
+void lat_probe_init(lat_probe_t *lp, uint32_t boot_id, uint32_t timeout_ms) {
+    if (!lp) return;
+    memset(lp, 0, sizeof(*lp));
+    lp->boot_id    = boot_id;
+    lp->timeout_us = timeout_ms * 1000u;
+}
+
+void lat_probe_on_send(lat_probe_t *lp, uint32_t seq, uint32_t conv_end_us, uint32_t send_us) {
+    if (!lp) return;
+
+    lat_series_add(&lp->c2s, send_us - conv_end_us);
+
+    lat_pending_t *pd = &lp->pend[seq % LAT_PROBE_PENDING];
+    if (pd->used) lp->stats.lost++; // echo 없이 slot 재사용
+    pd->seq     = seq;
+    pd->send_us = send_us;
+    pd->used    = true;
+    lp->stats.probed++;
+}
+
+bool lat_probe_on_echo(lat_probe_t *lp, const uint8_t *pkt, size_t len, uint32_t rx_us) {
+    if (!lp) return false;
+    if (!lat_probe_is_echo(pkt, len) || get_u32(pkt + 8) != lp->boot_id) {
+        lp->stats.bad++;
+        return false;
+    }
+
+    const uint32_t seq = get_u32(pkt + 4);
+    lat_pending_t *pd = &lp->pend[seq % LAT_PROBE_PENDING];
+    if (!pd->used || pd->seq != seq) {
+        lp->stats.stray++;
+        return false;
+    }
+
+    pd->used = false;
+    lat_series_add(&lp->rtt, rx_us - pd->send_us);
+    lp->stats.echoed++;
+    return true;
+}
+
+void lat_probe_expire(lat_probe_t *lp, uint32_t now_us) {
+    if (!lp) return;
+    for (uint32_t i = 0; i < LAT_PROBE_PENDING; i++) {
+        lat_pending_t *pd = &lp->pend[i];
+        if (pd->used && now_us - pd->send_us > lp->timeout_us) {
+            pd->used = false;
+            lp->stats.lost++;
+        }
+    }
+}
+
+void lat_series_add(lat_series_t *s, uint32_t v) {
+    s->v[s->n % LAT_PROBE_WINDOW] = v;
+    s->n++;
+    if (v > s->max) s->max = v;
+}
+
+void lat_series_reset(lat_series_t *s) {
+    s->n   = 0;
+    s->max = 0;
+}
+
+void lat_series_summary(const lat_series_t *s, lat_summary_t *out) {
+    if (!out) return;
+    memset(out, 0, sizeof(*out));
+    if (!s || s->n == 0) return;
+
+    const uint32_t k = s->n < LAT_PROBE_WINDOW ? s->n : LAT_PROBE_WINDOW;
+    uint32_t v[LAT_PROBE_WINDOW];
+    memcpy(v, s->v, k * sizeof(v[0]));
+
+    // insertion sort (k <= LAT_PROBE_WINDOW, 보고 주기마다 1회)
+    for (uint32_t i = 1; i < k; i++) {
+        const uint32_t x = v[i];
+        uint32_t j = i;
+        while (j > 0 && v[j - 1u] > x) {
+            v[j] = v[j - 1u];
+            j--;
+        }
+        v[j] = x;
+    }
+
+    out->n   = s->n;
+    out->p50 = rank(v, k, 50);
+    out->p99 = rank(v, k, 99);
+    out->max = s->max;
+}
+
+size_t lat_probe_stats_line(lat_probe_t *lp, uint64_t now_ms, char *out, size_t out_sz) {
+    if (!lp || !out || out_sz == 0) return 0;
+
+    lat_summary_t c2s, rtt;
+    lat_series_summary(&lp->c2s, &c2s);
+    lat_series_summary(&lp->rtt, &rtt);
+
+    int n = snprintf(out, out_sz,
+                     "stat=lat,ms=%llu,probed=%lu,echoed=%lu,lost=%lu,stray=%lu,"
+                     "c2s_p50_us=%lu,c2s_p99_us=%lu,c2s_max_us=%lu,"
+                     "rtt_n=%lu,rtt_p50_us=%lu,rtt_p99_us=%lu,rtt_max_us=%lu\n",
+                     (unsigned long long)now_ms,
+                     (unsigned long)lp->stats.probed,
+                     (unsigned long)lp->stats.echoed,
+                     (unsigned long)lp->stats.lost,
+                     (unsigned long)lp->stats.stray,
+                     (unsigned long)c2s.p50, (unsigned long)c2s.p99, (unsigned long)c2s.max,
+                     (unsigned long)rtt.n,
+                     (unsigned long)rtt.p50, (unsigned long)rtt.p99, (unsigned long)rtt.max);
+    if (n <= 0 || (size_t)n >= out_sz) return 0;
+
+    lat_series_reset(&lp->c2s);
+    lat_series_reset(&lp->rtt);
+    return (size_t)n;
+}
+
+size_t lat_probe_make_echo(const uint8_t *dgram, size_t len, uint8_t out[LAT_ECHO_SIZE]) {
+    if (!dgram || !out) return 0;
+
+    if (arq_is_packet(dgram, len)) {
+        if (dgram[1] != ARQ_TYPE_DATA) return 0;
+        dgram += ARQ_HDR_SIZE;
+        len   -= ARQ_HDR_SIZE;
+    }
+
+    const char *p   = (const char *)dgram;
+    const char *end = p + len;
+    uint32_t seq = 0, boot = 0;
+
+    if (len < 4 || memcmp(p, "pkt=", 4) != 0) return 0;
+    p = parse_dec_u32(p + 4, end, &seq);
+    if (!p || end - p < 6 || memcmp(p, ",boot=", 6) != 0) return 0;
+    p = parse_hex_u32(p + 6, end, &boot);
+    if (!p) return 0;
+
+    out[0] = (uint8_t)LAT_ECHO_MAGIC;
+    out[1] = (uint8_t)LAT_ECHO_TYPE;
+    out[2] = 0;
+    out[3] = 0;
+    put_u32(out + 4, seq);
+    put_u32(out + 8, boot);
+    return LAT_ECHO_SIZE;
+}
+
+bool lat_probe_is_echo(const uint8_t *pkt, size_t len) {
+    return pkt && len >= LAT_ECHO_SIZE && pkt[0] == LAT_ECHO_MAGIC && pkt[1] == LAT_ECHO_TYPE;
+}
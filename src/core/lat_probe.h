@@ -0,0 +1,112 @@
+// FILE: src/core/lat_probe.h
+#ifndef __LAT_PROBE_H__
+#define __LAT_PROBE_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+// end-to-end latency 측정 (진단 모드): host가 datagram header의 seq를 echo
+//
+//   conv_end ──c2s──> udp_send ──rtt──> echo 수신
+//
+// - c2s: 압력 conversion 완료 -> net_udp_send 직전 (driver/보상/format/batch 대기)
+// - rtt: udp_send -> echo 도착 (Wi-Fi + lwIP + host 수신/응답, 양방향)
+// - 송신 측은 seq별 시각을 LAT_PROBE_PENDING개까지 보관, timeout 지나면 lost
+// - 통계는 보고 주기(window)마다 최근 LAT_PROBE_WINDOW개로 p50/p99, max는 window 전체
+//
+// echo wire format (little-endian, LAT_ECHO_SIZE)
+//   [0] u8 LAT_ECHO_MAGIC, [1] u8 LAT_ECHO_TYPE, [2] u16 0, [4] u32 pkt seq, [8] u32 boot_id
+//   (boot_id가 다르면 이전 boot의 echo -> 무시)
+
+#define LAT_ECHO_MAGIC      0xE5u
+#define LAT_ECHO_TYPE       0x01u
+#define LAT_ECHO_SIZE       12u
+
+#ifndef LAT_PROBE_PENDING
+#define LAT_PROBE_PENDING   32u     // echo 대기 중 datagram 수 (seq % N slot)
+#endif
+#ifndef LAT_PROBE_WINDOW
+#define LAT_PROBE_WINDOW    128u    // window당 percentile 표본 (넘치면 최근 것으로 덮어씀)
+#endif
+
+typedef struct {
+    uint32_t n;                     // window 전체 표본 수 (max 포함)
+    uint32_t max;
+    uint32_t v[LAT_PROBE_WINDOW];   // 최근 표본 (ring)
+} lat_series_t;
+
+typedef struct {
+    uint32_t probed;        // 측정 시작한 datagram
+    uint32_t echoed;        // echo로 rtt 측정 완료
+    uint32_t lost;          // timeout / slot 재사용으로 포기
+    uint32_t stray;         // 대기 중이 아닌 seq의 echo (중복, 늦음, 비측정 datagram)
+    uint32_t bad;           // 형식/boot 불일치
+} lat_probe_stats_t;
+
+typedef struct {
+    uint32_t seq;
+    uint32_t send_us;
+    bool     used;
+} lat_pending_t;
+
+typedef struct {
+    uint32_t boot_id;
+    uint32_t timeout_us;
+
+    lat_pending_t pend[LAT_PROBE_PENDING];
+    lat_series_t  c2s;
+    lat_series_t  rtt;
+
+    lat_probe_stats_t stats;
+} lat_probe_t;
+
+typedef struct {
+    uint32_t n;
+    uint32_t p50;
+    uint32_t p99;
+    uint32_t max;
+} lat_summary_t;
+
+void lat_probe_init(lat_probe_t *lp, uint32_t boot_id, uint32_t timeout_ms);
+
+// datagram(seq)이 conv_end_us에 변환된 샘플을 싣고 send_us에 송신됨 (시각은 32-bit us, wrap 허용)
+void lat_probe_on_send(lat_probe_t *lp, uint32_t seq, uint32_t conv_end_us, uint32_t send_us);
+
+// echo packet 처리 (rx_us: 수신 시각). rtt를 기록했으면 true
+bool lat_probe_on_echo(lat_probe_t *lp, const uint8_t *pkt, size_t len, uint32_t rx_us);
+
+// timeout 지난 대기 slot 정리
+void lat_probe_expire(lat_probe_t *lp, uint32_t now_us);
+
+// 표본 1개 추가 (window가 차면 가장 오래된 표본을 덮어씀)
+void lat_series_add(lat_series_t *s, uint32_t v);
+
+// window 초기화
+void lat_series_reset(lat_series_t *s);
+
+// series 요약 (p50/p99: window 표본 정렬, max: window 전체)
+void lat_series_summary(const lat_series_t *s, lat_summary_t *out);
+
+// "stat=lat,ms=..,probed=..,echoed=..,lost=..,c2s_p50_us=..,..,rtt_max_us=..\n"
+// window 초기화 (누적 카운터는 유지). 길이 리턴
+size_t lat_probe_stats_line(lat_probe_t *lp, uint64_t now_ms, char *out, size_t out_sz);
+
+// ---- responder (host collector / stand-in) ----
+
+// telemetry datagram(ARQ framing 허용)의 header 줄 "pkt=<seq>,boot=<hex>,..."로 echo 작성
+// header가 없으면 0
+size_t lat_probe_make_echo(const uint8_t *dgram, size_t len, uint8_t out[LAT_ECHO_SIZE]);
+
+// 첫 byte로 echo 여부 판별
+bool lat_probe_is_echo(const uint8_t *pkt, size_t len);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // __LAT_PROBE_H__
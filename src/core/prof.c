@@ -0,0 +1,121 @@
+// FILE: src/core/prof.c
+#include "prof.h"
+
+#include <stdio.h>
+#include <string.h>
+
+static const char *const k_stage_names[PROF_STAGE_COUNT] = {
+    "read", "i2c_cmd", "conv_wait", "adc_read", "comp", "fmt", "usb", "udp", "est", "loop",
+};
+
+const char *prof_stage_name(prof_stage_t stage) {
+    return ((unsigned)stage < PROF_STAGE_COUNT) ? k_stage_names[stage] : "?";
+}
+
+#if CFG_PROF_ENABLE
+
+static prof_clock_fn s_clock;
+static uint32_t      s_tick_hz = 1000000u;
+static prof_stat_t   s_stat[PROF_STAGE_COUNT];
+
+// ---------- internal helpers ----------
+
+static void reset_stat(prof_stat_t *s) {
+    memset(s, 0, sizeof(*s));
+    s->min = UINT32_MAX;
+}
+
+static uint32_t ticks_to_us(uint64_t ticks) {
+    return (uint32_t)((ticks * 1000000u) / s_tick_hz);
+}
+
+// histogram 기반 percentile (bucket 상한, 보수적)
+static uint32_t hist_pct(const prof_stat_t *s, uint32_t pct) {
+    if (s->n == 0) return 0;
+    const uint32_t want = (uint32_t)(((uint64_t)s->n * pct + 99u) / 100u);
+    uint32_t acc = 0;
+    for (uint32_t i = 0; i < PROF_HIST_BUCKETS; i++) {
+        acc += s->hist[i];
+        if (acc >= want) {
+            const uint64_t hi = (i >= 31u) ? UINT32_MAX : ((1ull << (i + 1u)) - 1u);
+            return ticks_to_us(hi < s->max ? hi : s->max);
+        }
+    }
+    return ticks_to_us(s->max);
+}
+
+// ---------- public API ----------
+
+void prof_init(prof_clock_fn clock, uint32_t tick_hz) {
+    s_clock   = clock;
+    s_tick_hz = tick_hz ? tick_hz : 1000000u;
+    for (uint32_t i = 0; i < PROF_STAGE_COUNT; i++) reset_stat(&s_stat[i]);
+}
+
+uint32_t prof_ts(void) {
+    return s_clock ? s_clock() : 0u;
+}
+
+void prof_add(prof_stage_t stage, uint32_t ticks) {
+    if ((unsigned)stage >= PROF_STAGE_COUNT) return;
+    prof_stat_t *s = &s_stat[stage];
+
+    s->n++;
+    s->sum += ticks;
+    if (ticks < s->min) s->min = ticks;
+    if (ticks > s->max) s->max = ticks;
+    s->hist[ticks ? 31u - (uint32_t)__builtin_clz(ticks) : 0u]++;
+}
+
+size_t prof_take(prof_stat_t out[PROF_STAGE_COUNT]) {
+    if (!out) return 0;
+    memcpy(out, s_stat, sizeof(s_stat));
+    for (uint32_t i = 0; i < PROF_STAGE_COUNT; i++) reset_stat(&s_stat[i]);
+    return PROF_STAGE_COUNT;
+}
+
+size_t prof_format_stage(char *out, size_t out_sz, const prof_stat_t *s, prof_stage_t stage, uint64_t now_ms) {
+    if (!out || !s || s->n == 0 || (unsigned)stage >= PROF_STAGE_COUNT) return 0;
+
+    int n = snprintf(out, out_sz,
+                     "stat=prof,ms=%llu,st=%s,n=%lu,min_us=%lu,mean_us=%lu,max_us=%lu,p50_us=%lu,p99_us=%lu",
+                     (unsigned long long)now_ms, k_stage_names[stage],
+                     (unsigned long)s->n,
+                     (unsigned long)ticks_to_us(s->min),
+                     (unsigned long)ticks_to_us(s->sum / s->n),
+                     (unsigned long)ticks_to_us(s->max),
+                     (unsigned long)hist_pct(s, 50),
+                     (unsigned long)hist_pct(s, 99));
+
+    // histogram: 첫~마지막 non-zero bucket
+    uint32_t lo = 0, hi = PROF_HIST_BUCKETS - 1u;
+    while (lo < hi && s->hist[lo] == 0) lo++;
+    while (hi > lo && s->hist[hi] == 0) hi--;
+    if (n > 0 && (size_t)n < out_sz) {
+        n += snprintf(out + n, out_sz - (size_t)n, ",h=%lu:", (unsigned long)lo);
+    }
+    for (uint32_t b = lo; b <= hi && n > 0 && (size_t)n < out_sz; b++) {
+        n += snprintf(out + n, out_sz - (size_t)n, b == lo ? "%lu" : "/%lu", (unsigned long)s->hist[b]);
+    }
+    if (n <= 0 || (size_t)n + 1 >= out_sz) return 0;
+    out[n++] = '\n';
+    return (size_t)n;
+}
+
+#else
+
+size_t prof_take(prof_stat_t out[PROF_STAGE_COUNT]) {
+    (void)out;
+    return 0;
+}
+
+size_t prof_format_stage(char *out, size_t out_sz, const prof_stat_t *s, prof_stage_t stage, uint64_t now_ms) {
+    (void)out;
+    (void)out_sz;
+    (void)s;
+    (void)stage;
+    (void)now_ms;
+    return 0;
+}
+
+#endif // CFG_PROF_ENABLE
@@ -0,0 +1,83 @@
+// FILE: src/core/prof.h
+#ifndef __PROF_H__
+#define __PROF_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+// per-stage latency profiling (acquisition loop)
+//
+// - 측정점: PROF_T0(t) ... PROF_END(PROF_xxx, t)  -> stage별 n/min/max/sum + log2 histogram
+// - tick source는 platform이 등록 (RP2350: DWT cycle counter, 없으면 us timer)
+// - CFG_PROF_ENABLE=0 (기본) 이면 측정점은 빈 문장 -> 코드/RAM 0
+//   firmware는 CMake option GY63_PROFILE로 켬
+// - 보고: prof_take로 window(마지막 보고 이후) 통계를 가져오고(초기화) prof_format_stage로 "stat=prof" 줄 생성
+
+#ifndef CFG_PROF_ENABLE
+#define CFG_PROF_ENABLE 0
+#endif
+
+typedef enum {
+    PROF_SENSOR_READ = 0,   // gy63_read 전체
+    PROF_I2C_CMD,           // conversion 시작 command (I2C write)
+    PROF_CONV_WAIT,         // conversion 대기
+    PROF_ADC_READ,          // ADC 24-bit read (I2C write+read)
+    PROF_COMPENSATE,        // 보상 계산
+    PROF_FORMAT,            // text serializer
+    PROF_USB_PRINT,         // USB stdio 로컬 로그
+    PROF_UDP_SEND,          // net_udp_send (pbuf alloc + lwIP)
+    PROF_ESTIMATE,          // 고도/수직속도 estimator update
+    PROF_LOOP_BUSY,         // loop 1회 중 대기 제외 구간
+    PROF_STAGE_COUNT
+} prof_stage_t;
+
+#define PROF_HIST_BUCKETS  (32u)    // bucket i: [2^i, 2^(i+1)) tick
+
+typedef struct {
+    uint32_t n;
+    uint32_t min;
+    uint32_t max;
+    uint64_t sum;
+    uint32_t hist[PROF_HIST_BUCKETS];
+} prof_stat_t;
+
+typedef uint32_t (*prof_clock_fn)(void);
+
+#if CFG_PROF_ENABLE
+
+void     prof_init(prof_clock_fn clock, uint32_t tick_hz);
+uint32_t prof_ts(void);
+void     prof_add(prof_stage_t stage, uint32_t ticks);
+
+#define PROF_T0(var)          const uint32_t var = prof_ts()
+#define PROF_END(stage, var)  prof_add((stage), prof_ts() - (var))
+
+#else
+
+static inline void prof_init(prof_clock_fn clock, uint32_t tick_hz) { (void)clock; (void)tick_hz; }
+
+#define PROF_T0(var)          do { } while (0)
+#define PROF_END(stage, var)  do { } while (0)
+
+#endif // CFG_PROF_ENABLE
+
+const char *prof_stage_name(prof_stage_t stage);
+
+// window 통계 복사 후 초기화 (비활성 빌드면 0 리턴)
+size_t prof_take(prof_stat_t out[PROF_STAGE_COUNT]);
+
+// health line 1줄 (n == 0 stage는 0 리턴)
+//   "stat=prof,ms=..,st=<name>,n=..,min_us=..,mean_us=..,max_us=..,p50_us=..,p99_us=..,h=<b0>:c/c/..\n"
+//   h: 첫 non-zero bucket 번호 + 마지막 non-zero bucket까지의 count (bucket i = [2^i, 2^(i+1)) tick)
+//   p50/p99: histogram bucket 상한 (max로 clamp) -> 보수적 추정
+size_t prof_format_stage(char *out, size_t out_sz, const prof_stat_t *s, prof_stage_t stage, uint64_t now_ms);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // __PROF_H__
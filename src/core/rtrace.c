@@ -0,0 +1,296 @@
+// FILE: src/core/rtrace.c
+#include "rtrace.h"
+
+#include <string.h>
+
+#include "crc32.h"
+
+#define REC_HDR_SIZE    (1u + 16u + 2u + 4u)
+#define REC_KEY_SIZE    (1u + 4u + 3u + 3u)
+#define REC_OSR_SIZE    (1u + 2u)
+#define REC_SAMPLE_MAX  (1u + 5u + 4u + 4u)
+#define REC_ERR_MAX     (1u + 4u + 5u)
+
+// ---------- internal helpers ----------
+
+static void put_u16(uint8_t *p, uint16_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
+
+static void put_u24(uint8_t *p, uint32_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+}
+
+static void put_u32(uint8_t *p, uint32_t v) {
+    put_u16(p, (uint16_t)v);
+    put_u16(p + 2, (uint16_t)(v >> 16));
+}
+
+static uint16_t get_u16(const uint8_t *p) {
+    return (uint16_t)(p[0] | ((uint16_t)p[1] << 8));
+}
+
+static uint32_t get_u24(const uint8_t *p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16);
+}
+
+static uint32_t get_u32(const uint8_t *p) {
+    return (uint32_t)get_u16(p) | ((uint32_t)get_u16(p + 2) << 16);
+}
+
+static uint32_t zigzag(int32_t v) {
+    return ((uint32_t)v << 1) ^ (uint32_t)(v >> 31);
+}
+
+static int32_t unzigzag(uint32_t v) {
+    return (int32_t)(v >> 1) ^ -(int32_t)(v & 1u);
+}
+
+static size_t put_varint(uint8_t *p, uint32_t v) {
+    size_t n = 0;
+    while (v >= 0x80u) {
+        p[n++] = (uint8_t)(v | 0x80u);
+        v >>= 7;
+    }
+    p[n++] = (uint8_t)v;
+    return n;
+}
+
+// 성공 시 소비한 byte 수, 잘림/과길이면 0
+static size_t get_varint(const uint8_t *p, size_t len, uint32_t *out) {
+    uint32_t v = 0;
+    for (size_t i = 0; i < len && i < 5; i++) {
+        v |= (uint32_t)(p[i] & 0x7Fu) << (7u * i);
+        if ((p[i] & 0x80u) == 0) {
+            *out = v;
+            return i + 1;
+        }
+    }
+    return 0;
+}
+
+static uint32_t chunk_crc(const uint8_t *c, uint16_t len) {
+    uint32_t crc = 0xFFFFFFFFu;
+    crc = crc32_update(crc, c, 12);
+    crc = crc32_update(crc, c + RTRACE_HDR_SIZE, len);
+    return ~crc;
+}
+
+static size_t find_magic(const uint8_t *buf, size_t len) {
+    for (size_t i = 1; i < len; i++) {
+        if (buf[i] == (uint8_t)RTRACE_MAGIC) return i;
+    }
+    return len;
+}
+
+static uint8_t *payload_end(rtrace_enc_t *e) {
+    return e->chunk + RTRACE_HDR_SIZE + e->len;
+}
+
+// chunk 첫 record 전: 필요하면 HDR
+static void begin_chunk(rtrace_enc_t *e) {
+    e->flags = 0;
+    e->keyed = false;
+    if (e->seq != 0 && (e->hdr_every == 0 || e->since_hdr < e->hdr_every)) return;
+
+    uint8_t *p = payload_end(e);
+    p[0] = RTRACE_TAG_HDR;
+    for (int i = 0; i < 8; i++) put_u16(p + 1 + 2 * i, e->prom[i]);
+    put_u16(p + 17, e->osr);
+    put_u32(p + 19, e->boot_id);
+    e->len      += REC_HDR_SIZE;
+    e->flags    |= RTRACE_F_HDR;
+    e->since_hdr = 0;
+}
+
+// ---------- public API ----------
+
+void rtrace_enc_init(rtrace_enc_t *e, const uint16_t prom[8], uint16_t osr, uint32_t boot_id, uint32_t hdr_every) {
+    if (!e) return;
+    memset(e, 0, sizeof(*e));
+    if (prom) memcpy(e->prom, prom, sizeof(e->prom));
+    e->osr       = osr;
+    e->boot_id   = boot_id;
+    e->hdr_every = hdr_every;
+}
+
+bool rtrace_enc_sample(rtrace_enc_t *e, uint32_t t_us, uint32_t d1, uint32_t d2, uint16_t osr) {
+    if (!e) return false;
+
+    const bool fresh = (e->len == 0);
+    const size_t need = (fresh ? REC_HDR_SIZE : 0u) + REC_KEY_SIZE + REC_SAMPLE_MAX + REC_OSR_SIZE;
+    if (e->len + need > RTRACE_PAYLOAD_MAX) return false;
+
+    if (fresh) begin_chunk(e);
+
+    uint8_t *p = payload_end(e);
+    size_t n = 0;
+    if (osr != e->osr) {
+        p[n++] = RTRACE_TAG_OSR;
+        put_u16(p + n, osr);
+        n += 2;
+        e->osr = osr;
+    }
+
+    if (!e->keyed) {
+        p[n++] = RTRACE_TAG_KEY;
+        put_u32(p + n, t_us);
+        put_u24(p + n + 4, d1);
+        put_u24(p + n + 7, d2);
+        n += 10;
+        e->keyed = true;
+    } else {
+        const bool with_d2 = (d2 != e->last_d2);
+        p[n++] = (uint8_t)(RTRACE_TAG_SAMPLE | (with_d2 ? 1u : 0u));
+        n += put_varint(p + n, t_us - e->last_us);
+        n += put_varint(p + n, zigzag((int32_t)(d1 - e->last_d1)));
+        if (with_d2) n += put_varint(p + n, zigzag((int32_t)(d2 - e->last_d2)));
+    }
+
+    e->len    += (uint16_t)n;
+    e->last_us = t_us;
+    e->last_d1 = d1;
+    e->last_d2 = d2;
+    e->samples++;
+    return true;
+}
+
+bool rtrace_enc_error(rtrace_enc_t *e, uint32_t t_us, int32_t status) {
+    if (!e) return false;
+
+    const bool fresh = (e->len == 0);
+    const size_t need = (fresh ? REC_HDR_SIZE : 0u) + REC_ERR_MAX;
+    if (e->len + need > RTRACE_PAYLOAD_MAX) return false;
+
+    if (fresh) begin_chunk(e);
+
+    uint8_t *p = payload_end(e);
+    p[0] = RTRACE_TAG_ERR;
+    put_u32(p + 1, t_us);
+    e->len += (uint16_t)(5u + put_varint(p + 5, zigzag(status)));
+    e->errors++;
+    return true;
+}
+
+size_t rtrace_enc_finish(rtrace_enc_t *e, const uint8_t **chunk) {
+    if (!e || e->len == 0) return 0;
+
+    uint8_t *c = e->chunk;
+    put_u32(c + 0, RTRACE_MAGIC);
+    put_u32(c + 4, e->seq);
+    put_u16(c + 8, e->len);
+    c[10] = (uint8_t)RTRACE_VERSION;
+    c[11] = e->flags;
+    put_u32(c + 12, chunk_crc(c, e->len));
+
+    const size_t len = RTRACE_HDR_SIZE + e->len;
+    if (chunk) *chunk = c;
+    e->seq++;
+    e->since_hdr++;
+    e->len   = 0;
+    e->keyed = false;
+    return len;
+}
+
+int32_t rtrace_parse(const uint8_t *buf, size_t len, rtrace_info_t *info) {
+    if (!buf || len < 4) return 0;
+
+    if (get_u32(buf) != RTRACE_MAGIC) return -(int32_t)find_magic(buf, len);
+    if (len < RTRACE_HDR_SIZE) return 0;
+
+    const uint16_t plen = get_u16(buf + 8);
+    if (plen == 0 || plen > RTRACE_PAYLOAD_MAX || buf[10] != RTRACE_VERSION) {
+        return -(int32_t)find_magic(buf, len);
+    }
+
+    const size_t clen = RTRACE_HDR_SIZE + plen;
+    if (len < clen) return 0;
+    if (get_u32(buf + 12) != chunk_crc(buf, plen)) return -(int32_t)find_magic(buf, len);
+
+    if (info) {
+        info->seq   = get_u32(buf + 4);
+        info->len   = plen;
+        info->flags = buf[11];
+    }
+    return (int32_t)clen;
+}
+
+int32_t rtrace_decode(const uint8_t *chunk, const rtrace_info_t *info, rtrace_ev_fn fn, void *user) {
+    if (!chunk || !info || !fn) return -1;
+
+    const uint8_t *p   = chunk + RTRACE_HDR_SIZE;
+    const uint8_t *end = p + info->len;
+    bool have_key = false;
+    uint32_t t = 0, d1 = 0, d2 = 0;
+    int32_t events = 0;
+
+    while (p < end) {
+        const uint8_t tag = *p++;
+        const size_t left = (size_t)(end - p);
+        rtrace_ev_t ev;
+        memset(&ev, 0, sizeof(ev));
+
+        if (tag == RTRACE_TAG_HDR) {
+            if (left < REC_HDR_SIZE - 1u) return -1;
+            ev.kind = RTRACE_EV_HDR;
+            for (int i = 0; i < 8; i++) ev.prom[i] = get_u16(p + 2 * i);
+            ev.osr     = get_u16(p + 16);
+            ev.boot_id = get_u32(p + 18);
+            p += REC_HDR_SIZE - 1u;
+        } else if (tag == RTRACE_TAG_OSR) {
+            if (left < 2) return -1;
+            ev.kind = RTRACE_EV_OSR;
+            ev.osr  = get_u16(p);
+            p += 2;
+        } else if (tag == RTRACE_TAG_ERR) {
+            uint32_t zz = 0;
+            if (left < 5) return -1;
+            const size_t n = get_varint(p + 4, left - 4, &zz);
+            if (n == 0) return -1;
+            ev.kind   = RTRACE_EV_ERR;
+            ev.t_us   = get_u32(p);
+            ev.status = unzigzag(zz);
+            p += 4 + n;
+        } else if (tag == RTRACE_TAG_KEY) {
+            if (left < REC_KEY_SIZE - 1u) return -1;
+            t  = get_u32(p);
+            d1 = get_u24(p + 4);
+            d2 = get_u24(p + 7);
+            have_key = true;
+            p += REC_KEY_SIZE - 1u;
+            ev.kind = RTRACE_EV_SAMPLE;
+        } else if ((tag & 0xFEu) == RTRACE_TAG_SAMPLE) {
+            if (!have_key) return -1;
+            uint32_t v = 0;
+            size_t n = get_varint(p, (size_t)(end - p), &v);
+            if (n == 0) return -1;
+            t += v;
+            p += n;
+            n = get_varint(p, (size_t)(end - p), &v);
+            if (n == 0) return -1;
+            d1 += (uint32_t)unzigzag(v);
+            p += n;
+            if (tag & 1u) {
+                n = get_varint(p, (size_t)(end - p), &v);
+                if (n == 0) return -1;
+                d2 += (uint32_t)unzigzag(v);
+                p += n;
+            }
+            ev.kind = RTRACE_EV_SAMPLE;
+        } else {
+            return -1;
+        }
+
+        if (ev.kind == RTRACE_EV_SAMPLE) {
+            ev.t_us = t;
+            ev.d1   = d1;
+            ev.d2   = d2;
+        }
+        events++;
+        if (!fn(&ev, user)) break;
+    }
+    return events;
+}
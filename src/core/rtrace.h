@@ -0,0 +1,121 @@
+// FILE: src/core/rtrace.h
+#ifndef __RTRACE_H__
+#define __RTRACE_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+// raw trace: PROM + raw D1/D2 + timestamp (보상 전 값 -> host에서 같은 보상/필터/포맷을 결정적으로 재실행)
+//
+// chunk format (little-endian, tlm_bin과 같은 framing 방식)
+//   [0]  u32 magic      RTRACE_MAGIC
+//   [4]  u32 seq        chunk 번호 (boot마다 0부터, host에서 유실 검출)
+//   [8]  u16 len        payload byte 수
+//   [10] u8  version    RTRACE_VERSION
+//   [11] u8  flags      RTRACE_F_HDR: payload에 HDR record 포함
+//   [12] u32 crc32      [0..12) + payload 의 CRC-32
+//   [16] payload        record 열
+//
+// record (tag byte + 내용)
+//   HDR    0xF0  u16 prom[8], u16 osr, u32 boot_id           (첫 chunk + hdr_every chunk마다)
+//   KEY    0xF1  u32 t_us, u24 D1, u24 D2                    (chunk의 첫 sample: 절대값)
+//   OSR    0xF2  u16 osr                                    (변경 시)
+//   ERR    0xF3  u32 t_us, varint zigzag(status)             (측정 실패, delta 기준은 바꾸지 않음)
+//   SAMPLE 0x00 | 0x01  varint dt_us, varint zigzag(dD1) [, varint zigzag(dD2) if tag bit0]
+//          (직전 sample/KEY 대비 delta. D2가 같으면 생략 -> burst 모드에서 대부분 생략)
+// - chunk마다 KEY로 시작 -> chunk 하나가 유실/손상돼도 다음 chunk부터 그대로 복원
+// - 정지 구간 sample ~5 byte (raw 11 byte + timestamp 대비)
+
+#define RTRACE_MAGIC        0x54525947u // "GYRT"
+#define RTRACE_VERSION      (1u)
+#define RTRACE_HDR_SIZE     (16u)
+#define RTRACE_CHUNK_MAX    (512u)
+#define RTRACE_PAYLOAD_MAX  (RTRACE_CHUNK_MAX - RTRACE_HDR_SIZE)
+
+#define RTRACE_F_HDR        (0x01u)
+
+enum {
+    RTRACE_TAG_SAMPLE = 0x00,
+    RTRACE_TAG_HDR    = 0xF0,
+    RTRACE_TAG_KEY    = 0xF1,
+    RTRACE_TAG_OSR    = 0xF2,
+    RTRACE_TAG_ERR    = 0xF3,
+};
+
+typedef struct {
+    uint8_t  chunk[RTRACE_CHUNK_MAX];
+    uint16_t len;           // payload byte
+    uint8_t  flags;
+    bool     keyed;         // 현재 chunk에 KEY 기록됨
+    uint32_t seq;           // 다음 chunk seq
+
+    uint16_t prom[8];
+    uint16_t osr;           // 마지막 기록 OSR
+    uint32_t boot_id;
+    uint32_t hdr_every;     // HDR 반복 주기 (chunk)
+    uint32_t since_hdr;
+
+    uint32_t last_us;
+    uint32_t last_d1;
+    uint32_t last_d2;
+
+    uint32_t samples;
+    uint32_t errors;
+} rtrace_enc_t;
+
+typedef enum {
+    RTRACE_EV_HDR = 1,
+    RTRACE_EV_SAMPLE,
+    RTRACE_EV_OSR,
+    RTRACE_EV_ERR,
+} rtrace_ev_kind_t;
+
+typedef struct {
+    rtrace_ev_kind_t kind;
+    uint32_t t_us;
+    uint32_t d1;
+    uint32_t d2;
+    int32_t  status;        // ERR
+    uint16_t osr;           // HDR / OSR
+    uint16_t prom[8];       // HDR
+    uint32_t boot_id;       // HDR
+} rtrace_ev_t;
+
+typedef struct {
+    uint32_t seq;
+    uint16_t len;           // payload
+    uint8_t  flags;
+} rtrace_info_t;
+
+// ---- encode (firmware) ----
+
+void rtrace_enc_init(rtrace_enc_t *e, const uint16_t prom[8], uint16_t osr, uint32_t boot_id, uint32_t hdr_every);
+
+// 공간이 없으면 false (finish 후 다시). osr이 바뀌었으면 OSR record 먼저
+bool rtrace_enc_sample(rtrace_enc_t *e, uint32_t t_us, uint32_t d1, uint32_t d2, uint16_t osr);
+bool rtrace_enc_error(rtrace_enc_t *e, uint32_t t_us, int32_t status);
+
+// header/CRC 채우고 chunk 길이 리턴 (*chunk = 내부 버퍼, 다음 add 전까지 유효). 비어 있으면 0
+size_t rtrace_enc_finish(rtrace_enc_t *e, const uint8_t **chunk);
+
+static inline bool rtrace_enc_empty(const rtrace_enc_t *e) { return e->len == 0; }
+
+// ---- decode (host) ----
+
+// buf 앞에서 chunk 1개 검증 (>0: 길이, 0: byte 더 필요, <0: -n byte 버리고 재동기)
+int32_t rtrace_parse(const uint8_t *buf, size_t len, rtrace_info_t *info);
+
+// 검증된 chunk의 record -> fn (false 리턴 시 중단). 처리한 event 수, 형식 오류면 <0
+typedef bool (*rtrace_ev_fn)(const rtrace_ev_t *ev, void *user);
+int32_t rtrace_decode(const uint8_t *chunk, const rtrace_info_t *info, rtrace_ev_fn fn, void *user);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // __RTRACE_H__
@@ -0,0 +1,125 @@
+// FILE: src/core/tlm_bin.c
+#include "tlm_bin.h"
+
+#include <string.h>
+
+#include "crc32.h"
+
+// ---------- internal helpers ----------
+
+static void put_u16(uint8_t *p, uint16_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
+
+static void put_u32(uint8_t *p, uint32_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+static void put_u64(uint8_t *p, uint64_t v) {
+    put_u32(p, (uint32_t)v);
+    put_u32(p + 4, (uint32_t)(v >> 32));
+}
+
+static uint16_t get_u16(const uint8_t *p) {
+    return (uint16_t)(p[0] | ((uint16_t)p[1] << 8));
+}
+
+static uint32_t get_u32(const uint8_t *p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint64_t get_u64(const uint8_t *p) {
+    return (uint64_t)get_u32(p) | ((uint64_t)get_u32(p + 4) << 32);
+}
+
+static uint32_t frame_crc(const uint8_t *f, uint16_t count) {
+    uint32_t crc = 0xFFFFFFFFu;
+    crc = crc32_update(crc, f, 20);
+    crc = crc32_update(crc, f + TLM_BIN_HDR_SIZE, (size_t)count * TLM_BIN_REC_SIZE);
+    return ~crc;
+}
+
+// magic 첫 byte 후보 위치 (없으면 len)
+static size_t find_magic(const uint8_t *buf, size_t len) {
+    for (size_t i = 1; i < len; i++) {
+        if (buf[i] == (uint8_t)TLM_BIN_MAGIC) return i;
+    }
+    return len;
+}
+
+// ---------- public API ----------
+
+void tlm_bin_init(tlm_bin_enc_t *e) {
+    if (!e) return;
+    memset(e, 0, sizeof(*e));
+}
+
+bool tlm_bin_add(tlm_bin_enc_t *e, const tlm_sample_t *s) {
+    if (!e || !s || e->count >= TLM_BIN_MAX_BATCH) return false;
+
+    if (e->count == 0) e->base_ms = s->ms;
+    const uint64_t dms = s->ms - e->base_ms;
+    if (s->ms < e->base_ms || dms > 0xFFFFFFFFull) return false;
+
+    uint8_t *r = e->frame + TLM_BIN_HDR_SIZE + (size_t)e->count * TLM_BIN_REC_SIZE;
+    put_u32(r + 0, (uint32_t)dms);
+    put_u32(r + 4, (uint32_t)s->t_x100);
+    put_u32(r + 8, s->p_pa);
+    e->count++;
+    return true;
+}
+
+size_t tlm_bin_finish(tlm_bin_enc_t *e, const uint8_t **frame) {
+    if (!e || e->count == 0) return 0;
+
+    uint8_t *f = e->frame;
+    put_u32(f + 0, TLM_BIN_MAGIC);
+    put_u32(f + 4, e->seq);
+    put_u64(f + 8, e->base_ms);
+    put_u16(f + 16, e->count);
+    put_u16(f + 18, (uint16_t)TLM_BIN_REC_SIZE);
+    put_u32(f + 20, frame_crc(f, e->count));
+
+    const size_t len = TLM_BIN_HDR_SIZE + (size_t)e->count * TLM_BIN_REC_SIZE;
+    if (frame) *frame = f;
+    e->seq++;
+    e->count = 0;
+    return len;
+}
+
+int32_t tlm_bin_parse(const uint8_t *buf, size_t len, tlm_bin_info_t *info) {
+    if (!buf || len < 4) return 0;
+
+    if (get_u32(buf) != TLM_BIN_MAGIC) return -(int32_t)find_magic(buf, len);
+    if (len < TLM_BIN_HDR_SIZE) return 0;
+
+    const uint16_t count    = get_u16(buf + 16);
+    const uint16_t rec_size = get_u16(buf + 18);
+    if (count == 0 || count > TLM_BIN_MAX_BATCH || rec_size != TLM_BIN_REC_SIZE) {
+        return -(int32_t)find_magic(buf, len);
+    }
+
+    const size_t flen = TLM_BIN_HDR_SIZE + (size_t)count * TLM_BIN_REC_SIZE;
+    if (len < flen) return 0;
+    if (get_u32(buf + 20) != frame_crc(buf, count)) return -(int32_t)find_magic(buf, len);
+
+    if (info) {
+        info->seq     = get_u32(buf + 4);
+        info->base_ms = get_u64(buf + 8);
+        info->count   = count;
+    }
+    return (int32_t)flen;
+}
+
+void tlm_bin_sample(const uint8_t *frame, const tlm_bin_info_t *info, uint16_t idx, tlm_sample_t *out) {
+    if (!frame || !info || !out || idx >= info->count) return;
+
+    const uint8_t *r = frame + TLM_BIN_HDR_SIZE + (size_t)idx * TLM_BIN_REC_SIZE;
+    out->ms     = info->base_ms + get_u32(r + 0);
+    out->t_x100 = (int32_t)get_u32(r + 4);
+    out->p_pa   = get_u32(r + 8);
+}
@@ -0,0 +1,71 @@
+// FILE: src/core/tlm_bin.h
+#ifndef __TLM_BIN_H__
+#define __TLM_BIN_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "tlm_buffer.h" // tlm_sample_t
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+// binary sample batch frame (USB bulk 등 byte stream / UDP datagram 공용)
+//
+// frame format (little-endian)
+//   [0]  u32 magic      TLM_BIN_MAGIC
+//   [4]  u32 seq        frame 번호 (boot마다 0부터, host에서 유실 검출)
+//   [8]  u64 base_ms    첫 샘플 시각 (ms since boot)
+//   [16] u16 count      샘플 수 (<= TLM_BIN_MAX_BATCH)
+//   [18] u16 rec_size   TLM_BIN_REC_SIZE
+//   [20] u32 crc32      [0..20) + records 의 CRC-32
+//   [24] record[count]  u32 dms (base_ms 기준), i32 t_x100, u32 p_pa  (flash log record와 같음)
+//
+// byte stream에서는 magic으로 frame 경계를 찾고 CRC로 확인 (중간부터 읽어도 재동기)
+
+#define TLM_BIN_MAGIC       0x53425947u // "GYBS"
+#define TLM_BIN_HDR_SIZE    24u
+#define TLM_BIN_REC_SIZE    12u
+#define TLM_BIN_MAX_BATCH   64u
+#define TLM_BIN_FRAME_MAX   (TLM_BIN_HDR_SIZE + TLM_BIN_MAX_BATCH * TLM_BIN_REC_SIZE)
+
+typedef struct {
+    uint8_t  frame[TLM_BIN_FRAME_MAX];
+    uint16_t count;
+    uint64_t base_ms;
+    uint32_t seq;       // 다음 frame seq
+} tlm_bin_enc_t;
+
+typedef struct {
+    uint32_t seq;
+    uint64_t base_ms;
+    uint16_t count;
+} tlm_bin_info_t;
+
+void tlm_bin_init(tlm_bin_enc_t *e);
+
+// 샘플 추가. 가득 찼거나 base_ms와 2^32 ms 이상 떨어져 있으면 false (finish 후 다시)
+bool tlm_bin_add(tlm_bin_enc_t *e, const tlm_sample_t *s);
+
+// header/CRC 채우고 frame 길이 리턴 (*frame = 내부 버퍼, 다음 add 전까지 유효). 비어 있으면 0
+// seq 소모 + batch 초기화
+size_t tlm_bin_finish(tlm_bin_enc_t *e, const uint8_t **frame);
+
+// ---- decode (host reader) ----
+
+// buf 앞에서 frame 1개 검증
+//   >0: 유효 frame 길이 (info 채움)
+//    0: 판단에 byte가 더 필요
+//   <0: 앞의 -n byte는 frame 시작이 아님 -> 버리고 다시 (재동기)
+int32_t tlm_bin_parse(const uint8_t *buf, size_t len, tlm_bin_info_t *info);
+
+// idx번째 샘플 (parse 성공한 frame에만 사용)
+void tlm_bin_sample(const uint8_t *frame, const tlm_bin_info_t *info, uint16_t idx, tlm_sample_t *out);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // __TLM_BIN_H__
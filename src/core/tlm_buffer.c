@@ -0,0 +1,132 @@
+// FILE: src/core/tlm_buffer.c
+#include "tlm_buffer.h"
+
+#include <string.h>
+
+// ---------- internal helpers ----------
+
+static uint32_t slot_index(const tlm_buffer_t *b, uint32_t offset) {
+    uint32_t i = b->head + offset;
+    if (i >= b->capacity) i -= b->capacity;
+    return i;
+}
+
+static void pop_oldest(tlm_buffer_t *b) {
+    b->head = slot_index(b, 1);
+    b->count--;
+}
+
+static void evict_oldest(tlm_buffer_t *b) {
+    const tlm_sample_t *old = &b->slots[b->head];
+
+    if (b->spill_fn && b->spill_fn(old, b->spill_user)) b->stats.spilled++;
+    else                                                b->stats.dropped++;
+
+    pop_oldest(b);
+}
+
+// ---------- public API ----------
+
+void tlm_buffer_init(tlm_buffer_t *b,
+                     tlm_sample_t *storage,
+                     uint32_t capacity,
+                     uint32_t backfill_period_ms,
+                     uint32_t backfill_burst) {
+    if (!b) return;
+
+    memset(b, 0, sizeof(*b));
+    b->slots              = storage;
+    b->capacity           = storage ? capacity : 0;
+    b->backfill_period_ms = backfill_period_ms;
+    b->backfill_burst     = backfill_burst ? backfill_burst : 1;
+
+    b->stats.capacity = b->capacity;
+}
+
+void tlm_buffer_set_spill(tlm_buffer_t *b, tlm_spill_fn fn, void *user) {
+    if (!b) return;
+    b->spill_fn   = fn;
+    b->spill_user = user;
+}
+
+void tlm_buffer_push(tlm_buffer_t *b, const tlm_sample_t *s) {
+    if (!b || !s) return;
+
+    if (b->capacity == 0) {
+        // 저장소 없음: spill만 시도
+        if (b->spill_fn && b->spill_fn(s, b->spill_user)) b->stats.spilled++;
+        else                                              b->stats.dropped++;
+        return;
+    }
+
+    if (b->count == b->capacity) evict_oldest(b);
+
+    b->slots[slot_index(b, b->count)] = *s;
+    b->count++;
+    b->stats.buffered++;
+
+    if (b->count > b->stats.depth_max) b->stats.depth_max = b->count;
+}
+
+bool tlm_buffer_offer_live(tlm_buffer_t *b,
+                           const tlm_sample_t *s,
+                           bool link_up,
+                           tlm_send_fn send_fn,
+                           void *user) {
+    if (!b || !s || !send_fn) return false;
+
+    if (link_up && send_fn(s, user)) {
+        b->stats.sent_live++;
+        return true;
+    }
+
+    tlm_buffer_push(b, s);
+    return false;
+}
+
+void tlm_buffer_live_failed(tlm_buffer_t *b, const tlm_sample_t *s, uint32_t n) {
+    if (!b || !s) return;
+
+    for (uint32_t i = 0; i < n; i++) {
+        if (b->stats.sent_live > 0) b->stats.sent_live--;
+        tlm_buffer_push(b, &s[i]);
+    }
+}
+
+uint32_t tlm_buffer_service(tlm_buffer_t *b,
+                            uint64_t now_ms,
+                            bool link_up,
+                            tlm_send_fn send_fn,
+                            void *user) {
+    if (!b || !send_fn) return 0;
+    if (!link_up || b->count == 0) return 0;
+    if ((int64_t)(now_ms - b->next_backfill_ms) < 0) return 0;
+
+    uint32_t sent = 0;
+    while (sent < b->backfill_burst && b->count > 0) {
+        if (!send_fn(&b->slots[b->head], user)) break; // 링크 불안정: 다음 주기에 재시도
+        pop_oldest(b);
+        sent++;
+    }
+
+    b->stats.sent_backfill += sent;
+    b->next_backfill_ms = now_ms + (uint64_t)b->backfill_period_ms;
+    return sent;
+}
+
+uint32_t tlm_buffer_depth(const tlm_buffer_t *b) {
+    return b ? b->count : 0;
+}
+
+void tlm_buffer_get_stats(const tlm_buffer_t *b, uint64_t now_ms, tlm_buffer_stats_t *out) {
+    if (!b || !out) return;
+
+    *out = b->stats;
+    out->depth  = b->count;
+    out->lag_ms = 0;
+
+    if (b->count > 0) {
+        const uint64_t oldest = b->slots[b->head].ms;
+        if (now_ms > oldest) out->lag_ms = now_ms - oldest;
+    }
+}
@@ -0,0 +1,99 @@
+// FILE: src/core/tlm_buffer.h
+#ifndef __TLM_BUFFER_H__
+#define __TLM_BUFFER_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+// 송신 단위 샘플 (텍스트 포맷 이전의 원시 값)
+typedef struct {
+    uint64_t ms;
+    int32_t  t_x100;
+    uint32_t p_pa;
+} tlm_sample_t;
+
+// 샘플 1개 송신. true면 전송 성공 (false면 링크 다운/ pbuf 부족 등)
+typedef bool (*tlm_send_fn)(const tlm_sample_t *s, void *user);
+
+// 버퍼가 가득 찼을 때 밀려나는 가장 오래된 샘플을 받는 sink (예: flash).
+// true를 리턴하면 spilled로, false면 dropped로 집계.
+typedef bool (*tlm_spill_fn)(const tlm_sample_t *s, void *user);
+
+typedef struct {
+    uint32_t depth;          // 현재 적재 수
+    uint32_t depth_max;      // 최대 적재 수 (high-water mark)
+    uint32_t capacity;
+
+    uint32_t sent_live;
+    uint32_t sent_backfill;
+    uint32_t buffered;       // live 송신 실패로 적재된 수
+    uint32_t spilled;        // overflow -> spill sink 성공
+    uint32_t dropped;        // overflow -> 유실
+
+    uint64_t lag_ms;         // now - 가장 오래된 미송신 샘플 시각 (비어 있으면 0)
+} tlm_buffer_stats_t;
+
+typedef struct {
+    // ring storage (caller 소유)
+    tlm_sample_t *slots;
+    uint32_t capacity;
+    uint32_t head;           // 가장 오래된 샘플 index
+    uint32_t count;
+
+    // backfill rate limit: period마다 최대 burst개
+    uint32_t backfill_period_ms;
+    uint32_t backfill_burst;
+    uint64_t next_backfill_ms;
+
+    tlm_spill_fn spill_fn;
+    void *spill_user;
+
+    tlm_buffer_stats_t stats;
+} tlm_buffer_t;
+
+void tlm_buffer_init(tlm_buffer_t *b,
+                     tlm_sample_t *storage,
+                     uint32_t capacity,
+                     uint32_t backfill_period_ms,
+                     uint32_t backfill_burst);
+
+void tlm_buffer_set_spill(tlm_buffer_t *b, tlm_spill_fn fn, void *user);
+
+// 적재 (가득 차면 가장 오래된 샘플을 spill 또는 drop)
+void tlm_buffer_push(tlm_buffer_t *b, const tlm_sample_t *s);
+
+// live 샘플 처리: 바로 송신, 실패 시 버퍼에 적재.
+// link_up=false면 송신 시도 없이 적재. 송신 성공 시 true.
+bool tlm_buffer_offer_live(tlm_buffer_t *b,
+                           const tlm_sample_t *s,
+                           bool link_up,
+                           tlm_send_fn send_fn,
+                           void *user);
+
+// offer_live에서 인계(sent_live 집계)된 샘플을 나중에 실제로 못 보냄 (batch 송신 실패 등):
+// sent_live에서 빼고 backlog로 적재 (backfill 때 sent_backfill로 한 번만 집계)
+void tlm_buffer_live_failed(tlm_buffer_t *b, const tlm_sample_t *s, uint32_t n);
+
+// backlog 배출 (live 이후에 호출). rate limit 내에서 오래된 순으로 송신,
+// 첫 실패에서 중단. 이번 호출에서 송신한 개수 리턴.
+uint32_t tlm_buffer_service(tlm_buffer_t *b,
+                            uint64_t now_ms,
+                            bool link_up,
+                            tlm_send_fn send_fn,
+                            void *user);
+
+uint32_t tlm_buffer_depth(const tlm_buffer_t *b);
+
+// stats 스냅샷 (lag_ms는 now_ms 기준으로 계산)
+void tlm_buffer_get_stats(const tlm_buffer_t *b, uint64_t now_ms, tlm_buffer_stats_t *out);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // __TLM_BUFFER_H__
@@ -0,0 +1,137 @@
+// FILE: src/core/tlm_fmt.c
+#include "tlm_fmt.h"
+
+#include <string.h>
+
+// ---------- internal helpers ----------
+
+static const char k_pairs[200] = {
+    '0','0','0','1','0','2','0','3','0','4','0','5','0','6','0','7','0','8','0','9',
+    '1','0','1','1','1','2','1','3','1','4','1','5','1','6','1','7','1','8','1','9',
+    '2','0','2','1','2','2','2','3','2','4','2','5','2','6','2','7','2','8','2','9',
+    '3','0','3','1','3','2','3','3','3','4','3','5','3','6','3','7','3','8','3','9',
+    '4','0','4','1','4','2','4','3','4','4','4','5','4','6','4','7','4','8','4','9',
+    '5','0','5','1','5','2','5','3','5','4','5','5','5','6','5','7','5','8','5','9',
+    '6','0','6','1','6','2','6','3','6','4','6','5','6','6','6','7','6','8','6','9',
+    '7','0','7','1','7','2','7','3','7','4','7','5','7','6','7','7','7','8','7','9',
+    '8','0','8','1','8','2','8','3','8','4','8','5','8','6','8','7','8','8','8','9',
+    '9','0','9','1','9','2','9','3','9','4','9','5','9','6','9','7','9','8','9','9',
+};
+
+static uint32_t digits_u32(uint32_t v) {
+    if (v < 10u)         return 1;
+    if (v < 100u)        return 2;
+    if (v < 1000u)       return 3;
+    if (v < 10000u)      return 4;
+    if (v < 100000u)     return 5;
+    if (v < 1000000u)    return 6;
+    if (v < 10000000u)   return 7;
+    if (v < 100000000u)  return 8;
+    if (v < 1000000000u) return 9;
+    return 10;
+}
+
+// 끝에서부터 2자리씩 (end = 마지막 digit 다음 위치)
+static void write_u32_back(char *end, uint32_t v) {
+    while (v >= 100u) {
+        const uint32_t q = v / 100u;
+        const uint32_t r = (v - q * 100u) * 2u;
+        end -= 2;
+        end[0] = k_pairs[r];
+        end[1] = k_pairs[r + 1];
+        v = q;
+    }
+    if (v >= 10u) {
+        end -= 2;
+        end[0] = k_pairs[v * 2u];
+        end[1] = k_pairs[v * 2u + 1];
+    } else {
+        *--end = (char)('0' + v);
+    }
+}
+
+// 정확히 8자리 (앞 0 채움)
+static void write_8(char *out, uint32_t v) {
+    for (int i = 6; i >= 0; i -= 2) {
+        const uint32_t q = v / 100u;
+        const uint32_t r = (v - q * 100u) * 2u;
+        out[i]     = k_pairs[r];
+        out[i + 1] = k_pairs[r + 1];
+        v = q;
+    }
+}
+
+// ---------- public API ----------
+
+size_t tlm_fmt_u32(char *out, uint32_t v) {
+    const uint32_t n = digits_u32(v);
+    write_u32_back(out + n, v);
+    return n;
+}
+
+size_t tlm_fmt_u64(char *out, uint64_t v) {
+    if (v <= UINT32_MAX) return tlm_fmt_u32(out, (uint32_t)v);
+
+    // 8자리 단위로 분할: hi (<= 12자리) | lo (8자리, 앞 0 채움)
+    const uint64_t hi  = v / 100000000u;
+    const uint32_t lo  = (uint32_t)(v - hi * 100000000u);
+    size_t n;
+    if (hi <= UINT32_MAX) {
+        n = tlm_fmt_u32(out, (uint32_t)hi);
+    } else {
+        const uint32_t top = (uint32_t)(hi / 100000000u);    // <= 1844
+        const uint32_t mid = (uint32_t)(hi - (uint64_t)top * 100000000u);
+        n = tlm_fmt_u32(out, top);
+        write_8(out + n, mid);
+        n += 8;
+    }
+    write_8(out + n, lo);
+    return n + 8;
+}
+
+size_t tlm_fmt_i32(char *out, int32_t v) {
+    if (v >= 0) return tlm_fmt_u32(out, (uint32_t)v);
+    out[0] = '-';
+    return 1 + tlm_fmt_u32(out + 1, 0u - (uint32_t)v);
+}
+
+size_t tlm_fmt_x100(char *out, int32_t v) {
+    size_t n = 0;
+    uint32_t a = (uint32_t)v;
+    if (v < 0) {
+        out[n++] = '-';
+        a = 0u - a;
+    }
+    const uint32_t ip = a / 100u;
+    const uint32_t fp = (a - ip * 100u) * 2u;
+
+    n += tlm_fmt_u32(out + n, ip);
+    out[n++] = '.';
+    out[n++] = k_pairs[fp];
+    out[n++] = k_pairs[fp + 1];
+    return n;
+}
+
+size_t tlm_fmt_sample(char *out, size_t out_sz, const tlm_sample_t *s) {
+    if (!out || !s) return 0;
+
+    char tmp[TLM_FMT_SAMPLE_MAX];
+    char *p = (out_sz >= TLM_FMT_SAMPLE_MAX) ? out : tmp; // 작은 buffer면 임시로 만든 뒤 복사
+
+    size_t n = 0;
+    memcpy(p + n, "ms=", 3);
+    n += 3;
+    n += tlm_fmt_u64(p + n, s->ms);
+    memcpy(p + n, ",t_x100=", 8);
+    n += 8;
+    n += tlm_fmt_i32(p + n, s->t_x100);
+    memcpy(p + n, ",p_pa=", 6);
+    n += 6;
+    n += tlm_fmt_u32(p + n, s->p_pa);
+    p[n++] = '\n';
+
+    if (n >= out_sz) return 0; // snprintf 기준: NUL 자리까지 필요
+    if (p == tmp) memcpy(out, tmp, n);
+    out[n] = '\0';
+    return n;
+}
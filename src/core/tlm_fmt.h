@@ -0,0 +1,42 @@
+// FILE: src/core/tlm_fmt.h
+#ifndef __TLM_FMT_H__
+#define __TLM_FMT_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "tlm_buffer.h" // tlm_sample_t
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+// telemetry text serializer (snprintf 대체, heap/float/locale 없음)
+//
+// - 정수 -> 10진: 2자리씩 digit-pair table (나눗셈 횟수 절반, 분기 최소)
+// - u64는 UINT32_MAX 이하면 32-bit 경로 (M33에서 64-bit 나눗셈 = library call)
+// - 출력은 snprintf와 byte 단위로 동일:
+//     tlm_fmt_sample : "ms=%llu,t_x100=%ld,p_pa=%u\n"
+//     tlm_fmt_x100   : "%.2f" of (double)v / 100.0   (x100 고정소수점이라 반올림 없음)
+//
+// tlm_fmt_u32/u64/i32/x100는 NUL을 쓰지 않음, 쓴 byte 수 리턴. out은 최대 길이만큼 여유 필요.
+
+#define TLM_FMT_U32_MAX     (10u)
+#define TLM_FMT_U64_MAX     (20u)
+#define TLM_FMT_I32_MAX     (11u)
+#define TLM_FMT_X100_MAX    (12u)   // "-21474836.48"
+#define TLM_FMT_SAMPLE_MAX  (64u)   // 샘플 1줄 최대 (59) + 여유
+
+size_t tlm_fmt_u32(char *out, uint32_t v);
+size_t tlm_fmt_u64(char *out, uint64_t v);
+size_t tlm_fmt_i32(char *out, int32_t v);
+size_t tlm_fmt_x100(char *out, int32_t v);
+
+// 샘플 1줄 (NUL 포함 out_sz 확인, snprintf와 같이 NUL 종료). 공간 부족이면 0
+size_t tlm_fmt_sample(char *out, size_t out_sz, const tlm_sample_t *s);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // __TLM_FMT_H__
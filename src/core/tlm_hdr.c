@@ -0,0 +1,27 @@
+// FILE: src/core/tlm_hdr.c
+#include "tlm_hdr.h"
+
+#include <stdio.h>
+#include <string.h>
+
+void tlm_hdr_init(tlm_hdr_t *h, uint32_t boot_id, uint64_t uid) {
+    if (!h) return;
+    memset(h, 0, sizeof(*h));
+    h->boot_id = boot_id;
+    h->uid     = uid;
+}
+
+size_t tlm_hdr_format(const tlm_hdr_t *h, char *out, size_t out_sz) {
+    if (!h || !out || out_sz == 0) return 0;
+
+    int n = snprintf(out, out_sz, "pkt=%lu,boot=%08lx,uid=%016llx\n",
+                     (unsigned long)h->seq,
+                     (unsigned long)h->boot_id,
+                     (unsigned long long)h->uid);
+    if (n <= 0 || (size_t)n >= out_sz) return 0;
+    return (size_t)n;
+}
+
+void tlm_hdr_commit(tlm_hdr_t *h) {
+    if (h) h->seq++;
+}
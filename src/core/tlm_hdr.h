@@ -0,0 +1,44 @@
+// FILE: src/core/tlm_hdr.h
+#ifndef __TLM_HDR_H__
+#define __TLM_HDR_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+// telemetry datagram header 줄 (모든 datagram의 첫 줄)
+//
+//   "pkt=<seq>,boot=<8 hex>,uid=<16 hex>\n"
+//
+// - seq : boot마다 0부터, 실제 송신된 datagram마다 +1 (로컬 송신 실패는 소모 안 함)
+//         -> 수신측 seq 구멍 = 네트워크 손실, 역행 = 재정렬
+// - boot: boot마다 새 난수 (재부팅으로 seq가 0이 된 것과 구분)
+// - uid : board unique ID (flash 64-bit ID). IP/port가 바뀌어도 같은 장치로 식별
+//
+// 뒤따르는 샘플/stat 줄 format은 그대로 (key를 모르는 수신기는 이 줄을 무시하면 됨)
+
+#define TLM_HDR_MAX  (48u)   // header 줄 최대 길이
+
+typedef struct {
+    uint32_t seq;       // 다음 datagram seq
+    uint32_t boot_id;
+    uint64_t uid;
+} tlm_hdr_t;
+
+void tlm_hdr_init(tlm_hdr_t *h, uint32_t boot_id, uint64_t uid);
+
+// header 줄 작성 (현재 seq). 길이 리턴 (0: 공간 부족)
+size_t tlm_hdr_format(const tlm_hdr_t *h, char *out, size_t out_sz);
+
+// datagram이 실제로 송신됐을 때 호출 -> seq 소모
+void tlm_hdr_commit(tlm_hdr_t *h);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // __TLM_HDR_H__
@@ -0,0 +1,198 @@
+// FILE: src/core/tlm_prio.c
+#include "tlm_prio.h"
+
+#include <stdio.h>
+#include <string.h>
+
+// ---------- internal helpers ----------
+
+static void queue_bind(tlm_prio_queue_t *q, uint8_t *buf, uint16_t *len, uint32_t *tag, uint32_t *enq,
+                       uint32_t slot, uint32_t depth) {
+    q->buf    = buf;
+    q->len    = len;
+    q->tag    = tag;
+    q->enq_us = enq;
+    q->slot   = slot;
+    q->depth  = depth;
+    q->head   = 0;
+    q->count  = 0;
+}
+
+static void queue_pop(tlm_prio_queue_t *q) {
+    q->head = (q->head + 1u) % q->depth;
+    q->count--;
+}
+
+static void queue_push(tlm_prio_queue_t *q, const void *data, size_t len, uint32_t tag, uint32_t now_us) {
+    const uint32_t i = (q->head + q->count) % q->depth;
+    memcpy(q->buf + (size_t)i * q->slot, data, len);
+    q->len[i]    = (uint16_t)len;
+    q->tag[i]    = tag;
+    q->enq_us[i] = now_us;
+    q->count++;
+}
+
+// head 송신 시도. 성공이면 pop + latency 기록
+static bool queue_send_head(tlm_prio_t *p, tlm_prio_class_t cls, uint32_t now_us) {
+    tlm_prio_queue_t *q = &p->q[cls];
+    tlm_prio_class_stats_t *st = &p->stats[cls];
+    const uint32_t i = q->head;
+
+    if (!p->send(q->buf + (size_t)i * q->slot, q->len[i], cls, q->tag[i], p->user)) {
+        st->send_fail++;
+        return false;
+    }
+    st->sent++;
+    lat_series_add(&p->lat[cls], now_us - q->enq_us[i]);
+    queue_pop(q);
+    return true;
+}
+
+// 앞에 기다리는 것이 없으면 바로 송신 (bulk는 urgent도 비어 있어야: strict priority)
+// 0: 송신, 1: 대기 중인 것 있음, -1: 송신 실패
+static int send_direct(tlm_prio_t *p, tlm_prio_class_t cls, const void *data, size_t len, uint32_t tag) {
+    tlm_prio_class_stats_t *st = &p->stats[cls];
+    const bool clear = p->q[cls].count == 0 && (cls == TLM_PRIO_URGENT || p->q[TLM_PRIO_URGENT].count == 0);
+    if (!clear) return 1;
+
+    if (!p->send(data, len, cls, tag, p->user)) {
+        st->send_fail++;
+        return -1;
+    }
+    st->sent++;
+    st->direct++;
+    lat_series_add(&p->lat[cls], 0);
+    if (cls == TLM_PRIO_BULK) p->burst = 0;
+    else if (p->q[TLM_PRIO_BULK].count) p->burst++;
+    return 0;
+}
+
+// urgent와 bulk가 모두 대기 중일 때 bulk 차례인지
+static bool guard_due(const tlm_prio_t *p, uint32_t now_us) {
+    const tlm_prio_queue_t *b = &p->q[TLM_PRIO_BULK];
+    if (p->guard_burst && p->burst >= p->guard_burst) return true;
+    if (p->guard_wait_us && now_us - b->enq_us[b->head] >= p->guard_wait_us) return true;
+    return false;
+}
+
+// ---------- public API ----------
+
+void tlm_prio_init(tlm_prio_t *p, tlm_prio_send_fn send, void *user) {
+    if (!p) return;
+    memset(p, 0, sizeof(*p));
+    p->send = send;
+    p->user = user;
+
+    queue_bind(&p->q[TLM_PRIO_URGENT], &p->u_buf[0][0], p->u_len, p->u_tag, p->u_enq,
+               TLM_PRIO_URGENT_MAX, TLM_PRIO_URGENT_DEPTH);
+    queue_bind(&p->q[TLM_PRIO_BULK], &p->b_buf[0][0], p->b_len, p->b_tag, p->b_enq,
+               TLM_PRIO_BULK_MAX, TLM_PRIO_BULK_DEPTH);
+}
+
+void tlm_prio_set_guard(tlm_prio_t *p, uint32_t guard_burst, uint32_t guard_wait_ms) {
+    if (!p) return;
+    p->guard_burst   = guard_burst;
+    p->guard_wait_us = guard_wait_ms * 1000u;
+}
+
+bool tlm_prio_submit(tlm_prio_t *p, tlm_prio_class_t cls, const void *data, size_t len,
+                     uint32_t tag, uint32_t now_us) {
+    if (!p || !p->send || (unsigned)cls >= TLM_PRIO_CLASSES || !data || len == 0) return false;
+
+    tlm_prio_queue_t *q = &p->q[cls];
+    tlm_prio_class_stats_t *st = &p->stats[cls];
+    if (len > q->slot) {
+        st->too_big++;
+        return false;
+    }
+    st->submitted++;
+
+    if (send_direct(p, cls, data, len, tag) == 0) return true;
+
+    if (q->count >= q->depth) {
+        st->dropped++;
+        if (cls == TLM_PRIO_BULK) return false;
+        queue_pop(q); // urgent: 가장 오래된 경보 버림
+    }
+    queue_push(q, data, len, tag, now_us);
+    if (q->count > st->depth_max) st->depth_max = q->count;
+    return true;
+}
+
+bool tlm_prio_send_now(tlm_prio_t *p, tlm_prio_class_t cls, const void *data, size_t len, uint32_t tag) {
+    if (!p || !p->send || (unsigned)cls >= TLM_PRIO_CLASSES || !data || len == 0) return false;
+
+    tlm_prio_class_stats_t *st = &p->stats[cls];
+    if (len > p->q[cls].slot) {
+        st->too_big++;
+        return false;
+    }
+    st->submitted++;
+
+    const int r = send_direct(p, cls, data, len, tag);
+    if (r == 1) st->busy++;
+    return r == 0;
+}
+
+uint32_t tlm_prio_service(tlm_prio_t *p, uint32_t now_us, uint32_t budget) {
+    if (!p || !p->send) return 0;
+
+    const tlm_prio_queue_t *u = &p->q[TLM_PRIO_URGENT];
+    const tlm_prio_queue_t *b = &p->q[TLM_PRIO_BULK];
+    uint32_t sent = 0;
+
+    while ((budget == 0 || sent < budget) && (u->count || b->count)) {
+        tlm_prio_class_t cls = u->count ? TLM_PRIO_URGENT : TLM_PRIO_BULK;
+        const bool guarded = u->count && b->count && guard_due(p, now_us);
+        if (guarded) cls = TLM_PRIO_BULK;
+
+        if (!queue_send_head(p, cls, now_us)) break;
+        sent++;
+
+        if (cls == TLM_PRIO_URGENT && b->count) {
+            p->burst++;
+        } else {
+            p->burst = 0;
+            if (guarded) p->stats[TLM_PRIO_BULK].guard++;
+        }
+    }
+    return sent;
+}
+
+uint32_t tlm_prio_pending(const tlm_prio_t *p, tlm_prio_class_t cls) {
+    if (!p || (unsigned)cls >= TLM_PRIO_CLASSES) return 0;
+    return p->q[cls].count;
+}
+
+const tlm_prio_class_stats_t *tlm_prio_stats(const tlm_prio_t *p, tlm_prio_class_t cls) {
+    if (!p || (unsigned)cls >= TLM_PRIO_CLASSES) return NULL;
+    return &p->stats[cls];
+}
+
+size_t tlm_prio_stats_line(tlm_prio_t *p, uint64_t now_ms, char *out, size_t out_sz) {
+    if (!p || !out || out_sz == 0) return 0;
+
+    const tlm_prio_class_stats_t *u = &p->stats[TLM_PRIO_URGENT];
+    const tlm_prio_class_stats_t *b = &p->stats[TLM_PRIO_BULK];
+    lat_summary_t ul, bl;
+    lat_series_summary(&p->lat[TLM_PRIO_URGENT], &ul);
+    lat_series_summary(&p->lat[TLM_PRIO_BULK], &bl);
+
+    int n = snprintf(out, out_sz,
+                     "stat=prio,ms=%llu,"
+                     "u_sent=%lu,u_q=%lu,u_drop=%lu,u_p50_us=%lu,u_p99_us=%lu,u_max_us=%lu,"
+                     "b_sent=%lu,b_q=%lu,b_rej=%lu,b_guard=%lu,b_busy=%lu,"
+                     "b_p50_us=%lu,b_p99_us=%lu,b_max_us=%lu\n",
+                     (unsigned long long)now_ms,
+                     (unsigned long)u->sent, (unsigned long)p->q[TLM_PRIO_URGENT].count,
+                     (unsigned long)u->dropped,
+                     (unsigned long)ul.p50, (unsigned long)ul.p99, (unsigned long)ul.max,
+                     (unsigned long)b->sent, (unsigned long)p->q[TLM_PRIO_BULK].count,
+                     (unsigned long)b->dropped, (unsigned long)b->guard, (unsigned long)b->busy,
+                     (unsigned long)bl.p50, (unsigned long)bl.p99, (unsigned long)bl.max);
+    if (n <= 0 || (size_t)n >= out_sz) return 0;
+
+    lat_series_reset(&p->lat[TLM_PRIO_URGENT]);
+    lat_series_reset(&p->lat[TLM_PRIO_BULK]);
+    return (size_t)n;
+}
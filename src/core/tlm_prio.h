@@ -0,0 +1,125 @@
+// FILE: src/core/tlm_prio.h
+#ifndef __TLM_PRIO_H__
+#define __TLM_PRIO_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "lat_probe.h" // lat_series_t
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+// telemetry 송신 우선순위 (traffic class 2개, 같은 송신 경로 공유)
+//
+// - URGENT: 경보/이벤트. batch/backfill을 기다리지 않음. 대기 중인 urgent가 없으면 submit에서 즉시 송신,
+//   실패하면 queue (가득 차면 가장 오래된 것 drop: 최신 상태가 더 중요)
+// - BULK  : 샘플/stat/backfill. urgent가 대기 중이거나 bulk가 밀려 있으면 queue (깊이 제한),
+//   가득 차면 submit 실패 -> 호출자가 자기 backlog(tlm_buffer 등)에 보관
+// - send_now: queue 없이 즉시 송신만 (호출자 backlog가 원본인 샘플). queue에 넣은 것을 "송신"으로
+//   집계하면 호출자가 사본을 버린 뒤 queue에서 밀려날 수 있으므로, 실제 송신했을 때만 true
+// - service: strict priority (urgent 먼저). starvation guard: bulk가 대기 중일 때
+//   urgent를 guard_burst개 연속 보냈거나 bulk head가 guard_wait_us 이상 기다렸으면 bulk 1개 먼저
+// - 송신 실패(link down / lwIP heap 부족)면 그 자리에서 멈춤 (다음 service에서 재시도, 순서 유지)
+// - latency: class별 submit -> 송신 성공 (queue 대기, 즉시 송신은 0). lat_series로 p50/p99/max
+// - 시각은 32-bit us (wrap 허용), 호출자가 공급 -> host에서 그대로 시험 가능
+
+#ifndef TLM_PRIO_URGENT_DEPTH
+#define TLM_PRIO_URGENT_DEPTH   4u
+#endif
+#ifndef TLM_PRIO_URGENT_MAX
+#define TLM_PRIO_URGENT_MAX     160u    // urgent datagram payload 최대 (경보 줄 1~2개)
+#endif
+#ifndef TLM_PRIO_BULK_DEPTH
+#define TLM_PRIO_BULK_DEPTH     8u
+#endif
+#ifndef TLM_PRIO_BULK_MAX
+#define TLM_PRIO_BULK_MAX       1024u   // bulk datagram payload 최대 (live batch, CTRL_BATCH_MAX * 64)
+#endif
+
+typedef enum {
+    TLM_PRIO_URGENT = 0,
+    TLM_PRIO_BULK,
+    TLM_PRIO_CLASSES
+} tlm_prio_class_t;
+
+// datagram 1개 송신. tag = submit 때 받은 값 그대로. 로컬 송신 실패면 false
+typedef bool (*tlm_prio_send_fn)(const void *data, size_t len, tlm_prio_class_t cls, uint32_t tag, void *user);
+
+typedef struct {
+    uint32_t submitted;
+    uint32_t sent;
+    uint32_t direct;        // queue 없이 submit에서 바로 송신
+    uint32_t dropped;       // urgent: queue 가득 -> 가장 오래된 것 버림 / bulk: queue 가득 -> submit 거부
+    uint32_t too_big;
+    uint32_t send_fail;     // 송신 시도 실패 (queue에 남김)
+    uint32_t busy;          // send_now: 앞에 대기 중인 datagram -> 거부 (호출자 backlog로)
+    uint32_t guard;         // bulk: starvation guard로 urgent보다 먼저 보낸 횟수
+    uint32_t depth_max;
+} tlm_prio_class_stats_t;
+
+typedef struct {
+    uint8_t  *buf;          // depth * slot
+    uint16_t *len;
+    uint32_t *tag;
+    uint32_t *enq_us;
+    uint32_t  slot;
+    uint32_t  depth;
+    uint32_t  head;         // 다음 송신
+    uint32_t  count;
+} tlm_prio_queue_t;
+
+typedef struct {
+    tlm_prio_send_fn send;
+    void *user;
+
+    uint32_t guard_burst;   // 0: burst 기준 끔
+    uint32_t guard_wait_us; // 0: 대기 시간 기준 끔
+    uint32_t burst;         // bulk 대기 중 연속 urgent 송신 수
+
+    tlm_prio_queue_t q[TLM_PRIO_CLASSES];
+    uint8_t  u_buf[TLM_PRIO_URGENT_DEPTH][TLM_PRIO_URGENT_MAX];
+    uint16_t u_len[TLM_PRIO_URGENT_DEPTH];
+    uint32_t u_tag[TLM_PRIO_URGENT_DEPTH];
+    uint32_t u_enq[TLM_PRIO_URGENT_DEPTH];
+    uint8_t  b_buf[TLM_PRIO_BULK_DEPTH][TLM_PRIO_BULK_MAX];
+    uint16_t b_len[TLM_PRIO_BULK_DEPTH];
+    uint32_t b_tag[TLM_PRIO_BULK_DEPTH];
+    uint32_t b_enq[TLM_PRIO_BULK_DEPTH];
+
+    lat_series_t lat[TLM_PRIO_CLASSES];     // 보고 window마다 초기화
+    tlm_prio_class_stats_t stats[TLM_PRIO_CLASSES];
+} tlm_prio_t;
+
+void tlm_prio_init(tlm_prio_t *p, tlm_prio_send_fn send, void *user);
+
+// starvation guard (guard_wait_ms: bulk head 최대 대기)
+void tlm_prio_set_guard(tlm_prio_t *p, uint32_t guard_burst, uint32_t guard_wait_ms);
+
+// datagram 1개 제출. 송신했거나 queue에 넣었으면 true
+// false: bulk queue 가득 / 크기 초과 / 인자 오류 (데이터는 호출자 소유 그대로)
+bool tlm_prio_submit(tlm_prio_t *p, tlm_prio_class_t cls, const void *data, size_t len,
+                     uint32_t tag, uint32_t now_us);
+
+// 즉시 송신만 (queue 적재 없음). 앞에 대기 중인 것이 없고 송신이 성공했을 때만 true
+// false면 데이터는 호출자 소유 그대로 (송신 완료로 집계하지 말 것)
+bool tlm_prio_send_now(tlm_prio_t *p, tlm_prio_class_t cls, const void *data, size_t len, uint32_t tag);
+
+// queue 송신 (strict priority + starvation guard), 최대 budget개 (0: 제한 없음). 송신 수 리턴
+uint32_t tlm_prio_service(tlm_prio_t *p, uint32_t now_us, uint32_t budget);
+
+uint32_t tlm_prio_pending(const tlm_prio_t *p, tlm_prio_class_t cls);
+
+const tlm_prio_class_stats_t *tlm_prio_stats(const tlm_prio_t *p, tlm_prio_class_t cls);
+
+// "stat=prio,ms=..,u_sent=..,u_q=..,u_drop=..,u_p50_us=..,..,b_guard=..,b_busy=..,b_max_us=..\n"
+// latency window 초기화 (누적 카운터는 유지). 길이 리턴
+size_t tlm_prio_stats_line(tlm_prio_t *p, uint64_t now_ms, char *out, size_t out_sz);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // __TLM_PRIO_H__
@@ -0,0 +1,167 @@
+// FILE: src/core/tlm_raw.c
+#include "tlm_raw.h"
+
+#include <string.h>
+
+#include "crc32.h"
+
+// ---------- internal helpers ----------
+
+static void put_u16(uint8_t *p, uint16_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
+
+static void put_u24(uint8_t *p, uint32_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+}
+
+static void put_u32(uint8_t *p, uint32_t v) {
+    put_u24(p, v);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+static void put_u64(uint8_t *p, uint64_t v) {
+    put_u32(p, (uint32_t)v);
+    put_u32(p + 4, (uint32_t)(v >> 32));
+}
+
+static uint16_t get_u16(const uint8_t *p) {
+    return (uint16_t)(p[0] | ((uint16_t)p[1] << 8));
+}
+
+static uint32_t get_u24(const uint8_t *p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16);
+}
+
+static uint32_t get_u32(const uint8_t *p) {
+    return get_u24(p) | ((uint32_t)p[3] << 24);
+}
+
+static uint64_t get_u64(const uint8_t *p) {
+    return (uint64_t)get_u32(p) | ((uint64_t)get_u32(p + 4) << 32);
+}
+
+static size_t payload_size(uint8_t type, uint8_t count) {
+    return type == TLM_RAW_T_PROM ? TLM_RAW_PROM_SIZE : (size_t)count * TLM_RAW_REC_SIZE;
+}
+
+static uint32_t frame_crc(const uint8_t *f, size_t payload) {
+    uint32_t crc = 0xFFFFFFFFu;
+    crc = crc32_update(crc, f, 24);
+    crc = crc32_update(crc, f + TLM_RAW_HDR_SIZE, payload);
+    return ~crc;
+}
+
+static void put_hdr(const tlm_raw_enc_t *e, uint8_t *f, uint64_t base_ms, uint8_t type, uint8_t count) {
+    put_u32(f + 0, TLM_RAW_MAGIC);
+    put_u32(f + 4, e->boot);
+    put_u32(f + 8, e->seq);
+    put_u64(f + 12, base_ms);
+    f[20] = type;
+    f[21] = count;
+    put_u16(f + 22, e->osr);
+    put_u32(f + 24, frame_crc(f, payload_size(type, count)));
+}
+
+// ---------- public API ----------
+
+void tlm_raw_init(tlm_raw_enc_t *e, uint32_t boot) {
+    if (!e) return;
+    memset(e, 0, sizeof(*e));
+    e->boot = boot;
+}
+
+bool tlm_raw_set_osr(tlm_raw_enc_t *e, uint16_t osr) {
+    if (!e) return false;
+    if (e->osr == osr) return true;
+    if (e->count != 0) return false;
+    e->osr = osr;
+    return true;
+}
+
+bool tlm_raw_add(tlm_raw_enc_t *e, uint64_t ms, uint32_t d1, uint32_t d2) {
+    if (!e || e->count >= TLM_RAW_MAX_BATCH) return false;
+    if (d1 > 0xFFFFFFu || d2 > 0xFFFFFFu) return false;
+
+    if (e->count == 0) e->base_ms = ms;
+    if (ms < e->base_ms || ms - e->base_ms > TLM_RAW_DMS_MAX) return false;
+
+    uint8_t *r = e->frame + TLM_RAW_HDR_SIZE + (size_t)e->count * TLM_RAW_REC_SIZE;
+    put_u24(r + 0, (uint32_t)(ms - e->base_ms));
+    put_u24(r + 3, d1);
+    put_u24(r + 6, d2);
+    e->count++;
+    return true;
+}
+
+size_t tlm_raw_finish(tlm_raw_enc_t *e, const uint8_t **frame) {
+    if (!e || e->count == 0) return 0;
+
+    put_hdr(e, e->frame, e->base_ms, TLM_RAW_T_SAMPLES, e->count);
+
+    const size_t len = TLM_RAW_HDR_SIZE + (size_t)e->count * TLM_RAW_REC_SIZE;
+    if (frame) *frame = e->frame;
+    e->seq++;
+    e->count = 0;
+    return len;
+}
+
+size_t tlm_raw_prom(tlm_raw_enc_t *e, const uint16_t prom[8], uint64_t now_ms, uint8_t *out, size_t out_sz) {
+    if (!e || !prom || !out || out_sz < TLM_RAW_HDR_SIZE + TLM_RAW_PROM_SIZE) return 0;
+
+    for (uint32_t i = 0; i < 8u; i++) put_u16(out + TLM_RAW_HDR_SIZE + i * 2u, prom[i]);
+    put_hdr(e, out, now_ms, TLM_RAW_T_PROM, 0);
+    e->seq++;
+    return TLM_RAW_HDR_SIZE + TLM_RAW_PROM_SIZE;
+}
+
+bool tlm_raw_is_frame(const uint8_t *buf, size_t len) {
+    return buf && len >= 4 && get_u32(buf) == TLM_RAW_MAGIC;
+}
+
+int32_t tlm_raw_parse(const uint8_t *buf, size_t len, tlm_raw_info_t *info) {
+    if (!tlm_raw_is_frame(buf, len)) return -1;
+    if (len < TLM_RAW_HDR_SIZE) return 0;
+
+    const uint8_t type  = buf[20];
+    const uint8_t count = buf[21];
+    if (type == TLM_RAW_T_PROM) {
+        if (count != 0) return -1;
+    } else if (type == TLM_RAW_T_SAMPLES) {
+        if (count == 0 || count > TLM_RAW_MAX_BATCH) return -1;
+    } else {
+        return -1;
+    }
+
+    const size_t payload = payload_size(type, count);
+    if (len < TLM_RAW_HDR_SIZE + payload) return 0;
+    if (get_u32(buf + 24) != frame_crc(buf, payload)) return -1;
+
+    if (info) {
+        info->boot    = get_u32(buf + 4);
+        info->seq     = get_u32(buf + 8);
+        info->base_ms = get_u64(buf + 12);
+        info->type    = type;
+        info->count   = count;
+        info->osr     = get_u16(buf + 22);
+    }
+    return (int32_t)(TLM_RAW_HDR_SIZE + payload);
+}
+
+void tlm_raw_sample(const uint8_t *frame, const tlm_raw_info_t *info, uint8_t idx,
+                    uint64_t *ms, uint32_t *d1, uint32_t *d2) {
+    if (!frame || !info || idx >= info->count) return;
+
+    const uint8_t *r = frame + TLM_RAW_HDR_SIZE + (size_t)idx * TLM_RAW_REC_SIZE;
+    if (ms) *ms = info->base_ms + get_u24(r + 0);
+    if (d1) *d1 = get_u24(r + 3);
+    if (d2) *d2 = get_u24(r + 6);
+}
+
+void tlm_raw_get_prom(const uint8_t *frame, uint16_t prom[8]) {
+    if (!frame || !prom) return;
+    for (uint32_t i = 0; i < 8u; i++) prom[i] = get_u16(frame + TLM_RAW_HDR_SIZE + i * 2u);
+}
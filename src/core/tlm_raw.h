@@ -0,0 +1,98 @@
+// FILE: src/core/tlm_raw.h
+#ifndef __TLM_RAW_H__
+#define __TLM_RAW_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+// raw passthrough telemetry frame (UDP datagram 1개 = frame 1개)
+// 장치는 보상하지 않고 D1/D2만 송신, 보상은 host (같은 ms5611_math -> firmware 결과와 bit 동일)
+//
+// frame format (little-endian)
+//   [0]  u32 magic      TLM_RAW_MAGIC
+//   [4]  u32 boot       session (platform_boot_id). host는 (node, boot)마다 PROM 보관
+//   [8]  u32 seq        frame 번호 (PROM frame 포함, boot마다 0부터)
+//   [12] u64 base_ms    SAMPLES: 첫 샘플 시각 (ms since boot), PROM: 송신 시각
+//   [20] u8  type       TLM_RAW_T_*
+//   [21] u8  count      SAMPLES: 샘플 수, PROM: 0
+//   [22] u16 osr        측정 OSR (정보용, 보상에는 불필요)
+//   [24] u32 crc32      [0..24) + payload
+//   [28] payload
+//          PROM   : u16 prom[8] (word 0..7, CRC4 포함 그대로)
+//          SAMPLES: record[count] = u24 dms (base_ms 기준), u24 D1, u24 D2  (9 byte)
+//
+// PROM은 session 시작 시 1회 + 요청 시 (control "cmd=prom")
+
+#define TLM_RAW_MAGIC       0x57525947u // "GYRW"
+#define TLM_RAW_HDR_SIZE    28u
+#define TLM_RAW_REC_SIZE    9u
+#define TLM_RAW_PROM_SIZE   16u
+#define TLM_RAW_MAX_BATCH   64u
+#define TLM_RAW_FRAME_MAX   (TLM_RAW_HDR_SIZE + TLM_RAW_MAX_BATCH * TLM_RAW_REC_SIZE)
+#define TLM_RAW_DMS_MAX     0xFFFFFFu   // batch 안 시각 범위 (~4.6 h)
+
+typedef enum {
+    TLM_RAW_T_PROM    = 1,
+    TLM_RAW_T_SAMPLES = 2,
+} tlm_raw_type_t;
+
+typedef struct {
+    uint8_t  frame[TLM_RAW_FRAME_MAX];
+    uint8_t  count;
+    uint16_t osr;
+    uint64_t base_ms;
+    uint32_t boot;
+    uint32_t seq;       // 다음 frame seq
+} tlm_raw_enc_t;
+
+typedef struct {
+    uint32_t boot;
+    uint32_t seq;
+    uint64_t base_ms;
+    uint8_t  type;
+    uint8_t  count;
+    uint16_t osr;
+} tlm_raw_info_t;
+
+void tlm_raw_init(tlm_raw_enc_t *e, uint32_t boot);
+
+// 다음 샘플부터의 OSR (batch 중간에 바뀌면 false -> finish 후 다시)
+bool tlm_raw_set_osr(tlm_raw_enc_t *e, uint16_t osr);
+
+// 샘플 추가. 가득 찼거나 dms/D1/D2가 24 bit를 넘으면 false (D 값은 ADC 24 bit)
+bool tlm_raw_add(tlm_raw_enc_t *e, uint64_t ms, uint32_t d1, uint32_t d2);
+
+// header/CRC 채우고 frame 길이 리턴 (*frame = 내부 버퍼, 다음 add 전까지 유효). 비어 있으면 0
+size_t tlm_raw_finish(tlm_raw_enc_t *e, const uint8_t **frame);
+
+// PROM frame을 out에 작성 (seq 소모, 진행 중인 batch와 무관). 길이 리턴 (0: out 부족)
+size_t tlm_raw_prom(tlm_raw_enc_t *e, const uint16_t prom[8], uint64_t now_ms, uint8_t *out, size_t out_sz);
+
+// ---- decode (host) ----
+
+// true면 raw frame 후보 (magic). 다른 telemetry (텍스트 / ARQ)와 구분
+bool tlm_raw_is_frame(const uint8_t *buf, size_t len);
+
+// datagram 1개 검증
+//   >0: frame 길이 (info 채움)
+//    0: 길이 부족
+//   <0: magic/type/CRC 불일치
+int32_t tlm_raw_parse(const uint8_t *buf, size_t len, tlm_raw_info_t *info);
+
+// idx번째 샘플 (SAMPLES frame, parse 성공 후)
+void tlm_raw_sample(const uint8_t *frame, const tlm_raw_info_t *info, uint8_t idx,
+                    uint64_t *ms, uint32_t *d1, uint32_t *d2);
+
+// PROM frame payload
+void tlm_raw_get_prom(const uint8_t *frame, uint16_t prom[8]);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // __TLM_RAW_H__
@@ -0,0 +1,30 @@
+// FILE: src/core/tlm_transport.h
+#ifndef __TLM_TRANSPORT_H__
+#define __TLM_TRANSPORT_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+// telemetry 송신 경로 추상화 (UDP, USB bulk, host stand-in ...)
+// - send: message 1개를 non-blocking으로 넘김. 받아들이지 못하면 false (호출자가 drop 집계)
+// - ready: 지금 보낼 수 있는지 (링크 업 / host가 포트를 열었음). NULL이면 항상 true
+typedef struct {
+    const char *name;
+    bool (*send)(void *ctx, const void *data, size_t len);
+    bool (*ready)(void *ctx);
+    void *ctx;
+} tlm_transport_t;
+
+static inline bool tlm_transport_ready(const tlm_transport_t *t) {
+    return t && t->send && (!t->ready || t->ready(t->ctx));
+}
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // __TLM_TRANSPORT_H__
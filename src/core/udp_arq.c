@@ -0,0 +1,277 @@
+// FILE: src/core/udp_arq.c
+#include "udp_arq.h"
+
+#include <string.h>
+
+// ---------- internal helpers ----------
+
+static void put_u16(uint8_t *p, uint16_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
+
+static void put_u32(uint8_t *p, uint32_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+static uint16_t get_u16(const uint8_t *p) {
+    return (uint16_t)(p[0] | ((uint16_t)p[1] << 8));
+}
+
+static uint32_t get_u32(const uint8_t *p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// seq 비교 (wrap-safe)
+static bool seq_lt(uint32_t a, uint32_t b) {
+    return (int32_t)(a - b) < 0;
+}
+
+static arq_slot_t *slot_of(arq_tx_t *tx, uint32_t seq) {
+    return &tx->slots[seq % ARQ_WINDOW];
+}
+
+static void update_inflight(arq_tx_t *tx) {
+    uint32_t n = 0;
+    for (uint32_t s = tx->una; s != tx->next_seq; s++) {
+        if (slot_of(tx, s)->used) n++;
+    }
+    tx->stats.inflight = n;
+}
+
+static void advance_una(arq_tx_t *tx) {
+    while (tx->una != tx->next_seq && !slot_of(tx, tx->una)->used) tx->una++;
+}
+
+static void release(arq_tx_t *tx, arq_slot_t *sl, bool acked) {
+    if (!sl->used) return;
+    sl->used = false;
+    if (acked) tx->stats.acked++;
+    else       tx->stats.abandoned++;
+}
+
+static void retransmit(arq_tx_t *tx, arq_slot_t *sl, uint64_t now_ms) {
+    put_u16(sl->pkt + 2, ARQ_FLAG_RETX);
+
+    sl->tx_count++;
+    sl->last_tx_ms = now_ms;
+    tx->stats.retransmits++;
+
+    if (!tx->send(sl->pkt, ARQ_HDR_SIZE + (size_t)sl->len, tx->user)) tx->stats.send_errors++;
+}
+
+// rx: base 수신 처리 후 연속 수신분까지 base 전진
+static void rx_advance(arq_rx_t *rx) {
+    rx->base++;
+    while (rx->bits & 1u) {
+        rx->bits >>= 1;
+        rx->base++;
+    }
+    rx->bits >>= 1;
+}
+
+// ---------- public API: sender ----------
+
+void arq_tx_init(arq_tx_t *tx, uint32_t rto_ms, uint32_t holdoff_ms, uint8_t max_tx,
+                 arq_send_fn send, void *user) {
+    if (!tx) return;
+    memset(tx, 0, sizeof(*tx));
+    tx->rto_ms     = rto_ms;
+    tx->holdoff_ms = holdoff_ms;
+    tx->max_tx     = max_tx ? max_tx : 1;
+    tx->send       = send;
+    tx->user       = user;
+}
+
+bool arq_tx_send(arq_tx_t *tx, const void *payload, size_t len, uint64_t now_ms) {
+    if (!tx || !tx->send || (len && !payload) || len > ARQ_MAX_PAYLOAD) return false;
+
+    // 창이 차면 가장 오래된 미확인 packet 포기 (송신은 막지 않음)
+    if (tx->next_seq - tx->una >= ARQ_WINDOW) {
+        release(tx, slot_of(tx, tx->una), false);
+        tx->una++;
+        advance_una(tx);
+    }
+
+    const uint32_t seq = tx->next_seq;
+    arq_slot_t *sl = slot_of(tx, seq);
+
+    sl->pkt[0] = (uint8_t)ARQ_MAGIC;
+    sl->pkt[1] = (uint8_t)ARQ_TYPE_DATA;
+    put_u16(sl->pkt + 2, 0);
+    put_u32(sl->pkt + 4, seq);
+    if (len) memcpy(sl->pkt + ARQ_HDR_SIZE, payload, len);
+
+    sl->seq        = seq;
+    sl->len        = (uint16_t)len;
+    sl->tx_count   = 1;
+    sl->last_tx_ms = now_ms;
+
+    if (!tx->send(sl->pkt, ARQ_HDR_SIZE + len, tx->user)) {
+        // 로컬 송신 실패(링크 다운 등)는 호출자 책임 (store-and-forward) -> seq도 소모하지 않음
+        tx->stats.send_errors++;
+        return false;
+    }
+
+    sl->used = true;
+    tx->next_seq++;
+    tx->stats.sent++;
+    update_inflight(tx);
+    return true;
+}
+
+void arq_tx_on_feedback(arq_tx_t *tx, const uint8_t *pkt, size_t len, uint64_t now_ms) {
+    if (!tx || !pkt) return;
+    if (len < ARQ_FB_SIZE || pkt[0] != ARQ_MAGIC || pkt[1] != ARQ_TYPE_FB) {
+        tx->stats.feedback_bad++;
+        return;
+    }
+
+    const uint32_t ack  = get_u32(pkt + 4);
+    const uint32_t sack = get_u32(pkt + 8);
+    tx->stats.feedback_rx++;
+
+    // 1) cumulative ACK + SACK 해제
+    for (uint32_t s = tx->una; s != tx->next_seq; s++) {
+        arq_slot_t *sl = slot_of(tx, s);
+        if (!sl->used) continue;
+
+        if (seq_lt(s, ack)) {
+            release(tx, sl, true);
+        } else if (s != ack && (s - ack - 1u) < 32u && ((sack >> (s - ack - 1u)) & 1u)) {
+            release(tx, sl, true);
+        }
+    }
+    advance_una(tx);
+
+    // 2) NACK: 뒤 seq가 도착했는데 비어 있는 구멍만 재전송 (tail은 RTO가 담당)
+    if (sack != 0) {
+        uint32_t top = 31;
+        while (!((sack >> top) & 1u)) top--;
+        const uint32_t hi = ack + 1u + top; // 수신측이 본 최고 seq
+
+        for (uint32_t s = tx->una; s != tx->next_seq && seq_lt(s, hi); s++) {
+            arq_slot_t *sl = slot_of(tx, s);
+            if (!sl->used || seq_lt(s, ack)) continue;
+            if (sl->tx_count >= tx->max_tx) continue;
+            if (now_ms - sl->last_tx_ms < tx->holdoff_ms) continue;
+            retransmit(tx, sl, now_ms);
+        }
+    }
+
+    update_inflight(tx);
+}
+
+void arq_tx_poll(arq_tx_t *tx, uint64_t now_ms) {
+    if (!tx) return;
+
+    for (uint32_t s = tx->una; s != tx->next_seq; s++) {
+        arq_slot_t *sl = slot_of(tx, s);
+        if (!sl->used) continue;
+        if (now_ms - sl->last_tx_ms < tx->rto_ms) continue;
+
+        if (sl->tx_count < tx->max_tx) retransmit(tx, sl, now_ms);
+        else                           release(tx, sl, false);
+    }
+
+    advance_una(tx);
+    update_inflight(tx);
+}
+
+// ---------- public API: receiver ----------
+
+bool arq_is_packet(const uint8_t *pkt, size_t len) {
+    return pkt && len >= ARQ_HDR_SIZE && pkt[0] == ARQ_MAGIC &&
+           (pkt[1] == ARQ_TYPE_DATA || pkt[1] == ARQ_TYPE_FB);
+}
+
+void arq_rx_init(arq_rx_t *rx, uint32_t fb_every, uint32_t fb_interval_ms) {
+    if (!rx) return;
+    memset(rx, 0, sizeof(*rx));
+    rx->fb_every       = fb_every ? fb_every : 1;
+    rx->fb_interval_ms = fb_interval_ms;
+}
+
+bool arq_rx_on_packet(arq_rx_t *rx, const uint8_t *pkt, size_t len,
+                      const uint8_t **payload, size_t *payload_len, uint32_t *seq_out) {
+    if (!rx || !pkt || len < ARQ_HDR_SIZE) return false;
+    if (pkt[0] != ARQ_MAGIC || pkt[1] != ARQ_TYPE_DATA) return false;
+
+    const uint16_t flags = get_u16(pkt + 2);
+    const uint32_t seq   = get_u32(pkt + 4);
+
+    if (!rx->started) {
+        rx->started = true;
+        rx->base    = seq;
+        rx->bits    = 0;
+    }
+
+    rx->since_fb++;
+
+    if (seq_lt(seq, rx->base)) {
+        rx->stats.duplicates++;
+        return false;
+    }
+
+    if (seq == rx->base) {
+        rx_advance(rx);
+    } else {
+        // SACK 범위(32) 밖이면 가장 오래된 구멍부터 포기하며 창 이동
+        // (송신측이 ACK를 못 받아 멀쩡히 도착한 packet까지 포기하지 않도록 피드백 폭과 맞춤)
+        while (seq_lt(rx->base, seq) && (seq - rx->base - 1u) >= ARQ_RX_SPAN) {
+            rx->stats.lost++;
+            rx_advance(rx);
+        }
+
+        if (seq_lt(seq, rx->base)) {
+            // 창 이동 중 연속 수신분에 포함됨 -> 이미 받은 seq
+            rx->stats.duplicates++;
+            return false;
+        } else if (seq == rx->base) {
+            rx_advance(rx);
+        } else {
+            const uint32_t off = seq - rx->base - 1u;
+            if ((rx->bits >> off) & 1u) {
+                rx->stats.duplicates++;
+                return false;
+            }
+            rx->bits |= 1u << off;
+            rx->stats.out_of_order++;
+            rx->gap_seen = true;
+        }
+    }
+
+    rx->stats.delivered++;
+    if (flags & ARQ_FLAG_RETX) rx->stats.recovered++;
+
+    if (payload)     *payload     = pkt + ARQ_HDR_SIZE;
+    if (payload_len) *payload_len = len - ARQ_HDR_SIZE;
+    if (seq_out)     *seq_out     = seq;
+    return true;
+}
+
+bool arq_rx_feedback_due(const arq_rx_t *rx, uint64_t now_ms) {
+    if (!rx || !rx->started || rx->since_fb == 0) return false;
+    if (rx->gap_seen) return true;
+    if (rx->since_fb >= rx->fb_every) return true;
+    return (now_ms - rx->last_fb_ms) >= rx->fb_interval_ms;
+}
+
+size_t arq_rx_make_feedback(arq_rx_t *rx, uint64_t now_ms, uint8_t *out, size_t out_sz) {
+    if (!rx || !out || out_sz < ARQ_FB_SIZE) return 0;
+
+    out[0] = (uint8_t)ARQ_MAGIC;
+    out[1] = (uint8_t)ARQ_TYPE_FB;
+    put_u16(out + 2, 0);
+    put_u32(out + 4, rx->base);
+    put_u32(out + 8, rx->bits);
+
+    rx->since_fb   = 0;
+    rx->last_fb_ms = now_ms;
+    rx->gap_seen   = false;
+    rx->stats.feedback_tx++;
+    return ARQ_FB_SIZE;
+}
@@ -0,0 +1,137 @@
+// FILE: src/core/udp_arq.h
+#ifndef __UDP_ARQ_H__
+#define __UDP_ARQ_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+// Selective-retransmit ARQ (UDP 위 경량 신뢰성 계층)
+//
+// - 송신: seq 부여 + 최근 ARQ_WINDOW개 사본을 RAM에 유지, 창이 차면 가장 오래된 것을 포기
+//   (송신은 절대 block 되지 않음 -> TCP식 head-of-line blocking 없음)
+// - 수신: 도착 즉시 전달 (gap을 기다리지 않음), cumulative ACK + SACK bitmap 피드백
+// - 재전송: 피드백의 구멍(NACK) 또는 RTO 경과 시, seq당 최대 max_tx회
+//
+// wire format (little-endian)
+//   DATA : [0] u8 ARQ_MAGIC, [1] u8 ARQ_TYPE_DATA, [2] u16 flags, [4] u32 seq, [8] payload
+//   FB   : [0] u8 ARQ_MAGIC, [1] u8 ARQ_TYPE_FB,   [2] u16 0,     [4] u32 ack, [8] u32 sack
+//          ack  = 아직 못 받은 가장 낮은 seq (그 미만은 전부 수신/포기)
+//          sack = bit i: seq (ack + 1 + i) 수신 여부
+
+#define ARQ_MAGIC          0xA5u
+#define ARQ_TYPE_DATA      0x01u
+#define ARQ_TYPE_FB        0x02u
+#define ARQ_FLAG_RETX      0x0001u
+
+#define ARQ_HDR_SIZE       8u
+#define ARQ_FB_SIZE        12u
+
+#define ARQ_RX_SPAN        32u     // 수신 재정렬 추적 폭 (= sack bit 수)
+
+#ifndef ARQ_WINDOW
+#define ARQ_WINDOW         16u     // 송신 보관 슬롯 수
+#endif
+#ifndef ARQ_MAX_PAYLOAD
+#define ARQ_MAX_PAYLOAD    1024u   // 슬롯당 payload 최대
+#endif
+
+// 완성된 packet 1개 송신 (net_udp_send 등)
+typedef bool (*arq_send_fn)(const void *pkt, size_t len, void *user);
+
+typedef struct {
+    uint32_t sent;          // 최초 송신
+    uint32_t retransmits;
+    uint32_t acked;
+    uint32_t abandoned;     // 창 초과 / max_tx 소진으로 포기
+    uint32_t send_errors;
+    uint32_t feedback_rx;
+    uint32_t feedback_bad;
+    uint32_t inflight;      // 현재 미확인 슬롯 수
+} arq_tx_stats_t;
+
+typedef struct {
+    uint32_t seq;
+    uint16_t len;           // payload 길이
+    uint8_t  tx_count;
+    bool     used;
+    uint64_t last_tx_ms;
+    uint8_t  pkt[ARQ_HDR_SIZE + ARQ_MAX_PAYLOAD];
+} arq_slot_t;
+
+typedef struct {
+    arq_slot_t slots[ARQ_WINDOW];
+    uint32_t next_seq;
+    uint32_t una;           // 가장 오래된 미확인 seq
+
+    uint32_t rto_ms;        // 피드백 없을 때 재전송 간격 (tail loss / 피드백 유실)
+    uint32_t holdoff_ms;    // 같은 seq NACK 재전송 최소 간격
+    uint8_t  max_tx;        // seq당 최대 송신 횟수 (최초 포함)
+
+    arq_send_fn send;
+    void *user;
+
+    arq_tx_stats_t stats;
+} arq_tx_t;
+
+void arq_tx_init(arq_tx_t *tx, uint32_t rto_ms, uint32_t holdoff_ms, uint8_t max_tx,
+                 arq_send_fn send, void *user);
+
+// payload 송신 (seq 부여 + 보관). 너무 크면 false
+bool arq_tx_send(arq_tx_t *tx, const void *payload, size_t len, uint64_t now_ms);
+
+// 수신측 피드백 처리: ACK된 슬롯 해제 + 구멍 재전송
+void arq_tx_on_feedback(arq_tx_t *tx, const uint8_t *pkt, size_t len, uint64_t now_ms);
+
+// RTO 재전송 (주기적으로 호출)
+void arq_tx_poll(arq_tx_t *tx, uint64_t now_ms);
+
+// ---- receiver ----
+
+typedef struct {
+    uint32_t delivered;
+    uint32_t recovered;     // 재전송으로 채워진 구멍
+    uint32_t duplicates;
+    uint32_t out_of_order;
+    uint32_t lost;          // ARQ_RX_SPAN 밖으로 밀려 포기한 seq
+    uint32_t feedback_tx;
+} arq_rx_stats_t;
+
+typedef struct {
+    bool     started;
+    uint32_t base;          // 아직 못 받은 가장 낮은 seq
+    uint32_t bits;          // bit i: seq (base + 1 + i) 수신
+
+    uint32_t fb_every;      // 이 개수마다 피드백
+    uint32_t fb_interval_ms;
+    uint32_t since_fb;
+    uint64_t last_fb_ms;
+    bool     gap_seen;      // 새 구멍 발견 -> 즉시 피드백
+
+    arq_rx_stats_t stats;
+} arq_rx_t;
+
+void arq_rx_init(arq_rx_t *rx, uint32_t fb_every, uint32_t fb_interval_ms);
+
+// 수신 packet 처리. 새 payload면 true + payload/len (pkt 내부 포인터), 중복/비ARQ면 false
+bool arq_rx_on_packet(arq_rx_t *rx, const uint8_t *pkt, size_t len,
+                      const uint8_t **payload, size_t *payload_len, uint32_t *seq_out);
+
+// 지금 피드백을 보내야 하는지 (구멍 발견 / N개 / 주기)
+bool arq_rx_feedback_due(const arq_rx_t *rx, uint64_t now_ms);
+
+// 피드백 packet 작성 (ARQ_FB_SIZE). 송신 후 호출한 것으로 간주해 카운터 갱신
+size_t arq_rx_make_feedback(arq_rx_t *rx, uint64_t now_ms, uint8_t *out, size_t out_sz);
+
+// packet 첫 byte로 ARQ 여부 판별 (텍스트 telemetry와 공존)
+bool arq_is_packet(const uint8_t *pkt, size_t len);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // __UDP_ARQ_H__
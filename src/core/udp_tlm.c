@@ -2,57 +2,253 @@
 #include "udp_tlm.h"
 
 #include <stdio.h>
+#include <string.h>
 
-#include "platform_core.h"
-#include "net_wifi.h"
-#include "net_udp.h"
-#include "net_config.h"
+#if UDP_TLM_MAX_SOURCES > 32
+#error "UDP_TLM_MAX_SOURCES > 32 (udp_tlm_step taken bitmask)"
+#endif
 
-bool udp_telemetry_run(telemetry_build_fn build_fn, void *user_ctx) {
-    if (!build_fn) return false;
+// ---------- internal helpers ----------
 
-    if (!platform_init()) return false;
+static bool valid_id(const udp_tlm_t *p, int id) {
+    return p && id >= 0 && (uint32_t)id < p->n_src;
+}
+
+static bool is_due(const udp_tlm_source_t *s, uint64_t now_ms) {
+    return s->enabled && s->build && (int64_t)(now_ms - s->next_ms) >= 0;
+}
+
+// 다음 주기로. 밀렸으면 누적하지 않고 현재 시각 기준
+static void reschedule(udp_tlm_source_t *s, uint64_t now_ms) {
+    s->next_ms += s->period_ms;
+    if ((int64_t)(s->next_ms - now_ms) <= 0) s->next_ms = now_ms + s->period_ms;
+    s->waiting = false;
+}
+
+// 이번 datagram에 아직 안 넣은 due source 중 우선순위 최고 (동률이면 오래 기다린 쪽)
+static int pick_next(const udp_tlm_t *p, uint64_t now_ms, uint32_t taken) {
+    int best = -1;
+    for (uint32_t i = 0; i < p->n_src; i++) {
+        const udp_tlm_source_t *s = &p->src[i];
+        if ((taken >> i) & 1u) continue;
+        if (!is_due(s, now_ms)) continue;
+        if (best < 0 ||
+            s->priority < p->src[best].priority ||
+            (s->priority == p->src[best].priority && (int64_t)(s->next_ms - p->src[best].next_ms) < 0)) {
+            best = (int)i;
+        }
+    }
+    return best;
+}
 
-    platform_sleep_ms(1500);
-    printf("udp_telemetry_run start\n");
+static void refill(udp_tlm_t *p, uint64_t now_ms) {
+    if (p->rate_Bps == 0) return;
+    const uint64_t cap = (uint64_t)p->burst_bytes * 1000u;
+    p->tokens_mB += (now_ms - p->last_refill_ms) * (uint64_t)p->rate_Bps;
+    if (p->tokens_mB > cap) p->tokens_mB = cap;
+    p->last_refill_ms = now_ms;
+}
 
-    printf("Connecting Wi-Fi...\n");
-    if (!net_wifi_connect_wpa2(CFG_WIFI_SSID, CFG_WIFI_PASSWORD, CFG_WIFI_TIMEOUT_MS)) {
-        printf("Wi-Fi connect failed\n");
-        platform_deinit();
-        return false;
+static bool have_tokens(const udp_tlm_t *p, size_t len) {
+    return p->rate_Bps == 0 || p->tokens_mB >= (uint64_t)len * 1000u;
+}
+
+// 주기를 통째로 놓친 인스턴스는 버리고 (놓친 주기마다 1), 남은 due는 deferred로 집계
+static void age_pending(udp_tlm_t *p, uint64_t now_ms) {
+    for (uint32_t i = 0; i < p->n_src; i++) {
+        udp_tlm_source_t *s = &p->src[i];
+        if (!is_due(s, now_ms)) continue;
+
+        if (s->period_ms > 0 && now_ms - s->next_ms >= (uint64_t)s->period_ms) {
+            const uint64_t missed = (now_ms - s->next_ms) / s->period_ms;
+            s->stats.dropped += (uint32_t)missed;
+            s->next_ms += missed * s->period_ms; // 위상 유지, 현재 인스턴스는 계속 due
+            s->waiting = false;
+        }
+        if (!s->waiting) {
+            s->stats.deferred++;
+            s->waiting = true;
+        }
     }
-    printf("Wi-Fi connected\n");
+}
+
+// ---------- public API ----------
+
+void udp_tlm_init(udp_tlm_t *p, udp_tlm_send_fn send, void *send_user) {
+    if (!p) return;
+    memset(p, 0, sizeof(*p));
+    p->send                = send;
+    p->send_user           = send_user;
+    p->max_dgrams_per_step = 2;
+    p->backoff_min_ms      = 20;
+    p->backoff_max_ms      = 1000;
+}
+
+int udp_tlm_add_source(udp_tlm_t *p, const char *name, telemetry_build_fn build, void *user,
+                       uint32_t period_ms, uint8_t priority) {
+    if (!p || !build || p->n_src >= UDP_TLM_MAX_SOURCES) return -1;
+
+    udp_tlm_source_t *s = &p->src[p->n_src];
+    memset(s, 0, sizeof(*s));
+    s->name      = name ? name : "src";
+    s->build     = build;
+    s->user      = user;
+    s->period_ms = period_ms;
+    s->priority  = priority;
+    s->enabled   = true;
+    s->next_ms   = p->started ? p->last_refill_ms : 0; // 첫 step에서 due
+
+    return (int)p->n_src++;
+}
+
+void udp_tlm_set_period(udp_tlm_t *p, int id, uint32_t period_ms) {
+    if (valid_id(p, id)) p->src[id].period_ms = period_ms;
+}
+
+void udp_tlm_set_enabled(udp_tlm_t *p, int id, bool enabled) {
+    if (!valid_id(p, id)) return;
+    p->src[id].enabled = enabled;
+    p->src[id].waiting = false;
+}
+
+void udp_tlm_set_step_budget(udp_tlm_t *p, uint32_t max_dgrams) {
+    if (p) p->max_dgrams_per_step = max_dgrams ? max_dgrams : 1;
+}
+
+void udp_tlm_set_rate_limit(udp_tlm_t *p, uint32_t bytes_per_s, uint32_t burst_bytes) {
+    if (!p) return;
+    p->rate_Bps    = bytes_per_s;
+    p->burst_bytes = burst_bytes < UDP_TLM_MTU ? UDP_TLM_MTU : burst_bytes;
+    p->tokens_mB   = (uint64_t)p->burst_bytes * 1000u;
+}
 
-    net_udp_client_t *udp = NULL;
-    if (!net_udp_open(&udp, CFG_UDP_DST_IP, (uint16_t)CFG_UDP_DST_PORT)) {
-        printf("UDP open failed\n");
-        platform_deinit();
-        return false;
+void udp_tlm_set_backoff(udp_tlm_t *p, uint32_t min_ms, uint32_t max_ms) {
+    if (!p) return;
+    p->backoff_min_ms = min_ms ? min_ms : 1;
+    p->backoff_max_ms = max_ms < p->backoff_min_ms ? p->backoff_min_ms : max_ms;
+}
+
+uint32_t udp_tlm_step(udp_tlm_t *p, uint64_t now_ms) {
+    if (!p || !p->send) return 0;
+
+    if (!p->started) {
+        p->started        = true;
+        p->start_ms       = now_ms;
+        p->last_refill_ms = now_ms;
+        for (uint32_t i = 0; i < p->n_src; i++) {
+            if (p->src[i].next_ms == 0) p->src[i].next_ms = now_ms;
+        }
     }
-    printf("UDP ready -> %s:%u\n", CFG_UDP_DST_IP, (unsigned)CFG_UDP_DST_PORT);
+    p->stats.steps++;
+    refill(p, now_ms);
 
-    uint64_t next_ms = platform_millis() + (uint64_t)CFG_SEND_PERIOD_MS;
+    uint32_t sent_dgrams = 0;
+    const bool blocked = (int64_t)(p->blocked_until_ms - now_ms) > 0;
 
-    while (true) {
-        platform_poll();
+    while (!blocked && sent_dgrams < p->max_dgrams_per_step) {
+        size_t len = 0;
+        uint32_t taken = 0;
+        uint16_t line_len[UDP_TLM_MAX_SOURCES] = {0};
+
+        // due source를 우선순위 순으로 한 datagram에 묶음
+        while (true) {
+            const int id = pick_next(p, now_ms, taken);
+            if (id < 0) break;
+            udp_tlm_source_t *s = &p->src[id];
+
+            const size_t n = s->build(p->line, sizeof(p->line), now_ms, s->user);
+            if (n == 0 || n > sizeof(p->line)) {
+                reschedule(s, now_ms); // 이번 주기 출력 없음
+                continue;
+            }
+            s->stats.built++;
+
+            if (len + n > sizeof(p->pkt) || !have_tokens(p, len + n)) {
+                // 다음 datagram/step으로 (builder는 다시 호출됨 -> 최신 값)
+                s->stats.built--;
+                break;
+            }
+
+            memcpy(p->pkt + len, p->line, n);
+            len += n;
+            taken |= 1u << id;
+            line_len[id] = (uint16_t)n;
+        }
 
-        uint64_t now = platform_millis();
-        if ((int64_t)(now - next_ms) >= 0) {
-            next_ms += (uint64_t)CFG_SEND_PERIOD_MS;
+        if (len == 0) break;
 
-            char msg[128];
-            size_t n = build_fn(msg, sizeof(msg), now, user_ctx);
-            if (n > 0) {
-                (void)net_udp_send(udp, msg, n);
+        const bool ok = p->send(p->pkt, len, p->send_user);
+        for (uint32_t i = 0; i < p->n_src; i++) {
+            if (!((taken >> i) & 1u)) continue;
+            udp_tlm_source_t *s = &p->src[i];
+            if (ok) {
+                s->stats.sent++;
+                s->stats.bytes += line_len[i];
+            } else {
+                s->stats.dropped++; // stat 류는 재시도보다 다음 주기 최신 값이 유용
             }
+            reschedule(s, now_ms);
         }
 
-        platform_yield();
+        if (!ok) {
+            p->stats.send_fail++;
+            p->stats.backoffs++;
+            p->backoff_ms = p->backoff_ms ? p->backoff_ms * 2u : p->backoff_min_ms;
+            if (p->backoff_ms > p->backoff_max_ms) p->backoff_ms = p->backoff_max_ms;
+            p->blocked_until_ms = now_ms + p->backoff_ms;
+            break;
+        }
+
+        p->backoff_ms = 0;
+        if (p->rate_Bps) p->tokens_mB -= (uint64_t)len * 1000u;
+        p->stats.datagrams++;
+        p->stats.bytes += len;
+        sent_dgrams++;
     }
 
-    // never
-    net_udp_close(udp);
-    platform_deinit();
-    return true;
+    age_pending(p, now_ms);
+    return sent_dgrams;
+}
+
+bool udp_tlm_congested(const udp_tlm_t *p, uint64_t now_ms) {
+    if (!p) return false;
+    if ((int64_t)(p->blocked_until_ms - now_ms) > 0) return true;
+    for (uint32_t i = 0; i < p->n_src; i++) {
+        if (p->src[i].waiting) return true;
+    }
+    return false;
+}
+
+const udp_tlm_source_stats_t *udp_tlm_source_stats(const udp_tlm_t *p, int id) {
+    return valid_id(p, id) ? &p->src[id].stats : NULL;
+}
+
+const udp_tlm_stats_t *udp_tlm_get_stats(const udp_tlm_t *p) {
+    return p ? &p->stats : NULL;
+}
+
+size_t udp_tlm_stats_line(char *out, size_t out_sz, uint64_t now_ms, void *pipeline) {
+    const udp_tlm_t *p = (const udp_tlm_t *)pipeline;
+    if (!p || !out || out_sz == 0) return 0;
+
+    const uint64_t el_ms = now_ms - p->start_ms;
+    int n = snprintf(out, out_sz, "stat=tlm,ms=%llu,dg=%lu,fail=%lu",
+                     (unsigned long long)now_ms,
+                     (unsigned long)p->stats.datagrams,
+                     (unsigned long)p->stats.send_fail);
+
+    // source별 sent/drop/defer/평균 byte rate
+    for (uint32_t i = 0; i < p->n_src && n > 0 && (size_t)n < out_sz; i++) {
+        const udp_tlm_source_t *s = &p->src[i];
+        const unsigned long bps = el_ms ? (unsigned long)(s->stats.bytes * 1000u / el_ms) : 0;
+        n += snprintf(out + n, out_sz - (size_t)n, ",%s=%lu/%lu/%lu/%lu",
+                      s->name,
+                      (unsigned long)s->stats.sent,
+                      (unsigned long)s->stats.dropped,
+                      (unsigned long)s->stats.deferred,
+                      bps);
+    }
+    if (n <= 0 || (size_t)n + 1 >= out_sz) return 0;
+    out[n++] = '\n';
+    return (size_t)n;
 }
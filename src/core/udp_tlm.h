@@ -10,10 +10,117 @@
 extern "C" {
 #endif // __cplusplus
 
+// multi-source telemetry pipeline (non-blocking, main loop에서 udp_tlm_step 호출)
+//
+// - source마다 독립 주기/우선순위 (priority 0이 가장 높음)
+// - step마다 due source를 우선순위 순으로 한 datagram(UDP_TLM_MTU)에 줄 단위로 묶어 송신
+// - 송신 실패 -> backoff (지수 증가) 동안 송신 중단 = backpressure
+//   (udp_tlm_congested로 노출, 호출자는 다른 트래픽을 줄이는 데 사용)
+// - (옵션) token bucket byte rate limit
+// - 주기를 한 번 통째로 놓친 source 인스턴스는 버림 (오래된 stat을 쌓아 두지 않음)
+
+#ifndef UDP_TLM_MAX_SOURCES
+#define UDP_TLM_MAX_SOURCES   (24u)     // step의 taken bitmask가 32-bit -> 최대 32
+#endif
+#ifndef UDP_TLM_MTU
+#define UDP_TLM_MTU           (512u)    // datagram payload 최대
+#endif
+#define UDP_TLM_LINE_MAX      (256u)    // source 1회 출력 최대
+
 // payload builder: out에 메시지 써서 길이 리턴 (0이면 skip)
 typedef size_t (*telemetry_build_fn)(char *out, size_t out_sz, uint64_t now_ms, void *user_ctx);
 
-bool udp_telemetry_run(telemetry_build_fn build_fn, void *user_ctx);
+// 완성된 datagram 송신. 로컬 실패(링크 다운/pbuf 부족)면 false
+typedef bool (*udp_tlm_send_fn)(const void *data, size_t len, void *user);
+
+typedef struct {
+    uint32_t built;         // builder 호출 결과 줄 수
+    uint32_t sent;          // 송신 성공 줄 수
+    uint32_t dropped;       // 송신 실패 / 주기 초과로 버린 인스턴스
+    uint32_t deferred;      // due였으나 budget/backpressure로 다음 step으로 미룬 인스턴스
+    uint64_t bytes;         // 송신 성공 byte
+} udp_tlm_source_stats_t;
+
+typedef struct {
+    const char *name;
+    telemetry_build_fn build;
+    void *user;
+    uint32_t period_ms;
+    uint8_t  priority;
+    bool     enabled;
+
+    uint64_t next_ms;       // 다음 due 시각
+    bool     waiting;       // 현재 인스턴스가 deferred로 집계됨
+
+    udp_tlm_source_stats_t stats;
+} udp_tlm_source_t;
+
+typedef struct {
+    uint32_t steps;
+    uint32_t datagrams;
+    uint32_t send_fail;
+    uint64_t bytes;
+    uint32_t backoffs;      // backpressure 진입 횟수
+} udp_tlm_stats_t;
+
+typedef struct {
+    udp_tlm_source_t src[UDP_TLM_MAX_SOURCES];
+    uint32_t n_src;
+
+    udp_tlm_send_fn send;
+    void *send_user;
+
+    uint32_t max_dgrams_per_step;
+
+    // token bucket (rate_Bps=0: 무제한)
+    uint32_t rate_Bps;
+    uint32_t burst_bytes;
+    uint64_t tokens_mB;     // milli-byte 단위
+    uint64_t last_refill_ms;
+
+    // backpressure
+    uint32_t backoff_min_ms;
+    uint32_t backoff_max_ms;
+    uint32_t backoff_ms;    // 현재 (0: 정상)
+    uint64_t blocked_until_ms;
+
+    char pkt[UDP_TLM_MTU];
+    char line[UDP_TLM_LINE_MAX];
+
+    uint64_t start_ms;
+    bool     started;
+    udp_tlm_stats_t stats;
+} udp_tlm_t;
+
+void udp_tlm_init(udp_tlm_t *p, udp_tlm_send_fn send, void *send_user);
+
+// source 등록. source id (>= 0) 리턴, 가득 차면 -1. 첫 due는 등록 후 첫 step
+int udp_tlm_add_source(udp_tlm_t *p, const char *name, telemetry_build_fn build, void *user,
+                       uint32_t period_ms, uint8_t priority);
+
+void udp_tlm_set_period(udp_tlm_t *p, int id, uint32_t period_ms);
+void udp_tlm_set_enabled(udp_tlm_t *p, int id, bool enabled);
+
+// step당 최대 datagram 수 (기본 2)
+void udp_tlm_set_step_budget(udp_tlm_t *p, uint32_t max_dgrams);
+
+// byte rate limit (0 = 해제)
+void udp_tlm_set_rate_limit(udp_tlm_t *p, uint32_t bytes_per_s, uint32_t burst_bytes);
+
+// 송신 실패 시 backoff 범위 (기본 20 ~ 1000 ms)
+void udp_tlm_set_backoff(udp_tlm_t *p, uint32_t min_ms, uint32_t max_ms);
+
+// due source 처리. 이번 step에서 송신한 datagram 수 리턴
+uint32_t udp_tlm_step(udp_tlm_t *p, uint64_t now_ms);
+
+// backpressure: backoff 중이거나 due인데 못 보낸 source가 남아 있음
+bool udp_tlm_congested(const udp_tlm_t *p, uint64_t now_ms);
+
+const udp_tlm_source_stats_t *udp_tlm_source_stats(const udp_tlm_t *p, int id);
+const udp_tlm_stats_t *udp_tlm_get_stats(const udp_tlm_t *p);
+
+// "stat=tlm,ms=..,<name>=sent/drop/defer/Bps,..." 한 줄 (자체 source로 등록해서 사용 가능)
+size_t udp_tlm_stats_line(char *out, size_t out_sz, uint64_t now_ms, void *pipeline);
 
 #ifdef __cplusplus
 }
@@ -3,10 +3,10 @@
 
 #include <string.h>
 #include "pico/stdlib.h"
+#include "prof.h"
 
 // MS5611 commands (datasheet / command table)
 #define MS5611_CMD_RESET    0x1E
-#define MS5611_CMD_ADC_READ 0x00
 #define MS5611_CMD_PROM_RD  0xA0 // 0xA0..0xAE step 2
 
 #define MS5611_CMD_CONV_D1_BASE 0x40 // pressure
@@ -101,12 +101,20 @@ static ms5611_status_t read_adc24(ms5611_t *dev, uint32_t *out_adc) {
 static ms5611_status_t convert_and_read(ms5611_t *dev, bool is_temp, ms5611_osr_t osr, uint32_t *out_adc) {
     if (!out_adc) return MS5611_EINVAL;
 
+    PROF_T0(t_cmd);
     ms5611_status_t st = start_conversion(dev, is_temp, osr);
+    PROF_END(PROF_I2C_CMD, t_cmd);
     if (st != MS5611_OK) return st;
 
+    PROF_T0(t_wait);
     wait_conversion_done(osr);
+    dev->conv_end_us = time_us_32();
+    PROF_END(PROF_CONV_WAIT, t_wait);
 
-    return read_adc24(dev, out_adc);
+    PROF_T0(t_adc);
+    st = read_adc24(dev, out_adc);
+    PROF_END(PROF_ADC_READ, t_adc);
+    return st;
 }
 
 static ms5611_status_t read_prom_word(ms5611_t *dev, int idx, uint16_t *out_word) {
@@ -123,122 +131,11 @@ static ms5611_status_t read_prom_word(ms5611_t *dev, int idx, uint16_t *out_word
     return MS5611_OK;
 }
 
-static ms5611_status_t prom_sanity_check(const uint16_t prom[8]) {
-    if (!prom) return MS5611_EINVAL;
-
-    bool all0 = true, allf = true;
-    for (int i = 0; i < 8; i++) {
-        if (prom[i] != 0x0000) all0 = false;
-        if (prom[i] != 0xFFFF) allf = false;
-    }
-    if (all0 || allf) return MS5611_EPROM;
-    return MS5611_OK;
-}
-
-// CRC4 (MS5611 datasheet algorithm widely used)
-static uint8_t crc4_calc(const uint16_t prom[8]) {
-    uint16_t n_prom[8];
-    memcpy(n_prom, prom, sizeof(n_prom));
-
-    uint16_t n_rem = 0;
-    n_prom[7] &= 0xFF00; // clear CRC nibble
-
-    for (int cnt = 0; cnt < 16; cnt++) {
-        if (cnt & 1) n_rem ^= (uint16_t)(n_prom[cnt >> 1] & 0x00FF);
-        else         n_rem ^= (uint16_t)(n_prom[cnt >> 1] >> 8);
-
-        for (int n_bit = 0; n_bit < 8; n_bit++) {
-            if (n_rem & 0x8000) n_rem = (uint16_t)((n_rem << 1) ^ 0x3000);
-            else                n_rem = (uint16_t)(n_rem << 1);
-        }
-    }
-    n_rem = (n_rem >> 12) & 0x000F;
-    return (uint8_t)n_rem;
-}
-
-static ms5611_status_t prom_crc_check(const uint16_t prom[8]) {
-    if (!prom) return MS5611_EINVAL;
-
-    const uint8_t crc_read = (uint8_t)(prom[7] & 0x000F);
-    const uint8_t crc_calc = crc4_calc(prom);
-    if (crc_calc != crc_read) return MS5611_ECRC;
-
-    return MS5611_OK;
-}
-
 static void store_prom(ms5611_t *dev, const uint16_t prom[8]) {
     // memcpy 반환값 체크는 일반적으로 의미가 없어(항상 dest 반환).
     memcpy(dev->prom, prom, sizeof(dev->prom));
 }
 
-typedef struct {
-    int64_t C1, C2, C3, C4, C5, C6;
-} ms5611_coeffs_t;
-
-static void load_coeffs(const ms5611_t *dev, ms5611_coeffs_t *c) {
-    c->C1 = dev->prom[1];
-    c->C2 = dev->prom[2];
-    c->C3 = dev->prom[3];
-    c->C4 = dev->prom[4];
-    c->C5 = dev->prom[5];
-    c->C6 = dev->prom[6];
-}
-
-static ms5611_status_t compensate_and_check(const ms5611_coeffs_t *c,
-                                           uint32_t D1,
-                                           uint32_t D2,
-                                           int32_t *out_temp_c_x100,
-                                           uint32_t *out_press_pa) {
-    if (!c || !out_temp_c_x100 || !out_press_pa) return MS5611_EINVAL;
-
-    // ---- compensation (datasheet) ----
-    // dT = D2 - C5*2^8
-    int64_t dT = (int64_t)D2 - (c->C5 << 8);
-
-    // TEMP = 2000 + dT*C6 / 2^23  (0.01°C)
-    int64_t TEMP = 2000 + ((dT * c->C6) >> 23);
-
-    // OFF  = C2*2^16 + (C4*dT)/2^7
-    int64_t OFF  = (c->C2 << 16) + ((c->C4 * dT) >> 7);
-
-    // SENS = C1*2^15 + (C3*dT)/2^8
-    int64_t SENS = (c->C1 << 15) + ((c->C3 * dT) >> 8);
-
-    // Second-order temperature compensation (low temp)
-    int64_t T2 = 0, OFF2 = 0, SENS2 = 0;
-    if (TEMP < 2000) {
-        T2 = (dT * dT) >> 31;
-
-        int64_t t = TEMP - 2000;
-        OFF2  = (5 * t * t) >> 1;
-        SENS2 = (5 * t * t) >> 2;
-
-        if (TEMP < -1500) {
-            int64_t t2 = TEMP + 1500;
-            OFF2  += 7 * t2 * t2;
-            SENS2 += (11 * t2 * t2) >> 1;
-        }
-    }
-
-    TEMP -= T2;
-    OFF  -= OFF2;
-    SENS -= SENS2;
-
-    // P = (D1*SENS/2^21 - OFF)/2^15
-    int64_t P = (((int64_t)D1 * SENS) >> 21) - OFF;
-    P = P >> 15;
-
-    // MS5611 datasheet example output pressure unit is 0.01 mbar.
-    // 0.01 mbar == 1 Pa 이므로, 여기서는 Pa로 그대로 해석 가능.
-    if (P < 0 || P > 200000) { // 느슨한 가드: (정상 대기압 부근 기준으로 충분히 넓게)
-        return MS5611_ERANGE;
-    }
-
-    *out_temp_c_x100 = (int32_t)TEMP;
-    *out_press_pa    = (uint32_t)P;
-    return MS5611_OK;
-}
-
 // ---------- public API ----------
 
 const char *ms5611_status_str(ms5611_status_t st) {
@@ -281,10 +178,7 @@ ms5611_status_t ms5611_read_prom(ms5611_t *dev, uint16_t out_prom[8]) {
     }
 
     // 2) sanity + CRC
-    ms5611_status_t st = prom_sanity_check(out_prom);
-    if (st != MS5611_OK) return st;
-
-    st = prom_crc_check(out_prom);
+    ms5611_status_t st = ms5611_prom_validate(out_prom);
     if (st != MS5611_OK) return st;
 
     // 3) store
@@ -311,6 +205,16 @@ ms5611_status_t ms5611_init(ms5611_t *dev, i2c_pico_t *i2c, uint8_t addr7) {
     return MS5611_OK;
 }
 
+ms5611_status_t ms5611_read_raw(ms5611_t *dev, const ms5611_config_t *cfg, uint32_t *D1, uint32_t *D2) {
+    if (!dev || !dev->i2c || !cfg || !D1 || !D2) return MS5611_EINVAL;
+    if (!dev->initialized) return MS5611_ESTATE;
+
+    // conversions (return-value checks mandatory)
+    ms5611_status_t st = convert_and_read(dev, true, cfg->osr, D2);     // temperature ADC
+    if (st != MS5611_OK) return st;
+    return convert_and_read(dev, false, cfg->osr, D1);  // pressure ADC
+}
+
 ms5611_status_t ms5611_read(ms5611_t *dev,
                             const ms5611_config_t *cfg,
                             int32_t *temp_c_x100,
@@ -318,18 +222,144 @@ ms5611_status_t ms5611_read(ms5611_t *dev,
     ms5611_status_t st = validate_read_args(dev, cfg, temp_c_x100, press_pa);
     if (st != MS5611_OK) return st;
 
-    // 1) conversions (return-value checks mandatory)
-    uint32_t D2 = 0; // temperature ADC
-    st = convert_and_read(dev, true, cfg->osr, &D2);
-    if (st != MS5611_OK) return st;
-
-    uint32_t D1 = 0; // pressure ADC
-    st = convert_and_read(dev, false, cfg->osr, &D1);
+    // 1) conversions
+    uint32_t D1 = 0, D2 = 0;
+    st = ms5611_read_raw(dev, cfg, &D1, &D2);
     if (st != MS5611_OK) return st;
 
     // 2) compensation
+    PROF_T0(t_comp);
     ms5611_coeffs_t c;
-    load_coeffs(dev, &c);
+    ms5611_load_coeffs(dev->prom, &c);
+
+    st = ms5611_compensate(&c, D1, D2, temp_c_x100, press_pa);
+    PROF_END(PROF_COMPENSATE, t_comp);
+    return st;
+}
+
+ms5611_status_t ms5611_conv_start(ms5611_t *dev, bool is_temp, ms5611_osr_t osr, uint32_t margin_us,
+                                  uint32_t *due_us) {
+    if (!dev || !due_us) return MS5611_EINVAL;
+    if (!dev->initialized) return MS5611_ESTATE;
+
+    PROF_T0(t_cmd);
+    ms5611_status_t st = start_conversion(dev, is_temp, osr);
+    PROF_END(PROF_I2C_CMD, t_cmd);
+    if (st != MS5611_OK) return st;
+
+    *due_us = time_us_32() + conv_time_us_max(osr) + margin_us;
+    return MS5611_OK;
+}
+
+uint8_t ms5611_conv_cmd(bool is_temp, ms5611_osr_t osr) {
+    return build_conv_cmd(is_temp, osr);
+}
+
+uint32_t ms5611_conv_time_us(ms5611_osr_t osr) {
+    return conv_time_us_max(osr);
+}
+
+ms5611_status_t ms5611_adc_read(ms5611_t *dev, uint32_t *adc) {
+    if (!dev || !adc) return MS5611_EINVAL;
+    if (!dev->initialized) return MS5611_ESTATE;
+
+    dev->conv_end_us = time_us_32();
+    PROF_T0(t_adc);
+    ms5611_status_t st = read_adc24(dev, adc);
+    PROF_END(PROF_ADC_READ, t_adc);
+    if (st != MS5611_OK) return st;
+    return (*adc == 0) ? MS5611_ERANGE : MS5611_OK;
+}
+
+// ---------- burst acquisition ----------
+
+// conversion command 1개 + bus 시간 누적, 완료 예정 시각 설정
+static ms5611_status_t burst_cmd(ms5611_t *dev, ms5611_burst_t *b, bool is_temp) {
+    const uint32_t t0 = time_us_32();
+    ms5611_status_t st = start_conversion(dev, is_temp, b->osr);
+    const uint32_t t1 = time_us_32();
+    b->bus_us += t1 - t0;
+    if (st != MS5611_OK) return st;
+
+    b->phase  = is_temp ? 1u : 2u;
+    b->due_us = t1 + conv_time_us_max(b->osr) + b->margin_us;
+    return MS5611_OK;
+}
+
+ms5611_status_t ms5611_burst_start(ms5611_t *dev, ms5611_burst_t *b,
+                                   ms5611_osr_t osr, uint32_t temp_every, uint32_t margin_us) {
+    if (!dev || !dev->i2c || !b) return MS5611_EINVAL;
+    if (!dev->initialized) return MS5611_ESTATE;
+
+    // 통계는 유지 (오류 후 재시작해도 누적)
+    b->osr         = osr;
+    b->temp_every  = temp_every ? temp_every : 1u;
+    b->margin_us   = margin_us;
+    b->phase       = 0;
+    b->d1_since_d2 = 0;
+
+    // 온도부터: 첫 D1 보상에 필요
+    ms5611_status_t st = burst_cmd(dev, b, true);
+    if (st != MS5611_OK) b->errors++;
+    return st;
+}
+
+ms5611_status_t ms5611_burst_poll(ms5611_t *dev, ms5611_burst_t *b, bool *ready, uint32_t *D1, uint32_t *D2) {
+    if (!dev || !dev->i2c || !b || !ready || !D1 || !D2) return MS5611_EINVAL;
+    *ready = false;
+    if (!dev->initialized || b->phase == 0) return MS5611_ESTATE;
+
+    const uint32_t now = time_us_32();
+    if ((int32_t)(now - b->due_us) < 0) return MS5611_OK;
+
+    const uint32_t late = now - b->due_us;
+    b->late_us += late;
+    if (late > b->late_max_us) b->late_max_us = late;
+
+    const bool was_temp = (b->phase == 1u);
+    uint32_t adc = 0;
+
+    PROF_T0(t_adc);
+    ms5611_status_t st = read_adc24(dev, &adc);
+    PROF_END(PROF_ADC_READ, t_adc);
+    dev->conv_end_us = now;
+    b->bus_us += time_us_32() - now;
+
+    // ADC 0 = 변환 미완료/중단 (datasheet) -> 오류로 보고 온도부터 다시
+    if (st != MS5611_OK || adc == 0) {
+        b->errors++;
+        b->phase = 0;
+        return (st != MS5611_OK) ? st : MS5611_ERANGE;
+    }
+
+    bool next_temp = false;
+    if (was_temp) {
+        b->d2 = adc;
+        b->d2_count++;
+        b->d1_since_d2 = 0;
+    } else {
+        b->d1_count++;
+        b->d1_since_d2++;
+        next_temp = (b->d1_since_d2 >= b->temp_every);
+    }
+
+    // 다음 conversion을 바로 시작 (보상/decimation은 이 변환 시간 동안)
+    PROF_T0(t_cmd);
+    st = burst_cmd(dev, b, next_temp);
+    PROF_END(PROF_I2C_CMD, t_cmd);
+    if (st != MS5611_OK) {
+        b->errors++;
+        b->phase = 0;   // 다음 poll이 ESTATE -> 호출자가 재시작
+    }
+
+    if (!was_temp) {
+        *ready = true;
+        *D1 = adc;
+        *D2 = b->d2;
+    }
+    return MS5611_OK;
+}
 
-    return compensate_and_check(&c, D1, D2, temp_c_x100, press_pa);
+void ms5611_burst_stop(ms5611_burst_t *b) {
+    if (b) b->phase = 0;
 }
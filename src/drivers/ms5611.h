@@ -6,28 +6,16 @@
 #include <stdint.h>
 
 #include "i2c_pico.h"
+#include "ms5611_math.h" // status codes, PROM/compensation math
 
 #ifdef __cplusplus
 extern "C" {
 #endif // __cplusplus
 
-// 0: OK
-// <0: error
-// I2C 오류는 i2c_pico_status_t를 그대로 패스스루(예: -5, -13 등)
-typedef int32_t ms5611_status_t;
-
-enum {
-    MS5611_OK       = 0,
-
-    MS5611_EINVAL   = -2000,
-    MS5611_ESTATE   = -2001,
-    MS5611_EPROM    = -2002,
-    MS5611_ECRC     = -2003,
-    MS5611_ERANGE   = -2004
-};
-
 const char *ms5611_status_str(ms5611_status_t st);
 
+#define MS5611_CMD_ADC_READ 0x00 // 직전 conversion 결과 (24-bit) read
+
 // OSR (conversion command에 매핑)
 typedef enum {
     MS5611_OSR_256  = 256,
@@ -48,8 +36,57 @@ typedef struct {
 
     // PROM words (0..7)
     uint16_t prom[8];
+
+    // 마지막 conversion 완료 시각 (time_us_32, ms5611_read 후에는 D1) -> end-to-end latency 기준점
+    uint32_t conv_end_us;
 } ms5611_t;
 
+// non-blocking 1-step (sensor registry / 외부 scheduler용)
+// conversion command 송신 -> *due_us (datasheet max + margin_us). 대기는 호출자가 due_us 비교로
+ms5611_status_t ms5611_conv_start(ms5611_t *dev, bool is_temp, ms5611_osr_t osr, uint32_t margin_us,
+                                  uint32_t *due_us);
+
+// conversion 완료 후 ADC 24-bit read (ADC 0 = 미완료/중단 -> MS5611_ERANGE). conv_end_us 갱신
+ms5611_status_t ms5611_adc_read(ms5611_t *dev, uint32_t *adc);
+
+// IRQ 수집용 (command를 i2c_pico_async_xfer로 직접 송신): conversion command byte / datasheet max 변환 시간
+uint8_t  ms5611_conv_cmd(bool is_temp, ms5611_osr_t osr);
+uint32_t ms5611_conv_time_us(ms5611_osr_t osr);
+
+// burst acquisition: 연속 conversion (non-blocking state machine)
+// - ADC read 직후 같은 호출에서 다음 conversion command -> 센서는 쉬지 않고 변환,
+//   보상/decimation 등 CPU 작업은 다음 conversion 시간 동안 수행 (overlap)
+// - 대기는 sleep이 아니라 deadline 비교 -> 호출자가 자주 poll 할수록 실제 rate가 이론치에 가까움
+// - 온도(D2)는 천천히 변하므로 D1 temp_every회마다 1회 (pressure rate ~2배)
+typedef struct {
+    ms5611_osr_t osr;
+    uint32_t temp_every;
+    uint32_t margin_us;     // conversion max time 뒤 여유
+
+    uint8_t  phase;         // 0: 정지, 1: D2 변환 중, 2: D1 변환 중
+    uint32_t due_us;        // 현재 conversion 완료 예정 시각
+    uint32_t d1_since_d2;
+    uint32_t d2;            // 마지막 온도 ADC
+
+    // 누적 통계
+    uint32_t d1_count;
+    uint32_t d2_count;
+    uint32_t errors;
+    uint64_t bus_us;        // I2C transaction 시간 합 (read + command)
+    uint64_t late_us;       // 완료 예정 시각 이후 poll이 늦은 시간 합 (센서 유휴)
+    uint32_t late_max_us;
+} ms5611_burst_t;
+
+// 첫 conversion(D2) 시작
+ms5611_status_t ms5611_burst_start(ms5611_t *dev, ms5611_burst_t *b,
+                                   ms5611_osr_t osr, uint32_t temp_every, uint32_t margin_us);
+
+// conversion이 끝났으면 ADC read + 다음 conversion 시작.
+// 새 pressure 값이면 *ready=true + D1/D2 (D2는 가장 최근 온도). I2C 오류 시 burst를 D2부터 재시작
+ms5611_status_t ms5611_burst_poll(ms5611_t *dev, ms5611_burst_t *b, bool *ready, uint32_t *D1, uint32_t *D2);
+
+void ms5611_burst_stop(ms5611_burst_t *b);
+
 void ms5611_config_default(ms5611_config_t *cfg);
 
 // init: reset -> PROM read -> CRC check
@@ -59,7 +96,10 @@ ms5611_status_t ms5611_init(ms5611_t *dev, i2c_pico_t *i2c, uint8_t addr7);
 ms5611_status_t ms5611_reset(ms5611_t *dev);
 ms5611_status_t ms5611_read_prom(ms5611_t *dev, uint16_t out_prom[8]); // also stores in dev
 
-// read
+// raw read (D2 -> D1 conversion, 보상 없음): raw trace capture / host replay용
+ms5611_status_t ms5611_read_raw(ms5611_t *dev, const ms5611_config_t *cfg, uint32_t *D1, uint32_t *D2);
+
+// read (= ms5611_read_raw + ms5611_compensate)
 // returns: temp_c_x100 (0.01°C), press_pa (Pa)
 ms5611_status_t ms5611_read(ms5611_t *dev,
                             const ms5611_config_t *cfg,
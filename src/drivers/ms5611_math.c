@@ -0,0 +1,122 @@
+// FILE: src/drivers/ms5611_math.c
+#include "ms5611_math.h"
+
+#include <string.h>
+
+// ---------- internal helpers ----------
+
+static ms5611_status_t prom_sanity_check(const uint16_t prom[8]) {
+    if (!prom) return MS5611_EINVAL;
+
+    bool all0 = true, allf = true;
+    for (int i = 0; i < 8; i++) {
+        if (prom[i] != 0x0000) all0 = false;
+        if (prom[i] != 0xFFFF) allf = false;
+    }
+    if (all0 || allf) return MS5611_EPROM;
+    return MS5611_OK;
+}
+
+static ms5611_status_t prom_crc_check(const uint16_t prom[8]) {
+    if (!prom) return MS5611_EINVAL;
+
+    const uint8_t crc_read = (uint8_t)(prom[7] & 0x000F);
+    const uint8_t crc_calc = ms5611_crc4(prom);
+    if (crc_calc != crc_read) return MS5611_ECRC;
+
+    return MS5611_OK;
+}
+
+// ---------- public API ----------
+
+// CRC4 (MS5611 datasheet algorithm widely used)
+uint8_t ms5611_crc4(const uint16_t prom[8]) {
+    uint16_t n_prom[8];
+    memcpy(n_prom, prom, sizeof(n_prom));
+
+    uint16_t n_rem = 0;
+    n_prom[7] &= 0xFF00; // clear CRC nibble
+
+    for (int cnt = 0; cnt < 16; cnt++) {
+        if (cnt & 1) n_rem ^= (uint16_t)(n_prom[cnt >> 1] & 0x00FF);
+        else         n_rem ^= (uint16_t)(n_prom[cnt >> 1] >> 8);
+
+        for (int n_bit = 0; n_bit < 8; n_bit++) {
+            if (n_rem & 0x8000) n_rem = (uint16_t)((n_rem << 1) ^ 0x3000);
+            else                n_rem = (uint16_t)(n_rem << 1);
+        }
+    }
+    n_rem = (n_rem >> 12) & 0x000F;
+    return (uint8_t)n_rem;
+}
+
+ms5611_status_t ms5611_prom_validate(const uint16_t prom[8]) {
+    ms5611_status_t st = prom_sanity_check(prom);
+    if (st != MS5611_OK) return st;
+    return prom_crc_check(prom);
+}
+
+void ms5611_load_coeffs(const uint16_t prom[8], ms5611_coeffs_t *c) {
+    if (!prom || !c) return;
+    c->C1 = prom[1];
+    c->C2 = prom[2];
+    c->C3 = prom[3];
+    c->C4 = prom[4];
+    c->C5 = prom[5];
+    c->C6 = prom[6];
+}
+
+ms5611_status_t ms5611_compensate(const ms5611_coeffs_t *c,
+                                  uint32_t D1,
+                                  uint32_t D2,
+                                  int32_t *out_temp_c_x100,
+                                  uint32_t *out_press_pa) {
+    if (!c || !out_temp_c_x100 || !out_press_pa) return MS5611_EINVAL;
+
+    // ---- compensation (datasheet) ----
+    // dT = D2 - C5*2^8
+    int64_t dT = (int64_t)D2 - (c->C5 << 8);
+
+    // TEMP = 2000 + dT*C6 / 2^23  (0.01°C)
+    int64_t TEMP = 2000 + ((dT * c->C6) >> 23);
+
+    // OFF  = C2*2^16 + (C4*dT)/2^7
+    int64_t OFF  = (c->C2 << 16) + ((c->C4 * dT) >> 7);
+
+    // SENS = C1*2^15 + (C3*dT)/2^8
+    int64_t SENS = (c->C1 << 15) + ((c->C3 * dT) >> 8);
+
+    // Second-order temperature compensation (low temp)
+    int64_t T2 = 0, OFF2 = 0, SENS2 = 0;
+    if (TEMP < 2000) {
+        T2 = (dT * dT) >> 31;
+
+        int64_t t = TEMP - 2000;
+        OFF2  = (5 * t * t) >> 1;
+        SENS2 = (5 * t * t) >> 2;
+
+        if (TEMP < -1500) {
+            int64_t t2 = TEMP + 1500;
+            OFF2  += 7 * t2 * t2;
+            SENS2 += (11 * t2 * t2) >> 1;
+        }
+    }
+
+    TEMP -= T2;
+    OFF  -= OFF2;
+    SENS -= SENS2;
+
+    // P = (D1*SENS/2^21 - OFF)/2^15
+    int64_t P = (((int64_t)D1 * SENS) >> 21) - OFF;
+    P = P >> 15;
+
+    // MS5611 datasheet example output pressure unit is 0.01 mbar.
+    // 0.01 mbar == 1 Pa 이므로, 여기서는 Pa로 그대로 해석 가능.
+    if (P < 0 || P > 200000) { // 느슨한 가드: (정상 대기압 부근 기준으로 충분히 넓게)
+        return MS5611_ERANGE;
+    }
+
+    *out_temp_c_x100 = (int32_t)TEMP;
+    *out_press_pa    = (uint32_t)P;
+    return MS5611_OK;
+}
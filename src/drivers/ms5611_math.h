@@ -0,0 +1,54 @@
+// FILE: src/drivers/ms5611_math.h
+#ifndef __MS5611_MATH_H__
+#define __MS5611_MATH_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+// MS5611 pure computation: PROM 검증(sanity + CRC4) + 1/2차 보상
+// I2C/pico SDK 의존 없음 -> driver(ms5611.c)와 host benchmark가 같은 코드를 compile
+
+// 0: OK
+// <0: error
+// I2C 오류는 i2c_pico_status_t를 그대로 패스스루(예: -5, -13 등)
+typedef int32_t ms5611_status_t;
+
+enum {
+    MS5611_OK       = 0,
+
+    MS5611_EINVAL   = -2000,
+    MS5611_ESTATE   = -2001,
+    MS5611_EPROM    = -2002,
+    MS5611_ECRC     = -2003,
+    MS5611_ERANGE   = -2004
+};
+
+// PROM C1..C6 (보상식에서 64-bit로 사용)
+typedef struct {
+    int64_t C1, C2, C3, C4, C5, C6;
+} ms5611_coeffs_t;
+
+// PROM word 7 하위 nibble과 비교할 CRC4
+uint8_t ms5611_crc4(const uint16_t prom[8]);
+
+// all-0 / all-1 검사 + CRC4 (MS5611_EPROM / MS5611_ECRC)
+ms5611_status_t ms5611_prom_validate(const uint16_t prom[8]);
+
+void ms5611_load_coeffs(const uint16_t prom[8], ms5611_coeffs_t *c);
+
+// D1 (pressure ADC), D2 (temperature ADC) -> 0.01°C, Pa (범위 밖이면 MS5611_ERANGE)
+ms5611_status_t ms5611_compensate(const ms5611_coeffs_t *c,
+                                  uint32_t D1,
+                                  uint32_t D2,
+                                  int32_t *out_temp_c_x100,
+                                  uint32_t *out_press_pa);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif /* __MS5611_MATH_H__ */
@@ -0,0 +1,108 @@
+// FILE: src/drivers/ms5611_sensor.c
+#include "ms5611_sensor.h"
+
+#include <string.h>
+
+#include "prof.h"
+
+// ---------- internal helpers ----------
+
+static int32_t ms_init(void *dev) {
+    ms5611_sensor_t *s = (ms5611_sensor_t *)dev;
+    if (!s || !s->dev) return MS5611_EINVAL;
+
+    if (!s->dev->initialized) {
+        const ms5611_status_t st = ms5611_init(s->dev, s->i2c, s->addr7);
+        if (st != MS5611_OK) return st;
+    }
+    ms5611_load_coeffs(s->dev->prom, &s->coeffs);
+    s->phase = 0;
+    return MS5611_OK;
+}
+
+static int32_t ms_start(void *dev, uint32_t now_us) {
+    (void)now_us;
+    ms5611_sensor_t *s = (ms5611_sensor_t *)dev;
+
+    // 온도 먼저 (ms5611_read와 같은 순서)
+    const ms5611_status_t st = ms5611_conv_start(s->dev, true, s->osr, s->margin_us, &s->due_us);
+    s->phase = (st == MS5611_OK) ? 1u : 0u;
+    return st;
+}
+
+static int32_t ms_poll(void *dev, uint32_t now_us) {
+    ms5611_sensor_t *s = (ms5611_sensor_t *)dev;
+    if (s->phase == 0) return MS5611_ESTATE;
+    if ((int32_t)(now_us - s->due_us) < 0) return SENSOR_PENDING;
+
+    uint32_t adc = 0;
+    ms5611_status_t st = ms5611_adc_read(s->dev, &adc);
+    if (st != MS5611_OK) {
+        s->phase = 0;
+        return st;
+    }
+
+    if (s->phase == 2u) {
+        s->d1    = adc;
+        s->phase = 0;
+        return SENSOR_READY;
+    }
+
+    s->d2 = adc;
+    st = ms5611_conv_start(s->dev, false, s->osr, s->margin_us, &s->due_us);
+    if (st != MS5611_OK) {
+        s->phase = 0;
+        return st;
+    }
+    s->phase = 2u;
+    return SENSOR_STEP;
+}
+
+static uint32_t ms_read_raw(void *dev, uint32_t raw[SENSOR_RAW_MAX]) {
+    const ms5611_sensor_t *s = (const ms5611_sensor_t *)dev;
+    raw[0] = s->d1;
+    raw[1] = s->d2;
+    return 2u;
+}
+
+static int32_t ms_convert(const void *dev, const uint32_t *raw, uint32_t n, sensor_sample_t *out) {
+    const ms5611_sensor_t *s = (const ms5611_sensor_t *)dev;
+    if (n < 2u) return MS5611_EINVAL;
+
+    int32_t  t_x100 = 0;
+    uint32_t p_pa   = 0;
+    PROF_T0(t_comp);
+    const ms5611_status_t st = ms5611_compensate(&s->coeffs, raw[0], raw[1], &t_x100, &p_pa);
+    PROF_END(PROF_COMPENSATE, t_comp);
+    if (st != MS5611_OK) return st;
+
+    out->n      = 2u;
+    out->qty[0] = SENSOR_Q_TEMP_CX100;
+    out->val[0] = t_x100;
+    out->qty[1] = SENSOR_Q_PRESS_PA;
+    out->val[1] = (int32_t)p_pa;
+    out->t_us   = s->dev->conv_end_us;   // D1 conversion 완료 (gy63_read 경로와 같은 기준점)
+    return MS5611_OK;
+}
+
+// ---------- public API ----------
+
+const sensor_ops_t ms5611_sensor_ops = {
+    .name     = "ms5611",
+    .init     = ms_init,
+    .start    = ms_start,
+    .poll     = ms_poll,
+    .read_raw = ms_read_raw,
+    .convert  = ms_convert,
+};
+
+void ms5611_sensor_bind(ms5611_sensor_t *s, ms5611_t *dev, i2c_pico_t *i2c, uint8_t addr7,
+                        ms5611_osr_t osr, uint32_t margin_us) {
+    if (!s) return;
+    memset(s, 0, sizeof(*s));
+    s->dev       = dev;
+    s->i2c       = i2c;
+    s->addr7     = addr7;
+    s->osr       = osr;
+    s->margin_us = margin_us;
+}
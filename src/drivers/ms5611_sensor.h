@@ -0,0 +1,43 @@
+// FILE: src/drivers/ms5611_sensor.h
+#ifndef __MS5611_SENSOR_H__
+#define __MS5611_SENSOR_H__
+
+#include <stdint.h>
+
+#include "ms5611.h"
+#include "sensor.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+// MS5611 sensor_ops_t 구현
+// - 측정 1회: start = D2 command, poll = (D2 완료) ADC read + D1 command -> SENSOR_STEP,
+//   (D1 완료) ADC read -> SENSOR_READY.  raw = { D1, D2 }
+// - convert = ms5611_compensate (PROM coeffs는 init에서 1회), sample = TEMP_CX100 + PRESS_PA
+// - ms5611_t는 호출자 소유: 이미 init된 device면 PROM을 다시 읽지 않음
+
+typedef struct {
+    ms5611_t       *dev;
+    i2c_pico_t     *i2c;
+    uint8_t         addr7;
+    ms5611_osr_t    osr;        // 측정 시작 시점 값 적용 (control channel 변경 반영)
+    uint32_t        margin_us;
+
+    ms5611_coeffs_t coeffs;
+    uint8_t         phase;      // 0: idle, 1: D2, 2: D1
+    uint32_t        due_us;
+    uint32_t        d1;
+    uint32_t        d2;
+} ms5611_sensor_t;
+
+extern const sensor_ops_t ms5611_sensor_ops;
+
+void ms5611_sensor_bind(ms5611_sensor_t *s, ms5611_t *dev, i2c_pico_t *i2c, uint8_t addr7,
+                        ms5611_osr_t osr, uint32_t margin_us);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif /* __MS5611_SENSOR_H__ */
@@ -0,0 +1,65 @@
+// FILE: src/drivers/sensor.h
+#ifndef __SENSOR_H__
+#define __SENSOR_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+// Sensor driver interface (ops table) + tagged sample
+//
+// - 측정 1회 = start -> poll ... (>0) -> read_raw -> convert
+//   start/poll은 non-blocking: conversion 대기는 driver가 deadline으로, 여러 단계(예: MS5611 D2 -> D1)는
+//   poll 안에서 다음 command까지 진행
+// - read_raw / convert 분리: raw word는 그대로 기록/재생 가능, convert는 I/O 없는 pure 함수 (host 재사용)
+// - 상태 코드: 0 OK, <0 driver 오류 (ms5611_status_t / i2c_pico_status_t 그대로)
+// - 호출은 한 thread(main loop)에서만. 같은 bus의 sensor들은 registry가 순서대로 호출 (transaction 단위 직렬)
+
+#define SENSOR_VAL_MAX  (3u)    // 한 sample의 값 개수 (T + P, T + RH, x/y/z)
+#define SENSOR_RAW_MAX  (4u)    // raw word 개수
+
+// 값 종류 (단위 포함, 고정소수점)
+typedef enum {
+    SENSOR_Q_NONE = 0,
+    SENSOR_Q_TEMP_CX100,    // 0.01 C
+    SENSOR_Q_PRESS_PA,      // Pa
+    SENSOR_Q_RH_X100,       // 0.01 %RH
+    SENSOR_Q_ACCEL_MG,      // mg (x/y/z 순서)
+    SENSOR_Q_COUNT
+} sensor_qty_t;
+
+// poll 결과
+enum {
+    SENSOR_PENDING = 0,     // 진행 중 (bus 사용 없음)
+    SENSOR_READY   = 1,     // raw 준비됨
+    SENSOR_STEP    = 2,     // 다음 단계 command 송신 (bus 사용, 아직 미완료)
+};
+
+// tagged sample (24 byte): 어떤 sensor의 어떤 값인지 sample 안에 포함 -> 소비자는 sensor 종류를 몰라도 됨
+typedef struct {
+    uint32_t t_us;                      // 측정 완료 시각 (time_us_32)
+    uint8_t  id;                        // registry slot
+    uint8_t  n;                         // 유효 값 개수
+    uint8_t  qty[SENSOR_VAL_MAX];       // sensor_qty_t
+    uint8_t  rsv[3];
+    int32_t  val[SENSOR_VAL_MAX];
+} sensor_sample_t;
+
+typedef struct sensor_ops {
+    const char *name;
+
+    int32_t  (*init)(void *dev);                                            // 1회 (PROM 등)
+    int32_t  (*start)(void *dev, uint32_t now_us);                          // 측정 시작
+    int32_t  (*poll)(void *dev, uint32_t now_us);                           // SENSOR_* 또는 <0
+    uint32_t (*read_raw)(void *dev, uint32_t raw[SENSOR_RAW_MAX]);          // 준비된 raw word 수
+    int32_t  (*convert)(const void *dev, const uint32_t *raw, uint32_t n, sensor_sample_t *out); // val/qty/n
+} sensor_ops_t;
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif /* __SENSOR_H__ */
@@ -0,0 +1,172 @@
+// FILE: src/drivers/sensor_reg.c
+#include "sensor_reg.h"
+
+#include <stdio.h>
+#include <string.h>
+
+// ---------- internal helpers ----------
+
+static void slot_fail(sensor_slot_t *s, int32_t st) {
+    s->busy     = false;
+    s->errors++;
+    s->last_err = st;
+}
+
+// 다음 측정 시각 (밀렸으면 누적하지 않음)
+static void slot_advance(sensor_slot_t *s, uint32_t now_us) {
+    s->next_us += s->period_us;
+    if ((int32_t)(now_us - s->next_us) >= 0) s->next_us = now_us + s->period_us;
+}
+
+// READY slot: raw (-> tap) -> tagged sample
+static bool slot_collect(const sensor_reg_t *r, sensor_slot_t *s, uint32_t id, uint32_t now_us,
+                         sensor_sample_t *out) {
+    uint32_t raw[SENSOR_RAW_MAX];
+    const uint32_t nraw = s->ops->read_raw(s->dev, raw);
+    if (r->tap) r->tap(id, now_us, raw, nraw, r->tap_user);
+
+    memset(out, 0, sizeof(*out));
+    out->t_us = now_us;
+    out->id   = (uint8_t)id;
+
+    const int32_t st = s->ops->convert(s->dev, raw, nraw, out);
+    if (st < 0) {
+        slot_fail(s, st);
+        return false;
+    }
+    s->busy = false;
+    s->samples++;
+    return true;
+}
+
+// ---------- public API ----------
+
+void sensor_reg_init(sensor_reg_t *r) {
+    if (!r) return;
+    memset(r, 0, sizeof(*r));
+}
+
+int32_t sensor_reg_add(sensor_reg_t *r, const sensor_ops_t *ops, void *dev, uint8_t bus, uint32_t period_us) {
+    if (!r || !ops || r->n >= SENSOR_REG_MAX) return -1;
+    if (!ops->start || !ops->poll || !ops->read_raw || !ops->convert) return -1;
+
+    sensor_slot_t *s = &r->slot[r->n];
+    memset(s, 0, sizeof(*s));
+    s->ops       = ops;
+    s->dev       = dev;
+    s->bus       = bus;
+    s->period_us = period_us;
+    return (int32_t)r->n++;
+}
+
+uint32_t sensor_reg_init_all(sensor_reg_t *r, uint32_t now_us) {
+    if (!r) return 0;
+
+    uint32_t ok = 0;
+    for (uint32_t i = 0; i < r->n; i++) {
+        sensor_slot_t *s = &r->slot[i];
+        const int32_t st = s->ops->init ? s->ops->init(s->dev) : 0;
+        s->ok       = (st >= 0);
+        s->busy     = false;
+        s->next_us  = now_us;
+        s->last_err = (st < 0) ? st : 0;
+        if (s->ok) ok++;
+    }
+    return ok;
+}
+
+void sensor_reg_set_tap(sensor_reg_t *r, sensor_raw_tap_fn fn, void *user) {
+    if (!r) return;
+    r->tap      = fn;
+    r->tap_user = user;
+}
+
+void sensor_reg_set_period(sensor_reg_t *r, uint32_t id, uint32_t period_us) {
+    if (!r || id >= r->n) return;
+    r->slot[id].period_us = period_us;
+}
+
+size_t sensor_reg_poll(sensor_reg_t *r, uint32_t now_us, sensor_sample_t *out, size_t max) {
+    if (!r || r->n == 0 || !out) return 0;
+
+    uint32_t bus_used = 0;
+    size_t got = 0;
+
+    for (uint32_t k = 0; k < r->n; k++) {
+        const uint32_t id = (r->rr + k) % r->n;
+        sensor_slot_t *s = &r->slot[id];
+        if (!s->ok) continue;
+        const uint32_t bus_bit = 1u << (s->bus & 31u);
+
+        if (s->busy) {
+            if (got >= max) continue;   // 결과 둘 곳 없음 -> 다음 순회에 read
+
+            const int32_t st = s->ops->poll(s->dev, now_us);
+            if (st == SENSOR_PENDING) continue;
+            bus_used |= bus_bit;
+            if (st < 0) {
+                slot_fail(s, st);
+                continue;
+            }
+            if (st == SENSOR_READY && slot_collect(r, s, id, now_us, &out[got])) got++;
+            continue;
+        }
+
+        if (s->period_us == 0 || (int32_t)(now_us - s->next_us) < 0) continue;
+        if (bus_used & bus_bit) {
+            s->deferred++;
+            continue;
+        }
+        bus_used |= bus_bit;
+        slot_advance(s, now_us);
+
+        const int32_t st = s->ops->start(s->dev, now_us);
+        if (st < 0) {
+            slot_fail(s, st);
+            continue;
+        }
+        s->busy = true;
+    }
+
+    r->rr = (r->rr + 1u) % r->n;
+    return got;
+}
+
+bool sensor_sample_get(const sensor_sample_t *s, sensor_qty_t qty, int32_t *val) {
+    if (!s || !val) return false;
+    for (uint32_t i = 0; i < s->n && i < SENSOR_VAL_MAX; i++) {
+        if (s->qty[i] == (uint8_t)qty) {
+            *val = s->val[i];
+            return true;
+        }
+    }
+    return false;
+}
+
+size_t sensor_reg_stats_line(const sensor_reg_t *r, uint64_t now_ms, char *out, size_t out_sz) {
+    if (!r || !out || out_sz == 0) return 0;
+
+    int n = snprintf(out, out_sz, "stat=sensor,ms=%llu,n=%lu",
+                     (unsigned long long)now_ms, (unsigned long)r->n);
+    if (n <= 0 || (size_t)n >= out_sz) return 0;
+    size_t len = (size_t)n;
+
+    // slot별: s<id>=<name>/samples/errors/deferred/last_err
+    for (uint32_t i = 0; i < r->n; i++) {
+        const sensor_slot_t *s = &r->slot[i];
+        n = snprintf(out + len, out_sz - len, ",s%lu=%s/%lu/%lu/%lu/%ld",
+                     (unsigned long)i,
+                     s->ops->name ? s->ops->name : "?",
+                     (unsigned long)s->samples,
+                     (unsigned long)s->errors,
+                     (unsigned long)s->deferred,
+                     (long)s->last_err);
+        if (n <= 0 || (size_t)n >= out_sz - len) return 0;
+        len += (size_t)n;
+    }
+
+    if (len + 1 >= out_sz) return 0;
+    out[len++] = '\n';
+    out[len]   = '\0';
+    return len;
+}
@@ -0,0 +1,80 @@
+// FILE: src/drivers/sensor_reg.h
+#ifndef __SENSOR_REG_H__
+#define __SENSOR_REG_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "sensor.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+// Sensor registry / scheduler (N개 이종 sensor, 공유 bus)
+//
+// - slot마다 ops + driver 상태 + bus 번호 + 측정 주기
+// - sensor_reg_poll 1회 = 전 slot 1순회 (round-robin 시작 위치):
+//     진행 중 slot은 poll (deadline 지난 driver만 bus 사용), 주기 도래 slot은 start
+//     bus당 start는 순회마다 1개: 같은 bus의 sensor가 동시에 도래해도 command가 몰리지 않음
+//     (poll은 제한 없음 - conversion 완료 후 ADC read 지연은 곧 latency)
+// - 주기가 밀리면 누적하지 않고 현재 기준으로 재시작 (main loop 고정 주기와 같은 정책)
+// - pure: I/O는 ops 뒤, host benchmark가 같은 코드로 dispatch 비용 측정
+
+#define SENSOR_REG_MAX  (8u)
+
+typedef struct {
+    const sensor_ops_t *ops;
+    void    *dev;
+    uint8_t  bus;
+    bool     ok;            // init 성공
+    bool     busy;          // 측정 진행 중
+    uint32_t period_us;     // 0: 정지
+    uint32_t next_us;
+
+    uint32_t samples;
+    uint32_t errors;
+    uint32_t deferred;      // 같은 bus 사용으로 start가 다음 순회로 밀린 횟수
+    int32_t  last_err;
+} sensor_slot_t;
+
+// raw tap: READY slot의 read_raw 결과 (convert 전). raw trace capture용
+typedef void (*sensor_raw_tap_fn)(uint32_t id, uint32_t t_us, const uint32_t *raw, uint32_t n, void *user);
+
+typedef struct {
+    sensor_slot_t slot[SENSOR_REG_MAX];
+    uint32_t n;
+    uint32_t rr;
+
+    sensor_raw_tap_fn tap;
+    void             *tap_user;
+} sensor_reg_t;
+
+void sensor_reg_init(sensor_reg_t *r);
+
+// slot 추가 -> id (0..), 가득 차면 -1. init은 sensor_reg_init_all에서
+int32_t sensor_reg_add(sensor_reg_t *r, const sensor_ops_t *ops, void *dev, uint8_t bus, uint32_t period_us);
+
+// 전 slot ops->init, 성공한 slot 수 (실패 slot은 scheduling에서 제외)
+uint32_t sensor_reg_init_all(sensor_reg_t *r, uint32_t now_us);
+
+// raw tap 등록 (fn NULL이면 해제)
+void sensor_reg_set_tap(sensor_reg_t *r, sensor_raw_tap_fn fn, void *user);
+
+void sensor_reg_set_period(sensor_reg_t *r, uint32_t id, uint32_t period_us);
+
+// 1순회. 완료된 sample을 out에 (최대 max개), 개수 리턴
+size_t sensor_reg_poll(sensor_reg_t *r, uint32_t now_us, sensor_sample_t *out, size_t max);
+
+// sample에서 qty 값 찾기 (없으면 false)
+bool sensor_sample_get(const sensor_sample_t *s, sensor_qty_t qty, int32_t *val);
+
+// "stat=sensor,ms=..,n=..,<name>=samples/errors/deferred,...\n"
+size_t sensor_reg_stats_line(const sensor_reg_t *r, uint64_t now_ms, char *out, size_t out_sz);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif /* __SENSOR_REG_H__ */
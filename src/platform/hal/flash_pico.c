@@ -0,0 +1,105 @@
+// FILE: src/platform/hal/flash_pico.c
+#include "flash_pico.h"
+
+#include <string.h>
+
+#include "pico/stdlib.h"
+#include "pico/flash.h"            // flash_safe_execute()
+#include "hardware/flash.h"        // flash_range_program/erase, FLASH_PAGE_SIZE, FLASH_SECTOR_SIZE
+#include "hardware/regs/addressmap.h"
+
+#define FLASH_PICO_SAFE_TIMEOUT_MS 100u
+
+extern char __flash_binary_end; // linker symbol: image 끝 (XIP 주소)
+
+typedef struct {
+    uint32_t flash_offset;
+    const void *src;
+    size_t len;
+} flash_op_args_t;
+
+// ---------- internal helpers ----------
+
+static void do_program(void *param) {
+    const flash_op_args_t *a = (const flash_op_args_t *)param;
+    flash_range_program(a->flash_offset, (const uint8_t *)a->src, a->len);
+}
+
+static void do_erase(void *param) {
+    const flash_op_args_t *a = (const flash_op_args_t *)param;
+    flash_range_erase(a->flash_offset, a->len);
+}
+
+static bool range_ok(const flash_pico_t *ctx, uint32_t off, size_t len) {
+    if (!ctx || ctx->size == 0) return false;
+    if (off > ctx->size) return false;
+    return len <= (size_t)(ctx->size - off);
+}
+
+static uint32_t image_end_offset(void) {
+    return (uint32_t)((uintptr_t)&__flash_binary_end - (uintptr_t)XIP_BASE);
+}
+
+// ---------- public API ----------
+
+bool flash_pico_init(flash_pico_t *ctx, uint32_t flash_offset, uint32_t size) {
+    if (!ctx) return false;
+    memset(ctx, 0, sizeof(*ctx));
+
+    if ((flash_offset % FLASH_SECTOR_SIZE) != 0) return false;
+    if (flash_offset < image_end_offset()) return false; // firmware 덮어쓰기 방지
+    if (flash_offset >= PICO_FLASH_SIZE_BYTES) return false;
+
+    if (size == 0) size = PICO_FLASH_SIZE_BYTES - flash_offset;
+    if ((size % FLASH_SECTOR_SIZE) != 0) return false;
+    if (size > PICO_FLASH_SIZE_BYTES - flash_offset) return false;
+
+    ctx->flash_offset = flash_offset;
+    ctx->size = size;
+    return true;
+}
+
+uint32_t flash_pico_sector_size(void) {
+    return FLASH_SECTOR_SIZE;
+}
+
+uint32_t flash_pico_page_size(void) {
+    return FLASH_PAGE_SIZE;
+}
+
+bool flash_pico_read(flash_pico_t *ctx, uint32_t off, void *dst, size_t len) {
+    if (!range_ok(ctx, off, len) || (len && !dst)) return false;
+
+    // program/erase 직후에도 최신 값을 보도록 cache 우회 alias 사용
+    const uint8_t *src = (const uint8_t *)(uintptr_t)(XIP_NOCACHE_NOALLOC_BASE + ctx->flash_offset + off);
+    memcpy(dst, src, len);
+    return true;
+}
+
+bool flash_pico_program(flash_pico_t *ctx, uint32_t off, const void *src, size_t len) {
+    if (!range_ok(ctx, off, len) || !src || len == 0) return false;
+    if ((off % FLASH_PAGE_SIZE) != 0 || (len % FLASH_PAGE_SIZE) != 0) return false;
+
+    flash_op_args_t a = { .flash_offset = ctx->flash_offset + off, .src = src, .len = len };
+
+    const uint64_t t0 = time_us_64();
+    int rc = flash_safe_execute(do_program, &a, FLASH_PICO_SAFE_TIMEOUT_MS);
+    ctx->program_us += time_us_64() - t0;
+    ctx->programs++;
+
+    return (rc == PICO_OK);
+}
+
+bool flash_pico_erase(flash_pico_t *ctx, uint32_t off, size_t len) {
+    if (!range_ok(ctx, off, len) || len == 0) return false;
+    if ((off % FLASH_SECTOR_SIZE) != 0 || (len % FLASH_SECTOR_SIZE) != 0) return false;
+
+    flash_op_args_t a = { .flash_offset = ctx->flash_offset + off, .src = NULL, .len = len };
+
+    const uint64_t t0 = time_us_64();
+    int rc = flash_safe_execute(do_erase, &a, FLASH_PICO_SAFE_TIMEOUT_MS);
+    ctx->erase_us += time_us_64() - t0;
+    ctx->erases++;
+
+    return (rc == PICO_OK);
+}
@@ -0,0 +1,45 @@
+// FILE: src/platform/hal/flash_pico.h
+#ifndef __FLASH_PICO_H__
+#define __FLASH_PICO_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+// 온보드 QSPI flash의 firmware image 위쪽 영역을 데이터 영역으로 사용.
+// offset은 영역 기준 (flash 시작 기준 아님).
+typedef struct {
+    uint32_t flash_offset;   // flash 시작 기준 영역 시작 (sector 정렬)
+    uint32_t size;           // 영역 크기 (sector 배수)
+
+    // 누적 busy 시간 (program/erase 동안 XIP 정지 구간 포함)
+    uint64_t program_us;
+    uint64_t erase_us;
+    uint32_t programs;
+    uint32_t erases;
+} flash_pico_t;
+
+// flash_offset이 firmware image 끝(__flash_binary_end) 위인지, sector 정렬인지 검사.
+// size == 0이면 flash 끝까지.
+bool flash_pico_init(flash_pico_t *ctx, uint32_t flash_offset, uint32_t size);
+
+uint32_t flash_pico_sector_size(void);
+uint32_t flash_pico_page_size(void);
+
+// read: XIP (cache bypass) memcpy
+bool flash_pico_read(flash_pico_t *ctx, uint32_t off, void *dst, size_t len);
+
+// program: page 정렬 / page 배수, erase: sector 정렬 / sector 배수.
+// flash_safe_execute로 다른 core/IRQ를 잠시 막고 수행 (blocking).
+bool flash_pico_program(flash_pico_t *ctx, uint32_t off, const void *src, size_t len);
+bool flash_pico_erase(flash_pico_t *ctx, uint32_t off, size_t len);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif /* __FLASH_PICO_H__ */
@@ -8,9 +8,13 @@
 
 #include "hardware/gpio.h"
 #include "hardware/i2c.h"          // i2c_*(), i2c_get_hw()
+#include "hardware/irq.h"
 #include "hardware/structs/i2c.h"
 #include "hardware/regs/i2c.h"     // I2C_IC_TX_ABRT_SOURCE_* bits
 
+// async transfer 중인 ctx (instance index별, IRQ handler에서 조회)
+static i2c_pico_t *s_async_ctx[NUM_I2CS];
+
 // ---------- internal helpers ----------
 
 static bool valid_addr7(uint8_t addr_7bit) {
@@ -170,6 +174,63 @@ static void init_configure_gpio(const i2c_pico_config_t *cfg) {
     }
 }
 
+static void async_reset(i2c_pico_t *ctx) {
+    ctx->async_busy   = false;
+    ctx->async_cancel = false;
+    ctx->async_st     = I2C_PICO_OK;
+    ctx->async_rd     = NULL;
+    ctx->async_rlen   = 0;
+    ctx->async_done   = NULL;
+    ctx->async_user   = NULL;
+}
+
+// 완료 처리: 상태 정리 후 콜백 (콜백에서 다음 transfer 시작 가능)
+static void async_finish(i2c_pico_t *ctx, i2c_hw_t *hw, i2c_pico_status_t st) {
+    hw->intr_mask = 0;
+    ctx->async_count++;
+    if (st != I2C_PICO_OK) ctx->async_errors++;
+
+    i2c_pico_done_fn done = ctx->async_done;
+    void *user = ctx->async_user;
+    ctx->async_cancel = false;
+    ctx->async_busy   = false;
+    if (done) done(st, user);
+}
+
+// abort는 기록만, 완료는 STOP_DET에서 (abort 후에도 controller가 STOP을 냄)
+static void async_irq(uint idx) {
+    i2c_pico_t *ctx = s_async_ctx[idx];
+    if (!ctx || !ctx->instance) return;
+
+    i2c_hw_t *hw = i2c_get_hw(ctx->instance);
+    const uint32_t stat = hw->intr_stat;
+
+    if (stat & I2C_IC_INTR_STAT_R_TX_ABRT_BITS) {
+        ctx->last_diag.abort_source_register |= hw->tx_abrt_source;
+        ctx->last_diag.pico_result = PICO_ERROR_GENERIC;
+        (void)hw->clr_tx_abrt;
+        ctx->async_st = map_pico_result_to_status(ctx, PICO_ERROR_GENERIC);
+    }
+
+    if (stat & I2C_IC_INTR_STAT_R_STOP_DET_BITS) {
+        (void)hw->clr_stop_det;
+        if (!ctx->async_busy) return;
+
+        i2c_pico_status_t st = ctx->async_st;
+        if (st == I2C_PICO_OK) {
+            size_t n = 0;
+            while (n < ctx->async_rlen && hw->rxflr) ctx->async_rd[n++] = (uint8_t)hw->data_cmd;
+            ctx->last_diag.read_completed = n;
+            ctx->last_diag.pico_result    = (int)n;
+            if (n != ctx->async_rlen) st = I2C_PICO_EIO;
+        }
+        async_finish(ctx, hw, st);
+    }
+}
+
+static void async_irq0(void) { async_irq(0); }
+static void async_irq1(void) { async_irq(1); }
+
 // ---------- public API ----------
 
 i2c_pico_status_t i2c_pico_init(i2c_pico_t *ctx, const i2c_pico_config_t *cfg) {
@@ -180,6 +241,9 @@ i2c_pico_status_t i2c_pico_init(i2c_pico_t *ctx, const i2c_pico_config_t *cfg) {
 
     ctx->is_initialized = false;
     memset(&ctx->last_diag, 0, sizeof(ctx->last_diag));
+    async_reset(ctx);
+    ctx->async_count  = 0;
+    ctx->async_errors = 0;
 
     init_configure_controller(ctx, cfg);
     init_configure_gpio(cfg);
@@ -299,6 +363,104 @@ i2c_pico_status_t i2c_pico_probe(i2c_pico_t *ctx, uint8_t addr_7bit) {
     return i2c_pico_read(ctx, addr_7bit, &dummy, 1, false);
 }
 
+i2c_pico_status_t i2c_pico_async_init(i2c_pico_t *ctx) {
+    i2c_pico_status_t st = validate_ready(ctx);
+    if (st != I2C_PICO_OK) return st;
+
+    const uint idx = i2c_hw_index(ctx->instance);
+    if (idx >= NUM_I2CS) return I2C_PICO_EINVAL;
+
+    async_reset(ctx);
+    i2c_get_hw(ctx->instance)->intr_mask = 0;
+    s_async_ctx[idx] = ctx;
+
+    const uint irq = idx ? I2C1_IRQ : I2C0_IRQ;
+    irq_set_exclusive_handler(irq, idx ? async_irq1 : async_irq0);
+    irq_set_enabled(irq, true);
+    return I2C_PICO_OK;
+}
+
+i2c_pico_status_t i2c_pico_async_xfer(i2c_pico_t *ctx,
+                                      uint8_t addr_7bit,
+                                      const uint8_t *write_data,
+                                      size_t write_len,
+                                      uint8_t *read_data,
+                                      size_t read_len,
+                                      i2c_pico_done_fn done,
+                                      void *user) {
+    i2c_pico_status_t st;
+
+    st = validate_ready(ctx);
+    if (st != I2C_PICO_OK) return st;
+
+    st = validate_addr(addr_7bit);
+    if (st != I2C_PICO_OK) return st;
+
+    st = validate_buffer(write_data, write_len);
+    if (st != I2C_PICO_OK) return st;
+
+    st = validate_buffer(read_data, read_len);
+    if (st != I2C_PICO_OK) return st;
+
+    if (write_len + read_len == 0 || write_len + read_len > I2C_PICO_ASYNC_MAX) return I2C_PICO_EINVAL;
+    if (ctx->async_busy) return I2C_PICO_ESTATE;
+
+    i2c_hw_t *hw = i2c_get_hw(ctx->instance);
+    diag_begin(ctx, addr_7bit, write_len, read_len, write_len > 0 && read_len > 0);
+
+    ctx->async_busy   = true;
+    ctx->async_cancel = false;
+    ctx->async_st     = I2C_PICO_OK;
+    ctx->async_rd     = read_data;
+    ctx->async_rlen   = read_len;
+    ctx->async_done   = done;
+    ctx->async_user   = user;
+
+    // target 주소는 controller disable 상태에서만 변경 가능
+    hw->enable = 0;
+    hw->tar    = addr_7bit;
+    hw->enable = 1;
+    while (hw->rxflr) (void)hw->data_cmd;
+    (void)hw->clr_tx_abrt;
+    (void)hw->clr_stop_det;
+
+    // 전체 transaction을 FIFO에 적재 (byte 시간 ~25 us >> 적재 시간)
+    for (size_t i = 0; i < write_len; i++) {
+        const bool last = (i + 1u == write_len) && read_len == 0;
+        hw->data_cmd = (uint32_t)write_data[i] | (last ? I2C_IC_DATA_CMD_STOP_BITS : 0u);
+    }
+    for (size_t i = 0; i < read_len; i++) {
+        uint32_t cmd = I2C_IC_DATA_CMD_CMD_BITS;
+        if (i == 0 && write_len > 0) cmd |= I2C_IC_DATA_CMD_RESTART_BITS;
+        if (i + 1u == read_len)      cmd |= I2C_IC_DATA_CMD_STOP_BITS;
+        hw->data_cmd = cmd;
+    }
+    ctx->last_diag.write_completed = write_len;
+
+    // 적재 후 unmask: 그 사이 끝났어도 raw 상태가 남아 있어 바로 IRQ
+    hw->intr_mask = I2C_IC_INTR_MASK_M_STOP_DET_BITS | I2C_IC_INTR_MASK_M_TX_ABRT_BITS;
+    return I2C_PICO_OK;
+}
+
+bool i2c_pico_async_busy(const i2c_pico_t *ctx) {
+    return ctx && ctx->async_busy;
+}
+
+void i2c_pico_async_cancel(i2c_pico_t *ctx) {
+    if (!ctx || !ctx->instance || !ctx->async_busy) return;
+
+    i2c_hw_t *hw = i2c_get_hw(ctx->instance);
+    if (!ctx->async_cancel) {
+        ctx->async_cancel = true;
+        hw->enable |= I2C_IC_ENABLE_ABORT_BITS;
+        return;
+    }
+
+    // abort 후에도 STOP 없음: SCL/SDA 고착 -> controller 끄고 강제 완료 (다음 xfer가 다시 enable)
+    hw->enable = 0;
+    async_finish(ctx, hw, I2C_PICO_ETIMEOUT);
+}
+
 const i2c_pico_diagnostics_t *i2c_pico_last_diagnostics(const i2c_pico_t *ctx) {
     if (!ctx) return NULL;
     return &ctx->last_diag;
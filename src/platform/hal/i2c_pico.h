@@ -59,12 +59,28 @@ typedef struct {
     bool enable_pullups;    // true => gpio_pull_up(sda/scl)
 } i2c_pico_config_t;
 
+// async transfer 완료 콜백 (I2C IRQ 컨텍스트). st != OK면 read 데이터 무효
+typedef void (*i2c_pico_done_fn)(i2c_pico_status_t st, void *user);
+
+#define I2C_PICO_ASYNC_MAX  (16u)   // write + read byte 합 최대 (controller TX FIFO 깊이)
+
 typedef struct {
     i2c_inst_t *instance;
     uint32_t timeout_us;
     bool is_initialized;
 
     i2c_pico_diagnostics_t last_diag;
+
+    // async (IRQ) transfer: 진행 중에는 blocking API 사용 금지
+    volatile bool    async_busy;
+    bool             async_cancel;
+    i2c_pico_status_t async_st;
+    uint8_t         *async_rd;
+    size_t           async_rlen;
+    i2c_pico_done_fn async_done;
+    void            *async_user;
+    uint32_t         async_count;
+    uint32_t         async_errors;
 } i2c_pico_t;
 
 // Init / deinit
@@ -95,6 +111,26 @@ i2c_pico_status_t i2c_pico_write_read(i2c_pico_t *ctx,
 // Probe helper (safe-ish for scanner): try 1-byte read and check ACK
 i2c_pico_status_t i2c_pico_probe(i2c_pico_t *ctx, uint8_t addr_7bit);
 
+// Async (IRQ-driven)
+// - i2c_pico_async_init: instance IRQ handler 등록 (init 후 1회)
+// - i2c_pico_async_xfer: write(wlen) -> repeated start -> read(rlen) -> stop 을 TX FIFO에 한 번에 적재,
+//   완료(STOP) / abort 시 IRQ에서 done 호출. wlen + rlen <= I2C_PICO_ASYNC_MAX, 버퍼는 완료까지 유효해야 함
+//   IRQ 컨텍스트(timer callback 등)에서 호출 가능. 진행 중이면 ESTATE
+i2c_pico_status_t i2c_pico_async_init(i2c_pico_t *ctx);
+i2c_pico_status_t i2c_pico_async_xfer(i2c_pico_t *ctx,
+                                      uint8_t addr_7bit,
+                                      const uint8_t *write_data,
+                                      size_t write_len,
+                                      uint8_t *read_data,
+                                      size_t read_len,
+                                      i2c_pico_done_fn done,
+                                      void *user);
+bool i2c_pico_async_busy(const i2c_pico_t *ctx);
+
+// 진행 중 transfer 중단: 1회차 = controller abort (STOP 후 IRQ에서 done, EBUS 계열)
+// 다음 호출까지도 끝나지 않았으면 (bus 고착) controller 끄고 즉시 done(ETIMEOUT)
+void i2c_pico_async_cancel(i2c_pico_t *ctx);
+
 // Diagnostics / strings
 const i2c_pico_diagnostics_t *i2c_pico_last_diagnostics(const i2c_pico_t *ctx);
 const char *i2c_pico_status_str(i2c_pico_status_t st);
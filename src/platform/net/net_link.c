@@ -0,0 +1,350 @@
+// FILE: src/platform/net/net_link.c
+#include "net_link.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "pico/cyw43_arch.h"
+
+#include "lwip/dhcp.h"
+#include "lwip/ip_addr.h"
+#include "lwip/netif.h"
+
+#include "platform_core.h"
+
+// lwIP callback 대상 (STA interface 1개)
+static net_link_t *s_link;
+
+// ---------- internal helpers ----------
+
+static struct netif *sta_netif(void) {
+    return &cyw43_state.netif[CYW43_ITF_STA];
+}
+
+// background 컨텍스트: counter/시각만 기록
+static void on_netif_link(struct netif *n) {
+    net_link_t *l = s_link;
+    if (!l) return;
+    if (!netif_is_link_up(n)) l->ev_down_ms = (uint32_t)platform_millis();
+    l->ev_link = l->ev_link + 1u;
+}
+
+static void on_netif_status(struct netif *n) {
+    (void)n;
+    net_link_t *l = s_link;
+    if (l) l->ev_status = l->ev_status + 1u;
+}
+
+static uint32_t next_rand(net_link_t *l) {
+    uint32_t x = l->rng;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    l->rng = x;
+    return x;
+}
+
+static const char *state_str(net_link_state_t st) {
+    switch (st) {
+    case NET_LINK_IDLE:    return "idle";
+    case NET_LINK_JOINING: return "join";
+    case NET_LINK_UP:      return "up";
+    case NET_LINK_BACKOFF: return "backoff";
+    }
+    return "?";
+}
+
+// 연결된 AP의 channel (WLC_GET_CHANNEL: channel_info_t의 hw_channel, little-endian)
+static uint32_t read_channel(void) {
+    uint8_t buf[12] = {0};
+    cyw43_arch_lwip_begin();
+    int rc = cyw43_ioctl(&cyw43_state, CYW43_IOCTL_GET_CHANNEL, sizeof(buf), buf, CYW43_ITF_STA);
+    cyw43_arch_lwip_end();
+    if (rc != 0) return CYW43_CHANNEL_NONE;
+
+    const uint32_t ch = (uint32_t)buf[0] | ((uint32_t)buf[1] << 8) | ((uint32_t)buf[2] << 16) | ((uint32_t)buf[3] << 24);
+    return (ch >= 1u && ch <= 196u) ? ch : CYW43_CHANNEL_NONE;
+}
+
+// UP 진입 시: 다음 재연결용 BSSID/channel/lease 저장
+static void cache_assoc(net_link_t *l) {
+    uint8_t bssid[6];
+    cyw43_arch_lwip_begin();
+    int rc = cyw43_wifi_get_bssid(&cyw43_state, bssid);
+    cyw43_arch_lwip_end();
+    if (rc == 0) {
+        memcpy(l->bssid, bssid, sizeof(bssid));
+        l->channel = read_channel();
+        l->have_ap = true;
+    }
+
+    if (l->static_ip) return;
+
+    cyw43_arch_lwip_begin();
+    const struct netif *n = sta_netif();
+    const uint32_t ip = ip4_addr_get_u32(netif_ip4_addr(n));
+    if (ip != 0u) {
+        l->ip   = ip;
+        l->mask = ip4_addr_get_u32(netif_ip4_netmask(n));
+        l->gw   = ip4_addr_get_u32(netif_ip4_gw(n));
+        l->have_lease = true;
+    }
+    cyw43_arch_lwip_end();
+}
+
+// DHCP 재연결: 주소가 비어 있으면 마지막 lease 적용 (DHCP는 계속 동작하며 재확인/교체)
+static void apply_lease(net_link_t *l) {
+    if (l->static_ip || !l->cfg.reuse_lease || !l->have_lease) return;
+
+    cyw43_arch_lwip_begin();
+    struct netif *n = sta_netif();
+    if (ip4_addr_get_u32(netif_ip4_addr(n)) == 0u) {
+        ip4_addr_t ip, mask, gw;
+        ip4_addr_set_u32(&ip, l->ip);
+        ip4_addr_set_u32(&mask, l->mask);
+        ip4_addr_set_u32(&gw, l->gw);
+        netif_set_addr(n, &ip, &mask, &gw);
+        l->st.lease_reuse++;
+    }
+    cyw43_arch_lwip_end();
+}
+
+static void fail_attempt(net_link_t *l, uint64_t now_ms) {
+    // backoff ±25% jitter (같은 AP에 붙은 board들이 동시에 재시도하지 않도록)
+    const uint32_t b = l->backoff_ms;
+    const uint32_t delay = b - b / 4u + (b / 2u ? next_rand(l) % (b / 2u + 1u) : 0u);
+
+    l->backoff_ms = (b >= l->cfg.backoff_max_ms / 2u) ? l->cfg.backoff_max_ms : b * 2u;
+    l->retry_ms   = now_ms + delay;
+    l->state      = NET_LINK_BACKOFF;
+}
+
+static void start_attempt(net_link_t *l, uint64_t now_ms) {
+    const bool fast = l->have_ap && l->tries < l->cfg.fast_tries;
+    const char *pw = l->cfg.password ? l->cfg.password : "";
+    const uint32_t auth = pw[0] ? CYW43_AUTH_WPA2_AES_PSK : CYW43_AUTH_OPEN;
+
+    apply_lease(l);
+
+    cyw43_arch_lwip_begin();
+    // timeout/실패한 이전 시도 정리
+    if (cyw43_wifi_link_status(&cyw43_state, CYW43_ITF_STA) != CYW43_LINK_DOWN) {
+        (void)cyw43_wifi_leave(&cyw43_state, CYW43_ITF_STA);
+    }
+    int rc = cyw43_wifi_join(&cyw43_state, strlen(l->cfg.ssid), (const uint8_t *)l->cfg.ssid,
+                             strlen(pw), (const uint8_t *)pw, auth,
+                             fast ? l->bssid : NULL, fast ? l->channel : CYW43_CHANNEL_NONE);
+    cyw43_arch_lwip_end();
+
+    l->tries++;
+    l->st.attempts++;
+    if (fast) l->st.fast_attempts++;
+    l->fast       = fast;
+    l->assoc      = false;
+    l->attempt_ms = now_ms;
+    l->state      = NET_LINK_JOINING;
+
+    if (rc != 0) {
+        // join 명령 자체 실패 (driver busy 등)
+        l->st.fail_other++;
+        fail_attempt(l, now_ms);
+    }
+}
+
+static void enter_up(net_link_t *l, uint64_t now_ms) {
+    net_link_stats_t *st = &l->st;
+
+    if (l->state == NET_LINK_JOINING) {
+        if (!l->assoc) l->assoc_ms = now_ms;
+        const uint32_t rc_ms = (uint32_t)(now_ms - l->attempt_ms);
+        st->last_rc_ms    = rc_ms;
+        st->last_assoc_ms = (uint32_t)(l->assoc_ms - l->attempt_ms);
+        st->last_ip_ms    = (uint32_t)(now_ms - l->assoc_ms);
+        if (rc_ms > st->max_rc_ms) st->max_rc_ms = rc_ms;
+        st->rc_ms_total += rc_ms;
+        if (l->fast) st->fast_ok++;
+        st->connects++;
+    }
+
+    if (l->in_outage) {
+        const uint32_t out_ms = (uint32_t)(now_ms - l->down_since_ms);
+        st->reconnects++;
+        st->last_outage_ms = out_ms;
+        if (out_ms > st->max_outage_ms) st->max_outage_ms = out_ms;
+        st->down_ms_total += out_ms;
+        l->in_outage = false;
+    }
+
+    l->state      = NET_LINK_UP;
+    l->tries      = 0;
+    l->backoff_ms = l->cfg.backoff_min_ms;
+    cache_assoc(l);
+    if (l->event_fn) l->event_fn(true, l->event_user);
+}
+
+static void enter_lost(net_link_t *l, uint64_t now_ms, bool link_ev) {
+    // link down callback이 있었으면 그 시각부터 (poll 간격만큼 outage가 짧게 잡히지 않도록)
+    const uint32_t since_ev = (uint32_t)now_ms - l->ev_down_ms;
+    l->down_since_ms = (link_ev && since_ev < 60000u) ? now_ms - since_ev : now_ms;
+    l->in_outage = true;
+    l->st.outages++;
+    if (l->event_fn) l->event_fn(false, l->event_user);
+
+    start_attempt(l, now_ms);   // 첫 재시도는 즉시 (fast path)
+}
+
+// ---------- public API ----------
+
+void net_link_cfg_default(net_link_cfg_t *cfg) {
+    if (!cfg) return;
+    memset(cfg, 0, sizeof(*cfg));
+    cfg->join_timeout_ms = 10000u;
+    cfg->backoff_min_ms  = 500u;
+    cfg->backoff_max_ms  = 30000u;
+    cfg->fast_tries      = 3u;
+    cfg->reuse_lease     = true;
+}
+
+bool net_link_init(net_link_t *l, const net_link_cfg_t *cfg) {
+    if (!l || !cfg || !cfg->ssid || cfg->backoff_min_ms == 0u) return false;
+
+    memset(l, 0, sizeof(*l));
+    l->cfg = *cfg;
+    if (l->cfg.backoff_max_ms < l->cfg.backoff_min_ms) l->cfg.backoff_max_ms = l->cfg.backoff_min_ms;
+    l->backoff_ms = l->cfg.backoff_min_ms;
+    l->channel    = CYW43_CHANNEL_NONE;
+    l->rng        = platform_boot_id() | 1u;
+
+    bool ok = true;
+    cyw43_arch_lwip_begin();
+    struct netif *n = sta_netif();
+    if (cfg->static_ip && cfg->static_ip[0]) {
+        ip4_addr_t ip, mask, gw;
+        ip4_addr_set_u32(&gw, 0u);
+        ok = ip4addr_aton(cfg->static_ip, &ip) &&
+             ip4addr_aton(cfg->static_mask ? cfg->static_mask : "255.255.255.0", &mask) &&
+             (!cfg->static_gw || !cfg->static_gw[0] || ip4addr_aton(cfg->static_gw, &gw));
+        if (ok) {
+            dhcp_stop(n);
+            netif_set_addr(n, &ip, &mask, &gw);
+            l->static_ip = true;
+        }
+    }
+    s_link = l;
+    netif_set_link_callback(n, on_netif_link);
+    netif_set_status_callback(n, on_netif_status);
+    cyw43_arch_lwip_end();
+
+    return ok;
+}
+
+void net_link_set_event_fn(net_link_t *l, net_link_event_fn fn, void *user) {
+    if (!l) return;
+    l->event_fn   = fn;
+    l->event_user = user;
+}
+
+bool net_link_start(net_link_t *l, uint64_t now_ms) {
+    if (!l || l->state != NET_LINK_IDLE) return false;
+    l->seen_link   = l->ev_link;
+    l->seen_status = l->ev_status;
+    start_attempt(l, now_ms);
+    return true;
+}
+
+void net_link_poll(net_link_t *l, uint64_t now_ms) {
+    if (!l || l->state == NET_LINK_IDLE) return;
+
+    const uint32_t ev_link   = l->ev_link;
+    const uint32_t ev_status = l->ev_status;
+    const bool link_ev   = (ev_link != l->seen_link);
+    const bool status_ev = (ev_status != l->seen_status);
+    l->seen_link   = ev_link;
+    l->seen_status = ev_status;
+
+    const int ls = cyw43_tcpip_link_status(&cyw43_state, CYW43_ITF_STA);
+
+    switch (l->state) {
+    case NET_LINK_UP:
+        if (ls != CYW43_LINK_UP) enter_lost(l, now_ms, link_ev);
+        else if (status_ev) cache_assoc(l);     // DHCP 갱신으로 주소 변경
+        break;
+
+    case NET_LINK_JOINING:
+        if (ls == CYW43_LINK_UP) {
+            enter_up(l, now_ms);
+        } else if (ls == CYW43_LINK_BADAUTH) {
+            l->st.fail_auth++;
+            fail_attempt(l, now_ms);
+        } else if (ls == CYW43_LINK_NONET) {
+            l->st.fail_nonet++;
+            fail_attempt(l, now_ms);
+        } else if (ls == CYW43_LINK_FAIL) {
+            l->st.fail_other++;
+            fail_attempt(l, now_ms);
+        } else if (now_ms - l->attempt_ms >= l->cfg.join_timeout_ms) {
+            l->st.timeouts++;
+            fail_attempt(l, now_ms);
+        } else if (ls == CYW43_LINK_NOIP && !l->assoc) {
+            l->assoc    = true;
+            l->assoc_ms = now_ms;
+        }
+        break;
+
+    case NET_LINK_BACKOFF:
+        if (ls == CYW43_LINK_UP) enter_up(l, now_ms);
+        else if ((int64_t)(now_ms - l->retry_ms) >= 0) start_attempt(l, now_ms);
+        break;
+
+    case NET_LINK_IDLE:
+        break;
+    }
+}
+
+bool net_link_up(const net_link_t *l) {
+    return l && l->state == NET_LINK_UP;
+}
+
+void net_link_get_stats(const net_link_t *l, uint64_t now_ms, net_link_stats_t *out) {
+    if (!l || !out) return;
+    *out = l->st;
+    // 진행 중 outage 포함
+    if (l->in_outage) out->down_ms_total += now_ms - l->down_since_ms;
+}
+
+size_t net_link_stats_line(const net_link_t *l, uint64_t now_ms, char *out, size_t out_sz) {
+    if (!l || !out || out_sz == 0) return 0;
+
+    net_link_stats_t st;
+    net_link_get_stats(l, now_ms, &st);
+
+    const uint32_t cur_out = l->in_outage ? (uint32_t)(now_ms - l->down_since_ms) : 0u;
+    int n = snprintf(out, out_sz,
+                     "stat=link,ms=%llu,st=%s,ch=%lu,out=%lu,rc=%lu,att=%lu,fast=%lu/%lu,fail_auth=%lu,"
+                     "fail_nonet=%lu,fail=%lu,to=%lu,lease=%lu,down_ms=%llu,cur_out_ms=%lu,out_last_ms=%lu,"
+                     "out_max_ms=%lu,rc_last_ms=%lu,assoc_ms=%lu,ip_ms=%lu,rc_max_ms=%lu,rc_avg_ms=%lu\n",
+                     (unsigned long long)now_ms,
+                     state_str(l->state),
+                     (unsigned long)(l->channel == CYW43_CHANNEL_NONE ? 0u : l->channel),
+                     (unsigned long)st.outages,
+                     (unsigned long)st.reconnects,
+                     (unsigned long)st.attempts,
+                     (unsigned long)st.fast_ok,
+                     (unsigned long)st.fast_attempts,
+                     (unsigned long)st.fail_auth,
+                     (unsigned long)st.fail_nonet,
+                     (unsigned long)st.fail_other,
+                     (unsigned long)st.timeouts,
+                     (unsigned long)st.lease_reuse,
+                     (unsigned long long)st.down_ms_total,
+                     (unsigned long)cur_out,
+                     (unsigned long)st.last_outage_ms,
+                     (unsigned long)st.max_outage_ms,
+                     (unsigned long)st.last_rc_ms,
+                     (unsigned long)st.last_assoc_ms,
+                     (unsigned long)st.last_ip_ms,
+                     (unsigned long)st.max_rc_ms,
+                     (unsigned long)(st.connects ? st.rc_ms_total / st.connects : 0u));
+    if (n <= 0 || (size_t)n >= out_sz) return 0;
+    return (size_t)n;
+}
@@ -0,0 +1,129 @@
+// FILE: src/platform/net/net_link.h
+#ifndef __NET_LINK_H__
+#define __NET_LINK_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+// Wi-Fi STA link manager (boot 1회 blocking connect 대체)
+//
+// - 감시: lwIP netif link/status callback (cyw43 background 컨텍스트) -> 이벤트 counter만 기록,
+//   상태 전이는 net_link_poll() (main loop)에서. poll마다 cyw43_tcpip_link_status로도 확인
+// - 재연결: 비동기 join (cyw43_wifi_join), 샘플링은 계속. 실패/timeout 시 backoff (min부터 2배, max 상한, ±25% jitter)
+// - fast path: 마지막 연결의 BSSID + channel로 join (scan 생략) -> outage마다 fast_tries회, 이후 일반 join
+// - IP: static_ip 지정 시 DHCP 없이 고정. 아니면 DHCP + reuse_lease면 재연결 시 마지막 lease를 즉시 적용
+//   (DHCP는 계속 동작: 같은 주소 재확인, 바뀌면 교체) -> association 직후 송신 가능
+// - 통계: outage 시간 (link 끊김 감지 -> 다시 UP), reconnect latency (성공한 시도 시작 -> UP, assoc/IP 구간 분리)
+
+typedef enum {
+    NET_LINK_IDLE = 0,      // net_link_start 전
+    NET_LINK_JOINING,       // join 시도 중 (assoc 또는 IP 대기)
+    NET_LINK_UP,
+    NET_LINK_BACKOFF,       // 실패 후 다음 시도 대기
+} net_link_state_t;
+
+typedef struct {
+    const char *ssid;
+    const char *password;
+    uint32_t join_timeout_ms;   // 시도 1회 (assoc + IP)
+    uint32_t backoff_min_ms;
+    uint32_t backoff_max_ms;
+    uint32_t fast_tries;        // outage마다 cached BSSID/channel 시도 횟수 (0: 사용 안 함)
+    const char *static_ip;      // NULL/"" = DHCP
+    const char *static_mask;
+    const char *static_gw;
+    bool     reuse_lease;       // DHCP: 재연결 시 마지막 lease 즉시 적용
+} net_link_cfg_t;
+
+typedef struct {
+    uint32_t outages;           // UP -> 끊김 횟수
+    uint32_t reconnects;        // outage 후 복구 횟수
+    uint32_t attempts;          // join 시도 (boot 포함)
+    uint32_t fast_attempts;     // 그중 cached BSSID/channel
+    uint32_t fast_ok;
+    uint32_t fail_auth;
+    uint32_t fail_nonet;
+    uint32_t fail_other;
+    uint32_t timeouts;
+    uint32_t lease_reuse;       // 재연결 시 cached IP 적용 횟수
+
+    uint64_t down_ms_total;     // 완료된 outage 누적
+    uint32_t last_outage_ms;
+    uint32_t max_outage_ms;
+
+    uint32_t last_rc_ms;        // 성공한 시도: 시작 -> UP
+    uint32_t last_assoc_ms;     //   시작 -> association (IP 대기 진입)
+    uint32_t last_ip_ms;        //   association -> UP
+    uint32_t max_rc_ms;
+    uint64_t rc_ms_total;       // 평균 = rc_ms_total / connects
+    uint32_t connects;          // 시도로 UP 진입 (boot 포함)
+} net_link_stats_t;
+
+// UP/끊김 알림 (net_link_poll 컨텍스트)
+typedef void (*net_link_event_fn)(bool up, void *user);
+
+typedef struct {
+    net_link_cfg_t   cfg;
+    net_link_state_t state;
+
+    net_link_event_fn event_fn;
+    void *event_user;
+
+    // callback -> poll (background 컨텍스트에서 증가)
+    volatile uint32_t ev_link;
+    volatile uint32_t ev_status;
+    volatile uint32_t ev_down_ms;   // 마지막 link down callback 시각 (u32 ms)
+    uint32_t seen_link;
+    uint32_t seen_status;
+
+    // 마지막 연결 (fast path)
+    bool     have_ap;
+    uint8_t  bssid[6];
+    uint32_t channel;
+    bool     have_lease;
+    uint32_t ip, mask, gw;          // network byte order
+    bool     static_ip;
+
+    // 현재 시도 / outage
+    bool     fast;
+    bool     assoc;                 // 이번 시도 association 완료
+    uint32_t tries;                 // 이번 outage 시도 수
+    uint32_t backoff_ms;
+    uint64_t attempt_ms;
+    uint64_t assoc_ms;
+    uint64_t retry_ms;
+    bool     in_outage;
+    uint64_t down_since_ms;
+
+    uint32_t rng;
+    net_link_stats_t st;
+} net_link_t;
+
+void net_link_cfg_default(net_link_cfg_t *cfg);
+
+// lwIP callback 등록 + (static_ip면) 주소 고정. 연결은 시작하지 않음
+bool net_link_init(net_link_t *l, const net_link_cfg_t *cfg);
+void net_link_set_event_fn(net_link_t *l, net_link_event_fn fn, void *user);
+
+// 첫 비동기 join 시작 (이후 재시도는 poll이 관리)
+bool net_link_start(net_link_t *l, uint64_t now_ms);
+
+// main loop에서 주기 호출 (blocking 없음)
+void net_link_poll(net_link_t *l, uint64_t now_ms);
+
+bool net_link_up(const net_link_t *l);
+void net_link_get_stats(const net_link_t *l, uint64_t now_ms, net_link_stats_t *out);
+
+// "stat=link,ms=..,st=up,out=..,..." (0: 버퍼 부족)
+size_t net_link_stats_line(const net_link_t *l, uint64_t now_ms, char *out, size_t out_sz);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // __NET_LINK_H__
@@ -9,11 +9,97 @@
 #include "lwip/pbuf.h"
 #include "lwip/udp.h"
 #include "lwip/ip_addr.h"
+#include "lwip/igmp.h"
+
+#include "net_wifi.h"
+#include "prof.h"
+
+typedef struct {
+    ip_addr_t addr;
+    uint16_t  port;
+    uint32_t  sent;
+    uint32_t  failed;
+} udp_dst_t;
 
 struct net_udp_client {
     struct udp_pcb *pcb;
+
+    // fan-out 목적지 ([0] = primary: open/set_dst)
+    udp_dst_t dst[NET_UDP_MAX_DST];
+    uint8_t   n_dst;
+
+    net_udp_recv_fn recv_fn;
+    void *recv_user;
 };
 
+// ---------- internal helpers ----------
+
+// PBUF_RAM = lwIP heap: NO_SYS에서는 heap 자체 보호가 없음 (background의 ARP/IGMP/DHCP 송신과 공유)
+// -> alloc/free 모두 cyw43_arch_lwip_begin 구간에서
+static struct pbuf *alloc_payload(const void *data, size_t len) {
+    struct pbuf *p = pbuf_alloc(PBUF_TRANSPORT, (u16_t)len, PBUF_RAM);
+    if (!p) return NULL;
+
+    memcpy(p->payload, data, len);
+    return p;
+}
+
+// fan-out 공유 payload: PBUF_REF (caller 버퍼를 가리킴, header 공간 없음)
+// PBUF_RAM을 여러 번 udp_sendto 하면 lwIP가 첫 송신 때 넣은 UDP/IP/Ethernet header가 그대로 남아
+// 다음 목적지 datagram 앞에 붙음. REF는 header를 못 넣으므로 udp_sendto가 매번 새 header pbuf를 chain 후 해제.
+// ARP 대기 queue 등 리턴 후까지 잡히는 경우 lwIP가 REF chain을 복사해서 보관 -> 리턴 후 data 재사용 안전
+static struct pbuf *ref_payload(const void *data, size_t len) {
+    struct pbuf *p = pbuf_alloc(PBUF_RAW, (u16_t)len, PBUF_REF);
+    if (!p) return NULL;
+
+    p->payload = (void *)data;
+    return p;
+}
+
+static bool send_pbuf(net_udp_client_t *c, const ip_addr_t *dst, uint16_t dst_port,
+                      const void *data, size_t len) {
+    if (!c || !c->pcb || !data || len == 0) return false;
+    if (len > 0xFFFF) return false;
+
+    cyw43_arch_lwip_begin();
+    struct pbuf *p = alloc_payload(data, len);
+    err_t e = p ? udp_sendto(c->pcb, p, dst, dst_port) : ERR_MEM;
+    if (p) pbuf_free(p);
+    cyw43_arch_lwip_end();
+
+    return (e == ERR_OK);
+}
+
+static int find_dst(const net_udp_client_t *c, const ip_addr_t *addr, uint16_t port) {
+    for (int i = 0; i < (int)c->n_dst; i++) {
+        if (ip_addr_cmp(&c->dst[i].addr, addr) && c->dst[i].port == port) return i;
+    }
+    return -1;
+}
+
+static void set_dst(udp_dst_t *d, const ip_addr_t *addr, uint16_t port) {
+    memset(d, 0, sizeof(*d));
+    ip_addr_copy(d->addr, *addr);
+    d->port = port;
+}
+
+// lwIP recv 콜백 (lwIP 컨텍스트)
+static void on_recv(void *arg, struct udp_pcb *pcb, struct pbuf *p, const ip_addr_t *addr, u16_t port) {
+    (void)pcb;
+    net_udp_client_t *c = (net_udp_client_t *)arg;
+    if (!p) return;
+
+    if (c && c->recv_fn && addr) {
+        uint8_t buf[NET_UDP_RX_MAX];
+        u16_t n = pbuf_copy_partial(p, buf, (u16_t)sizeof(buf), 0);
+        c->recv_fn(buf, n, ip4_addr_get_u32(ip_2_ip4(addr)), port, c->recv_user);
+    }
+
+    pbuf_free(p);
+}
+
+// ---------- public API ----------
+
 bool net_udp_open(net_udp_client_t **out, const char *dst_ip, uint16_t dst_port) {
     if (!out || !dst_ip || dst_port == 0) return false;
     *out = NULL;
@@ -37,32 +123,200 @@ bool net_udp_open(net_udp_client_t **out, const char *dst_ip, uint16_t dst_port)
         return false;
     }
 
+    set_dst(&c->dst[0], &addr, dst_port);
+    c->n_dst = 1;
+
     *out = c;
     return true;
 }
 
+bool net_udp_bind(net_udp_client_t **out, uint16_t local_port) {
+    if (!out || local_port == 0) return false;
+    *out = NULL;
+
+    net_udp_client_t *c = (net_udp_client_t *)calloc(1, sizeof(*c));
+    if (!c) return false;
+
+    c->pcb = udp_new_ip_type(IPADDR_TYPE_V4);
+    if (!c->pcb) { free(c); return false; }
+
+    cyw43_arch_lwip_begin();
+    err_t e = udp_bind(c->pcb, IP_ADDR_ANY, local_port);
+    cyw43_arch_lwip_end();
+
+    if (e != ERR_OK) {
+        udp_remove(c->pcb);
+        free(c);
+        return false;
+    }
+
+    *out = c;
+    return true;
+}
+
+void net_udp_set_recv(net_udp_client_t *c, net_udp_recv_fn fn, void *user) {
+    if (!c || !c->pcb) return;
+
+    cyw43_arch_lwip_begin();
+    c->recv_fn   = fn;
+    c->recv_user = user;
+    udp_recv(c->pcb, fn ? on_recv : NULL, fn ? c : NULL);
+    cyw43_arch_lwip_end();
+}
+
 bool net_udp_send(net_udp_client_t *c, const void *data, size_t len) {
     if (!c || !c->pcb || !data || len == 0) return false;
-    if (len > 0xFFFF) return false;
+    if (len > 0xFFFF || c->n_dst == 0) return false;
 
-    struct pbuf *p = pbuf_alloc(PBUF_TRANSPORT, (u16_t)len, PBUF_RAM);
-    if (!p) return false;
+    PROF_T0(t0);
+    bool any = false;
 
-    memcpy(p->payload, data, len);
+    // 목적지 1개: header 공간 포함 PBUF_RAM 1회 (기존 경로)
+    if (c->n_dst == 1) {
+        udp_dst_t *d = &c->dst[0];
+        any = send_pbuf(c, &d->addr, d->port, data, len);
+        if (any) d->sent++;
+        else     d->failed++;
+        PROF_END(PROF_UDP_SEND, t0);
+        return any;
+    }
 
+    // fan-out: payload pbuf 1개를 모든 목적지에 공유
     cyw43_arch_lwip_begin();
-    err_t e = udp_send(c->pcb, p);
+    struct pbuf *p = ref_payload(data, len);
+    for (uint8_t i = 0; i < c->n_dst; i++) {
+        udp_dst_t *d = &c->dst[i];
+        const err_t e = p ? udp_sendto(c->pcb, p, &d->addr, d->port) : ERR_MEM;
+
+        if (e == ERR_OK) { d->sent++; any = true; }
+        else             { d->failed++; }
+    }
+    if (p) pbuf_free(p);
+    cyw43_arch_lwip_end();
+
+    PROF_END(PROF_UDP_SEND, t0);
+    return any;
+}
+
+bool net_udp_add_dst(net_udp_client_t *c, const char *dst_ip, uint16_t dst_port) {
+    if (!c || !dst_ip || dst_port == 0) return false;
+    if (c->n_dst >= NET_UDP_MAX_DST) return false;
+
+    ip_addr_t addr;
+    if (!ipaddr_aton(dst_ip, &addr)) return false;
+    if (find_dst(c, &addr, dst_port) >= 0) return false;
+
+    cyw43_arch_lwip_begin();
+    set_dst(&c->dst[c->n_dst], &addr, dst_port);
+    c->n_dst++;
+    cyw43_arch_lwip_end();
+    return true;
+}
+
+void net_udp_clear_extra_dst(net_udp_client_t *c) {
+    if (!c) return;
+    cyw43_arch_lwip_begin();
+    if (c->n_dst > 1) c->n_dst = 1;
+    cyw43_arch_lwip_end();
+}
+
+size_t net_udp_get_dst_stats(const net_udp_client_t *c, net_udp_dst_stats_t *out, size_t max) {
+    if (!c || !out) return 0;
+
+    size_t n = 0;
+    for (uint8_t i = 0; i < c->n_dst && n < max; i++, n++) {
+        const udp_dst_t *d = &c->dst[i];
+        out[n].ip        = ip4_addr_get_u32(ip_2_ip4(&d->addr));
+        out[n].port      = d->port;
+        out[n].multicast = ip_addr_ismulticast(&d->addr);
+        out[n].sent      = d->sent;
+        out[n].failed    = d->failed;
+    }
+    return n;
+}
+
+void net_udp_set_multicast_ttl(net_udp_client_t *c, uint8_t ttl) {
+    if (!c || !c->pcb) return;
+    cyw43_arch_lwip_begin();
+    udp_set_multicast_ttl(c->pcb, ttl);
+    cyw43_arch_lwip_end();
+}
+
+bool net_udp_join_group(net_udp_client_t *c, const char *group_ip) {
+    if (!c || !group_ip) return false;
+
+    ip_addr_t g;
+    if (!ipaddr_aton(group_ip, &g) || !ip_addr_ismulticast(&g)) return false;
+
+    cyw43_arch_lwip_begin();
+    err_t e = igmp_joingroup(IP4_ADDR_ANY4, ip_2_ip4(&g));
+    cyw43_arch_lwip_end();
+    return (e == ERR_OK);
+}
+
+bool net_udp_leave_group(net_udp_client_t *c, const char *group_ip) {
+    if (!c || !group_ip) return false;
+
+    ip_addr_t g;
+    if (!ipaddr_aton(group_ip, &g) || !ip_addr_ismulticast(&g)) return false;
+
+    cyw43_arch_lwip_begin();
+    err_t e = igmp_leavegroup(IP4_ADDR_ANY4, ip_2_ip4(&g));
+    cyw43_arch_lwip_end();
+    return (e == ERR_OK);
+}
+
+bool net_udp_sendto(net_udp_client_t *c, uint32_t dst_ip, uint16_t dst_port, const void *data, size_t len) {
+    if (dst_port == 0) return false;
+
+    ip_addr_t addr;
+    ip_addr_set_ip4_u32(&addr, dst_ip);
+    return send_pbuf(c, &addr, dst_port, data, len);
+}
+
+bool net_udp_set_dst(net_udp_client_t *c, const char *dst_ip, uint16_t dst_port) {
+    if (!c || !c->pcb || !dst_ip || dst_port == 0) return false;
+
+    ip_addr_t addr;
+    if (!ipaddr_aton(dst_ip, &addr)) return false;
+
+    cyw43_arch_lwip_begin();
+    err_t e = udp_connect(c->pcb, &addr, dst_port);
+    if (e == ERR_OK) {
+        // primary 교체 (카운터 초기화)
+        set_dst(&c->dst[0], &addr, dst_port);
+        if (c->n_dst == 0) c->n_dst = 1;
+    }
     cyw43_arch_lwip_end();
 
-    pbuf_free(p);
     return (e == ERR_OK);
 }
 
 void net_udp_close(net_udp_client_t *c) {
     if (!c) return;
     if (c->pcb) {
+        cyw43_arch_lwip_begin();
+        udp_recv(c->pcb, NULL, NULL);
         udp_remove(c->pcb);
+        cyw43_arch_lwip_end();
         c->pcb = NULL;
     }
     free(c);
 }
+
+static bool transport_send(void *ctx, const void *data, size_t len) {
+    return net_udp_send((net_udp_client_t *)ctx, data, len);
+}
+
+static bool transport_ready(void *ctx) {
+    (void)ctx;
+    return net_wifi_link_up();
+}
+
+void net_udp_transport(net_udp_client_t *c, tlm_transport_t *out) {
+    if (!out) return;
+    out->name  = "udp";
+    out->send  = transport_send;
+    out->ready = transport_ready;
+    out->ctx   = c;
+}
@@ -6,6 +6,8 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include "tlm_transport.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif // __cplusplus
@@ -13,10 +15,63 @@ extern "C" {
 // lwIP 타입 노출 방지: opaque handle
 typedef struct net_udp_client net_udp_client_t;
 
+// 수신 콜백: lwIP 컨텍스트(background IRQ)에서 호출됨 -> 복사만 하고 바로 리턴할 것.
+// src_ip는 IPv4 (network byte order 그대로, ip4_addr_t.addr)
+typedef void (*net_udp_recv_fn)(const uint8_t *data, size_t len,
+                                uint32_t src_ip, uint16_t src_port, void *user);
+
+// 수신 datagram 최대 길이 (초과분은 잘림)
+#define NET_UDP_RX_MAX  (512u)
+
+// fan-out 목적지 수 (open/set_dst의 primary 포함)
+#define NET_UDP_MAX_DST (4u)
+
+typedef struct {
+    uint32_t ip;        // IPv4 (network byte order)
+    uint16_t port;
+    bool     multicast;
+    uint32_t sent;
+    uint32_t failed;
+} net_udp_dst_stats_t;
+
 bool net_udp_open(net_udp_client_t **out, const char *dst_ip, uint16_t dst_port);
-bool net_udp_send(net_udp_client_t *c, const void *data, size_t len);
 void net_udp_close(net_udp_client_t *c);
 
+// 등록된 모든 목적지로 송신 (목적지 2개 이상이면 data를 가리키는 PBUF_REF 1개를 공유, header는 목적지마다 새로).
+// 하나라도 전달되면 true. 목적지별 결과는 net_udp_get_dst_stats.
+bool net_udp_send(net_udp_client_t *c, const void *data, size_t len);
+
+// fan-out 목적지 추가 (unicast 또는 IPv4 multicast 그룹 주소). 중복/초과 시 false
+bool net_udp_add_dst(net_udp_client_t *c, const char *dst_ip, uint16_t dst_port);
+
+// primary(0번)를 제외한 목적지 제거
+void net_udp_clear_extra_dst(net_udp_client_t *c);
+
+// 목적지별 송신/실패 카운터. 채운 개수 리턴
+size_t net_udp_get_dst_stats(const net_udp_client_t *c, net_udp_dst_stats_t *out, size_t max);
+
+// multicast 송신 TTL (기본 1: 로컬 서브넷)
+void net_udp_set_multicast_ttl(net_udp_client_t *c, uint8_t ttl);
+
+// IGMP 그룹 가입/탈퇴 (수신용, 예: fleet 전체 control 명령)
+bool net_udp_join_group(net_udp_client_t *c, const char *group_ip);
+bool net_udp_leave_group(net_udp_client_t *c, const char *group_ip);
+
+// 수신 전용 소켓: local_port에 bind (connect 없음 -> 임의 송신자 수신)
+bool net_udp_bind(net_udp_client_t **out, uint16_t local_port);
+
+// 수신 콜백 등록 (fn=NULL이면 해제)
+void net_udp_set_recv(net_udp_client_t *c, net_udp_recv_fn fn, void *user);
+
+// 지정 주소로 송신 (응답/ack 용)
+bool net_udp_sendto(net_udp_client_t *c, uint32_t dst_ip, uint16_t dst_port, const void *data, size_t len);
+
+// primary 목적지 변경 (open으로 연결된 client)
+bool net_udp_set_dst(net_udp_client_t *c, const char *dst_ip, uint16_t dst_port);
+
+// tlm_transport_t 어댑터 (name "udp", send = net_udp_send, ready = Wi-Fi link up)
+void net_udp_transport(net_udp_client_t *c, tlm_transport_t *out);
+
 #ifdef __cplusplus
 }
 #endif // __cplusplus
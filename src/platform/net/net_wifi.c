@@ -12,3 +12,7 @@ bool net_wifi_connect_wpa2(const char *ssid, const char *password, uint32_t time
     );
     return (st == 0);
 }
+
+bool net_wifi_link_up(void) {
+    return cyw43_tcpip_link_status(&cyw43_state, CYW43_ITF_STA) == CYW43_LINK_UP;
+}
@@ -11,6 +11,9 @@ extern "C" {
 
 bool net_wifi_connect_wpa2(const char *ssid, const char *password, uint32_t timeout_ms);
 
+// STA 링크 + IP 확보 여부 (CYW43_LINK_UP)
+bool net_wifi_link_up(void);
+
 #ifdef __cplusplus
 }
 #endif // __cplusplus
@@ -3,6 +3,9 @@
 
 #include "pico/stdlib.h"
 #include "pico/cyw43_arch.h"
+#include "pico/rand.h"
+#include "pico/unique_id.h"
+#include "hardware/clocks.h"
 
 bool platform_init(void) {
     stdio_init_all();
@@ -31,3 +34,65 @@ void platform_sleep_ms(uint32_t ms) {
 void platform_yield(void) {
     tight_loop_contents();
 }
+
+uint64_t platform_micros(void) {
+    return time_us_64();
+}
+
+uint32_t platform_cpu_hz(void) {
+    return clock_get_hz(clk_sys);
+}
+
+// Cortex-M33 DWT cycle counter (CMSIS 없이 고정 주소 사용)
+#define PLAT_DEMCR          (*(volatile uint32_t *)0xE000EDFCu)
+#define PLAT_DEMCR_TRCENA   (1u << 24)
+#define PLAT_DWT_CTRL       (*(volatile uint32_t *)0xE0001000u)
+#define PLAT_DWT_CYCCNTENA  (1u << 0)
+#define PLAT_DWT_NOCYCCNT   (1u << 25)
+#define PLAT_DWT_CYCCNT     (*(volatile uint32_t *)0xE0001004u)
+
+static uint32_t read_cyccnt(void) {
+    return PLAT_DWT_CYCCNT;
+}
+
+static uint32_t read_us32(void) {
+    return time_us_32();
+}
+
+bool platform_prof_clock(uint32_t (**clock)(void), uint32_t *tick_hz) {
+    if (!clock || !tick_hz) return false;
+
+    PLAT_DEMCR |= PLAT_DEMCR_TRCENA;
+    if (!(PLAT_DWT_CTRL & PLAT_DWT_NOCYCCNT)) {
+        PLAT_DWT_CTRL |= PLAT_DWT_CYCCNTENA;
+
+        const uint32_t c0 = PLAT_DWT_CYCCNT;
+        busy_wait_us_32(2);
+        if (PLAT_DWT_CYCCNT != c0) {
+            *clock   = read_cyccnt;
+            *tick_hz = clock_get_hz(clk_sys);
+            return true;
+        }
+    }
+
+    *clock   = read_us32;
+    *tick_hz = 1000000u;
+    return false;
+}
+
+uint32_t platform_boot_id(void) {
+    static uint32_t s_boot_id = 0;
+    while (s_boot_id == 0 || s_boot_id == 0xFFFFFFFFu) {
+        s_boot_id = get_rand_32(); // ROSC/타이머 엔트로피 기반 (pico_rand)
+    }
+    return s_boot_id;
+}
+
+uint64_t platform_unique_id(void) {
+    pico_unique_board_id_t id;
+    pico_get_unique_board_id(&id);
+
+    uint64_t v = 0;
+    for (int i = 0; i < PICO_UNIQUE_BOARD_ID_SIZE_BYTES; i++) v = (v << 8) | id.id[i];
+    return v;
+}
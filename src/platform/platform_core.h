@@ -21,6 +21,18 @@ uint64_t platform_millis(void);
 void     platform_sleep_ms(uint32_t ms);
 void     platform_yield(void);
 
+// 측정용 (benchmark / profiling)
+uint64_t platform_micros(void);
+uint32_t platform_cpu_hz(void);     // clk_sys
+
+// per-stage profiling tick (prof_init에 그대로 넘김)
+// DWT cycle counter를 켜고 동작하면 clk_sys tick, 아니면 1 MHz us timer로 fallback
+bool     platform_prof_clock(uint32_t (**clock)(void), uint32_t *tick_hz);
+
+// 장치/boot 식별 (telemetry header, flash log)
+uint32_t platform_boot_id(void);    // boot마다 새 난수 (첫 호출 시 생성, 0/0xFFFFFFFF 제외)
+uint64_t platform_unique_id(void);  // board unique ID (flash 64-bit ID, big-endian)
+
 #ifdef __cplusplus
 }
 #endif // __cplusplus
@@ -0,0 +1,27 @@
+// FILE: src/platform/usb/tusb/tusb_config.h
+#ifndef __TUSB_CONFIG_H__
+#define __TUSB_CONFIG_H__
+
+// TinyUSB device 설정 (CMake option GY63_USB_STREAM=ON일 때만 사용)
+// CDC 0: pico stdio (printf / 1-char 명령), CDC 1: binary sample stream (usb_bulk)
+
+#ifndef CFG_TUSB_MCU
+#error CFG_TUSB_MCU must be defined (pico SDK tinyusb_device)
+#endif
+
+#define CFG_TUSB_RHPORT0_MODE   OPT_MODE_DEVICE
+#define CFG_TUSB_OS             OPT_OS_PICO
+
+#define CFG_TUD_ENDPOINT0_SIZE  64
+
+#define CFG_TUD_CDC             2
+#define CFG_TUD_MSC             0
+#define CFG_TUD_HID             0
+#define CFG_TUD_MIDI            0
+#define CFG_TUD_VENDOR          0
+
+#define CFG_TUD_CDC_RX_BUFSIZE  64
+#define CFG_TUD_CDC_TX_BUFSIZE  1024    // usb_bulk drain 단위 (double buffer와 별개인 TinyUSB FIFO)
+#define CFG_TUD_CDC_EP_BUFSIZE  64      // full-speed bulk max packet
+
+#endif /* __TUSB_CONFIG_H__ */
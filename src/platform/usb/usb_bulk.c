@@ -0,0 +1,161 @@
+// FILE: src/platform/usb/usb_bulk.c
+#include "usb_bulk.h"
+
+#include <string.h>
+
+#if CFG_USB_STREAM_ENABLE
+#include "tusb.h"
+#endif
+
+#define USB_BULK_ITF  1u    // CDC 1 (CDC 0 = stdio)
+
+typedef struct {
+    uint8_t  buf[2][USB_BULK_BUF_SIZE];
+    uint32_t len[2];
+    uint8_t  fill;          // main loop가 적재 중인 buffer
+    uint32_t drain_off;     // drain buffer(= 1 - fill)에서 TinyUSB로 넘긴 위치
+    bool     ready;
+    usb_bulk_stats_t stats;
+} usb_bulk_t;
+
+static usb_bulk_t s_usb;
+
+// ---------- internal helpers ----------
+
+#if CFG_USB_STREAM_ENABLE
+
+static uint8_t drain_idx(void) {
+    return (uint8_t)(1u - s_usb.fill);
+}
+
+static bool drain_idle(void) {
+    return s_usb.drain_off >= s_usb.len[drain_idx()];
+}
+
+// drain이 끝났고 fill에 데이터가 있으면 교대 (submit)
+static void try_submit(void) {
+    if (!drain_idle() || s_usb.len[s_usb.fill] == 0) return;
+
+    const uint8_t d = drain_idx();
+    s_usb.len[d]    = 0;
+    s_usb.fill      = d;
+    s_usb.drain_off = 0;
+    s_usb.stats.submits++;
+}
+
+// TinyUSB FIFO 여유만큼 넘김 (여유 없으면 다음 poll)
+static void drain(void) {
+    const uint8_t d = drain_idx();
+    while (s_usb.drain_off < s_usb.len[d]) {
+        const uint32_t avail = tud_cdc_n_write_available(USB_BULK_ITF);
+        if (avail == 0) break;
+
+        uint32_t n = s_usb.len[d] - s_usb.drain_off;
+        if (n > avail) n = avail;
+        n = tud_cdc_n_write(USB_BULK_ITF, s_usb.buf[d] + s_usb.drain_off, n);
+        if (n == 0) break;
+        s_usb.drain_off   += n;
+        s_usb.stats.bytes += n;
+    }
+    (void)tud_cdc_n_write_flush(USB_BULK_ITF);
+}
+
+#endif // CFG_USB_STREAM_ENABLE
+
+static bool bulk_send(void *ctx, const void *data, size_t len) {
+    (void)ctx;
+    return usb_bulk_send(data, len);
+}
+
+static bool bulk_ready(void *ctx) {
+    (void)ctx;
+    return usb_bulk_connected();
+}
+
+// ---------- public API ----------
+
+void usb_bulk_device_init(void) {
+#if CFG_USB_STREAM_ENABLE
+    if (!tud_inited()) tusb_init();
+#endif
+}
+
+bool usb_bulk_init(void) {
+    memset(&s_usb, 0, sizeof(s_usb));
+#if CFG_USB_STREAM_ENABLE
+    usb_bulk_device_init(); // boot에서 이미 했으면 no-op
+    s_usb.fill  = 0;
+    s_usb.len[1] = 0;  // drain buffer 비어 있음 -> idle
+    s_usb.ready = true;
+#endif
+    return s_usb.ready;
+}
+
+bool usb_bulk_connected(void) {
+#if CFG_USB_STREAM_ENABLE
+    return s_usb.ready && tud_cdc_n_connected(USB_BULK_ITF);
+#else
+    return false;
+#endif
+}
+
+bool usb_bulk_send(const void *data, size_t len) {
+    if (!data || len == 0 || len > USB_BULK_BUF_SIZE) return false;
+#if CFG_USB_STREAM_ENABLE
+    if (!usb_bulk_connected()) {
+        s_usb.stats.drop_detached++;
+        return false;
+    }
+
+    if (s_usb.len[s_usb.fill] + len > USB_BULK_BUF_SIZE) {
+        // fill이 찼음: drain이 끝났으면 교대 후 빈 쪽에 적재
+        try_submit();
+        if (s_usb.len[s_usb.fill] + len > USB_BULK_BUF_SIZE) {
+            s_usb.stats.drop_busy++;
+            return false;
+        }
+    }
+
+    uint8_t *dst = s_usb.buf[s_usb.fill] + s_usb.len[s_usb.fill];
+    memcpy(dst, data, len);
+    s_usb.len[s_usb.fill] += (uint32_t)len;
+    s_usb.stats.frames++;
+    if (!drain_idle() && s_usb.len[s_usb.fill] > s_usb.stats.fill_max) {
+        s_usb.stats.fill_max = s_usb.len[s_usb.fill];
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+void usb_bulk_poll(void) {
+#if CFG_USB_STREAM_ENABLE
+    // SDK background task 없음: stdio(CDC 0) enumerate / 송수신도 여기서
+    if (tud_inited()) tud_task();
+    if (!s_usb.ready) return;
+
+    if (!tud_cdc_n_connected(USB_BULK_ITF)) {
+        // host가 포트를 닫음: 적재분 폐기 (다시 열면 최신 데이터부터)
+        s_usb.len[0] = s_usb.len[1] = 0;
+        s_usb.drain_off = 0;
+        return;
+    }
+
+    drain();
+    try_submit();   // drain이 방금 끝났으면 바로 다음 buffer 제출
+    drain();
+#endif
+}
+
+void usb_bulk_get_stats(usb_bulk_stats_t *out) {
+    if (out) *out = s_usb.stats;
+}
+
+void usb_bulk_transport(tlm_transport_t *out) {
+    if (!out) return;
+    out->name  = "usb";
+    out->send  = bulk_send;
+    out->ready = bulk_ready;
+    out->ctx   = NULL;
+}
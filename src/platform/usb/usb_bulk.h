@@ -0,0 +1,60 @@
+// FILE: src/platform/usb/usb_bulk.h
+#ifndef __USB_BULK_H__
+#define __USB_BULK_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "tlm_transport.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+// USB bulk binary stream (TinyUSB CDC 1, stdio와 별도 endpoint)
+//
+// - double buffer: main loop가 한쪽(fill)에 frame을 복사하는 동안 다른 쪽(drain)을 TinyUSB FIFO로 넘김
+//   drain이 끝나면 fill을 제출하고 역할 교대 -> USB 전송 중에도 다음 batch 적재가 막히지 않음
+// - 절대 block 하지 않음: 양쪽 모두 차 있거나 host가 포트를 열지 않았으면 frame drop (카운터)
+// - CMake option GY63_USB_STREAM=OFF 빌드에서는 init이 false를 리턴 (stdio 기본 descriptor 유지)
+// - ON 빌드는 app이 TinyUSB를 직접 link -> SDK stdio_usb는 tusb_init / background tud_task를 하지 않음.
+//   usb_bulk_device_init (stdio_init_all 직전) + usb_bulk_poll (항상)이 CDC 0 stdio까지 담당
+
+#define USB_BULK_BUF_SIZE   (2048u)   // buffer 1개 (frame 여러 개를 모아 한 번에 submit)
+
+typedef struct {
+    uint32_t frames;            // 적재된 frame
+    uint32_t bytes;             // TinyUSB로 넘긴 byte
+    uint32_t submits;           // buffer 교대 횟수
+    uint32_t drop_busy;         // 양쪽 buffer가 다 참
+    uint32_t drop_detached;     // host 미연결 (DTR low)
+    uint32_t fill_max;          // drain 대기 중 fill buffer 최대 사용량 (byte)
+} usb_bulk_stats_t;
+
+// TinyUSB device stack init (CDC 0 stdio + CDC 1 stream). stream 사용 여부와 무관하게 boot 직후 1회,
+// stdio_init_all 전에 (SDK stdio_usb가 TinyUSB init 완료를 전제). OFF 빌드에서는 no-op
+void usb_bulk_device_init(void);
+
+// stream 시작 (double buffer reset). OFF 빌드에서는 false
+bool usb_bulk_init(void);
+
+// host가 stream 포트를 열었는지 (DTR)
+bool usb_bulk_connected(void);
+
+// message 1개를 fill buffer에 복사 (non-blocking). 공간/연결 없으면 false
+bool usb_bulk_send(const void *data, size_t len);
+
+// TinyUSB task (stream 미사용이어도 stdio를 위해 항상) + drain 진행 (main loop / 대기 중 주기 호출)
+void usb_bulk_poll(void);
+
+void usb_bulk_get_stats(usb_bulk_stats_t *out);
+
+// tlm_transport_t 어댑터 (name "usb")
+void usb_bulk_transport(tlm_transport_t *out);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // __USB_BULK_H__
@@ -0,0 +1,107 @@
+// FILE: src/platform/usb/usb_descriptors.c
+// composite CDC x2 descriptor (GY63_USB_STREAM). OFF면 pico stdio_usb 기본 descriptor 사용
+#if CFG_USB_STREAM_ENABLE
+
+#include <string.h>
+
+#include "tusb.h"
+#include "pico/unique_id.h"
+
+#define USB_VID             0x2E8Au // Raspberry Pi
+#define USB_PID             0x000Au // pico SDK stdio_usb PID 재사용 (개발용, 배포 시 별도 PID 할당)
+#define USB_BCD             0x0200u
+
+enum {
+    ITF_NUM_CDC0 = 0,   // stdio
+    ITF_NUM_CDC0_DATA,
+    ITF_NUM_CDC1,       // binary stream
+    ITF_NUM_CDC1_DATA,
+    ITF_NUM_TOTAL
+};
+
+#define EPNUM_CDC0_NOTIF    0x81
+#define EPNUM_CDC0_OUT      0x02
+#define EPNUM_CDC0_IN       0x82
+#define EPNUM_CDC1_NOTIF    0x83
+#define EPNUM_CDC1_OUT      0x04
+#define EPNUM_CDC1_IN       0x84
+
+#define CONFIG_TOTAL_LEN    (TUD_CONFIG_DESC_LEN + CFG_TUD_CDC * TUD_CDC_DESC_LEN)
+
+enum {
+    STRID_LANGID = 0,
+    STRID_MANUFACTURER,
+    STRID_PRODUCT,
+    STRID_SERIAL,
+    STRID_CDC_STDIO,
+    STRID_CDC_STREAM,
+};
+
+static const tusb_desc_device_t s_desc_device = {
+    .bLength            = sizeof(tusb_desc_device_t),
+    .bDescriptorType    = TUSB_DESC_DEVICE,
+    .bcdUSB             = USB_BCD,
+    .bDeviceClass       = TUSB_CLASS_MISC,          // IAD
+    .bDeviceSubClass    = MISC_SUBCLASS_COMMON,
+    .bDeviceProtocol    = MISC_PROTOCOL_IAD,
+    .bMaxPacketSize0    = CFG_TUD_ENDPOINT0_SIZE,
+    .idVendor           = USB_VID,
+    .idProduct          = USB_PID,
+    .bcdDevice          = 0x0100,
+    .iManufacturer      = STRID_MANUFACTURER,
+    .iProduct           = STRID_PRODUCT,
+    .iSerialNumber      = STRID_SERIAL,
+    .bNumConfigurations = 1,
+};
+
+static const uint8_t s_desc_config[] = {
+    TUD_CONFIG_DESCRIPTOR(1, ITF_NUM_TOTAL, 0, CONFIG_TOTAL_LEN, 0x00, 100),
+    TUD_CDC_DESCRIPTOR(ITF_NUM_CDC0, STRID_CDC_STDIO, EPNUM_CDC0_NOTIF, 8, EPNUM_CDC0_OUT, EPNUM_CDC0_IN, 64),
+    TUD_CDC_DESCRIPTOR(ITF_NUM_CDC1, STRID_CDC_STREAM, EPNUM_CDC1_NOTIF, 8, EPNUM_CDC1_OUT, EPNUM_CDC1_IN, 64),
+};
+
+static const char *const s_strings[] = {
+    [STRID_MANUFACTURER] = "GY63",
+    [STRID_PRODUCT]      = "GY63 MS5611 telemetry",
+    [STRID_SERIAL]       = NULL, // board unique id
+    [STRID_CDC_STDIO]    = "GY63 stdio",
+    [STRID_CDC_STREAM]   = "GY63 sample stream",
+};
+
+const uint8_t *tud_descriptor_device_cb(void) {
+    return (const uint8_t *)&s_desc_device;
+}
+
+const uint8_t *tud_descriptor_configuration_cb(uint8_t index) {
+    (void)index;
+    return s_desc_config;
+}
+
+const uint16_t *tud_descriptor_string_cb(uint8_t index, uint16_t langid) {
+    (void)langid;
+    static uint16_t desc[1 + 32];
+    char serial[2 * PICO_UNIQUE_BOARD_ID_SIZE_BYTES + 1];
+    const char *str;
+    size_t n;
+
+    if (index == STRID_LANGID) {
+        desc[1] = 0x0409; // English
+        n = 1;
+    } else {
+        if (index >= sizeof(s_strings) / sizeof(s_strings[0])) return NULL;
+        if (index == STRID_SERIAL) {
+            pico_get_unique_board_id_string(serial, sizeof(serial));
+            str = serial;
+        } else {
+            str = s_strings[index];
+        }
+        n = strlen(str);
+        if (n > 32) n = 32;
+        for (size_t i = 0; i < n; i++) desc[1 + i] = (uint8_t)str[i];
+    }
+
+    desc[0] = (uint16_t)((TUSB_DESC_STRING << 8) | (2u * n + 2u));
+    return desc;
+}
+
+#endif // CFG_USB_STREAM_ENABLE